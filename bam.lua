@@ -10,6 +10,7 @@ function dl_type_lib( tlc_file, dltlc, dl_tests )
 	local out_lib       = out_file .. ".bin"
 	local out_lib_h     = out_file .. ".bin.h"
 	local out_lib_txt_h = out_file .. ".txt.h"
+	local out_serializers = out_file .. ".serializers.h"
 
 	local BIN2HEX  = _bam_exe .. " -e tool/bin2hex.lua"
 
@@ -21,9 +22,11 @@ function dl_type_lib( tlc_file, dltlc, dl_tests )
 	AddJob( out_lib_h,     "tlc " .. out_lib_h,  BIN2HEX .. " dst="   .. out_lib_h  .. " src=" .. out_lib,   out_lib )
 	AddJob( out_lib_txt_h, "tlc " .. out_lib_h,  BIN2HEX .. " dst="   .. out_lib_txt_h  .. " src=" .. tlc_file, tlc_file )
 	AddJob( out_header,    "tlc " .. out_header, dltlc   .. " -c -o " .. out_header .. " "     .. tlc_file,  tlc_file )
+	AddJob( out_serializers, "tlc " .. out_serializers, dltlc .. " -s -o " .. out_serializers .. " " .. tlc_file, tlc_file )
 
 	AddDependency( tlc_file, dltlc )
 	AddDependency( dl_tests, out_lib_h )
+	AddDependency( dl_tests, out_serializers )
 end
 
 function DefaultSettings( platform, config, compiler )
@@ -269,7 +272,12 @@ dl_shared = SharedLibrary( dl_settings,    "dlsh",  Compile( dl_so_settings, Col
 dl_settings.cc.includes:Add('tool/dlpack')
 getopt   = Compile( dl_settings, CollectRecursive( "tool/dlpack/*.c" ) )
 dl_pack  = Link( build_settings, "dlpack",   Compile( dl_settings, CollectRecursive("tool/dlpack/*.cpp") ), getopt, dl_lib )
-dltlc    = Link( build_settings, "dltlc",    Compile( dl_settings, CollectRecursive("tool/dltlc/*.cpp") ), getopt, dl_lib )
+dltlc_settings = TableDeepCopy( build_settings )
+if build_platform == "linux_x86_64" or build_platform == "linux_x86" then
+	dltlc_settings.link.libs:Add( "pthread" ) -- dltlc compile inputs in parallel.
+end
+
+dltlc    = Link( dltlc_settings, "dltlc",    Compile( dl_settings, CollectRecursive("tool/dltlc/*.cpp") ), getopt, dl_lib )
 dl_tests = Link( test_settings,  "dl_tests", Compile( test_settings, Collect("tests/*.cpp") ), dl_lib, gtest_lib )
 dlbench  = Link( test_settings,  "dlbench",  Compile( test_settings, Collect("benchmark/*.cpp") ), dl_lib )
 
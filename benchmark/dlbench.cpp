@@ -5,14 +5,33 @@
 #include <dl/dl.h>
 #include <dl/dl_txt.h>
 #include <dl/dl_typelib.h>
+#include <dl/dl_convert.h>
+#include <dl/dl_diff.h>
+#include <dl/dl_compress.h>
+#include <dl/dl_path.h>
 
 #include <vector>
+#include <string>
 
 #include "ubench.h"
 
 #define DL_ARRAY_LENGTH(arr) (uint32_t)(sizeof(arr)/sizeof(arr[0]))
 
+/**
+ * Check the result of a dl-call in a benchmark, a benchmark of a failing call would not measure anything useful.
+ */
+#define DLBENCH_CHECK( expr ) \
+	do { \
+		dl_error_t dlbench_err = ( expr ); \
+		if( dlbench_err != DL_ERROR_OK ) \
+		{ \
+			fprintf( stderr, "%s:%d: %s failed with %s\n", __FILE__, __LINE__, #expr, dl_error_to_string( dlbench_err ) ); \
+			abort(); \
+		} \
+	} while( false )
+
 #include "generated/dlbench.h"
+#include "generated/dlbench.serializers.h"
 
 const unsigned char TYPELIB_SRC[] = {
 	#include "generated/dlbench.bin.h"
@@ -205,6 +224,661 @@ UBENCH_EX_F(dlbench, txt_pack_big_array_str_null)
 	}
 }
 
+// testing perf unpacking an instance with a big array of long strings with the odd char that needs escaping
+UBENCH_EX_F(dlbench, txt_unpack_big_array_long_str)
+{
+	const char* long_str = "a long string of text without much escaping, \"quoted\" at one point and with a newline\n at the end";
+	std::vector<char*> data(10000);
+	str_array inst = { { (const char**)&data[0], (uint32_t)data.size() } };
+	for( size_t i = 0; i < data.size(); ++i ) inst.arr[i] = long_str;
+
+	dlbench& f = *ubench_fixture;
+	size_t pack_size = 0;
+	DLBENCH_CHECK( dl_instance_store( f.ctx, str_array::TYPE_ID, &inst, 0x0, 0, &pack_size ) );
+	std::vector<unsigned char> packed( pack_size );
+	DLBENCH_CHECK( dl_instance_store( f.ctx, str_array::TYPE_ID, &inst, &packed[0], pack_size, 0x0 ) );
+
+	size_t txt_size = 0;
+	DLBENCH_CHECK( dl_txt_unpack( f.ctx, str_array::TYPE_ID, &packed[0], pack_size, 0x0, 0, &txt_size ) );
+	std::vector<char> txt( txt_size );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_txt_unpack( f.ctx, str_array::TYPE_ID, &packed[0], pack_size, &txt[0], txt_size, 0x0 ) );
+	}
+}
+
+/**
+ * Helper class to store an instance of dlbench_store_instance::T with the interpreter or the generated serializers.
+ */
+template<typename T>
+struct dlbench_store_instance
+{
+	dlbench_store_instance(dl_ctx_t ctx, const T* inst)
+		: size(0)
+	{
+		DLBENCH_CHECK( dl_instance_calc_size( ctx, T::TYPE_ID, inst, &size ) );
+		buffer = (unsigned char*)malloc( size );
+	}
+
+	~dlbench_store_instance()
+	{
+		free(buffer);
+	}
+
+	size_t         size;
+	unsigned char* buffer;
+};
+
+static void dlbench_fill_array_array_fp32( std::vector<fp32_array>& data, fp32_array_array& inst )
+{
+	static float data2[] = { 1.0f, 2.0f, 3.0f };
+	for( size_t i = 0; i < data.size(); ++i )
+	{
+		data[i].arr.data  = data2;
+		data[i].arr.count = DL_ARRAY_LENGTH(data2);
+	}
+	inst.arr.data  = &data[0];
+	inst.arr.count = (uint32_t)data.size();
+}
+
+// testing perf storing an instance with a big array of small arrays of floats with the interpreter
+UBENCH_EX_F(dlbench, store_big_array_array_fp32)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	dlbench_store_instance<fp32_array_array> b( f.ctx, &inst );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_store( f.ctx, fp32_array_array::TYPE_ID, &inst, b.buffer, b.size, 0x0 ) );
+	}
+}
+
+// testing perf storing an instance with a big array of small arrays of floats with generated serializers
+UBENCH_EX_F(dlbench, store_big_array_array_fp32_generated)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	dlbench_store_instance<fp32_array_array> b( f.ctx, &inst );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_serializer_store( inst, b.buffer, b.size, 0x0 ) );
+	}
+}
+
+// testing perf storing an instance with a big array of strings with the interpreter
+UBENCH_EX_F(dlbench, store_big_array_str)
+{
+	std::vector<char*> data(10000);
+	str_array inst = { { (const char**)&data[0], (uint32_t)data.size() } };
+	for( size_t i = 0; i < data.size(); ++i ) inst.arr[i] = "apa";
+
+	dlbench& f = *ubench_fixture;
+	dlbench_store_instance<str_array> b( f.ctx, &inst );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_store( f.ctx, str_array::TYPE_ID, &inst, b.buffer, b.size, 0x0 ) );
+	}
+}
+
+// testing perf storing an instance with a big array of strings with generated serializers
+UBENCH_EX_F(dlbench, store_big_array_str_generated)
+{
+	std::vector<char*> data(10000);
+	str_array inst = { { (const char**)&data[0], (uint32_t)data.size() } };
+	for( size_t i = 0; i < data.size(); ++i ) inst.arr[i] = "apa";
+
+	dlbench& f = *ubench_fixture;
+	dlbench_store_instance<str_array> b( f.ctx, &inst );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_serializer_store( inst, b.buffer, b.size, 0x0 ) );
+	}
+}
+
+// testing perf calculating the packed size of an instance with a big array of small arrays of floats with the interpreter
+UBENCH_EX_F(dlbench, calc_size_big_array_array_fp32)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	size_t size = 0;
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_calc_size( f.ctx, fp32_array_array::TYPE_ID, &inst, &size ) );
+	}
+}
+
+// testing perf calculating the packed size of an instance with a big array of unique strings with the interpreter
+UBENCH_EX_F(dlbench, calc_size_big_array_str)
+{
+	std::vector<char> chars( 10000 * 8 );
+	std::vector<char*> data( 10000 );
+	str_array inst = { { (const char**)&data[0], (uint32_t)data.size() } };
+	for( size_t i = 0; i < data.size(); ++i )
+	{
+		data[i] = &chars[i * 8];
+		snprintf( data[i], 8, "apa%u", (unsigned int)i );
+	}
+
+	dlbench& f = *ubench_fixture;
+	size_t size = 0;
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_calc_size( f.ctx, str_array::TYPE_ID, &inst, &size ) );
+	}
+}
+
+// testing perf calculating an upper bound of the packed size of an instance with a big array of unique strings with the interpreter
+UBENCH_EX_F(dlbench, calc_size_upper_bound_big_array_str)
+{
+	std::vector<char> chars( 10000 * 8 );
+	std::vector<char*> data( 10000 );
+	str_array inst = { { (const char**)&data[0], (uint32_t)data.size() } };
+	for( size_t i = 0; i < data.size(); ++i )
+	{
+		data[i] = &chars[i * 8];
+		snprintf( data[i], 8, "apa%u", (unsigned int)i );
+	}
+
+	dlbench& f = *ubench_fixture;
+	size_t size = 0;
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_calc_size_ex( f.ctx, str_array::TYPE_ID, &inst, DL_CALC_SIZE_FLAGS_UPPER_BOUND, &size ) );
+	}
+}
+
+// testing perf calculating the packed size of an instance with a big array of small arrays of floats with generated serializers
+UBENCH_EX_F(dlbench, calc_size_big_array_array_fp32_generated)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	size_t size = 0;
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_serializer_calc_size( inst, &size ) );
+	}
+}
+
+// testing perf endian-swapping a packed instance with a big array of small arrays of floats with the interpreter
+UBENCH_EX_F(dlbench, swap_endian_big_array_array_fp32)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	dlbench_store_instance<fp32_array_array> b( f.ctx, &inst );
+	DLBENCH_CHECK( dl_instance_store( f.ctx, fp32_array_array::TYPE_ID, &inst, b.buffer, b.size, 0x0 ) );
+	std::vector<unsigned char> out( b.size );
+
+	dl_endian_t other_endian = DL_ENDIAN_HOST == DL_ENDIAN_LITTLE ? DL_ENDIAN_BIG : DL_ENDIAN_LITTLE;
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_convert( f.ctx, fp32_array_array::TYPE_ID, b.buffer, b.size, &out[0], out.size(), other_endian, sizeof(void*), 0x0 ) );
+	}
+}
+
+// testing perf endian-swapping a packed instance with a big array of small arrays of floats with generated serializers
+UBENCH_EX_F(dlbench, swap_endian_big_array_array_fp32_generated)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	dlbench_store_instance<fp32_array_array> b( f.ctx, &inst );
+	DLBENCH_CHECK( dl_serializer_store( inst, b.buffer, b.size, 0x0 ) );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_serializer_swap_endian<fp32_array_array>( b.buffer, b.size ) );
+	}
+}
+
+// testing perf validating a packed instance with a big array of floats
+UBENCH_EX_F(dlbench, validate_big_array_fp32)
+{
+	std::vector<float> data( 1024 * 1024 );
+	fp32_array inst = { { &data[0], (uint32_t)data.size() } };
+	for( size_t i = 0; i < data.size(); ++i ) inst.arr[i] = (float)i;
+
+	dlbench& f = *ubench_fixture;
+	dlbench_store_instance<fp32_array> b( f.ctx, &inst );
+	DLBENCH_CHECK( dl_instance_store( f.ctx, fp32_array::TYPE_ID, &inst, b.buffer, b.size, 0x0 ) );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_validate( f.ctx, fp32_array::TYPE_ID, b.buffer, b.size ) );
+	}
+}
+
+// testing perf validating a packed instance with a big array of small arrays of floats
+UBENCH_EX_F(dlbench, validate_big_array_array_fp32)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	dlbench_store_instance<fp32_array_array> b( f.ctx, &inst );
+	DLBENCH_CHECK( dl_instance_store( f.ctx, fp32_array_array::TYPE_ID, &inst, b.buffer, b.size, 0x0 ) );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_validate( f.ctx, fp32_array_array::TYPE_ID, b.buffer, b.size ) );
+	}
+}
+
+// testing perf loading a packed instance with a big array of small arrays of floats
+UBENCH_EX_F(dlbench, load_big_array_array_fp32)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	dlbench_store_instance<fp32_array_array> b( f.ctx, &inst );
+	DLBENCH_CHECK( dl_instance_store( f.ctx, fp32_array_array::TYPE_ID, &inst, b.buffer, b.size, 0x0 ) );
+	std::vector<uint64_t> loaded( b.size / sizeof(uint64_t) + 1 );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_load( f.ctx, fp32_array_array::TYPE_ID, &loaded[0], loaded.size() * sizeof(uint64_t), b.buffer, b.size, 0x0 ) );
+	}
+}
+
+// testing perf loading a packed instance with a big array of small arrays of floats, validating it while patching
+UBENCH_EX_F(dlbench, load_validate_big_array_array_fp32)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	dlbench_store_instance<fp32_array_array> b( f.ctx, &inst );
+	DLBENCH_CHECK( dl_instance_store( f.ctx, fp32_array_array::TYPE_ID, &inst, b.buffer, b.size, 0x0 ) );
+	std::vector<uint64_t> loaded( b.size / sizeof(uint64_t) + 1 );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_load_ex( f.ctx, fp32_array_array::TYPE_ID, &loaded[0], loaded.size() * sizeof(uint64_t), b.buffer, b.size, DL_LOAD_FLAGS_VALIDATE, 0x0 ) );
+	}
+}
+
+// testing perf loading one element from a packed instance with a big array of small arrays of floats
+UBENCH_EX_F(dlbench, load_path_big_array_array_fp32)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	dlbench_store_instance<fp32_array_array> b( f.ctx, &inst );
+	DLBENCH_CHECK( dl_instance_store( f.ctx, fp32_array_array::TYPE_ID, &inst, b.buffer, b.size, 0x0 ) );
+	uint64_t loaded[16];
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_load_path( f.ctx, fp32_array_array::TYPE_ID, "arr[5000]", loaded, sizeof(loaded), b.buffer, b.size, 0x0 ) );
+	}
+}
+
+// testing perf reading a member of a loaded instance through a compiled member-path
+UBENCH_EX_F(dlbench, path_get_array_array_fp32)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	dl_path_t path;
+	DLBENCH_CHECK( dl_path_compile( f.ctx, fp32_array_array::TYPE_ID, "arr[5000].arr[1]", &path ) );
+	double value = 0.0;
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_path_get_fp64( path, &inst, &value ) );
+		UBENCH_DO_NOTHING( &value );
+	}
+
+	DLBENCH_CHECK( dl_path_destroy( path ) );
+}
+
+// testing perf copying a loaded instance with a big array of small arrays of floats
+UBENCH_EX_F(dlbench, clone_big_array_array_fp32)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	size_t size = 0;
+	DLBENCH_CHECK( dl_instance_clone( f.ctx, fp32_array_array::TYPE_ID, &inst, 0x0, 0, &size ) );
+	std::vector<uint64_t> out( size / sizeof( uint64_t ) + 1 );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_clone( f.ctx, fp32_array_array::TYPE_ID, &inst, &out[0], size, 0x0 ) );
+		UBENCH_DO_NOTHING( &out[0] );
+	}
+}
+
+// testing perf comparing two equal instances with a big array of small arrays of floats
+UBENCH_EX_F(dlbench, compare_big_array_array_fp32)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	size_t size = 0;
+	DLBENCH_CHECK( dl_instance_clone( f.ctx, fp32_array_array::TYPE_ID, &inst, 0x0, 0, &size ) );
+	std::vector<uint64_t> copy( size / sizeof( uint64_t ) + 1 );
+	DLBENCH_CHECK( dl_instance_clone( f.ctx, fp32_array_array::TYPE_ID, &inst, &copy[0], size, 0x0 ) );
+	int result = 0;
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_compare( f.ctx, fp32_array_array::TYPE_ID, &inst, &copy[0], &result, 0x0, 0 ) );
+		UBENCH_DO_NOTHING( &result );
+	}
+}
+
+// testing perf hashing a loaded instance with a big array of small arrays of floats
+UBENCH_EX_F(dlbench, hash_big_array_array_fp32)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	uint64_t hash = 0;
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_hash( f.ctx, fp32_array_array::TYPE_ID, &inst, &hash ) );
+		UBENCH_DO_NOTHING( &hash );
+	}
+}
+
+// testing perf hashing a packed instance with a big array of small arrays of floats
+UBENCH_EX_F(dlbench, hash_packed_big_array_array_fp32)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	dlbench_store_instance<fp32_array_array> b( f.ctx, &inst );
+	DLBENCH_CHECK( dl_instance_store( f.ctx, fp32_array_array::TYPE_ID, &inst, b.buffer, b.size, 0x0 ) );
+	uint64_t hash = 0;
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_hash_packed( f.ctx, fp32_array_array::TYPE_ID, b.buffer, b.size, &hash ) );
+		UBENCH_DO_NOTHING( &hash );
+	}
+}
+
+/**
+ * Helper class to build an old and a new instance with a big array of small arrays of floats where only one element differ
+ * and the patch between them.
+ */
+struct dlbench_diff_array_array_fp32
+{
+	explicit dlbench_diff_array_array_fp32( dl_ctx_t ctx )
+		: old_data( 10000 )
+		, new_data( 10000 )
+	{
+		static float changed[] = { 1.0f, 2.0f, 4.0f };
+		dlbench_fill_array_array_fp32( old_data, old_inst );
+		dlbench_fill_array_array_fp32( new_data, new_inst );
+		new_data[5000].arr.data = changed;
+
+		size_t patch_size = 0;
+		DLBENCH_CHECK( dl_instance_diff( ctx, fp32_array_array::TYPE_ID, &old_inst, &new_inst, 0x0, 0, &patch_size ) );
+		patch.resize( patch_size );
+		DLBENCH_CHECK( dl_instance_diff( ctx, fp32_array_array::TYPE_ID, &old_inst, &new_inst, &patch[0], patch.size(), 0x0 ) );
+
+		DLBENCH_CHECK( dl_instance_calc_size( ctx, fp32_array_array::TYPE_ID, &new_inst, &packed_size ) );
+	}
+
+	std::vector<fp32_array>    old_data;
+	std::vector<fp32_array>    new_data;
+	fp32_array_array           old_inst;
+	fp32_array_array           new_inst;
+	std::vector<unsigned char> patch;
+	size_t                     packed_size;
+};
+
+// testing perf diffing two instances with a big array of small arrays of floats where one element differ
+UBENCH_EX_F(dlbench, diff_big_array_array_fp32_one_changed)
+{
+	dlbench& f = *ubench_fixture;
+	dlbench_diff_array_array_fp32 d( f.ctx );
+	std::vector<unsigned char> patch( d.patch.size() );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_diff( f.ctx, fp32_array_array::TYPE_ID, &d.old_inst, &d.new_inst, &patch[0], patch.size(), 0x0 ) );
+	}
+}
+
+// testing perf applying a patch to an instance with a big array of small arrays of floats where one element differ
+UBENCH_EX_F(dlbench, apply_diff_big_array_array_fp32_one_changed)
+{
+	dlbench& f = *ubench_fixture;
+	dlbench_diff_array_array_fp32 d( f.ctx );
+	std::vector<unsigned char> out( d.packed_size );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_apply_diff( f.ctx, fp32_array_array::TYPE_ID, &d.old_inst, &d.patch[0], d.patch.size(), &out[0], out.size(), 0x0 ) );
+	}
+}
+
+// testing perf diffing two instances with a big array of strings where one string differ
+UBENCH_EX_F(dlbench, diff_big_array_str_one_changed)
+{
+	std::vector<char*> old_data(10000);
+	std::vector<char*> new_data(10000);
+	str_array old_inst = { { (const char**)&old_data[0], (uint32_t)old_data.size() } };
+	str_array new_inst = { { (const char**)&new_data[0], (uint32_t)new_data.size() } };
+	for( size_t i = 0; i < old_data.size(); ++i )
+	{
+		old_inst.arr[i] = "apa";
+		new_inst.arr[i] = "apa";
+	}
+	new_inst.arr[5000] = "bepa";
+
+	dlbench& f = *ubench_fixture;
+	size_t patch_size = 0;
+	DLBENCH_CHECK( dl_instance_diff( f.ctx, str_array::TYPE_ID, &old_inst, &new_inst, 0x0, 0, &patch_size ) );
+	std::vector<unsigned char> patch( patch_size );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_diff( f.ctx, str_array::TYPE_ID, &old_inst, &new_inst, &patch[0], patch.size(), 0x0 ) );
+	}
+}
+
+// testing perf compressing a packed instance with a big array of small arrays of floats
+UBENCH_EX_F(dlbench, compress_big_array_array_fp32)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	dlbench_store_instance<fp32_array_array> b( f.ctx, &inst );
+	DLBENCH_CHECK( dl_instance_store( f.ctx, fp32_array_array::TYPE_ID, &inst, b.buffer, b.size, 0x0 ) );
+
+	size_t compressed_size = 0;
+	DLBENCH_CHECK( dl_instance_compress( f.ctx, b.buffer, b.size, 0, 0x0, 0, &compressed_size ) );
+	std::vector<unsigned char> compressed( compressed_size );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_compress( f.ctx, b.buffer, b.size, 0, &compressed[0], compressed.size(), 0x0 ) );
+	}
+}
+
+// testing perf decompressing a packed instance with a big array of small arrays of floats
+UBENCH_EX_F(dlbench, decompress_big_array_array_fp32)
+{
+	std::vector<fp32_array> data( 10000 );
+	fp32_array_array inst;
+	dlbench_fill_array_array_fp32( data, inst );
+
+	dlbench& f = *ubench_fixture;
+	dlbench_store_instance<fp32_array_array> b( f.ctx, &inst );
+	DLBENCH_CHECK( dl_instance_store( f.ctx, fp32_array_array::TYPE_ID, &inst, b.buffer, b.size, 0x0 ) );
+
+	size_t compressed_size = 0;
+	DLBENCH_CHECK( dl_instance_compress( f.ctx, b.buffer, b.size, 0, 0x0, 0, &compressed_size ) );
+	std::vector<unsigned char> compressed( compressed_size );
+	DLBENCH_CHECK( dl_instance_compress( f.ctx, b.buffer, b.size, 0, &compressed[0], compressed.size(), 0x0 ) );
+	std::vector<unsigned char> out( b.size );
+
+	UBENCH_DO_BENCHMARK()
+	{
+		DLBENCH_CHECK( dl_instance_decompress( &compressed[0], compressed.size(), &out[0], out.size(), 0x0 ) );
+	}
+}
+
+/**
+ * Helper class to build a set of small binary typelibs, as when many modules each have their own tld.
+ */
+struct dlbench_small_typelibs
+{
+	explicit dlbench_small_typelibs( unsigned int count )
+	{
+		dl_create_params_t p;
+		DL_CREATE_PARAMS_SET_DEFAULT(p);
+
+		for( unsigned int i = 0; i < count; ++i )
+		{
+			char txt[1024];
+			int txt_len = snprintf( txt, sizeof(txt),
+				"{ \"module\" : \"tl%u\","
+				"  \"enums\" : { \"e%u\" : { \"values\" : { \"e%u_a\" : 1, \"e%u_b\" : 2, \"e%u_c\" : 3 } } },"
+				"  \"types\" : {"
+				"    \"t%u_a\" : { \"members\" : [ { \"name\" : \"m1\", \"type\" : \"uint32\", \"default\" : 1 }, { \"name\" : \"m2\", \"type\" : \"e%u\" }, { \"name\" : \"m3\", \"type\" : \"string\", \"default\" : \"apa\" } ] },"
+				"    \"t%u_b\" : { \"members\" : [ { \"name\" : \"m1\", \"type\" : \"t%u_a\" }, { \"name\" : \"m2\", \"type\" : \"fp32[]\" }, { \"name\" : \"m3\", \"type\" : \"t%u_a*\" } ] },"
+				"    \"t%u_c\" : { \"members\" : [ { \"name\" : \"m1\", \"type\" : \"int64\" }, { \"name\" : \"m2\", \"type\" : \"t%u_b[4]\" } ] }"
+				"  }"
+				"}", i, i, i, i, i, i, i, i, i, i, i, i );
+
+			dl_ctx_t ctx;
+			DLBENCH_CHECK( dl_context_create( &ctx, &p ) );
+			DLBENCH_CHECK( dl_context_load_txt_type_library( ctx, txt, (size_t)txt_len ) );
+
+			size_t size = 0;
+			DLBENCH_CHECK( dl_context_write_type_library( ctx, 0x0, 0, &size ) );
+			libs.push_back( std::vector<unsigned char>( size ) );
+			DLBENCH_CHECK( dl_context_write_type_library( ctx, &libs.back()[0], size, 0x0 ) );
+			DLBENCH_CHECK( dl_context_destroy( ctx ) );
+		}
+
+		for( size_t i = 0; i < libs.size(); ++i )
+		{
+			datas.push_back( &libs[i][0] );
+			sizes.push_back( libs[i].size() );
+		}
+	}
+
+	std::vector< std::vector<unsigned char> > libs;
+	std::vector<const unsigned char*> datas;
+	std::vector<size_t>               sizes;
+};
+
+// testing perf creating a context and loading 40 small typelibs one at a time
+UBENCH_EX(dlbench, startup_load_40_typelibs)
+{
+	dlbench_small_typelibs tl( 40 );
+
+	dl_create_params_t p;
+	DL_CREATE_PARAMS_SET_DEFAULT(p);
+
+	UBENCH_DO_BENCHMARK()
+	{
+		dl_ctx_t ctx;
+		DLBENCH_CHECK( dl_context_create( &ctx, &p ) );
+		for( size_t i = 0; i < tl.datas.size(); ++i )
+			DLBENCH_CHECK( dl_context_load_type_library( ctx, tl.datas[i], tl.sizes[i] ) );
+		DLBENCH_CHECK( dl_context_destroy( ctx ) );
+	}
+}
+
+// testing perf creating a context and loading 40 small typelibs with one call
+UBENCH_EX(dlbench, startup_load_40_typelibs_batched)
+{
+	dlbench_small_typelibs tl( 40 );
+
+	dl_create_params_t p;
+	DL_CREATE_PARAMS_SET_DEFAULT(p);
+
+	UBENCH_DO_BENCHMARK()
+	{
+		dl_ctx_t ctx;
+		DLBENCH_CHECK( dl_context_create( &ctx, &p ) );
+		DLBENCH_CHECK( dl_context_load_type_libraries( ctx, &tl.datas[0], &tl.sizes[0], (unsigned int)tl.datas.size() ) );
+		DLBENCH_CHECK( dl_context_destroy( ctx ) );
+	}
+}
+
+// testing perf compiling one big txt-typelib where types reference each other and most members have defaults
+UBENCH_EX(dlbench, txt_typelib_compile_2000_types)
+{
+	std::string txt = "{ \"module\" : \"big\", \"enums\" : { \"e\" : { \"values\" : { \"e_a\" : 1, \"e_b\" : 2 } } }, \"types\" : {";
+	for( unsigned int i = 0; i < 2000; ++i )
+	{
+		// ... each type stores one of the types before it inline ...
+		char sub[64] = "";
+		if( i > 0 )
+			snprintf( sub, sizeof(sub), ", { \"name\" : \"m4\", \"type\" : \"t%u\" }", i / 2 );
+
+		char type[512];
+		snprintf( type, sizeof(type),
+			"%s \"t%u\" : { \"members\" : [ { \"name\" : \"m1\", \"type\" : \"uint32\", \"default\" : %u },"
+			" { \"name\" : \"m2\", \"type\" : \"fp32\", \"default\" : 1.5 }, { \"name\" : \"m3\", \"type\" : \"e\", \"default\" : \"e_b\" }%s ] }",
+			i == 0 ? "" : ",", i, i, sub );
+		txt += type;
+	}
+	txt += "} }";
+
+	dl_create_params_t p;
+	DL_CREATE_PARAMS_SET_DEFAULT(p);
+
+	UBENCH_DO_BENCHMARK()
+	{
+		dl_ctx_t ctx;
+		DLBENCH_CHECK( dl_context_create( &ctx, &p ) );
+		DLBENCH_CHECK( dl_context_load_txt_type_library( ctx, txt.c_str(), txt.size() ) );
+		DLBENCH_CHECK( dl_context_destroy( ctx ) );
+	}
+}
+
 UBENCH_MAIN();
 
 #ifdef _MSC_VER
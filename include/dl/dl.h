@@ -44,7 +44,7 @@ static const int DL_INLINE_ARRAY_LENGTH_MAX = 0xFFFF;
 	DL_ERROR_DYNAMIC_SIZE_TYPES_AND_NO_INSTANCE_ALLOCATOR  - DL would need to do a dynamic allocation but has no allocator.
 	DL_ERROR_TYPE_MISMATCH                                 - Expected type A but found type B.
 	DL_ERROR_TYPE_NOT_FOUND                                - Could not find a requested type. Is the correct type library loaded?
-	DL_ERROR_MEMBER_NOT_FOUND                              - Could not find a requested member of a type.
+	DL_ERROR_MEMBER_NOT_FOUND                              - Could not find a requested member of a type, or an element or pointed to struct in a member-path.
 	DL_ERROR_BUFFER_TOO_SMALL                              - Provided buffer is to small.
 	DL_ERROR_ENDIAN_MISMATCH                               - Endianness of provided data is not the same as the platform's.
 	DL_ERROR_BAD_ALIGNMENT                                 - One argument has a bad alignment that will break, for example, loaded data.
@@ -57,6 +57,8 @@ static const int DL_INLINE_ARRAY_LENGTH_MAX = 0xFFFF;
 	DL_ERROR_UTIL_FILE_NOT_FOUND                           - An argument-file is not found.
 	DL_ERROR_UTIL_FILE_TYPE_MISMATCH                       - File type specified to read do not match file content.
 
+	DL_ERROR_ARCHIVE_ENTRY_NOT_FOUND                       - No instance with the requested name and type in archive.
+
 	DL_ERROR_INTERNAL_ERROR                                - Internal error, contact dev!
 */
 typedef enum DL_NODISCARD
@@ -91,6 +93,10 @@ typedef enum DL_NODISCARD
 	DL_ERROR_UTIL_FILE_NOT_FOUND,
 	DL_ERROR_UTIL_FILE_TYPE_MISMATCH,
 
+	DL_ERROR_ARCHIVE_ENTRY_NOT_FOUND,
+
+	DL_ERROR_MEMBER_NOT_FOUND,
+
 	DL_ERROR_INTERNAL_ERROR
 } dl_error_t;
 
@@ -202,6 +208,31 @@ typedef void  (*dl_free_func) ( void* ptr, void* alloc_ctx );
 */
 typedef void  (*dl_error_msg_handler)( const char* msg, void* msg_ctx );
 
+/*
+	Function: dl_job_func
+		Job passed by DL to dl_parallel_for_func.
+
+	Parameters:
+		job_data  - same ptr that was passed to dl_parallel_for_func as job_data.
+		job_index - index of the job to run, in the range [0, job_count).
+*/
+typedef void  (*dl_job_func)( void* job_data, unsigned int job_index );
+
+/*
+	Function: dl_parallel_for_func
+		Callback used by DL to run independent jobs in parallel, for example parsing parts of a big array
+		in dl_txt_pack.
+		The callback is expected to call job( job_data, i ) once for every i in [0, job_count), in any order
+		and on any thread, and not return before all calls to job has returned.
+
+	Parameters:
+		job          - job to run.
+		job_data     - data to pass to job.
+		job_count    - number of jobs to run.
+		parallel_ctx - same ptr that was passed to dl_context_create via dl_create_params.parallel_ctx.
+*/
+typedef void  (*dl_parallel_for_func)( dl_job_func job, void* job_data, unsigned int job_count, void* parallel_ctx );
+
 /*
 	Struct: dl_create_params_t
 		Passed with initialization parameters to dl_context_create.
@@ -217,11 +248,17 @@ typedef void  (*dl_error_msg_handler)( const char* msg, void* msg_ctx );
 		                 to the user, set to 0x0 to ignore error-strings.
 		error_msg_ctx  - data passed to error_msg_func as user-data.
 
+		parallel_for_func - callback used to run jobs in parallel, set to 0x0 to run all work on the
+		                    calling thread.
+		parallel_ctx      - data passed to parallel_for_func as user-data.
+
 	Note:
 		As a user you might replace the internal memory allocation function by using alloc_func, realloc_func
 		and free_func.
 		If you set alloc_func you are required to set free_func as well and can optionally set realloc_func.
 		If no realloc_func is set but alloc_func and free_func is set DL will fallback on alloc_func + memcpy.
+		If parallel_for_func is set, alloc_func, realloc_func and free_func might be called from the threads
+		running the jobs and need to be thread-safe.
 */
 typedef struct dl_create_params
 {
@@ -232,6 +269,9 @@ typedef struct dl_create_params
 
 	dl_error_msg_handler error_msg_func;
 	void*                error_msg_ctx;
+
+	dl_parallel_for_func parallel_for_func;
+	void*                parallel_ctx;
 } dl_create_params_t;
 
 /*
@@ -253,7 +293,9 @@ typedef struct dl_create_params
 		params.free_func    = 0x0; \
 		params.alloc_ctx    = 0x0; \
 		params.error_msg_func = 0x0; \
-		params.error_msg_ctx  = 0x0;
+		params.error_msg_ctx  = 0x0; \
+		params.parallel_for_func = 0x0; \
+		params.parallel_ctx      = 0x0;
 
 /*
 	Group: Context
@@ -276,6 +318,41 @@ dl_error_t DL_DLL_EXPORT dl_context_create( dl_ctx_t* dl_ctx, dl_create_params_t
 */
 dl_error_t DL_DLL_EXPORT dl_context_destroy( dl_ctx_t dl_ctx );
 
+/*
+	Function: dl_context_freeze
+		Mark a context as immutable, after this no more type-libraries can be loaded into it and all loading
+		functions will return DL_ERROR_UNSUPPORTED_OPERATION.
+
+		Nothing in a frozen context is ever written to, so it can be used from any number of threads at the same
+		time without locks. The only state the context shares between calls is its allocator and callbacks, to
+		give each thread its own allocator, error-callback and scratch-memory create one workspace per thread with
+		dl_context_create_workspace.
+
+	Parameters:
+		dl_ctx - Context to freeze.
+*/
+dl_error_t DL_DLL_EXPORT dl_context_freeze( dl_ctx_t dl_ctx );
+
+/*
+	Function: dl_context_create_workspace
+		Create a workspace for a frozen context. A workspace can be passed as the context to any function in dl
+		and uses all type-data of the frozen context without copying it, but all memory for scratch-buffers and
+		other temporary data is allocated from the allocator of the workspace and errors are reported to the
+		error-callback of the workspace.
+
+		A workspace is not thread-safe by itself, use one per thread. The workspace is destroyed with
+		dl_context_destroy and needs to be destroyed before the frozen context it was created from.
+
+	Parameters:
+		dl_ctx        - Frozen context to create workspace for.
+		create_params - Allocator and callbacks to use in the workspace, 0x0 to use the same as dl_ctx.
+		out_workspace - Ptr to workspace to create.
+
+	Returns:
+		DL_ERROR_OK on success, DL_ERROR_UNSUPPORTED_OPERATION if dl_ctx is not frozen.
+*/
+dl_error_t DL_DLL_EXPORT dl_context_create_workspace( dl_ctx_t dl_ctx, dl_create_params_t* create_params, dl_ctx_t* out_workspace );
+
 /*
 	Function: dl_context_load_type_library
 		Load a type-library from bin-data into the context for use.
@@ -288,6 +365,47 @@ dl_error_t DL_DLL_EXPORT dl_context_destroy( dl_ctx_t dl_ctx );
 */
 dl_error_t DL_DLL_EXPORT dl_context_load_type_library( dl_ctx_t dl_ctx, const unsigned char* lib_data, size_t lib_data_size );
 
+/*
+	Function: dl_context_load_type_libraries
+		Load multiple type-libraries from bin-data into the context in one go. The result is the same as calling
+		dl_context_load_type_library for each library in order, but the context is only grown once to fit all of
+		them and per-context lookup-structures are only built once at the end.
+
+		All libraries are validated before anything is loaded, if one of them is not a valid type-library nothing
+		is loaded and the error is returned.
+
+	Parameters:
+		dl_ctx         - Context to load type-libraries into.
+		lib_datas      - Array of lib_count pointers to binary-data with type-libraries.
+		lib_data_sizes - Array of lib_count sizes, one for each of lib_datas.
+		lib_count      - Number of type-libraries to load.
+*/
+dl_error_t DL_DLL_EXPORT dl_context_load_type_libraries( dl_ctx_t dl_ctx, const unsigned char* const* lib_datas, const size_t* lib_data_sizes, unsigned int lib_count );
+
+/*
+	Function: dl_context_load_type_library_inplace
+		Load a type-library from bin-data into the context without copying the type-descriptors, the context will
+		reference lib_data directly and only allocate small lookup-structures of its own. This makes loading cost
+		independent of the size of the type-library and, if lib_data is a memory-mapped file, lets the descriptor
+		pages be shared between processes.
+
+		lib_data is never written to and must be kept alive and unchanged until the context is destroyed.
+
+		The type-library is only referenced inplace if it is the first one loaded into the context, to load
+		many type-libraries inplace merge them into one with dltlc first. If the context already has types
+		loaded, or the platform is big endian, the type-library is copied just as with dl_context_load_type_library.
+		The same goes for any type-library, binary or txt, that is loaded after this one.
+
+	Parameters:
+		dl_ctx        - Context to load type-library into.
+		lib_data      - Pointer to binary-data with type-library, needs to be 8-byte aligned.
+		lib_data_size - Size of lib_data.
+
+	Returns:
+		DL_ERROR_OK on success, DL_ERROR_BAD_ALIGNMENT if lib_data is not aligned well enough to be used as is.
+*/
+dl_error_t DL_DLL_EXPORT dl_context_load_type_library_inplace( dl_ctx_t dl_ctx, const unsigned char* lib_data, size_t lib_data_size );
+
 
 /*
 	Group: Load
@@ -335,6 +453,99 @@ dl_error_t DL_DLL_EXPORT dl_instance_load_inplace( dl_ctx_t       dl_ctx,
 												   unsigned char* packed_instance, size_t      packed_instance_size,
 												   void**         loaded_instance, size_t*     consumed );
 
+/*
+	Enum: dl_load_flags_t
+		Flags to dl_instance_load_ex and dl_instance_load_inplace_ex.
+
+	Values:
+		DL_LOAD_FLAGS_NONE     - Load as dl_instance_load and dl_instance_load_inplace.
+		DL_LOAD_FLAGS_VALIDATE - Validate the instance as dl_instance_validate in the same pass as its pointers are patched,
+		                         use when loading data that can not be trusted. DL_ERROR_MALFORMED_DATA is returned if the
+		                         instance is not valid and the content of the loaded instance is then undefined.
+*/
+typedef enum
+{
+	DL_LOAD_FLAGS_NONE     = 0,
+	DL_LOAD_FLAGS_VALIDATE = 1 << 0
+} dl_load_flags_t;
+
+/*
+	Function: dl_instance_load_ex
+		Same as dl_instance_load but with flags controlling how the instance is loaded.
+
+	Parameters:
+		flags - combination of dl_load_flags_t.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_load_ex( dl_ctx_t             dl_ctx,          dl_typeid_t  type,
+                                              void*                instance,        size_t       instance_size,
+                                              const unsigned char* packed_instance, size_t       packed_instance_size,
+                                              unsigned int         flags,           size_t*      consumed );
+
+/*
+	Function: dl_instance_load_inplace_ex
+		Same as dl_instance_load_inplace but with flags controlling how the instance is loaded.
+
+	Parameters:
+		flags - combination of dl_load_flags_t.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_load_inplace_ex( dl_ctx_t       dl_ctx,          dl_typeid_t  type,
+                                                      unsigned char* packed_instance, size_t       packed_instance_size,
+                                                      unsigned int   flags,
+                                                      void**         loaded_instance, size_t*      consumed );
+
+/*
+	Function: dl_instance_validate
+		Check that a packed instance is safe to load, in one pass over the instance driven by the types in it. Every
+		pointer, array and string need to be inside the instance and aligned, no two structs, arrays or strings may
+		overlap, strings need to be terminated, unions need a valid type and enums a valid value. The chain of pointers
+		to patch that dl_instance_load use need to contain exactly the pointers in the instance.
+
+	Parameters:
+		dl_ctx               - DL-context with the types of the instance loaded.
+		type                 - Type of instance in the packed data.
+		packed_instance      - Packed instance to validate, not modified.
+		packed_instance_size - Size of packed_instance.
+
+	Return:
+		DL_ERROR_OK if the instance can be loaded, DL_ERROR_MALFORMED_DATA if it is not valid.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_validate( dl_ctx_t dl_ctx, dl_typeid_t type, const unsigned char* packed_instance, size_t packed_instance_size );
+
+/*
+	Function: dl_instance_load_path
+		Load only the value of one member, and the data it reference, from a packed instance without loading the
+		rest of the instance. Only the parts of the packed instance on the way to the member and the data reachable
+		from it is read, so loading a small part of a large instance cost about as much as the part loaded.
+
+		The member is selected by a member-path, member names separated by '.' and [index] to select an element in
+		an array or inline array, i.e. "header.version" or "items[3].name". Members of a struct pointed to are
+		selected through the ptr-member as "next.value". An empty path load the entire instance.
+
+		The value of the member is loaded to the start of out_value followed by the strings, arrays and structs it
+		reference, with all pointers patched to point into out_value.
+
+	Parameters:
+		dl_ctx               - DL-context to use when loading.
+		type                 - Type of instance in the packed data.
+		path                 - Member-path of value to load.
+		out_value            - Buffer to load value to, need to be aligned as an instance of type.
+		out_value_size       - Size of out_value, 0 to only calculate the size needed.
+		packed_instance      - Packed instance to load from, not modified.
+		packed_instance_size - Size of packed_instance.
+		produced_bytes       - Number of bytes needed in out_value is returned here, 0x0 to ignore.
+
+	Return:
+		DL_ERROR_OK on success, DL_ERROR_INVALID_PARAMETER if path can not be parsed, DL_ERROR_MEMBER_NOT_FOUND if
+		a member in path do not exist, an index is outside of its array, a pointer on the path is null or a union
+		member on the path is not the member set in the union. DL_ERROR_BUFFER_TOO_SMALL if out_value_size is > 0
+		but smaller than needed.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_load_path( dl_ctx_t             dl_ctx,          dl_typeid_t type,
+                                                const char*          path,
+                                                void*                out_value,       size_t      out_value_size,
+                                                const unsigned char* packed_instance, size_t      packed_instance_size,
+                                                size_t*              produced_bytes );
+
 /*
 	Group: Store
 */
@@ -350,6 +561,32 @@ dl_error_t DL_DLL_EXPORT dl_instance_load_inplace( dl_ctx_t       dl_ctx,
 */
 dl_error_t DL_DLL_EXPORT dl_instance_calc_size( dl_ctx_t dl_ctx, dl_typeid_t type, const void* instance, size_t* out_size);
 
+/*
+	Enum: dl_calc_size_flags_t
+		Flags to dl_instance_calc_size_ex.
+
+	Values:
+		DL_CALC_SIZE_FLAGS_NONE        - Calculate the exact size as dl_instance_calc_size.
+		DL_CALC_SIZE_FLAGS_UPPER_BOUND - Skip merging of equal strings, the returned size is then at least the size
+		                                 needed to store the instance but can be larger if the instance contain equal
+		                                 strings. Use when only sizing a buffer to store into. Pointers to the same
+		                                 struct is still only counted once since they can form cycles.
+*/
+typedef enum
+{
+	DL_CALC_SIZE_FLAGS_NONE        = 0,
+	DL_CALC_SIZE_FLAGS_UPPER_BOUND = 1 << 0
+} dl_calc_size_flags_t;
+
+/*
+	Function: dl_instance_calc_size_ex
+		Same as dl_instance_calc_size but with flags controlling how the size is calculated.
+
+	Parameters:
+		flags - combination of dl_calc_size_flags_t.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_calc_size_ex( dl_ctx_t dl_ctx, dl_typeid_t type, const void* instance, unsigned int flags, size_t* out_size );
+
 /*
 	Function: dl_instace_store
 		Store the instances.
@@ -377,6 +614,109 @@ dl_error_t DL_DLL_EXPORT dl_instance_calc_size( dl_ctx_t dl_ctx, dl_typeid_t typ
 dl_error_t DL_DLL_EXPORT dl_instance_store( dl_ctx_t       dl_ctx,     dl_typeid_t type,            const void* instance,
 											unsigned char* out_buffer, size_t      out_buffer_size, size_t*     produced_bytes );
 
+/*
+	Function: dl_instance_clone
+		Copy a loaded instance, and everything it reference, to a buffer as a loaded instance without storing and
+		loading it. Pointers to the same struct in the instance point to the same struct in the copy, also when the
+		pointers form cycles, and equal strings are only copied once. The copy is placed compact in out_buffer, the
+		instance first followed by its subdata, and is ready to use without patching.
+
+	Parameters:
+		dl_ctx          - Context with type loaded.
+		type            - Type id of instance.
+		instance        - Ptr to instance to copy.
+		out_buffer      - Buffer to copy instance to, need to be aligned as an instance of type and not overlap instance.
+		out_buffer_size - Size of out_buffer, 0 to only calculate the size needed.
+		produced_bytes  - Number of bytes needed in out_buffer is returned here, 0x0 to ignore.
+
+	Return:
+		DL_ERROR_OK on success. DL_ERROR_BUFFER_TOO_SMALL if out_buffer_size is > 0 but smaller than needed, the
+		content of out_buffer is then undefined.
+
+	Note:
+		The instance is walked once, a buffer that is large enough, for example the rest of a block in an arena, can
+		be used directly and produced_bytes tell how much of it was used.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_clone( dl_ctx_t    dl_ctx,     dl_typeid_t type,
+                                            const void* instance,
+                                            void*       out_buffer, size_t      out_buffer_size,
+                                            size_t*     produced_bytes );
+
+/*
+	Function: dl_instance_compare
+		Compare two loaded instances of the same type member by member. Padding and the addresses of the data the
+		instances reference do not affect the result, strings are compared by content and pointers by the structs they
+		point to. Instances that point to the same struct from different places, or form cycles, are only equal if the
+		other instance point to one struct from the same places.
+
+	Parameters:
+		dl_ctx             - Context with type loaded.
+		type               - Type id of the instances.
+		instance_a         - Ptr to first instance to compare.
+		instance_b         - Ptr to second instance to compare.
+		out_result         - < 0 if instance_a is ordered before instance_b, 0 if they are equal and > 0 otherwise.
+		out_diff_path      - Member-path, as used by dl_instance_load_path, to the first member that differ is written here,
+		                     an empty string if the instances are equal, 0x0 to ignore.
+		out_diff_path_size - Size of out_diff_path, a path that do not fit is truncated.
+
+	Return:
+		DL_ERROR_OK on success. DL_ERROR_MALFORMED_DATA if a union in one of the instances has an invalid type-tag.
+
+	Note:
+		The order is only meant to be stable, to be used for sorting and searching. Numbers are compared by value,
+		strings as by strcmp and null before any string or pointer. Arrays are ordered by length before their
+		elements, unions by their type-tag before the member that is set and structs pointed to are compared after
+		all members of the instance in the order they are first reached.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_compare( dl_ctx_t    dl_ctx,     dl_typeid_t type,
+                                              const void* instance_a, const void* instance_b,
+                                              int*        out_result,
+                                              char*       out_diff_path, size_t out_diff_path_size );
+
+/*
+	Function: dl_instance_hash
+		Calculate a 64 bit hash of the content of a loaded instance, to be used as key for caching and deduplication.
+		The hash do not depend on padding, where the data the instance reference is placed or if equal strings are
+		shared, instances that dl_instance_compare find equal get the same hash. Structs pointed to from more than one
+		place, or that form cycles, is hashed once and in a deterministic order.
+
+	Parameters:
+		dl_ctx   - Context with type loaded.
+		type     - Type id of instance, the type id is part of the hash.
+		instance - Ptr to instance to hash.
+		out_hash - Hash is returned here.
+
+	Return:
+		DL_ERROR_OK on success. DL_ERROR_MALFORMED_DATA if a union in the instance has an invalid type-tag.
+
+	Note:
+		The hash is calculated with an in-tree implementation of XXH64 and is the same on all platforms, so it can be
+		stored. It is not affected by overriding DL_HASH_BUFFER. It change if members are added to or removed from
+		the types in the instance.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_hash( dl_ctx_t dl_ctx, dl_typeid_t type, const void* instance, uint64_t* out_hash );
+
+/*
+	Function: dl_instance_hash_packed
+		Same as dl_instance_hash but calculated directly on a packed instance, without loading it. The hash of a packed
+		instance is the same as the hash of the instance it was stored from.
+
+	Parameters:
+		dl_ctx               - Context with type loaded.
+		type                 - Type id of instance.
+		packed_instance      - Packed instance in the format of the host, see dl_convert to convert instances in
+		                       other formats.
+		packed_instance_size - Size of packed_instance.
+		out_hash             - Hash is returned here.
+
+	Return:
+		DL_ERROR_OK on success. Errors as by dl_instance_load if the packed instance do not match type or the host and
+		DL_ERROR_MALFORMED_DATA if data in the packed instance is out of bounds.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_hash_packed( dl_ctx_t             dl_ctx,          dl_typeid_t type,
+                                                  const unsigned char* packed_instance, size_t      packed_instance_size,
+                                                  uint64_t*            out_hash );
+
 
 /*
 	Group: Util
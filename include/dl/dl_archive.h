@@ -0,0 +1,179 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#ifndef DL_DL_ARCHIVE_H_INCLUDED
+#define DL_DL_ARCHIVE_H_INCLUDED
+
+/*
+	File: dl_archive.h
+		Functions to build and read dl-archives, a container for many packed instances that can be looked up
+		by name and type without scanning the archive.
+
+		An archive is a header, an index sorted by name-hash and typeid, the names of all instances and last the
+		packed instances, each aligned to the alignment of the archive. All offsets are relative to the start of
+		the archive and nothing is patched when opening it so an archive can be used directly from a memory-mapped
+		file as long as it is mapped to an address aligned to the alignment of the archive.
+
+		Header and index is stored in the same endian as the instances in the archive.
+*/
+
+#include <dl/dl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/*
+	Struct: dl_archive_input_t
+		One instance to write to an archive with dl_archive_write.
+
+	Members:
+		name                 - name of the instance, name and type of the instance is the key used to find it.
+		packed_instance      - instance packed by dl_instance_store, dl_txt_pack or dl_convert.
+		packed_instance_size - size of packed_instance.
+*/
+typedef struct dl_archive_input
+{
+	const char*          name;
+	const unsigned char* packed_instance;
+	size_t               packed_instance_size;
+} dl_archive_input_t;
+
+/*
+	Struct: dl_archive_t
+		An opened archive, see dl_archive_open. Only refer to the memory passed to dl_archive_open.
+
+	Members:
+		data        - the archive.
+		size        - size of data.
+		entry_count - number of instances in the archive.
+		alignment   - alignment of each instance in the archive.
+*/
+typedef struct dl_archive
+{
+	unsigned char* data;
+	size_t         size;
+	unsigned int   entry_count;
+	unsigned int   alignment;
+} dl_archive_t;
+
+/*
+	Struct: dl_archive_entry_t
+		Information about one instance in an archive.
+
+	Members:
+		name                 - name of the instance.
+		name_hash            - hash of name, the index is sorted on it.
+		type                 - type of the instance.
+		packed_instance      - the instance in the archive.
+		packed_instance_size - size of packed_instance.
+		loaded               - 1 if the instance has been loaded by dl_archive_load_inplace, packed_instance is then
+		                       patched and can not be used as a packed instance, 0 otherwise.
+*/
+typedef struct dl_archive_entry
+{
+	const char*    name;
+	unsigned int   name_hash;
+	dl_typeid_t    type;
+	unsigned char* packed_instance;
+	size_t         packed_instance_size;
+	int            loaded;
+} dl_archive_entry_t;
+
+/*
+	Function: dl_archive_write
+		Write packed instances to an archive.
+
+	Parameters:
+		dl_ctx           - dl-context, used for temporary allocations and error-reporting.
+		instances        - instances to write.
+		instance_count   - number of instances.
+		alignment        - alignment of each instance in the archive, power of 2 that is 16 or more and at least the
+		                   alignment of the root type of each instance. 64 keep each instance on its own cache-line.
+		out_archive      - buffer to write archive to.
+		out_archive_size - size of out_archive.
+		produced_bytes   - number of bytes that would have been written to out_archive if it was large enough.
+
+	Return:
+		DL_ERROR_OK on success. Writing to a 0-sized out_archive is thought of as a success as it can be used to
+		calculate the size of the archive.
+		DL_ERROR_INVALID_PARAMETER if two instances has the same name and type, DL_ERROR_ENDIAN_MISMATCH if all
+		instances are not packed with the same endian, DL_ERROR_TYPE_NOT_FOUND if the root type of an instance is not
+		loaded in dl_ctx and DL_ERROR_BAD_ALIGNMENT if the root type of an instance need a larger alignment than
+		alignment.
+*/
+dl_error_t DL_DLL_EXPORT dl_archive_write( dl_ctx_t                  dl_ctx,
+                                           const dl_archive_input_t* instances,   unsigned int instance_count,
+                                           unsigned int              alignment,
+                                           unsigned char*            out_archive, size_t       out_archive_size,
+                                           size_t*                   produced_bytes );
+
+/*
+	Function: dl_archive_open
+		Open an archive written by dl_archive_write. Only the header is validated, each entry is validated as it
+		is fetched.
+
+	Parameters:
+		archive_data - the archive, need to be aligned to the alignment the archive was written with. Need to be
+		               writable if dl_archive_load_inplace is to be used.
+		archive_size - size of archive_data.
+		out_archive  - opened archive.
+
+	Return:
+		DL_ERROR_OK on success, DL_ERROR_ENDIAN_MISMATCH if the archive is written for the other endian and
+		DL_ERROR_BAD_ALIGNMENT if archive_data is not aligned. DL_ERROR_MALFORMED_DATA if any entry in the archive
+		has been loaded by dl_archive_load_inplace, see dl_archive_load_inplace.
+*/
+dl_error_t DL_DLL_EXPORT dl_archive_open( unsigned char* archive_data, size_t archive_size, dl_archive_t* out_archive );
+
+/*
+	Function: dl_archive_get_entry
+		Get information about the instance at index in the archive, used to list everything in an archive.
+
+	Parameters:
+		archive   - opened archive.
+		index     - index of entry, less than archive->entry_count.
+		out_entry - information about the instance.
+*/
+dl_error_t DL_DLL_EXPORT dl_archive_get_entry( const dl_archive_t* archive, unsigned int index, dl_archive_entry_t* out_entry );
+
+/*
+	Function: dl_archive_find
+		Find an instance in the archive by binary-search of the index.
+
+	Parameters:
+		archive   - opened archive.
+		name      - name of instance to find.
+		type      - type of instance to find, 0 to find an instance named name of any type.
+		out_entry - information about the instance.
+
+	Return:
+		DL_ERROR_OK on success, DL_ERROR_ARCHIVE_ENTRY_NOT_FOUND if there is no such instance.
+*/
+dl_error_t DL_DLL_EXPORT dl_archive_find( const dl_archive_t* archive, const char* name, dl_typeid_t type, dl_archive_entry_t* out_entry );
+
+/*
+	Function: dl_archive_load_inplace
+		Find an instance in the archive and load it inplace, see dl_instance_load_inplace.
+
+	Parameters:
+		dl_ctx          - dl-context with the type of the instance loaded.
+		archive         - opened archive.
+		name            - name of instance to load.
+		type            - type of instance to load.
+		loaded_instance - ptr to the loaded instance in the archive.
+
+	Note:
+		The archive memory is modified by the load, use dl_archive_find and dl_instance_load to load from memory
+		that is read-only. The entry is marked as loaded in the index of the archive, loading it again return the
+		same instance without patching it again and dl_archive_find and dl_archive_get_entry report it as loaded.
+		As the patched ptrs are only valid where the archive was loaded, memory with loaded entries can not be
+		opened again by dl_archive_open, keep the opened archive for as long as the memory is used, and must not be
+		written back to a file. Loading the same archive from multiple threads at the same time is not supported.
+*/
+dl_error_t DL_DLL_EXPORT dl_archive_load_inplace( dl_ctx_t dl_ctx, const dl_archive_t* archive, const char* name, dl_typeid_t type, void** loaded_instance );
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif // DL_DL_ARCHIVE_H_INCLUDED
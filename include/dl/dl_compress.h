@@ -0,0 +1,146 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#ifndef DL_DL_COMPRESS_H_INCLUDED
+#define DL_DL_COMPRESS_H_INCLUDED
+
+/*
+	File: dl_compress.h
+		Functions to compress packed instances into a block-compressed container and to decompress them again.
+
+		The packed instance is split into blocks of equal size, except the last one, that are compressed independently
+		of each other with a small LZ77-codec built into dl. As no block depend on another block, blocks can be
+		decompressed in any order, on many threads at the same time, and only the blocks covering a part of the
+		instance need to be decompressed to read that part.
+
+		Each block decompress to the same offset in the packed instance that it was compressed from, so decompressing
+		straight into the buffer that is to be loaded with dl_instance_load_inplace do not need any extra copy.
+
+		The container is stored in the same endian as the packed instance but can be decompressed on any platform.
+*/
+
+#include <dl/dl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/*
+	Struct: dl_compressed_info_t
+		Information about a compressed instance, see dl_compressed_get_info.
+
+	Members:
+		instance_size - size of the packed instance when decompressed.
+		block_size    - number of bytes of the packed instance in each block, except the last one that might be smaller.
+		block_count   - number of blocks.
+*/
+typedef struct dl_compressed_info
+{
+	size_t       instance_size;
+	unsigned int block_size;
+	unsigned int block_count;
+} dl_compressed_info_t;
+
+/*
+	Function: dl_instance_compress
+		Compress a packed instance into a block-compressed container.
+
+	Parameters:
+		dl_ctx               - dl-context used for temporary allocations and error-reporting.
+		packed_instance      - instance packed by dl_instance_store, dl_txt_pack or dl_convert.
+		packed_instance_size - size of packed_instance.
+		block_size           - bytes of the packed instance to compress into each block, 0 to use the default of 64KB.
+		                       Need to be at least 256.
+		out_buffer           - buffer to write compressed instance to.
+		out_buffer_size      - size of out_buffer.
+		produced_bytes       - number of bytes that would have been written to out_buffer if it was large enough.
+
+	Return:
+		DL_ERROR_OK on success. Compressing to a 0-sized out_buffer is thought of as a success as it can be used to
+		calculate the size of the compressed instance.
+		DL_ERROR_INVALID_PARAMETER if block_size is to small.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_compress( dl_ctx_t             dl_ctx,
+                                               const unsigned char* packed_instance, size_t       packed_instance_size,
+                                               unsigned int         block_size,
+                                               unsigned char*       out_buffer,      size_t       out_buffer_size,
+                                               size_t*              produced_bytes );
+
+/*
+	Function: dl_compressed_get_info
+		Fetch information about a compressed instance.
+
+	Parameters:
+		compressed      - compressed instance written by dl_instance_compress.
+		compressed_size - size of compressed.
+		out_info        - ptr to dl_compressed_info_t where to return info.
+
+	Return:
+		DL_ERROR_OK on success.
+*/
+dl_error_t DL_DLL_EXPORT dl_compressed_get_info( const unsigned char* compressed, size_t compressed_size, dl_compressed_info_t* out_info );
+
+/*
+	Function: dl_compressed_decompress_blocks
+		Decompress a range of blocks of a compressed instance. Block i is decompressed to out_instance + i * block_size,
+		i.e. to the same place as it would have been by dl_instance_decompress, so disjoint ranges of blocks can be
+		decompressed to the same out_instance from different threads.
+
+	Parameters:
+		compressed        - compressed instance written by dl_instance_compress.
+		compressed_size   - size of compressed.
+		first_block       - index of first block to decompress.
+		block_count       - number of blocks to decompress.
+		out_instance      - buffer to decompress the packed instance to.
+		out_instance_size - size of out_instance, need to at least reach the end of the last decompressed block.
+
+	Return:
+		DL_ERROR_OK on success, DL_ERROR_INVALID_PARAMETER if the blocks are not in the compressed instance.
+*/
+dl_error_t DL_DLL_EXPORT dl_compressed_decompress_blocks( const unsigned char* compressed,   size_t       compressed_size,
+                                                          unsigned int         first_block,  unsigned int block_count,
+                                                          unsigned char*       out_instance, size_t       out_instance_size );
+
+/*
+	Function: dl_compressed_decompress_range
+		Decompress only the blocks of a compressed instance that cover the bytes [offset, offset + size) of the packed
+		instance, to the same place in out_instance as they would have been decompressed to by dl_instance_decompress.
+
+	Parameters:
+		compressed        - compressed instance written by dl_instance_compress.
+		compressed_size   - size of compressed.
+		offset            - offset of first byte in the packed instance to decompress.
+		size              - number of bytes to decompress.
+		out_instance      - buffer to decompress the packed instance to.
+		out_instance_size - size of out_instance, need to at least reach the end of the last decompressed block.
+
+	Return:
+		DL_ERROR_OK on success, DL_ERROR_INVALID_PARAMETER if the range is outside of the packed instance.
+*/
+dl_error_t DL_DLL_EXPORT dl_compressed_decompress_range( const unsigned char* compressed,   size_t compressed_size,
+                                                         size_t               offset,       size_t size,
+                                                         unsigned char*       out_instance, size_t out_instance_size );
+
+/*
+	Function: dl_instance_decompress
+		Decompress a complete compressed instance.
+
+	Parameters:
+		compressed        - compressed instance written by dl_instance_compress.
+		compressed_size   - size of compressed.
+		out_instance      - buffer to decompress the packed instance to.
+		out_instance_size - size of out_instance.
+		produced_bytes    - size of the packed instance.
+
+	Return:
+		DL_ERROR_OK on success. Decompressing to a 0-sized out_instance is thought of as a success as it can be used to
+		fetch the size of the packed instance.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_decompress( const unsigned char* compressed,   size_t  compressed_size,
+                                                 unsigned char*       out_instance, size_t  out_instance_size,
+                                                 size_t*              produced_bytes );
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif // DL_DL_COMPRESS_H_INCLUDED
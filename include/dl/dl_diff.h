@@ -0,0 +1,88 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#ifndef DL_DL_DIFF_H_INCLUDED
+#define DL_DL_DIFF_H_INCLUDED
+
+/*
+	File: dl_diff.h
+		Functions to calculate the difference between two instances of the same type as a compact patch and to build
+		the new packed instance from the old instance and such a patch, for example to replicate an instance over a
+		network without resending all of it when only parts of it changes.
+
+		A patch is a list of the members that changed, walked with the type-descriptors, with the new value of each
+		changed member. Arrays that keep their length only store the changed elements, arrays that change length store
+		the changed elements before the unchanged tail, i.e. an insert or remove only store the inserted elements and
+		the elements that moved. Strings are stored in full when changed. Each pointer found in the new instance is
+		stored as a reference to an earlier pointer or as a patch against the instance pointed to by the old instance in
+		the same place, so pointers to the same instance are still pointing to the same instance after the patch is
+		applied.
+
+		Diffing is done in one pass where each member is diffed once and the patch is rolled back for members that
+		turn out to be unchanged, structs without pointers that are equal byte by byte are skipped without being
+		visited. The exception is arrays that change length, the elements at their end are compared to find the
+		unchanged tail before the rest of the array is diffed. Applying visits each member in the patch once.
+
+		The patch is stored in host-endian and can only be applied on a platform with the same endian.
+*/
+
+#include <dl/dl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/*
+	Function: dl_instance_diff
+		Calculate the patch from one loaded instance to another of the same type.
+
+	Parameters:
+		dl_ctx         - dl-context with the type of the instances loaded, used for temporary allocations and error-reporting.
+		type           - type of the instances.
+		old_instance   - instance to diff from, the instance the patch is to be applied on with dl_instance_apply_diff.
+		new_instance   - instance to diff to.
+		out_patch      - buffer to write patch to.
+		out_patch_size - size of out_patch.
+		produced_bytes - number of bytes that would have been written to out_patch if it was large enough.
+
+	Return:
+		DL_ERROR_OK on success. Diffing to a 0-sized out_patch is thought of as a success as it can be used to calculate
+		the size of the patch.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_diff( dl_ctx_t       dl_ctx,       dl_typeid_t type,
+                                           const void*    old_instance, const void* new_instance,
+                                           unsigned char* out_patch,    size_t      out_patch_size,
+                                           size_t*        produced_bytes );
+
+/*
+	Function: dl_instance_apply_diff
+		Apply a patch calculated by dl_instance_diff to the old instance and store the resulting new instance, packed
+		as by dl_instance_store.
+
+	Parameters:
+		dl_ctx          - dl-context with the type of the instances loaded, used for temporary allocations and error-reporting.
+		type            - type of the instances.
+		old_instance    - loaded instance the patch was calculated from, not modified.
+		patch           - patch calculated by dl_instance_diff.
+		patch_size      - size of patch.
+		out_buffer      - buffer to store the new packed instance to.
+		out_buffer_size - size of out_buffer.
+		produced_bytes  - number of bytes that would have been written to out_buffer if it was large enough.
+
+	Return:
+		DL_ERROR_OK on success. Storing to a 0-sized out_buffer is thought of as a success as it can be used to calculate
+		the size of the new instance.
+		DL_ERROR_TYPE_MISMATCH if the patch was calculated for another type, DL_ERROR_ENDIAN_MISMATCH if the patch was
+		calculated on a platform with another endian and DL_ERROR_MALFORMED_DATA if the patch is broken or do not match
+		old_instance.
+*/
+dl_error_t DL_DLL_EXPORT dl_instance_apply_diff( dl_ctx_t             dl_ctx,       dl_typeid_t type,
+                                                 const void*          old_instance,
+                                                 const unsigned char* patch,        size_t      patch_size,
+                                                 unsigned char*       out_buffer,   size_t      out_buffer_size,
+                                                 size_t*              produced_bytes );
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif // DL_DL_DIFF_H_INCLUDED
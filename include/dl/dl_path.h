@@ -0,0 +1,164 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#ifndef DL_DL_PATH_H_INCLUDED
+#define DL_DL_PATH_H_INCLUDED
+
+/*
+	File: dl_path.h
+		Compiled member-paths, used to read and write one member of a loaded instance selected by a path such as
+		"a.b[3].c" without looking up members and calculating offsets on each access.
+
+		A member-path is member names separated by '.' with [index] to select an element in an array or inline array.
+		Members of a struct pointed to are selected through the ptr-member as "next.value". See dl_instance_load_path
+		to load a member from a packed instance.
+
+		dl_path_compile resolve the path against the types once. The compiled path only hold offsets and is not
+		changed after it is compiled, so it can be cached and used by many threads at the same time. Accessing a member
+		through it only cost following the pointers and arrays on the path. A compiled path is valid as long as the
+		types used on the path is not changed in the dl-context it was compiled with, see dl_type_context_info_t.generation.
+*/
+
+#include <dl/dl.h>
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/*
+	Handle: dl_path_t
+		Compiled member-path.
+*/
+typedef struct dl_path* dl_path_t;
+
+/*
+	Struct: dl_path_info_t
+		Information about the member at the end of a compiled member-path.
+
+	Members:
+		atom        - atom-type of the member, always DL_TYPE_ATOM_POD for elements of arrays.
+		storage     - storage-type of the member or the elements of an array.
+		type_id     - type of struct- and ptr-members and enum of enum-members, 0 for other members.
+		size        - size of the member on the host.
+		array_count - number of elements if the member is an inline array, 0 otherwise.
+		generation  - generation of the dl-context when the path was compiled, see dl_type_context_info_t.
+*/
+typedef struct dl_path_info
+{
+	dl_type_atom_t    atom;
+	dl_type_storage_t storage;
+	dl_typeid_t       type_id;
+	unsigned int      size;
+	unsigned int      array_count;
+	unsigned int      generation;
+} dl_path_info_t;
+
+/*
+	Function: dl_path_compile
+		Compile a member-path.
+
+	Parameters:
+		dl_ctx   - dl-context with type loaded, the compiled path is allocated with the allocator of dl_ctx.
+		type     - type of the instances the path will be used on.
+		path     - member-path to compile, an empty path select the instance itself.
+		out_path - compiled path is returned here, free with dl_path_destroy.
+
+	Return:
+		DL_ERROR_OK on success, DL_ERROR_INVALID_PARAMETER if path can not be parsed and DL_ERROR_MEMBER_NOT_FOUND
+		if a member on the path do not exist, an index is outside an inline array or a member is not a struct, ptr or
+		array where the path need one.
+*/
+dl_error_t DL_DLL_EXPORT dl_path_compile( dl_ctx_t dl_ctx, dl_typeid_t type, const char* path, dl_path_t* out_path );
+
+/*
+	Function: dl_path_destroy
+		Free a path compiled with dl_path_compile.
+*/
+dl_error_t DL_DLL_EXPORT dl_path_destroy( dl_path_t path );
+
+/*
+	Function: dl_path_get_info
+		Get information about the member at the end of a compiled path.
+*/
+dl_error_t DL_DLL_EXPORT dl_path_get_info( dl_path_t path, dl_path_info_t* out_info );
+
+/*
+	Function: dl_path_resolve
+		Get the address of the member selected by path in a loaded instance.
+
+	Parameters:
+		path     - compiled member-path.
+		instance - loaded instance of the type path was compiled for.
+
+	Return:
+		Address of the member, 0x0 if a pointer on the path is null, an index is outside of its array or a union on
+		the path do not have the member on the path set. For bitfield-members the address of the integer that hold the
+		bitfield is returned.
+*/
+DL_DLL_EXPORT void* dl_path_resolve( dl_path_t path, void* instance );
+
+/*
+	Function: dl_path_get_int64
+		Read an integer-, enum- or bitfield-member selected by path.
+
+	Return:
+		DL_ERROR_OK on success, DL_ERROR_MEMBER_NOT_FOUND if the member can not be reached as by dl_path_resolve,
+		DL_ERROR_TYPE_MISMATCH if the member is not an integer, enum or bitfield and DL_ERROR_INVALID_PARAMETER if
+		the value do not fit in the returned type.
+*/
+dl_error_t DL_DLL_EXPORT dl_path_get_int64( dl_path_t path, const void* instance, int64_t* out_value );
+
+/*
+	Function: dl_path_get_uint64
+		Same as dl_path_get_int64 but read the value as an unsigned integer.
+*/
+dl_error_t DL_DLL_EXPORT dl_path_get_uint64( dl_path_t path, const void* instance, uint64_t* out_value );
+
+/*
+	Function: dl_path_get_fp64
+		Read a fp32- or fp64-member selected by path, as dl_path_get_int64.
+*/
+dl_error_t DL_DLL_EXPORT dl_path_get_fp64( dl_path_t path, const void* instance, double* out_value );
+
+/*
+	Function: dl_path_get_str
+		Read a string-member selected by path, as dl_path_get_int64.
+*/
+dl_error_t DL_DLL_EXPORT dl_path_get_str( dl_path_t path, const void* instance, const char** out_value );
+
+/*
+	Function: dl_path_set_int64
+		Write an integer-, enum- or bitfield-member selected by path.
+
+	Return:
+		DL_ERROR_OK on success, DL_ERROR_MEMBER_NOT_FOUND if the member can not be reached as by dl_path_resolve,
+		DL_ERROR_TYPE_MISMATCH if the member is not an integer, enum or bitfield and DL_ERROR_INVALID_PARAMETER if
+		value do not fit in the member. Values of enum-members are not checked against the values of the enum.
+*/
+dl_error_t DL_DLL_EXPORT dl_path_set_int64( dl_path_t path, void* instance, int64_t value );
+
+/*
+	Function: dl_path_set_uint64
+		Same as dl_path_set_int64 but with an unsigned value.
+*/
+dl_error_t DL_DLL_EXPORT dl_path_set_uint64( dl_path_t path, void* instance, uint64_t value );
+
+/*
+	Function: dl_path_set_fp64
+		Write a fp32- or fp64-member selected by path, as dl_path_set_int64.
+*/
+dl_error_t DL_DLL_EXPORT dl_path_set_fp64( dl_path_t path, void* instance, double value );
+
+/*
+	Function: dl_path_set_str
+		Write a string-member selected by path, as dl_path_set_int64. Only the pointer is stored in the instance, value
+		need to be valid as long as the instance use it.
+*/
+dl_error_t DL_DLL_EXPORT dl_path_set_str( dl_path_t path, void* instance, const char* value );
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif // DL_DL_PATH_H_INCLUDED
@@ -16,11 +16,19 @@
 /*
 	Struct: dl_type_context_info_t
 		Struct used to retrieve information about the dl_context
+
+	Members:
+		num_types  - number of loaded types.
+		num_enums  - number of loaded enums.
+		generation - changed each time types are loaded, replaced or unloaded. Data derived from the types in
+		             the context, such as indices or resolved type-info, can be cached together with the
+		             generation and is still valid as long as the generation is the same.
 */
 typedef struct dl_type_context_info
 {
 	unsigned int num_types;
 	unsigned int num_enums;
+	unsigned int generation;
 } dl_type_context_info_t;
 
 /*
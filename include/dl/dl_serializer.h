@@ -0,0 +1,812 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#ifndef DL_DL_SERIALIZER_H_INCLUDED
+#define DL_DL_SERIALIZER_H_INCLUDED
+
+/*
+	File: dl_serializer.h
+		Runtime used by the c++ serializers generated by dl_context_write_type_library_cpp_serializers().
+
+		The generated serializers store, load and endian-swap instances with all offsets and sizes known at compile
+		time, no dl_ctx_t is needed and no type-information is interpreted at runtime. Data produced is exactly the
+		same as what dl_instance_store() would produce and can be used with all other functions in dl.
+
+	Example:
+		#include "generated/my_types.h"
+		#include "generated/my_types.serializers.h"
+
+		my_type instance = ...;
+
+		size_t size;
+		dl_serializer_calc_size( instance, &size );
+
+		unsigned char* packed = (unsigned char*)malloc( size );
+		dl_serializer_store( instance, packed, size, 0x0 );
+
+		my_type* loaded;
+		dl_serializer_load_inplace( packed, size, &loaded, 0x0 );
+*/
+
+#if !defined( __cplusplus )
+#  error "dl_serializer.h is only supported in c++"
+#endif
+
+#include <dl/dl.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+	Macro: DL_SERIALIZER_PTR_SEL
+		Select between the value used on platforms with 32- and 64-bit pointers, used by generated code.
+*/
+#define DL_SERIALIZER_PTR_SEL( ptr32, ptr64 ) ( sizeof( void* ) == 8 ? (size_t)( ptr64 ) : (size_t)( ptr32 ) )
+
+/*
+	Struct: dl_serializer
+		Specialized for each type in generated code with the constants
+
+		TYPE_ID     - typeid of type.
+		SIZE        - size of type.
+		ALIGNMENT   - alignment of type.
+		HAS_SUBDATA - true if type has any pointer, string or array.
+
+		and the functions store(), patch() and swap() used by the functions in this file.
+*/
+template <typename T>
+struct dl_serializer;
+
+// ... mirror of the instance header in the binary format ...
+struct dl_serializer_data_header
+{
+	uint32_t    id;
+	uint32_t    version;
+	dl_typeid_t root_instance_type;
+	uint32_t    instance_size;
+	uint8_t     is_64_bit_ptr;
+	uint8_t     not_using_ptr_chain_patching;
+	uint8_t     pad[2];
+	uint32_t    first_pointer_to_patch;
+};
+
+static const uint32_t DL_SERIALIZER_INSTANCE_ID      = ('D'<< 24) | ('L' << 16) | ('D' << 8) | 'L';
+static const uint32_t DL_SERIALIZER_INSTANCE_VERSION = 2;
+
+inline uint16_t dl_serializer_swap16( uint16_t v ) { return (uint16_t)( ( v >> 8 ) | ( v << 8 ) ); }
+inline uint32_t dl_serializer_swap32( uint32_t v ) { return ( v >> 24 ) | ( ( v >> 8 ) & 0xFF00 ) | ( ( v << 8 ) & 0xFF0000 ) | ( v << 24 ); }
+inline uint64_t dl_serializer_swap64( uint64_t v ) { return ( (uint64_t)dl_serializer_swap32( (uint32_t)v ) << 32 ) | dl_serializer_swap32( (uint32_t)( v >> 32 ) ); }
+
+inline size_t dl_serializer_align_up( size_t value, size_t alignment )
+{
+	return ( value + alignment - 1 ) & ~( alignment - 1 );
+}
+
+inline uintptr_t dl_serializer_read_ptr( const unsigned char* ptr_data )
+{
+	uintptr_t value;
+	memcpy( &value, ptr_data, sizeof( uintptr_t ) );
+	return value;
+}
+
+inline uint32_t dl_serializer_read_count( const unsigned char* array_data )
+{
+	uint32_t count;
+	memcpy( &count, array_data + sizeof( void* ), sizeof( uint32_t ) );
+	return count;
+}
+
+/*
+	Array with N elements of inline storage, growing on the heap when that is not enough.
+*/
+template <typename T, size_t N>
+struct dl_serializer_array
+{
+	T*     data;
+	size_t count;
+	size_t capacity;
+	T      storage[N];
+
+	dl_serializer_array() : data( storage ), count( 0 ), capacity( N ) {}
+	~dl_serializer_array() { if( data != storage ) free( data ); }
+
+	bool add( const T& value )
+	{
+		// ... value might be an element in this array that is freed when growing ...
+		T copy = value;
+		if( count == capacity )
+		{
+			T* new_data = (T*)malloc( capacity * 2 * sizeof( T ) );
+			if( new_data == 0x0 )
+				return false;
+			memcpy( new_data, data, count * sizeof( T ) );
+			if( data != storage )
+				free( data );
+			data = new_data;
+			capacity *= 2;
+		}
+		data[count++] = copy;
+		return true;
+	}
+
+private:
+	dl_serializer_array( const dl_serializer_array& );
+	dl_serializer_array& operator=( const dl_serializer_array& );
+};
+
+/*
+	Open addressed map from pointers, or strings, to offsets in a packed instance.
+*/
+struct dl_serializer_map
+{
+	struct entry
+	{
+		const void* key;
+		size_t      length; // ... length of string, (size_t)-1 for pointers compared by address ...
+		uintptr_t   value;
+	};
+
+	entry* slots;
+	size_t mask;
+	size_t count;
+	entry  storage[64];
+
+	dl_serializer_map() : slots( storage ), mask( 63 ), count( 0 ) { memset( storage, 0x0, sizeof( storage ) ); }
+	~dl_serializer_map() { if( slots != storage ) free( slots ); }
+
+	static size_t hash( const void* key, size_t length )
+	{
+		// ... FNV-1a over the string or the address ...
+		size_t h = (size_t)2166136261u;
+		if( length == (size_t)-1 )
+		{
+			uintptr_t addr = (uintptr_t)key;
+			for( size_t i = 0; i < sizeof( uintptr_t ); ++i, addr >>= 8 )
+				h = ( h ^ ( addr & 0xFF ) ) * 16777619u;
+			return h;
+		}
+		const unsigned char* str = (const unsigned char*)key;
+		for( size_t i = 0; i < length; ++i )
+			h = ( h ^ str[i] ) * 16777619u;
+		return h;
+	}
+
+	entry* find_slot( const void* key, size_t length )
+	{
+		for( size_t i = hash( key, length ) & mask; ; i = ( i + 1 ) & mask )
+		{
+			entry* e = &slots[i];
+			if( e->key == 0x0 )
+				return e;
+			if( e->length != length )
+				continue;
+			if( length == (size_t)-1 ? e->key == key : memcmp( e->key, key, length ) == 0 )
+				return e;
+		}
+	}
+
+	uintptr_t find( const void* key, size_t length )
+	{
+		entry* e = find_slot( key, length );
+		return e->key == 0x0 ? 0 : e->value;
+	}
+
+	bool insert( const void* key, size_t length, uintptr_t value )
+	{
+		if( ( count + 1 ) * 2 > mask + 1 )
+		{
+			size_t old_size = mask + 1;
+			entry* new_slots = (entry*)malloc( old_size * 2 * sizeof( entry ) );
+			if( new_slots == 0x0 )
+				return false;
+			memset( new_slots, 0x0, old_size * 2 * sizeof( entry ) );
+
+			entry* old_slots = slots;
+			slots = new_slots;
+			mask  = old_size * 2 - 1;
+			for( size_t i = 0; i < old_size; ++i )
+				if( old_slots[i].key != 0x0 )
+					*find_slot( old_slots[i].key, old_slots[i].length ) = old_slots[i];
+			if( old_slots != storage )
+				free( old_slots );
+		}
+
+		entry* e = find_slot( key, length );
+		e->key    = key;
+		e->length = length;
+		e->value  = value;
+		++count;
+		return true;
+	}
+
+private:
+	dl_serializer_map( const dl_serializer_map& );
+	dl_serializer_map& operator=( const dl_serializer_map& );
+};
+
+/*
+	Struct: dl_serializer_writer
+		Writes a packed instance, used by the generated store-functions. Only calculates the size of the instance if
+		constructed without a buffer.
+*/
+struct dl_serializer_writer
+{
+	unsigned char* data;
+	size_t         data_size;
+	size_t         end;   ///< end of packed instance, new subdata is appended here.
+	bool           dummy;
+	dl_error_t     error;
+
+	dl_serializer_map                   strings;
+	dl_serializer_map                   written_ptrs;
+	dl_serializer_array<uintptr_t, 256> ptrs; ///< positions of all pointers to patch when loading.
+
+	dl_serializer_writer( unsigned char* out_data, size_t out_data_size )
+		: data( out_data )
+		, data_size( out_data_size )
+		, end( 0 )
+		, dummy( out_data_size == 0 )
+		, error( DL_ERROR_OK )
+	{}
+
+	void write( size_t pos, const void* src, size_t size )
+	{
+		if( !dummy && pos + size <= data_size )
+			memcpy( data + pos, src, size );
+	}
+
+	void write_ptr( size_t pos, uintptr_t value )
+	{
+		write( pos, &value, sizeof( uintptr_t ) );
+	}
+
+	/*
+		Reserve size bytes at the end of the instance, aligned to alignment, and return the position of them.
+	*/
+	size_t reserve( size_t size, size_t alignment )
+	{
+		size_t pos = dl_serializer_align_up( end, alignment );
+		if( !dummy && pos != end && pos <= data_size )
+			memset( data + end, 0x0, pos - end );
+		end = pos + size;
+		return pos;
+	}
+
+	void add_patch_pos( size_t pos )
+	{
+		if( !dummy && !ptrs.add( pos ) )
+			error = DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	}
+
+	void store_string( size_t pos, const unsigned char* str_data )
+	{
+		const char* str;
+		memcpy( &str, str_data, sizeof( const char* ) );
+		if( str == 0x0 )
+		{
+			write_ptr( pos, 0 );
+			return;
+		}
+
+		size_t length = strlen( str );
+		uintptr_t offset = strings.find( str, length );
+		if( offset == 0 ) // ... merge identical strings ...
+		{
+			offset = end;
+			write( end, str, length + 1 );
+			end += length + 1;
+			if( !strings.insert( str, length, offset ) )
+				error = DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+		}
+		add_patch_pos( pos );
+		write_ptr( pos, offset );
+	}
+
+	void store_pod_array( size_t pos, const unsigned char* array_data, size_t elem_size )
+	{
+		uint32_t count = dl_serializer_read_count( array_data );
+		uintptr_t offset = 0;
+		if( count > 0 )
+		{
+			offset = reserve( count * elem_size, elem_size );
+			write( offset, (const void*)dl_serializer_read_ptr( array_data ), count * elem_size );
+			add_patch_pos( pos );
+		}
+		write_ptr( pos, offset );
+		write( pos + sizeof( void* ), &count, sizeof( uint32_t ) );
+	}
+
+	void store_str_array( size_t pos, const unsigned char* array_data )
+	{
+		uint32_t count = dl_serializer_read_count( array_data );
+		uintptr_t offset = 0;
+		if( count > 0 )
+		{
+			offset = reserve( count * sizeof( char* ), sizeof( char* ) );
+			const unsigned char* strs = (const unsigned char*)dl_serializer_read_ptr( array_data );
+			for( uint32_t i = 0; i < count; ++i )
+				store_string( offset + i * sizeof( char* ), strs + i * sizeof( char* ) );
+			add_patch_pos( pos );
+		}
+		write_ptr( pos, offset );
+		write( pos + sizeof( void* ), &count, sizeof( uint32_t ) );
+	}
+
+	/*
+		Fill in the header and link all pointers in a chain for dl_instance_load_inplace to patch.
+	*/
+	dl_error_t finish( dl_typeid_t type_id, size_t header_size, size_t* produced_bytes )
+	{
+		if( produced_bytes )
+			*produced_bytes = end;
+
+		if( dummy )
+			return error;
+
+		dl_serializer_data_header* header = (dl_serializer_data_header*)data;
+		header->id                 = DL_SERIALIZER_INSTANCE_ID;
+		header->version            = DL_SERIALIZER_INSTANCE_VERSION;
+		header->root_instance_type = type_id;
+		header->is_64_bit_ptr      = sizeof( void* ) == 8 ? 1 : 0;
+		header->instance_size      = (uint32_t)( end - header_size );
+
+		if( end > data_size )
+			return DL_ERROR_BUFFER_TOO_SMALL;
+
+		uintptr_t offset_shift = sizeof( uintptr_t ) * 4;
+		if( end >= ( (uint64_t)1 << offset_shift ) )
+		{
+			header->not_using_ptr_chain_patching = 1;
+			return error;
+		}
+
+		if( ptrs.count > 0 )
+		{
+			uintptr_t* pos = ptrs.data;
+			size_t count = ptrs.count;
+
+			// ... sort positions, insertion sort since they are mostly written in order ...
+			for( size_t i = 1; i < count; ++i )
+			{
+				uintptr_t p = pos[i];
+				size_t j = i;
+				for( ; j > 0 && pos[j - 1] > p; --j )
+					pos[j] = pos[j - 1];
+				pos[j] = p;
+			}
+
+			for( size_t i = 0; i < count; ++i )
+			{
+				uintptr_t next = i + 1 < count ? pos[i + 1] - pos[i] : 0; // ... 0 terminates patching ...
+				uintptr_t offset = dl_serializer_read_ptr( data + pos[i] );
+				write_ptr( pos[i], offset | ( next << offset_shift ) );
+			}
+			header->first_pointer_to_patch = (uint32_t)pos[0];
+		}
+
+		return error;
+	}
+
+private:
+	dl_serializer_writer( const dl_serializer_writer& );
+	dl_serializer_writer& operator=( const dl_serializer_writer& );
+};
+
+/*
+	Struct: dl_serializer_patcher
+		Patches offsets in a packed instance to pointers, used by the generated patch-functions when an instance is
+		too big to use chained patching.
+*/
+struct dl_serializer_patcher
+{
+	uintptr_t         patch_distance;
+	dl_error_t        error;
+	dl_serializer_map patched;
+
+	explicit dl_serializer_patcher( uintptr_t distance ) : patch_distance( distance ), error( DL_ERROR_OK ) {}
+
+	uintptr_t patch( unsigned char* ptr_data )
+	{
+		uintptr_t value = dl_serializer_read_ptr( ptr_data );
+		if( value != 0 )
+		{
+			value += patch_distance;
+			memcpy( ptr_data, &value, sizeof( uintptr_t ) );
+		}
+		return value;
+	}
+
+	// ... returns pointed to instance if it is not already patched ...
+	unsigned char* patch_ptr( unsigned char* ptr_data )
+	{
+		unsigned char* ptr = (unsigned char*)patch( ptr_data );
+		if( ptr == 0x0 || patched.find( ptr, (size_t)-1 ) )
+			return 0x0;
+		if( !patched.insert( ptr, (size_t)-1, 1 ) )
+		{
+			error = DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+			return 0x0;
+		}
+		return ptr;
+	}
+};
+
+/*
+	Struct: dl_serializer_swapper
+		Swaps endianness of a packed instance in place, used by the generated swap-functions.
+*/
+struct dl_serializer_swapper
+{
+	unsigned char*    base;
+	size_t            size;
+	uintptr_t         offset_mask;
+	bool              from_host;
+	dl_error_t        error;
+	dl_serializer_map visited;
+
+	void swap_pod( unsigned char* p, size_t pod_size )
+	{
+		switch( pod_size )
+		{
+			case 2: { uint16_t v; memcpy( &v, p, 2 ); v = dl_serializer_swap16( v ); memcpy( p, &v, 2 ); } break;
+			case 4: { uint32_t v; memcpy( &v, p, 4 ); v = dl_serializer_swap32( v ); memcpy( p, &v, 4 ); } break;
+			case 8: { uint64_t v; memcpy( &v, p, 8 ); v = dl_serializer_swap64( v ); memcpy( p, &v, 8 ); } break;
+			default: break;
+		}
+	}
+
+	void swap_pods( unsigned char* p, size_t pod_size, size_t count )
+	{
+		if( pod_size > 1 )
+			for( size_t i = 0; i < count; ++i )
+				swap_pod( p + i * pod_size, pod_size );
+	}
+
+	// ... swap an uint32 and return its value in host endian ...
+	uint32_t swap_uint32( unsigned char* p )
+	{
+		uint32_t v;
+		memcpy( &v, p, 4 );
+		uint32_t swapped = dl_serializer_swap32( v );
+		memcpy( p, &swapped, 4 );
+		return from_host ? v : swapped;
+	}
+
+	// ... swap a pointer and return the offset stored in it ...
+	uintptr_t swap_ptr( unsigned char* p )
+	{
+		if( sizeof( void* ) == 8 )
+		{
+			uint64_t v;
+			memcpy( &v, p, 8 );
+			uint64_t swapped = dl_serializer_swap64( v );
+			memcpy( p, &swapped, 8 );
+			return (uintptr_t)( from_host ? v : swapped ) & offset_mask;
+		}
+		return (uintptr_t)swap_uint32( p ) & offset_mask;
+	}
+
+	// ... returns subdata at offset, 0x0 if null or out of bounds ...
+	unsigned char* subdata( uintptr_t offset, size_t bytes )
+	{
+		if( offset == 0 )
+			return 0x0;
+		if( offset > size || bytes > size - offset )
+		{
+			error = DL_ERROR_MALFORMED_DATA;
+			return 0x0;
+		}
+		return base + offset;
+	}
+
+	// ... returns instance pointed to if it was not already swapped ...
+	unsigned char* swap_ptr_instance( unsigned char* p, size_t instance_size )
+	{
+		uintptr_t offset = swap_ptr( p );
+		unsigned char* instance = subdata( offset, instance_size );
+		if( instance == 0x0 || visited.find( instance, (size_t)-1 ) )
+			return 0x0;
+		visited.insert( instance, (size_t)-1, 1 );
+		return instance;
+	}
+
+	// ... fields is pairs of bit-offset and bit-count of all bitfield-members sharing the same storage ...
+	void swap_bitfield( unsigned char* p, size_t storage_size, const uint16_t* fields, size_t field_count )
+	{
+		uint64_t v = 0;
+		switch( storage_size )
+		{
+			case 1: { uint8_t  t; memcpy( &t, p, 1 ); v = t; } break;
+			case 2: { uint16_t t; memcpy( &t, p, 2 ); v = from_host ? t : dl_serializer_swap16( t ); } break;
+			case 4: { uint32_t t; memcpy( &t, p, 4 ); v = from_host ? t : dl_serializer_swap32( t ); } break;
+			case 8: { uint64_t t; memcpy( &t, p, 8 ); v = from_host ? t : dl_serializer_swap64( t ); } break;
+			default: return;
+		}
+
+		// ... big endian allocates bitfields from the most significant bit ...
+		const uint32_t test = 1;
+		bool host_is_little = *(const unsigned char*)&test == 1;
+		bool src_is_little  = from_host == host_is_little;
+
+		uint64_t res = 0;
+		uint32_t storage_bits = (uint32_t)storage_size * 8;
+		for( size_t i = 0; i < field_count; ++i )
+		{
+			uint32_t offset = fields[i * 2];
+			uint32_t bits   = fields[i * 2 + 1];
+			uint32_t src_offset = src_is_little ? offset : storage_bits - offset - bits;
+			uint32_t tgt_offset = src_is_little ? storage_bits - offset - bits : offset;
+			uint64_t field_mask = bits == 64 ? ~(uint64_t)0 : ( ( (uint64_t)1 << bits ) - 1 );
+			res |= ( ( v >> src_offset ) & field_mask ) << tgt_offset;
+		}
+
+		switch( storage_size )
+		{
+			case 1: { uint8_t  t = (uint8_t)res;                                              memcpy( p, &t, 1 ); } break;
+			case 2: { uint16_t t = from_host ? dl_serializer_swap16( (uint16_t)res ) : (uint16_t)res; memcpy( p, &t, 2 ); } break;
+			case 4: { uint32_t t = from_host ? dl_serializer_swap32( (uint32_t)res ) : (uint32_t)res; memcpy( p, &t, 4 ); } break;
+			case 8: { uint64_t t = from_host ? dl_serializer_swap64( res ) : res;                     memcpy( p, &t, 8 ); } break;
+		}
+	}
+};
+
+template <typename T>
+inline void dl_serializer_store_ptr( dl_serializer_writer& w, size_t pos, const unsigned char* ptr_data )
+{
+	const unsigned char* ptr = (const unsigned char*)dl_serializer_read_ptr( ptr_data );
+	uintptr_t offset = 0;
+	if( ptr != 0x0 )
+	{
+		offset = w.written_ptrs.find( ptr, (size_t)-1 );
+		if( offset == 0 ) // ... has not been written yet ...
+		{
+			offset = w.reserve( dl_serializer_align_up( dl_serializer<T>::SIZE, dl_serializer<T>::ALIGNMENT ), dl_serializer<T>::ALIGNMENT );
+			if( !w.written_ptrs.insert( ptr, (size_t)-1, offset ) )
+				w.error = DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+			dl_serializer<T>::store( w, offset, ptr );
+		}
+		w.add_patch_pos( pos );
+	}
+	w.write_ptr( pos, offset );
+}
+
+template <typename T>
+inline void dl_serializer_store_struct_array( dl_serializer_writer& w, size_t pos, const unsigned char* array_data )
+{
+	uint32_t count = dl_serializer_read_count( array_data );
+	uintptr_t offset = 0;
+	if( count > 0 )
+	{
+		const size_t size = dl_serializer_align_up( dl_serializer<T>::SIZE, dl_serializer<T>::ALIGNMENT );
+		const unsigned char* elems = (const unsigned char*)dl_serializer_read_ptr( array_data );
+		offset = w.reserve( count * size, dl_serializer<T>::ALIGNMENT );
+		if( dl_serializer<T>::HAS_SUBDATA )
+		{
+			for( uint32_t i = 0; i < count; ++i )
+				dl_serializer<T>::store( w, offset + i * size, elems + i * size );
+		}
+		else
+			w.write( offset, elems, count * size );
+		w.add_patch_pos( pos );
+	}
+	w.write_ptr( pos, offset );
+	w.write( pos + sizeof( void* ), &count, sizeof( uint32_t ) );
+}
+
+template <typename T>
+inline void dl_serializer_store_ptr_array( dl_serializer_writer& w, size_t pos, const unsigned char* array_data )
+{
+	uint32_t count = dl_serializer_read_count( array_data );
+	uintptr_t offset = 0;
+	if( count > 0 )
+	{
+		const unsigned char* ptrs = (const unsigned char*)dl_serializer_read_ptr( array_data );
+		offset = w.reserve( count * sizeof( void* ), sizeof( void* ) );
+		for( uint32_t i = 0; i < count; ++i )
+			dl_serializer_store_ptr<T>( w, offset + i * sizeof( void* ), ptrs + i * sizeof( void* ) );
+		w.add_patch_pos( pos );
+	}
+	w.write_ptr( pos, offset );
+	w.write( pos + sizeof( void* ), &count, sizeof( uint32_t ) );
+}
+
+template <typename T>
+inline void dl_serializer_patch_ptr( dl_serializer_patcher& p, unsigned char* ptr_data )
+{
+	unsigned char* ptr = p.patch_ptr( ptr_data );
+	if( ptr != 0x0 )
+		dl_serializer<T>::patch( p, ptr );
+}
+
+template <typename T>
+inline void dl_serializer_swap_ptr( dl_serializer_swapper& s, unsigned char* ptr_data )
+{
+	unsigned char* ptr = s.swap_ptr_instance( ptr_data, dl_serializer<T>::SIZE );
+	if( ptr != 0x0 )
+		dl_serializer<T>::swap( s, ptr );
+}
+
+inline dl_error_t dl_serializer_check_header( const unsigned char* packed_instance, size_t packed_instance_size, dl_typeid_t type_id, size_t header_size, size_t type_size )
+{
+	const dl_serializer_data_header* header = (const dl_serializer_data_header*)packed_instance;
+	if( packed_instance_size < sizeof( dl_serializer_data_header ) )            return DL_ERROR_MALFORMED_DATA;
+	if( header->id == dl_serializer_swap32( DL_SERIALIZER_INSTANCE_ID ) )       return DL_ERROR_ENDIAN_MISMATCH;
+	if( header->id != DL_SERIALIZER_INSTANCE_ID )                               return DL_ERROR_MALFORMED_DATA;
+	if( header->version != DL_SERIALIZER_INSTANCE_VERSION )                     return DL_ERROR_VERSION_MISMATCH;
+	if( header->root_instance_type != type_id )                                 return DL_ERROR_TYPE_MISMATCH;
+
+	// ... the instance is patched relative to instance_size so it need to be within the packed instance ...
+	if( packed_instance_size < header_size ||
+		header->instance_size > packed_instance_size - header_size ||
+		header->instance_size < type_size )                                     return DL_ERROR_MALFORMED_DATA;
+	return DL_ERROR_OK;
+}
+
+inline dl_error_t dl_serializer_patch_chain( const dl_serializer_data_header* header, unsigned char* instance, size_t header_size )
+{
+	uintptr_t offset_shift = sizeof( uintptr_t ) * 4;
+	uintptr_t offset_mask  = ( (uintptr_t)1 << offset_shift ) - 1;
+	unsigned char* base_ptr  = instance - header_size;
+	unsigned char* patch_mem = base_ptr;
+	uintptr_t offset_to_pointer = header->first_pointer_to_patch; // 0 is the patch terminator
+	while( offset_to_pointer != 0 )
+	{
+		patch_mem += offset_to_pointer;
+		if( patch_mem > instance + header->instance_size )
+			return DL_ERROR_MALFORMED_DATA;
+		uintptr_t offsets = dl_serializer_read_ptr( patch_mem );
+		if( ( offsets & offset_mask ) > ( header->instance_size + header_size ) )
+			return DL_ERROR_MALFORMED_DATA;
+		offset_to_pointer = offsets >> offset_shift;
+		unsigned char* ptr = ( offsets & offset_mask ) + base_ptr;
+		memcpy( patch_mem, &ptr, sizeof( ptr ) );
+	}
+	return DL_ERROR_OK;
+}
+
+/*
+	Function: dl_serializer_store
+		Same as dl_instance_store() but using generated code for type T.
+*/
+template <typename T>
+inline dl_error_t dl_serializer_store( const T& instance, unsigned char* out_buffer, size_t out_buffer_size, size_t* produced_bytes )
+{
+	if( out_buffer_size > 0 && out_buffer_size <= sizeof( dl_serializer_data_header ) )
+		return DL_ERROR_BUFFER_TOO_SMALL;
+
+	const size_t header_size = dl_serializer_align_up( sizeof( dl_serializer_data_header ), dl_serializer<T>::ALIGNMENT );
+	if( out_buffer_size > 0 )
+	{
+		if( (const unsigned char*)&instance == out_buffer + header_size )
+			memset( out_buffer, 0x0, header_size );
+		else
+			memset( out_buffer, 0x0, out_buffer_size );
+	}
+
+	dl_serializer_writer w( out_buffer, out_buffer_size );
+	w.end = header_size + dl_serializer<T>::SIZE;
+	if( !w.written_ptrs.insert( &instance, (size_t)-1, header_size ) ) // ... pointers to the root-instance ...
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+
+	dl_serializer<T>::store( w, header_size, (const unsigned char*)&instance );
+	return w.finish( dl_serializer<T>::TYPE_ID, header_size, produced_bytes );
+}
+
+/*
+	Function: dl_serializer_calc_size
+		Same as dl_instance_calc_size() but using generated code for type T.
+*/
+template <typename T>
+inline dl_error_t dl_serializer_calc_size( const T& instance, size_t* out_size )
+{
+	return dl_serializer_store( instance, 0x0, 0, out_size );
+}
+
+/*
+	Function: dl_serializer_load_inplace
+		Same as dl_instance_load_inplace() but using generated code for type T.
+*/
+template <typename T>
+inline dl_error_t dl_serializer_load_inplace( unsigned char* packed_instance, size_t packed_instance_size, T** loaded_instance, size_t* consumed )
+{
+	const size_t header_size = dl_serializer_align_up( sizeof( dl_serializer_data_header ), dl_serializer<T>::ALIGNMENT );
+	dl_error_t err = dl_serializer_check_header( packed_instance, packed_instance_size, dl_serializer<T>::TYPE_ID, header_size, dl_serializer<T>::SIZE );
+	if( err != DL_ERROR_OK )
+		return err;
+
+	const dl_serializer_data_header* header = (const dl_serializer_data_header*)packed_instance;
+	unsigned char* instance = packed_instance + header_size;
+	*loaded_instance = (T*)instance;
+
+	if( consumed )
+		*consumed = header->instance_size + header_size;
+
+	if( !header->not_using_ptr_chain_patching )
+		return dl_serializer_patch_chain( header, instance, header_size );
+
+	dl_serializer_patcher p( (uintptr_t)packed_instance );
+	if( !p.patched.insert( instance, (size_t)-1, 1 ) )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	dl_serializer<T>::patch( p, instance );
+	return p.error;
+}
+
+/*
+	Function: dl_serializer_load
+		Same as dl_instance_load() but using generated code for type T.
+*/
+template <typename T>
+inline dl_error_t dl_serializer_load( T* instance, size_t instance_size, const unsigned char* packed_instance, size_t packed_instance_size, size_t* consumed )
+{
+	const size_t header_size = dl_serializer_align_up( sizeof( dl_serializer_data_header ), dl_serializer<T>::ALIGNMENT );
+	dl_error_t err = dl_serializer_check_header( packed_instance, packed_instance_size, dl_serializer<T>::TYPE_ID, header_size, dl_serializer<T>::SIZE );
+	if( err != DL_ERROR_OK )
+		return err;
+
+	const dl_serializer_data_header* header = (const dl_serializer_data_header*)packed_instance;
+	if( header->instance_size > instance_size )
+		return DL_ERROR_BUFFER_TOO_SMALL;
+
+	memcpy( instance, packed_instance + header_size, header->instance_size );
+
+	if( consumed )
+		*consumed = header->instance_size + header_size;
+
+	if( !header->not_using_ptr_chain_patching )
+		return dl_serializer_patch_chain( header, (unsigned char*)instance, header_size );
+
+	dl_serializer_patcher p( (uintptr_t)instance - header_size );
+	if( !p.patched.insert( instance, (size_t)-1, 1 ) )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	dl_serializer<T>::patch( p, (unsigned char*)instance );
+	return p.error;
+}
+
+/*
+	Function: dl_serializer_swap_endian
+		Swap endianness of a packed instance of type T in place, from host endian to the other endian or back.
+		Only instances packed with the pointer-size of the host is supported, use dl_convert() for anything else.
+*/
+template <typename T>
+inline dl_error_t dl_serializer_swap_endian( unsigned char* packed_instance, size_t packed_instance_size )
+{
+	dl_serializer_data_header* header = (dl_serializer_data_header*)packed_instance;
+	if( packed_instance_size < sizeof( dl_serializer_data_header ) )
+		return DL_ERROR_MALFORMED_DATA;
+
+	dl_serializer_swapper s;
+	s.base  = packed_instance;
+	s.size  = packed_instance_size;
+	s.error = DL_ERROR_OK;
+	if( header->id == DL_SERIALIZER_INSTANCE_ID )
+		s.from_host = true;
+	else if( header->id == dl_serializer_swap32( DL_SERIALIZER_INSTANCE_ID ) )
+		s.from_host = false;
+	else
+		return DL_ERROR_MALFORMED_DATA;
+
+	uint32_t version = s.from_host ? header->version            : dl_serializer_swap32( header->version );
+	dl_typeid_t root = s.from_host ? header->root_instance_type : dl_serializer_swap32( header->root_instance_type );
+	if( version != DL_SERIALIZER_INSTANCE_VERSION )             return DL_ERROR_VERSION_MISMATCH;
+	if( root != dl_serializer<T>::TYPE_ID )                     return DL_ERROR_TYPE_MISMATCH;
+	if( header->is_64_bit_ptr != ( sizeof( void* ) == 8 ? 1 : 0 ) ) return DL_ERROR_UNSUPPORTED_OPERATION;
+
+	const size_t header_size = dl_serializer_align_up( sizeof( dl_serializer_data_header ), dl_serializer<T>::ALIGNMENT );
+	if( packed_instance_size < header_size + dl_serializer<T>::SIZE )
+		return DL_ERROR_MALFORMED_DATA;
+
+	s.offset_mask = header->not_using_ptr_chain_patching ? ~(uintptr_t)0 : ( ( (uintptr_t)1 << ( sizeof( uintptr_t ) * 4 ) ) - 1 );
+
+	header->id                     = dl_serializer_swap32( header->id );
+	header->version                = dl_serializer_swap32( header->version );
+	header->root_instance_type     = dl_serializer_swap32( header->root_instance_type );
+	header->instance_size          = dl_serializer_swap32( header->instance_size );
+	header->first_pointer_to_patch = dl_serializer_swap32( header->first_pointer_to_patch );
+
+	unsigned char* instance = packed_instance + header_size;
+	s.visited.insert( instance, (size_t)-1, 1 );
+	dl_serializer<T>::swap( s, instance );
+	return s.error;
+}
+
+#endif // DL_DL_SERIALIZER_H_INCLUDED
@@ -33,6 +33,54 @@ extern "C" {
  */
 dl_error_t DL_DLL_EXPORT dl_context_load_txt_type_library( dl_ctx_t dl_ctx, const char* lib_data, size_t lib_data_size );
 
+/*
+	Function: dl_context_replace_type_library
+		Replace all types and enums of a previously loaded module with the ones in a new type-library, or load
+		it under that module-name if no module with that name is loaded.
+
+		A txt-typelib get its module-name from its "module"-key, binary type-libraries do not store a module-name
+		so to be able to replace or unload one it has to be loaded with this function.
+
+		Only types that reference the replaced types are re-resolved. If any of them can't find its type anymore,
+		or store the type inline and the size or alignment of it changed, the replace fails and dl_ctx is left
+		exactly as it was before the call.
+
+		Each successful replace/unload bumps the generation reported by dl_reflect_context_info so that
+		users can detect that cached type-information is stale. Instances packed with the old types need
+		to be converted by the user.
+
+	Parameters:
+		dl_ctx        - dl-context to replace typelib in.
+		module        - module-name of type-library to replace.
+		lib_data      - pointer to binary-data with type-library.
+		lib_data_size - size of lib_data.
+
+	Note:
+		This function do not have the same rules of memory allocation and might allocate memory behind the scenes.
+ */
+dl_error_t DL_DLL_EXPORT dl_context_replace_type_library( dl_ctx_t dl_ctx, const char* module, const unsigned char* lib_data, size_t lib_data_size );
+
+/*
+	Function: dl_context_replace_txt_type_library
+		Same as dl_context_replace_type_library but with a type-library in text representation.
+ */
+dl_error_t DL_DLL_EXPORT dl_context_replace_txt_type_library( dl_ctx_t dl_ctx, const char* module, const char* lib_data, size_t lib_data_size );
+
+/*
+	Function: dl_context_unload_type_library
+		Unload all types and enums of a previously loaded module. Fails and leave dl_ctx untouched if any type
+		left in dl_ctx reference a type in the module.
+
+	Parameters:
+		dl_ctx - dl-context to unload typelib from.
+		module - module-name of type-library to unload.
+
+	Return:
+		DL_ERROR_OK on success, DL_ERROR_INVALID_PARAMETER if no module named module is loaded and
+		DL_ERROR_TYPE_NOT_FOUND if another type depend on the module.
+ */
+dl_error_t DL_DLL_EXPORT dl_context_unload_type_library( dl_ctx_t dl_ctx, const char* module );
+
 /*
 	Function: dl_context_write_type_library
 		Write all types loaded in dl_ctx to a dl-typelibrary.
@@ -97,6 +145,31 @@ dl_error_t DL_DLL_EXPORT dl_context_write_txt_type_library( dl_ctx_t dl_ctx, cha
 */
 dl_error_t DL_DLL_EXPORT dl_context_write_type_library_c_header( dl_ctx_t dl_ctx, const char* module_name, char* out_header, size_t out_header_size, size_t* produced_bytes );
 
+/*
+	Function: dl_context_write_type_library_cpp_serializers
+		Write c++ serializers for all types loaded in dl_ctx to a header. The header is to be included after the
+		c-header written by dl_context_write_type_library_c_header for the same types and specialize
+		dl_serializer<T> for all of them, see dl/dl_serializer.h.
+
+		The serializers store, load and endian-swap instances with offsets and sizes known at compile-time and
+		produce exactly the same data as dl_instance_store.
+
+	Parameters:
+		dl_ctx          - dl-context to write serializers for.
+		module_name     - name of generated module.
+		out_header      - buffer to write header to.
+		out_header_size - size of out_header.
+		produced_bytes  - number of bytes that would have been written to out_header if it was large enough.
+
+	Return:
+		DL_ERROR_OK on success, DL_ERROR_UNSUPPORTED_OPERATION if a type has too many members to generate a
+		serializer for.
+
+	Note:
+		This function do not have the same rules of memory allocation and might allocate memory behind the scenes.
+*/
+dl_error_t DL_DLL_EXPORT dl_context_write_type_library_cpp_serializers( dl_ctx_t dl_ctx, const char* module_name, char* out_header, size_t out_header_size, size_t* produced_bytes );
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -0,0 +1,124 @@
+/* Auto generated c++ serializers for dl type library */
+#ifndef __DL_AUTOGEN_SERIALIZERS_DLBENCH_SERIALIZERS_H_INCLUDED
+#define __DL_AUTOGEN_SERIALIZERS_DLBENCH_SERIALIZERS_H_INCLUDED
+
+// ... include after the header generated for the same type library with dl_context_write_type_library_c_header() ...
+#include <dl/dl_serializer.h>
+
+template <>
+struct dl_serializer<fp32_array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xC7082619;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<fp32_array_array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x83115657;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<str_array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x7FFC8EB7;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+inline void dl_serializer<fp32_array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<fp32_array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<fp32_array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 4 );
+        if( a != 0x0 )
+            s.swap_pods( a, 4, count );
+    }
+}
+
+inline void dl_serializer<fp32_array_array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<fp32_array>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<fp32_array_array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            dl_serializer<fp32_array>::patch( p, a + i * dl_serializer_align_up( dl_serializer<fp32_array>::SIZE, dl_serializer<fp32_array>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<fp32_array_array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<fp32_array>::SIZE, dl_serializer<fp32_array>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<fp32_array>::swap( s, a + i * dl_serializer_align_up( dl_serializer<fp32_array>::SIZE, dl_serializer<fp32_array>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<str_array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_str_array( pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<str_array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            p.patch( a + i * sizeof( char* ) );
+    }
+}
+
+inline void dl_serializer<str_array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * sizeof( void* ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                s.swap_ptr( a + i * sizeof( char* ) );
+    }
+}
+
+#endif // __DL_AUTOGEN_SERIALIZERS_DLBENCH_SERIALIZERS_H_INCLUDED
+
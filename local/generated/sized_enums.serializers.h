@@ -0,0 +1,180 @@
+/* Auto generated c++ serializers for dl type library */
+#ifndef __DL_AUTOGEN_SERIALIZERS_SIZED_ENUMS_SERIALIZERS_H_INCLUDED
+#define __DL_AUTOGEN_SERIALIZERS_SIZED_ENUMS_SERIALIZERS_H_INCLUDED
+
+// ... include after the header generated for the same type library with dl_context_write_type_library_c_header() ...
+#include <dl/dl_serializer.h>
+
+template <>
+struct dl_serializer<sized_enums>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x2C6748C6;
+    static constexpr const size_t      SIZE        = 32;
+    static constexpr const size_t      ALIGNMENT   = 8;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<sized_enums_inl_array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xB10A6306;
+    static constexpr const size_t      SIZE        = 112;
+    static constexpr const size_t      ALIGNMENT   = 8;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<sized_enums_array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x74DD06C4;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 64, 128 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+inline void dl_serializer<sized_enums>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 1 );
+    w.write( pos + 2, inst + 2, 15 );
+    w.write( pos + 18, inst + 18, 14 );
+}
+
+inline void dl_serializer<sized_enums>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<sized_enums>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 2, 2 );
+    s.swap_pod( inst + 4, 4 );
+    s.swap_pod( inst + 8, 8 );
+    s.swap_pod( inst + 18, 2 );
+    s.swap_pod( inst + 20, 4 );
+    s.swap_pod( inst + 24, 8 );
+}
+
+inline void dl_serializer<sized_enums_inl_array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 28 );
+    w.write( pos + 32, inst + 32, 35 );
+    w.write( pos + 68, inst + 68, 6 );
+    w.write( pos + 76, inst + 76, 36 );
+}
+
+inline void dl_serializer<sized_enums_inl_array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<sized_enums_inl_array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pods( inst + 4, 2, 4 );
+    s.swap_pods( inst + 12, 4, 4 );
+    s.swap_pods( inst + 32, 8, 4 );
+    s.swap_pods( inst + 68, 2, 3 );
+    s.swap_pods( inst + 76, 4, 3 );
+    s.swap_pods( inst + 88, 8, 3 );
+}
+
+inline void dl_serializer<sized_enums_array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 1 );
+    w.store_pod_array( pos + DL_SERIALIZER_PTR_SEL( 8, 16 ), inst + DL_SERIALIZER_PTR_SEL( 8, 16 ), 2 );
+    w.store_pod_array( pos + DL_SERIALIZER_PTR_SEL( 16, 32 ), inst + DL_SERIALIZER_PTR_SEL( 16, 32 ), 4 );
+    w.store_pod_array( pos + DL_SERIALIZER_PTR_SEL( 24, 48 ), inst + DL_SERIALIZER_PTR_SEL( 24, 48 ), 8 );
+    w.store_pod_array( pos + DL_SERIALIZER_PTR_SEL( 32, 64 ), inst + DL_SERIALIZER_PTR_SEL( 32, 64 ), 1 );
+    w.store_pod_array( pos + DL_SERIALIZER_PTR_SEL( 40, 80 ), inst + DL_SERIALIZER_PTR_SEL( 40, 80 ), 2 );
+    w.store_pod_array( pos + DL_SERIALIZER_PTR_SEL( 48, 96 ), inst + DL_SERIALIZER_PTR_SEL( 48, 96 ), 4 );
+    w.store_pod_array( pos + DL_SERIALIZER_PTR_SEL( 56, 112 ), inst + DL_SERIALIZER_PTR_SEL( 56, 112 ), 8 );
+}
+
+inline void dl_serializer<sized_enums_array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+    p.patch( inst + DL_SERIALIZER_PTR_SEL( 8, 16 ) );
+    p.patch( inst + DL_SERIALIZER_PTR_SEL( 16, 32 ) );
+    p.patch( inst + DL_SERIALIZER_PTR_SEL( 24, 48 ) );
+    p.patch( inst + DL_SERIALIZER_PTR_SEL( 32, 64 ) );
+    p.patch( inst + DL_SERIALIZER_PTR_SEL( 40, 80 ) );
+    p.patch( inst + DL_SERIALIZER_PTR_SEL( 48, 96 ) );
+    p.patch( inst + DL_SERIALIZER_PTR_SEL( 56, 112 ) );
+}
+
+inline void dl_serializer<sized_enums_array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 1 );
+        if( a != 0x0 )
+            s.swap_pods( a, 1, count );
+    }
+    {
+        uintptr_t offset = s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 8, 16 ) );
+        size_t    count  = s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 8, 16 ) + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 2 );
+        if( a != 0x0 )
+            s.swap_pods( a, 2, count );
+    }
+    {
+        uintptr_t offset = s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 16, 32 ) );
+        size_t    count  = s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 16, 32 ) + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 4 );
+        if( a != 0x0 )
+            s.swap_pods( a, 4, count );
+    }
+    {
+        uintptr_t offset = s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 24, 48 ) );
+        size_t    count  = s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 24, 48 ) + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 8 );
+        if( a != 0x0 )
+            s.swap_pods( a, 8, count );
+    }
+    {
+        uintptr_t offset = s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 32, 64 ) );
+        size_t    count  = s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 32, 64 ) + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 1 );
+        if( a != 0x0 )
+            s.swap_pods( a, 1, count );
+    }
+    {
+        uintptr_t offset = s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 40, 80 ) );
+        size_t    count  = s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 40, 80 ) + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 2 );
+        if( a != 0x0 )
+            s.swap_pods( a, 2, count );
+    }
+    {
+        uintptr_t offset = s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 48, 96 ) );
+        size_t    count  = s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 48, 96 ) + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 4 );
+        if( a != 0x0 )
+            s.swap_pods( a, 4, count );
+    }
+    {
+        uintptr_t offset = s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 56, 112 ) );
+        size_t    count  = s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 56, 112 ) + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 8 );
+        if( a != 0x0 )
+            s.swap_pods( a, 8, count );
+    }
+}
+
+#endif // __DL_AUTOGEN_SERIALIZERS_SIZED_ENUMS_SERIALIZERS_H_INCLUDED
+
@@ -0,0 +1,163 @@
+0x7b, 0x0a, 0x09, 0x22, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73,
+0x69, 0x7a, 0x65, 0x64, 0x5f, 0x65, 0x6e, 0x75, 0x6d, 0x73, 0x22, 0x2c, 0x0a, 0x0a, 0x09, 0x22,
+0x65, 0x6e, 0x75, 0x6d, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x22, 0x65, 0x6e,
+0x75, 0x6d, 0x5f, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x2c, 0x20,
+0x20, 0x20, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22,
+0x69, 0x6e, 0x74, 0x38, 0x5f, 0x31, 0x22, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x32, 0x2c, 0x20, 0x22,
+0x69, 0x6e, 0x74, 0x38, 0x5f, 0x6e, 0x65, 0x67, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x2d, 0x31, 0x2c,
+0x20, 0x22, 0x69, 0x6e, 0x74, 0x38, 0x5f, 0x6d, 0x69, 0x6e, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x2d,
+0x31, 0x32, 0x38, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x38, 0x5f, 0x6d, 0x61, 0x78, 0x22, 0x20,
+0x20, 0x3a, 0x20, 0x31, 0x32, 0x37, 0x20, 0x7d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x65,
+0x6e, 0x75, 0x6d, 0x5f, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x22,
+0x2c, 0x20, 0x20, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20,
+0x22, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x31, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x33, 0x2c, 0x20,
+0x22, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x6e, 0x65, 0x67, 0x22, 0x20, 0x3a, 0x20, 0x2d, 0x31,
+0x2c, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x6d, 0x69, 0x6e, 0x22, 0x20, 0x3a, 0x20,
+0x2d, 0x33, 0x32, 0x37, 0x36, 0x38, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5f, 0x6d, 0x61, 0x78,
+0x22, 0x20, 0x3a, 0x20, 0x33, 0x32, 0x37, 0x36, 0x37, 0x20, 0x7d, 0x20, 0x7d, 0x2c, 0x0a, 0x09,
+0x09, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x20, 0x20, 0x3a,
+0x20, 0x7b, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74,
+0x33, 0x32, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x20, 0x3a,
+0x20, 0x7b, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x31, 0x22, 0x20, 0x20, 0x3a, 0x20,
+0x34, 0x2c, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x6e, 0x65, 0x67, 0x22, 0x20, 0x3a,
+0x20, 0x2d, 0x31, 0x2c, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x6d, 0x69, 0x6e, 0x22,
+0x20, 0x3a, 0x20, 0x2d, 0x32, 0x31, 0x34, 0x37, 0x34, 0x38, 0x33, 0x36, 0x34, 0x38, 0x2c, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f,
+0x6d, 0x61, 0x78, 0x22, 0x20, 0x3a, 0x20, 0x32, 0x31, 0x34, 0x37, 0x34, 0x38, 0x33, 0x36, 0x34,
+0x37, 0x20, 0x7d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x69,
+0x6e, 0x74, 0x36, 0x34, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x36,
+0x34, 0x5f, 0x31, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x35, 0x2c, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x36,
+0x34, 0x5f, 0x6e, 0x65, 0x67, 0x22, 0x20, 0x3a, 0x20, 0x2d, 0x31, 0x2c, 0x20, 0x22, 0x69, 0x6e,
+0x74, 0x36, 0x34, 0x5f, 0x6d, 0x69, 0x6e, 0x22, 0x20, 0x3a, 0x20, 0x2d, 0x39, 0x32, 0x32, 0x33,
+0x33, 0x37, 0x32, 0x30, 0x33, 0x36, 0x38, 0x35, 0x34, 0x37, 0x37, 0x35, 0x38, 0x30, 0x38, 0x2c,
+0x20, 0x22, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x6d, 0x61, 0x78, 0x22, 0x20, 0x3a, 0x20, 0x39,
+0x32, 0x32, 0x33, 0x33, 0x37, 0x32, 0x30, 0x33, 0x36, 0x38, 0x35, 0x34, 0x37, 0x37, 0x35, 0x38,
+0x30, 0x37, 0x20, 0x7d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x2c, 0x20, 0x20, 0x22,
+0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x75, 0x69, 0x6e,
+0x74, 0x38, 0x5f, 0x31, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x36, 0x2c, 0x20, 0x22, 0x75, 0x69, 0x6e,
+0x74, 0x38, 0x5f, 0x6d, 0x69, 0x6e, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x30, 0x2c, 0x20, 0x22, 0x75,
+0x69, 0x6e, 0x74, 0x38, 0x5f, 0x6d, 0x61, 0x78, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x30, 0x78, 0x46,
+0x46, 0x20, 0x7d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x75,
+0x69, 0x6e, 0x74, 0x31, 0x36, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x31, 0x36, 0x5f, 0x31, 0x22, 0x20, 0x3a, 0x20, 0x37, 0x2c, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x31, 0x36, 0x5f, 0x6d, 0x69, 0x6e, 0x22, 0x20, 0x3a, 0x20, 0x30, 0x2c, 0x20, 0x22, 0x75, 0x69,
+0x6e, 0x74, 0x31, 0x36, 0x5f, 0x6d, 0x61, 0x78, 0x22, 0x20, 0x3a, 0x20, 0x30, 0x78, 0x46, 0x46,
+0x46, 0x46, 0x20, 0x7d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f,
+0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x22,
+0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x75, 0x69, 0x6e,
+0x74, 0x33, 0x32, 0x5f, 0x31, 0x22, 0x20, 0x3a, 0x20, 0x38, 0x2c, 0x20, 0x22, 0x75, 0x69, 0x6e,
+0x74, 0x33, 0x32, 0x5f, 0x6d, 0x69, 0x6e, 0x22, 0x20, 0x3a, 0x20, 0x30, 0x2c, 0x20, 0x22, 0x75,
+0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x6d, 0x61, 0x78, 0x22, 0x20, 0x3a, 0x20, 0x30, 0x78, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x20, 0x7d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22,
+0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x22, 0x20, 0x3a, 0x20, 0x7b,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x36,
+0x34, 0x22, 0x2c, 0x20, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b,
+0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x31, 0x22, 0x20, 0x3a, 0x20, 0x39, 0x2c,
+0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x6d, 0x69, 0x6e, 0x22, 0x20, 0x3a, 0x20,
+0x30, 0x2c, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x6d, 0x61, 0x78, 0x22, 0x20,
+0x3a, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+0x46, 0x46, 0x46, 0x46, 0x20, 0x7d, 0x20, 0x7d, 0x0a, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x0a, 0x09,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x22, 0x73,
+0x69, 0x7a, 0x65, 0x64, 0x5f, 0x65, 0x6e, 0x75, 0x6d, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a,
+0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b,
+0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x69, 0x6e, 0x74, 0x38, 0x22,
+0x20, 0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x22, 0x2c, 0x20,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f,
+0x69, 0x6e, 0x74, 0x31, 0x36, 0x22, 0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b,
+0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x5f, 0x69, 0x6e, 0x74,
+0x33, 0x32, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x20, 0x20, 0x7d, 0x2c, 0x0a,
+0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x65, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x22,
+0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x2c, 0x20, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x75,
+0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x5f, 0x75, 0x69, 0x6e, 0x74,
+0x31, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65,
+0x6e, 0x75, 0x6d, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09,
+0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65,
+0x5f, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22,
+0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x65, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x22, 0x2c, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x75, 0x69,
+0x6e, 0x74, 0x36, 0x34, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x22, 0x73, 0x69, 0x7a, 0x65, 0x64, 0x5f, 0x65, 0x6e, 0x75, 0x6d, 0x73,
+0x5f, 0x69, 0x6e, 0x6c, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a,
+0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b,
+0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x69, 0x6e, 0x74, 0x38, 0x5b,
+0x34, 0x5d, 0x22, 0x20, 0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x31, 0x36,
+0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e,
+0x75, 0x6d, 0x5f, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5b, 0x34, 0x5d, 0x22, 0x20, 0x20, 0x7d, 0x2c,
+0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x69, 0x6e, 0x74, 0x33, 0x32,
+0x5b, 0x34, 0x5d, 0x22, 0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34,
+0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e,
+0x75, 0x6d, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5b, 0x34, 0x5d, 0x22, 0x20, 0x20, 0x7d, 0x2c,
+0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x65, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x38,
+0x5b, 0x33, 0x5d, 0x22, 0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x31,
+0x36, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e,
+0x75, 0x6d, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5b, 0x33, 0x5d, 0x22, 0x20, 0x7d, 0x2c,
+0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x65, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x5b, 0x33, 0x5d, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x36,
+0x34, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e,
+0x75, 0x6d, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5b, 0x33, 0x5d, 0x22, 0x20, 0x7d, 0x0a,
+0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x73, 0x69, 0x7a,
+0x65, 0x64, 0x5f, 0x65, 0x6e, 0x75, 0x6d, 0x73, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20,
+0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22,
+0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x2c, 0x20, 0x20, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x69,
+0x6e, 0x74, 0x38, 0x5b, 0x5d, 0x22, 0x20, 0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09,
+0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x5f, 0x69, 0x6e,
+0x74, 0x31, 0x36, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5b, 0x5d, 0x22, 0x20, 0x20,
+0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x69, 0x6e, 0x74,
+0x33, 0x32, 0x5b, 0x5d, 0x22, 0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x36,
+0x34, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65,
+0x6e, 0x75, 0x6d, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5b, 0x5d, 0x22, 0x20, 0x20, 0x7d, 0x2c,
+0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x65, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x38,
+0x5b, 0x5d, 0x22, 0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36,
+0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75,
+0x6d, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09,
+0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65,
+0x5f, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5b,
+0x5d, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x5f,
+0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d,
+0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x7d, 0x0a
\ No newline at end of file
@@ -0,0 +1,38 @@
+/* Auto generated c++ serializers for dl type library */
+#ifndef __DL_AUTOGEN_SERIALIZERS_SMALL_SERIALIZERS_H_INCLUDED
+#define __DL_AUTOGEN_SERIALIZERS_SMALL_SERIALIZERS_H_INCLUDED
+
+// ... include after the header generated for the same type library with dl_context_write_type_library_c_header() ...
+#include <dl/dl_serializer.h>
+
+template <>
+struct dl_serializer<single_int>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x4DB5F3EC;
+    static constexpr const size_t      SIZE        = 4;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+inline void dl_serializer<single_int>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<single_int>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<single_int>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+}
+
+#endif // __DL_AUTOGEN_SERIALIZERS_SMALL_SERIALIZERS_H_INCLUDED
+
@@ -0,0 +1,15 @@
+0x7b, 0x0a, 0x09, 0x22, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73,
+0x6d, 0x61, 0x6c, 0x6c, 0x22, 0x2c, 0x0a, 0x0a, 0x09, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x73, 0x22,
+0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x22, 0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x5f, 0x65,
+0x6e, 0x75, 0x6d, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x76, 0x61, 0x6c,
+0x75, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x22, 0x53, 0x49,
+0x4d, 0x50, 0x4c, 0x45, 0x5f, 0x56, 0x41, 0x4c, 0x31, 0x22, 0x20, 0x3a, 0x20, 0x30, 0x2c, 0x0a,
+0x09, 0x09, 0x09, 0x09, 0x22, 0x53, 0x49, 0x4d, 0x50, 0x4c, 0x45, 0x5f, 0x56, 0x41, 0x4c, 0x32,
+0x22, 0x20, 0x3a, 0x20, 0x31, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09,
+0x7d, 0x2c, 0x0a, 0x09, 0x0a, 0x09, 0x22, 0x74, 0x79, 0x70, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20,
+0x7b, 0x0a, 0x09, 0x09, 0x22, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x22,
+0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a,
+0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d,
+0x65, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x0a,
+0x09, 0x7d, 0x0a, 0x7d, 0x0a
\ No newline at end of file
@@ -0,0 +1,1559 @@
+/* Auto generated header for dl type library */
+#ifndef __DL_AUTOGEN_HEADER_UNITTEST_H_INCLUDED
+#define __DL_AUTOGEN_HEADER_UNITTEST_H_INCLUDED
+
+#include <stdint.h>
+
+#include <stddef.h> // for size_t and offsetof
+
+#ifndef __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+#define __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+
+#  if !defined(__cplusplus)
+#    define DL_SIZED_ENUM_SUPPORTED 0
+#  else
+#    if defined(_MSC_VER)
+#      if _MSC_VER < 1900
+#        define DL_SIZED_ENUM_SUPPORTED 0
+#      else
+#        define DL_SIZED_ENUM_SUPPORTED 0
+#      endif
+#    else
+       // this would need more work but it is good enough for now
+#      define DL_SIZED_ENUM_SUPPORTED 1
+#    endif
+#  endif
+
+   /// ... DL_C_STRUCT ...
+   /// The macro DL_C_STRUCT is used on external types to add struct in c
+   /// where it is needed. In c++ this is skipped as it is not needed and
+   /// could be something else such as a class or typedef.
+#  if defined(__cplusplus)
+#    define DL_C_STRUCT
+#  else
+#    define DL_C_STRUCT struct
+#  endif
+
+   /// ... DL_C_ENUM ...
+   /// Same concept as DL_C_STRUCT
+#  if defined(__cplusplus)
+#    define DL_C_ENUM
+#  else
+#    define DL_C_ENUM enum
+#  endif
+
+   /// ... DL_ALIGN() ...
+#  if defined(_MSC_VER)
+#    define DL_ALIGN(x) __declspec(align(x))
+#  elif defined(__GNUC__)
+#    define DL_ALIGN(x) __attribute__((aligned(x)))
+#  else
+#    error "Unsupported compiler"
+#  endif
+
+   /// ... DL_ALIGNOF() ...
+#  if defined(__clang__)
+#    if __has_feature(cxx_alignof)
+#      define DL_ALIGNOF(type) alignof(type)
+#    elif __has_feature(c_alignof)
+#      define DL_ALIGNOF(type) _Alignof(type)
+#    endif
+#  elif defined(__GNUC__)
+#    define DL_ALIGNOF(type) __alignof__(type)
+#  endif
+#  if defined(_MSC_VER )
+#    define DL_ALIGNOF(type) __alignof(type)
+#  endif
+
+#  ifndef DL_ALIGNOF
+#    define DL_ALIGNOF(type) ((sizeof(type) > 1)? offsetof(struct { char c; type x; }, x) : 1)
+#  endif
+
+   // ... DL_STATIC_ASSERT() ...
+   // ... clang ...
+#  if defined( __clang__ )
+#    if defined( __cplusplus ) && __has_feature(cxx_static_assert)
+#      define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+#    elif __has_feature(c_static_assert)
+#      define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#    endif
+   // ... msvc ...
+#  elif defined( _MSC_VER ) && ( defined(_MSC_VER) && (_MSC_VER >= 1600) )
+#    define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+   // ... gcc ...
+#  elif defined( __cplusplus )
+#    if __cplusplus >= 201103L || ( defined(_MSC_VER) && (_MSC_VER >= 1600) )
+#      define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+#    endif
+#  elif defined( __STDC__ )
+#    if defined( __STDC_VERSION__ )
+#      if __STDC_VERSION__ >= 201112L
+#        define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#      else
+#        define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#      endif
+#    endif
+#  endif
+#  if !defined(DL_STATIC_ASSERT)
+#    define DL_STATIC_ASSERT(x,y) // default to non-implemented.
+#  endif
+
+   // ... DL_DATA_ASSERT() ...
+#  if !defined(DL_DATA_ASSERT)
+#    define DL_DATA_ASSERT(x) // default to non-implemented.
+#  endif
+
+   // ... DL_DECLARE_ARRAY ...
+#  if defined(__cplusplus)
+	  template <typename T>
+	  struct dl_array
+	  {
+		   inline const T& operator[](size_t i) const
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline T& operator[](size_t i)
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const T* begin() const
+		   {
+		       return data;
+		   }
+		   inline const T* end() const
+		   {
+		       return data + count;
+		   }
+		   inline T* begin()
+		   {
+		       return data;
+		   }
+		   inline T* end()
+		   {
+		       return data + count;
+		   }
+		   T* data;
+		   uint32_t count;
+	   };
+	   template <>
+	   struct dl_array<const char*> {
+		   inline const char*& operator[](size_t i) const
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const char*& operator[](size_t i)
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const char* const* begin() const
+		   {
+		       return data;
+		   }
+		   inline const char* const* end() const
+		   {
+		       return data + count;
+		   }
+		   inline const char** begin()
+		   {
+		       return data;
+		   }
+		   inline const char** end()
+		   {
+		       return data + count;
+		   }
+		   const char** data;
+		   uint32_t count;
+	   };
+#	 define DL_DECLARE_ARRAY(type) dl_array<type>
+#  else
+#	 define DL_DECLARE_ARRAY(type)  \
+       struct              \
+       {                   \
+           type* data;     \
+           uint32_t count; \
+       }
+#  endif
+#endif // __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+
+//----------------------------------------------
+//                   INCLUDES                   
+//----------------------------------------------
+
+#include <stdio.h>
+
+
+//----------------------------------------------
+//                   TYPEID:s                   
+//----------------------------------------------
+
+// ENUMS
+#define TestEnum1_TYPE_ID (0x090926C6)
+#define TestEnum2_TYPE_ID (0x090926C7)
+#define multi_alias_enum_TYPE_ID (0xE8F67F88)
+#define EnumWithMeta_TYPE_ID (0x3CFFC538)
+
+// TYPES
+#define unused_TYPE_ID (0x20D327B4)
+#define Pods_TYPE_ID (0x7C8ABE56)
+#define i8Array_TYPE_ID (0x1DDC04A0)
+#define i16Array_TYPE_ID (0xA168660F)
+#define i32Array_TYPE_ID (0x32083D0D)
+#define i64Array_TYPE_ID (0x1DA14492)
+#define u8Array_TYPE_ID (0xB996DDAC)
+#define u16Array_TYPE_ID (0xB47E609B)
+#define u32Array_TYPE_ID (0x451E3799)
+#define u64Array_TYPE_ID (0x30B73F1E)
+#define fp32Array_TYPE_ID (0x87D3563A)
+#define fp64Array_TYPE_ID (0x736C5DBF)
+#define strArray_TYPE_ID (0x8D6E2318)
+#define ptrArray_TYPE_ID (0xC8A8A475)
+#define enumArray_TYPE_ID (0x9CF74254)
+#define default_empty_type_TYPE_ID (0xD7315B34)
+#define type_with_meta_TYPE_ID (0xD92D32C3)
+#define test_union_simple_TYPE_ID (0x79CDAD31)
+#define MorePods_TYPE_ID (0xFD3E1AC9)
+#define Pods2_TYPE_ID (0x0DE529E8)
+#define Pod2InStruct_TYPE_ID (0x08ACCFF1)
+#define PodPtr_TYPE_ID (0xCA8C7B99)
+#define Pod2InStructInStruct_TYPE_ID (0xF540FDCD)
+#define WithInlineArray_TYPE_ID (0x1123239A)
+#define WithInlineStructArray_TYPE_ID (0xFFC53F7F)
+#define WithInlineStructStructArray_TYPE_ID (0x2027F324)
+#define SubString_TYPE_ID (0xF2663CC1)
+#define InlineArrayWithSubString_TYPE_ID (0xC858A21B)
+#define PodArray1_TYPE_ID (0x7B3938D3)
+#define PodArray2_TYPE_ID (0x7B3938D4)
+#define StructArray1_TYPE_ID (0x8DE7A1F5)
+#define StructArrayRecursive1_TYPE_ID (0xAFD72DAD)
+#define StructArrayRecursive2_TYPE_ID (0xAFD72DAE)
+#define Strings_TYPE_ID (0x0FC202CA)
+#define StringInlineArray_TYPE_ID (0x3F4DBE15)
+#define StringArray_TYPE_ID (0xCC4EFE36)
+#define TestBits_TYPE_ID (0x74A160D2)
+#define MoreBits_TYPE_ID (0xFD365605)
+#define BitBitfield64_TYPE_ID (0xECE9CECC)
+#define SimplePtr_TYPE_ID (0x711E2A40)
+#define PtrChain_TYPE_ID (0x408C7639)
+#define DoublePtrChain_TYPE_ID (0x0EC87334)
+#define inline_ptr_array_TYPE_ID (0xCBD895B2)
+#define ptr_array_TYPE_ID (0x22873BB4)
+#define ptr_inline_array_TYPE_ID (0x8D27ED12)
+#define ptr_inline_array2_TYPE_ID (0x32283024)
+#define inline_array_pod_ptr_TYPE_ID (0xF0DF7E14)
+#define ptr_struct_inline_array_ptr_TYPE_ID (0x1EEB190B)
+#define A128BitAlignedType_TYPE_ID (0x77B2BAF1)
+#define TestingEnum_TYPE_ID (0x42659D73)
+#define InlineArrayEnum_TYPE_ID (0x0F58DEB3)
+#define ArrayEnum_TYPE_ID (0xED6EB494)
+#define PodsDefaults_TYPE_ID (0x752BE96E)
+#define BitfieldDefaultsMulti_TYPE_ID (0x006EC446)
+#define DefaultStr_TYPE_ID (0xA36FB79E)
+#define DefaultEnum_TYPE_ID (0x116185FA)
+#define DefaultStruct_TYPE_ID (0x114797AA)
+#define DefaultPtr_TYPE_ID (0xA36FAADB)
+#define DefaultInlArrayPod_TYPE_ID (0x441FC1CA)
+#define DefaultInlArrayStr_TYPE_ID (0x441FCF40)
+#define DefaultInlArrayEnum_TYPE_ID (0xC81491DC)
+#define DefaultInlArrayArray_TYPE_ID (0xCA632FA6)
+#define DefaultArrayPod_TYPE_ID (0x49F1A9E7)
+#define DefaultArrayStr_TYPE_ID (0x49F1B75D)
+#define DefaultArrayEnum_TYPE_ID (0x88237D99)
+#define DefaultArrayArray_TYPE_ID (0x8C4F9303)
+#define DefaultWithOtherDataBefore_TYPE_ID (0xA3FE2050)
+#define issue_40_1_TYPE_ID (0x7447F53C)
+#define issue_40_2_TYPE_ID (0x7447F53D)
+#define with_alias_enum_TYPE_ID (0xF589E359)
+#define BugTest4_TYPE_ID (0x897698F2)
+#define BugTest5_TYPE_ID (0x897698F3)
+#define PtrHolder_TYPE_ID (0x5E4C46D4)
+#define PtrArray_TYPE_ID (0x406E0855)
+#define circular_array_ptr_holder_TYPE_ID (0x1CD266A5)
+#define circular_array_TYPE_ID (0x91DB4AB3)
+#define str_before_array_bug_arr_type_TYPE_ID (0x28519FEB)
+#define str_before_array_bug_TYPE_ID (0x9533E3E6)
+#define bug_array_alignment_struct_TYPE_ID (0xF604479E)
+#define bug_alignment_struct_TYPE_ID (0xD34F93E0)
+#define bug_array_alignment_TYPE_ID (0x5C74D3FA)
+#define test_array_pad_1_TYPE_ID (0x717C6DE2)
+#define test_array_pad_TYPE_ID (0xAC2E57B2)
+#define test_inline_array_size_from_enum_TYPE_ID (0xF1AAF73D)
+#define test_inline_array_of_unions_TYPE_ID (0x68A11BCB)
+#define single_int_TYPE_ID (0x4DB5F3EC)
+#define struct_with_a_bitfield_TYPE_ID (0xD58CEA22)
+#define struct_with_some_defaults_TYPE_ID (0xBBA359AA)
+#define struct_with_one_member_and_default_TYPE_ID (0x555F266E)
+#define single_default_uint32_TYPE_ID (0xDCCFDE6A)
+#define test_inline_array_default_struct1_TYPE_ID (0x647D10D5)
+#define test_inline_array_default_struct2_TYPE_ID (0x647D10D6)
+#define vector2_type_TYPE_ID (0x1271A166)
+#define member_with_array_of_vector_TYPE_ID (0x59535DF7)
+#define struct_with_member_with_array_of_vector_TYPE_ID (0x03687D76)
+#define union_with_weird_members_TYPE_ID (0xD7D12468)
+#define test_union_inline_array_TYPE_ID (0xF975B584)
+#define test_union_array_TYPE_ID (0x50038066)
+#define test_union_ptr_TYPE_ID (0x7FF4E33D)
+#define test_has_union_array_TYPE_ID (0x6E33AAC1)
+#define union_with_weird_members_event_TYPE_ID (0x13A3F1C9)
+#define struct_with_array_of_weird_unions_TYPE_ID (0xB3CBCA67)
+#define test_with_union_array_TYPE_ID (0x3E92AF01)
+#define parallel_pack_item_TYPE_ID (0x498FFAD9)
+#define parallel_pack_root_TYPE_ID (0x4994D64E)
+#define test_lots_of_members_TYPE_ID (0x898C1BFF)
+
+
+//----------------------------------------------
+//                   ENUMS:s                    
+//----------------------------------------------
+
+#if DL_SIZED_ENUM_SUPPORTED
+
+typedef enum TestEnum1
+{
+    TESTENUM1_VALUE1 = 0,
+    TESTENUM1_VALUE2 = 1,
+    TESTENUM1_VALUE3 = 2,
+    TESTENUM1_VALUE4 = 3
+} TestEnum1;
+
+typedef enum TestEnum2
+{
+    TESTENUM2_VALUE1 = 7,
+    TESTENUM2_VALUE2 = 1337,
+    // whippzores!
+    TESTENUM2_VALUE3 = 1338,
+    // whoppa!
+    TESTENUM2_VALUE4 = 1337
+} TestEnum2;
+
+typedef enum multi_alias_enum
+{
+    MULTI_ALIAS1 = 7,
+    MULTI_ALIAS2 = 8
+} multi_alias_enum;
+
+typedef enum EnumWithMeta
+{
+    // whoppa!
+    TESTENUMWITHMETA = 1337
+} EnumWithMeta;
+
+#else // DL_SIZED_ENUM_SUPPORTED
+
+typedef enum TestEnum1
+{
+    TESTENUM1_VALUE1 = 0,
+    TESTENUM1_VALUE2 = 1,
+    TESTENUM1_VALUE3 = 2,
+    TESTENUM1_VALUE4 = 3
+} TestEnum1;
+
+typedef enum TestEnum2
+{
+    TESTENUM2_VALUE1 = 7,
+    TESTENUM2_VALUE2 = 1337,
+    // whippzores!
+    TESTENUM2_VALUE3 = 1338,
+    // whoppa!
+    TESTENUM2_VALUE4 = 1337
+} TestEnum2;
+
+typedef enum multi_alias_enum
+{
+    MULTI_ALIAS1 = 7,
+    MULTI_ALIAS2 = 8
+} multi_alias_enum;
+
+typedef enum EnumWithMeta
+{
+    // whoppa!
+    TESTENUMWITHMETA = 1337
+} EnumWithMeta;
+
+#endif // DL_SIZED_ENUM_SUPPORTED
+
+//----------------------------------------------
+//                   TYPES:s                    
+//----------------------------------------------
+
+struct unused
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x20D327B4;
+#endif // defined( __cplusplus )
+
+    //only used in unittests to check for errors
+    int32_t member; 
+};
+
+struct Pods
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x7C8ABE56;
+#endif // defined( __cplusplus )
+
+    int8_t i8; 
+    int16_t i16; 
+    int32_t i32; 
+    DL_ALIGN(8) int64_t i64; 
+    uint8_t u8; 
+    uint16_t u16; 
+    uint32_t u32; 
+    DL_ALIGN(8) uint64_t u64; 
+    float f32; 
+    DL_ALIGN(8) double f64; 
+};
+
+struct i8Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x1DDC04A0;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(int8_t) arr;
+ };
+
+struct i16Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xA168660F;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(int16_t) arr;
+ };
+
+struct i32Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x32083D0D;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(int32_t) arr;
+ };
+
+struct i64Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x1DA14492;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(int64_t) arr;
+ };
+
+struct u8Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xB996DDAC;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint8_t) arr;
+ };
+
+struct u16Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xB47E609B;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint16_t) arr;
+ };
+
+struct u32Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x451E3799;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint32_t) arr;
+ };
+
+struct u64Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x30B73F1E;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint64_t) arr;
+ };
+
+struct fp32Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x87D3563A;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(float) arr;
+ };
+
+struct fp64Array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x736C5DBF;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(double) arr;
+ };
+
+struct strArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x8D6E2318;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(const char*) arr;
+ };
+
+struct ptrArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xC8A8A475;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct Pods*) arr;
+ };
+
+struct enumArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x9CF74254;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(TestEnum1) arr;
+ };
+
+struct default_empty_type
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xD7315B34;
+#endif // defined( __cplusplus )
+
+    uint32_t empty; 
+};
+
+struct type_with_meta
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xD92D32C3;
+#endif // defined( __cplusplus )
+
+    int8_t i8; 
+};
+
+enum test_union_simple_type
+{
+    test_union_simple_type_item1 = test_union_simple_TYPE_ID + 1,
+    test_union_simple_type_item2 = test_union_simple_TYPE_ID + 2,
+    test_union_simple_type_item3 = test_union_simple_TYPE_ID + 3
+};
+
+struct test_union_simple
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x79CDAD31;
+#endif // defined( __cplusplus )
+
+    union
+    {
+    int32_t item1; 
+    float item2; 
+    DL_C_STRUCT Pods item3;
+    } value;
+    enum test_union_simple_type type;
+};
+
+struct MorePods
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xFD3E1AC9;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT Pods Pods1;
+    DL_C_STRUCT Pods Pods2;
+};
+
+struct Pods2
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x0DE529E8;
+#endif // defined( __cplusplus )
+
+    uint32_t Int1; 
+    uint32_t Int2; 
+};
+
+struct Pod2InStruct
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x08ACCFF1;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT Pods2 Pod1;
+    DL_C_STRUCT Pods2 Pod2;
+};
+
+struct PodPtr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xCA8C7B99;
+#endif // defined( __cplusplus )
+
+    const struct Pods2* PodPtr1;
+};
+
+struct Pod2InStructInStruct
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xF540FDCD;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT Pod2InStruct p2struct;
+};
+
+struct WithInlineArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x1123239A;
+#endif // defined( __cplusplus )
+
+    uint32_t Array[3];
+};
+
+struct WithInlineStructArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xFFC53F7F;
+#endif // defined( __cplusplus )
+
+    struct Pods2 Array[3];
+};
+
+struct WithInlineStructStructArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x2027F324;
+#endif // defined( __cplusplus )
+
+    struct WithInlineStructArray Array[2];
+};
+
+struct SubString
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xF2663CC1;
+#endif // defined( __cplusplus )
+
+    const char* Str; 
+};
+
+struct InlineArrayWithSubString
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xC858A21B;
+#endif // defined( __cplusplus )
+
+    struct SubString Array[2];
+};
+
+struct PodArray1
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x7B3938D3;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint32_t) u32_arr;
+ };
+
+struct PodArray2
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x7B3938D4;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct PodArray1) sub_arr;
+ };
+
+struct StructArray1
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x8DE7A1F5;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct Pods2) Array;
+ };
+
+struct StructArrayRecursive1
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xAFD72DAD;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct StructArrayRecursive2) Array;
+ };
+
+struct StructArrayRecursive2
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xAFD72DAE;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct StructArrayRecursive1) Array;
+ };
+
+struct Strings
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x0FC202CA;
+#endif // defined( __cplusplus )
+
+    const char* Str1; 
+    const char* Str2; 
+};
+
+struct StringInlineArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x3F4DBE15;
+#endif // defined( __cplusplus )
+
+    const char* Strings[3];
+};
+
+struct StringArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xCC4EFE36;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(const char*) Strings;
+ };
+
+struct TestBits
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x74A160D2;
+#endif // defined( __cplusplus )
+
+    uint8_t Bit1 : 1;
+    uint8_t Bit2 : 2;
+    uint8_t Bit3 : 3;
+    uint8_t make_it_uneven; 
+    uint8_t Bit4 : 1;
+    uint8_t Bit5 : 2;
+    uint8_t Bit6 : 3;
+};
+
+struct MoreBits
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xFD365605;
+#endif // defined( __cplusplus )
+
+    uint32_t Bit1 : 15;
+    uint32_t Bit2 : 7;
+};
+
+struct BitBitfield64
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xECE9CECC;
+#endif // defined( __cplusplus )
+
+    DL_ALIGN(8) uint64_t Package : 7;
+    uint64_t FileType : 9;
+    uint64_t PathHash : 16;
+    uint64_t FileHash : 32;
+};
+
+struct SimplePtr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x711E2A40;
+#endif // defined( __cplusplus )
+
+    const struct Pods* Ptr1;
+    const struct Pods* Ptr2;
+};
+
+struct PtrChain
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x408C7639;
+#endif // defined( __cplusplus )
+
+    uint32_t Int; 
+    const struct PtrChain* Next;
+};
+
+struct DoublePtrChain
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x0EC87334;
+#endif // defined( __cplusplus )
+
+    uint32_t Int; 
+    const struct DoublePtrChain* Next;
+    const struct DoublePtrChain* Prev;
+};
+
+struct inline_ptr_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xCBD895B2;
+#endif // defined( __cplusplus )
+
+    struct Pods2* arr[3];
+};
+
+struct ptr_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x22873BB4;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct Pods2*) arr;
+ };
+
+struct ptr_inline_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x8D27ED12;
+#endif // defined( __cplusplus )
+
+    const struct WithInlineArray* ptr;
+};
+
+struct ptr_inline_array2
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x32283024;
+#endif // defined( __cplusplus )
+
+    const struct WithInlineStructArray* ptr;
+};
+
+struct inline_array_pod_ptr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xF0DF7E14;
+#endif // defined( __cplusplus )
+
+    struct PodPtr inlarr[2];
+};
+
+struct ptr_struct_inline_array_ptr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x1EEB190B;
+#endif // defined( __cplusplus )
+
+    const struct inline_array_pod_ptr* ptr;
+};
+
+struct DL_ALIGN( 128 ) A128BitAlignedType
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x77B2BAF1;
+#endif // defined( __cplusplus )
+
+    uint32_t Int; 
+};
+
+struct TestingEnum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x42659D73;
+#endif // defined( __cplusplus )
+
+    TestEnum1 TheEnum;
+};
+
+struct InlineArrayEnum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x0F58DEB3;
+#endif // defined( __cplusplus )
+
+    TestEnum2 EnumArr[4];
+};
+
+struct ArrayEnum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xED6EB494;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(TestEnum2) EnumArr;
+ };
+
+struct PodsDefaults
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x752BE96E;
+#endif // defined( __cplusplus )
+
+    int8_t i8; 
+    int16_t i16; 
+    int32_t i32; 
+    DL_ALIGN(8) int64_t i64; 
+    uint8_t u8; 
+    uint16_t u16; 
+    uint32_t u32; 
+    DL_ALIGN(8) uint64_t u64; 
+    float f32; 
+    DL_ALIGN(8) double f64; 
+};
+
+struct BitfieldDefaultsMulti
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x006EC446;
+#endif // defined( __cplusplus )
+
+    uint16_t f1 : 1;
+    uint16_t f2 : 1;
+    uint16_t f3 : 2;
+    uint16_t f4 : 2;
+    uint16_t f5 : 2;
+    uint16_t f6 : 2;
+};
+
+struct DefaultStr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xA36FB79E;
+#endif // defined( __cplusplus )
+
+    const char* Str; 
+};
+
+struct DefaultEnum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x116185FA;
+#endif // defined( __cplusplus )
+
+    TestEnum1 Enum;
+};
+
+struct DefaultStruct
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x114797AA;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT Pods2 Struct;
+};
+
+struct DefaultPtr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xA36FAADB;
+#endif // defined( __cplusplus )
+
+    const struct Pods* Ptr;
+};
+
+struct DefaultInlArrayPod
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x441FC1CA;
+#endif // defined( __cplusplus )
+
+    uint32_t Arr[4];
+};
+
+struct DefaultInlArrayStr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x441FCF40;
+#endif // defined( __cplusplus )
+
+    const char* Arr[4];
+};
+
+struct DefaultInlArrayEnum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xC81491DC;
+#endif // defined( __cplusplus )
+
+    TestEnum1 Arr[4];
+};
+
+struct DefaultInlArrayArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xCA632FA6;
+#endif // defined( __cplusplus )
+
+    struct PodArray1 Arr[2];
+};
+
+struct DefaultArrayPod
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x49F1A9E7;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint32_t) Arr;
+ };
+
+struct DefaultArrayStr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x49F1B75D;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(const char*) Arr;
+ };
+
+struct DefaultArrayEnum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x88237D99;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(TestEnum1) Arr;
+ };
+
+struct DefaultArrayArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x8C4F9303;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct PodArray1) Arr;
+ };
+
+struct DefaultWithOtherDataBefore
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xA3FE2050;
+#endif // defined( __cplusplus )
+
+    const char* t1; 
+    const char* Str; 
+};
+
+struct issue_40_1
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x7447F53C;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(const char*) submember1;
+     uint32_t submember2; 
+};
+
+struct issue_40_2
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x7447F53D;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT issue_40_1 member1;
+};
+
+struct with_alias_enum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xF589E359;
+#endif // defined( __cplusplus )
+
+    multi_alias_enum e1;
+    multi_alias_enum e2;
+    multi_alias_enum e3;
+    multi_alias_enum e4;
+};
+
+struct BugTest4
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x897698F2;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct StringArray) struct_with_str_arr;
+ };
+
+struct BugTest5
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x897698F3;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct PtrChain) array;
+ };
+
+struct PtrHolder
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x5E4C46D4;
+#endif // defined( __cplusplus )
+
+    const struct Pods2* ptr;
+};
+
+struct PtrArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x406E0855;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct PtrHolder) arr;
+ };
+
+struct circular_array_ptr_holder
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x1CD266A5;
+#endif // defined( __cplusplus )
+
+    const struct circular_array* ptr;
+};
+
+struct circular_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x91DB4AB3;
+#endif // defined( __cplusplus )
+
+    uint16_t val; 
+    DL_DECLARE_ARRAY(struct circular_array_ptr_holder) arr;
+ };
+
+struct str_before_array_bug_arr_type
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x28519FEB;
+#endif // defined( __cplusplus )
+
+    const char* str; 
+};
+
+struct str_before_array_bug
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x9533E3E6;
+#endif // defined( __cplusplus )
+
+    const char* str; 
+    DL_DECLARE_ARRAY(struct str_before_array_bug_arr_type) arr;
+ };
+
+struct bug_array_alignment_struct
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xF604479E;
+#endif // defined( __cplusplus )
+
+    uint32_t type; 
+    DL_ALIGN(8) uint64_t ptr; 
+    uint32_t used_sources; 
+};
+
+struct bug_alignment_struct
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xD34F93E0;
+#endif // defined( __cplusplus )
+
+    uint32_t i32; 
+    DL_C_STRUCT A128BitAlignedType aligned;
+    const struct Pods2* ptr;
+};
+
+struct bug_array_alignment
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x5C74D3FA;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct bug_array_alignment_struct) components;
+ };
+
+struct test_array_pad_1
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x717C6DE2;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint8_t) ptr;
+     uint32_t type; 
+};
+
+struct test_array_pad
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xAC2E57B2;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct test_array_pad_1) components;
+ };
+
+struct test_inline_array_size_from_enum
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xF1AAF73D;
+#endif // defined( __cplusplus )
+
+    int32_t arr1[7];
+    int32_t arr2[3];
+};
+
+struct test_inline_array_of_unions
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x68A11BCB;
+#endif // defined( __cplusplus )
+
+    struct test_union_simple arr[3];
+};
+
+struct single_int
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x4DB5F3EC;
+#endif // defined( __cplusplus )
+
+    int32_t val; 
+};
+
+//! not_reloadable
+struct struct_with_a_bitfield
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xD58CEA22;
+#endif // defined( __cplusplus )
+
+    DL_ALIGN(8) uint64_t my_variable_1; 
+    uint32_t my_variable_2; 
+    uint8_t my_variable_3 : 1;
+};
+
+struct struct_with_some_defaults
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xBBA359AA;
+#endif // defined( __cplusplus )
+
+    uint32_t some_variable_1; 
+    float some_variable_2; 
+    float some_variable_3; 
+    float some_variable_4; 
+    float some_variable_5; 
+};
+
+struct struct_with_one_member_and_default
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x555F266E;
+#endif // defined( __cplusplus )
+
+    uint32_t dummy; 
+};
+
+struct single_default_uint32
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xDCCFDE6A;
+#endif // defined( __cplusplus )
+
+    uint32_t u; 
+};
+
+struct test_inline_array_default_struct1
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x647D10D5;
+#endif // defined( __cplusplus )
+
+    struct single_default_uint32 arr[3];
+};
+
+struct test_inline_array_default_struct2
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x647D10D6;
+#endif // defined( __cplusplus )
+
+    struct single_default_uint32 arr[3];
+};
+
+struct vector2_type
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x1271A166;
+#endif // defined( __cplusplus )
+
+    float x; 
+    float y; 
+};
+
+struct member_with_array_of_vector
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x59535DF7;
+#endif // defined( __cplusplus )
+
+    struct vector2_type varr[2];
+};
+
+struct struct_with_member_with_array_of_vector
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x03687D76;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT member_with_array_of_vector a;
+};
+
+enum union_with_weird_members_type
+{
+    union_with_weird_members_type_spawn_particles = union_with_weird_members_TYPE_ID + 1,
+    union_with_weird_members_type_decay = union_with_weird_members_TYPE_ID + 2,
+    union_with_weird_members_type_hide_all_meshes = union_with_weird_members_TYPE_ID + 3
+};
+
+struct union_with_weird_members
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xD7D12468;
+#endif // defined( __cplusplus )
+
+    union
+    {
+    DL_C_STRUCT struct_with_a_bitfield spawn_particles;
+    DL_C_STRUCT struct_with_some_defaults decay;
+    DL_C_STRUCT struct_with_one_member_and_default hide_all_meshes;
+    } value;
+    enum union_with_weird_members_type type;
+};
+
+enum test_union_inline_array_type
+{
+    test_union_inline_array_type_i32 = test_union_inline_array_TYPE_ID + 1,
+    test_union_inline_array_type_inlarr = test_union_inline_array_TYPE_ID + 2
+};
+
+struct test_union_inline_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xF975B584;
+#endif // defined( __cplusplus )
+
+    union
+    {
+    int32_t i32; 
+    int32_t inlarr[6];
+    } value;
+    enum test_union_inline_array_type type;
+};
+
+enum test_union_array_type
+{
+    test_union_array_type_i32 = test_union_array_TYPE_ID + 1,
+    test_union_array_type_arr = test_union_array_TYPE_ID + 2
+};
+
+struct test_union_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x50038066;
+#endif // defined( __cplusplus )
+
+    union
+    {
+    int32_t i32; 
+    DL_DECLARE_ARRAY(int32_t) arr;
+     } value;
+    enum test_union_array_type type;
+};
+
+enum test_union_ptr_type
+{
+    test_union_ptr_type_p1 = test_union_ptr_TYPE_ID + 1,
+    test_union_ptr_type_p2 = test_union_ptr_TYPE_ID + 2,
+    test_union_ptr_type_p3 = test_union_ptr_TYPE_ID + 3
+};
+
+struct test_union_ptr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x7FF4E33D;
+#endif // defined( __cplusplus )
+
+    union
+    {
+    const struct Pods* p1;
+    const struct SubString* p2;
+    const struct WithInlineArray* p3;
+    } value;
+    enum test_union_ptr_type type;
+};
+
+enum test_has_union_array_type
+{
+    test_has_union_array_type_floats = test_has_union_array_TYPE_ID + 1,
+    test_has_union_array_type_ints = test_has_union_array_TYPE_ID + 2
+};
+
+struct test_has_union_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x6E33AAC1;
+#endif // defined( __cplusplus )
+
+    union
+    {
+    DL_DECLARE_ARRAY(float) floats;
+     DL_DECLARE_ARRAY(int32_t) ints;
+     } value;
+    enum test_has_union_array_type type;
+};
+
+struct union_with_weird_members_event
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x13A3F1C9;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT union_with_weird_members effect;
+    float delay; 
+};
+
+struct struct_with_array_of_weird_unions
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xB3CBCA67;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct union_with_weird_members_event) event_array;
+ };
+
+struct test_with_union_array
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x3E92AF01;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct test_has_union_array) properties;
+ };
+
+struct parallel_pack_item
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x498FFAD9;
+#endif // defined( __cplusplus )
+
+    const char* name; 
+    DL_DECLARE_ARRAY(uint8_t) bytes;
+     DL_DECLARE_ARRAY(uint64_t) u64s;
+     DL_DECLARE_ARRAY(const char*) strs;
+     DL_DECLARE_ARRAY(struct PodArray1) sub;
+     const struct Pods2* ptr;
+    const char* def_str; 
+    DL_DECLARE_ARRAY(uint32_t) def_arr;
+ };
+
+struct parallel_pack_root
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x4994D64E;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct parallel_pack_item) items;
+ };
+
+struct test_lots_of_members
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x898C1BFF;
+#endif // defined( __cplusplus )
+
+    uint8_t mem00; 
+    uint8_t mem01; 
+    uint8_t mem02; 
+    uint8_t mem03; 
+    uint8_t mem04; 
+    uint8_t mem05; 
+    uint8_t mem06; 
+    uint8_t mem07; 
+    uint8_t mem08; 
+    uint8_t mem09; 
+    uint8_t mem10; 
+    uint8_t mem11; 
+    uint8_t mem12; 
+    uint8_t mem13; 
+    uint8_t mem14; 
+    uint8_t mem15; 
+    uint8_t mem16; 
+    uint8_t mem17; 
+    uint8_t mem18; 
+    uint8_t mem19; 
+    uint8_t mem20; 
+    uint8_t mem21; 
+    uint8_t mem22; 
+    uint8_t mem23; 
+    uint8_t mem24; 
+    uint8_t mem25; 
+    uint8_t mem26; 
+    uint8_t mem27; 
+    uint8_t mem28; 
+    uint8_t mem29; 
+    uint8_t mem30; 
+    uint8_t mem31; 
+    uint8_t mem32; 
+    uint8_t mem33; 
+    uint8_t mem34; 
+    uint8_t mem35; 
+    uint8_t mem36; 
+    uint8_t mem37; 
+    uint8_t mem38; 
+    uint8_t mem39; 
+    uint8_t mem40; 
+    uint8_t mem41; 
+    uint8_t mem42; 
+    uint8_t mem43; 
+    uint8_t mem44; 
+    uint8_t mem45; 
+    uint8_t mem46; 
+    uint8_t mem47; 
+    uint8_t mem48; 
+    uint8_t mem49; 
+    uint8_t mem50; 
+    uint8_t mem51; 
+    uint8_t mem52; 
+    uint8_t mem53; 
+    uint8_t mem54; 
+    uint8_t mem55; 
+    uint8_t mem56; 
+    uint8_t mem57; 
+    uint8_t mem58; 
+    uint8_t mem59; 
+    uint8_t mem60; 
+    uint8_t mem61; 
+    uint8_t mem62; 
+    uint8_t mem63; 
+    uint8_t mem64; 
+    uint8_t mem65; 
+    uint8_t mem66; 
+    uint8_t mem67; 
+    uint8_t mem68; 
+    uint8_t mem69; 
+    uint8_t mem70; 
+    uint8_t mem71; 
+    uint8_t mem72; 
+    uint8_t mem73; 
+    uint8_t mem74; 
+    uint8_t mem75; 
+    uint8_t mem76; 
+    uint8_t mem77; 
+    uint8_t mem78; 
+    uint8_t mem79; 
+};
+
+#endif // __DL_AUTOGEN_HEADER_UNITTEST_H_INCLUDED
+
@@ -0,0 +1,3801 @@
+/* Auto generated c++ serializers for dl type library */
+#ifndef __DL_AUTOGEN_SERIALIZERS_UNITTEST_SERIALIZERS_H_INCLUDED
+#define __DL_AUTOGEN_SERIALIZERS_UNITTEST_SERIALIZERS_H_INCLUDED
+
+// ... include after the header generated for the same type library with dl_context_write_type_library_c_header() ...
+#include <dl/dl_serializer.h>
+
+template <>
+struct dl_serializer<unused>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x20D327B4;
+    static constexpr const size_t      SIZE        = 4;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<Pods>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x7C8ABE56;
+    static constexpr const size_t      SIZE        = 48;
+    static constexpr const size_t      ALIGNMENT   = 8;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<i8Array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x1DDC04A0;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<i16Array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xA168660F;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<i32Array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x32083D0D;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<i64Array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x1DA14492;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<u8Array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xB996DDAC;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<u16Array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xB47E609B;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<u32Array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x451E3799;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<u64Array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x30B73F1E;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<fp32Array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x87D3563A;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<fp64Array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x736C5DBF;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<strArray>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x8D6E2318;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<ptrArray>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xC8A8A475;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<enumArray>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x9CF74254;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<default_empty_type>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xD7315B34;
+    static constexpr const size_t      SIZE        = 4;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<type_with_meta>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xD92D32C3;
+    static constexpr const size_t      SIZE        = 1;
+    static constexpr const size_t      ALIGNMENT   = 1;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<test_union_simple>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x79CDAD31;
+    static constexpr const size_t      SIZE        = 56;
+    static constexpr const size_t      ALIGNMENT   = 8;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<MorePods>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xFD3E1AC9;
+    static constexpr const size_t      SIZE        = 96;
+    static constexpr const size_t      ALIGNMENT   = 8;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<Pods2>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x0DE529E8;
+    static constexpr const size_t      SIZE        = 8;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<Pod2InStruct>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x08ACCFF1;
+    static constexpr const size_t      SIZE        = 16;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<PodPtr>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xCA8C7B99;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<Pod2InStructInStruct>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xF540FDCD;
+    static constexpr const size_t      SIZE        = 16;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<WithInlineArray>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x1123239A;
+    static constexpr const size_t      SIZE        = 12;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<WithInlineStructArray>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xFFC53F7F;
+    static constexpr const size_t      SIZE        = 24;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<WithInlineStructStructArray>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x2027F324;
+    static constexpr const size_t      SIZE        = 48;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<SubString>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xF2663CC1;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<InlineArrayWithSubString>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xC858A21B;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<PodArray1>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x7B3938D3;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<PodArray2>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x7B3938D4;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<StructArray1>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x8DE7A1F5;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<StructArrayRecursive1>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xAFD72DAD;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<StructArrayRecursive2>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xAFD72DAE;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<Strings>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x0FC202CA;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<StringInlineArray>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x3F4DBE15;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 12, 24 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<StringArray>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xCC4EFE36;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<TestBits>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x74A160D2;
+    static constexpr const size_t      SIZE        = 3;
+    static constexpr const size_t      ALIGNMENT   = 1;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<MoreBits>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xFD365605;
+    static constexpr const size_t      SIZE        = 4;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<BitBitfield64>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xECE9CECC;
+    static constexpr const size_t      SIZE        = 8;
+    static constexpr const size_t      ALIGNMENT   = 8;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<SimplePtr>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x711E2A40;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<PtrChain>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x408C7639;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<DoublePtrChain>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x0EC87334;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 12, 24 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<inline_ptr_array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xCBD895B2;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 12, 24 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<ptr_array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x22873BB4;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<ptr_inline_array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x8D27ED12;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<ptr_inline_array2>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x32283024;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<inline_array_pod_ptr>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xF0DF7E14;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<ptr_struct_inline_array_ptr>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x1EEB190B;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<A128BitAlignedType>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x77B2BAF1;
+    static constexpr const size_t      SIZE        = 128;
+    static constexpr const size_t      ALIGNMENT   = 128;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<TestingEnum>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x42659D73;
+    static constexpr const size_t      SIZE        = 4;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<InlineArrayEnum>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x0F58DEB3;
+    static constexpr const size_t      SIZE        = 16;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<ArrayEnum>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xED6EB494;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<PodsDefaults>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x752BE96E;
+    static constexpr const size_t      SIZE        = 48;
+    static constexpr const size_t      ALIGNMENT   = 8;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<BitfieldDefaultsMulti>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x006EC446;
+    static constexpr const size_t      SIZE        = 2;
+    static constexpr const size_t      ALIGNMENT   = 2;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<DefaultStr>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xA36FB79E;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<DefaultEnum>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x116185FA;
+    static constexpr const size_t      SIZE        = 4;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<DefaultStruct>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x114797AA;
+    static constexpr const size_t      SIZE        = 8;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<DefaultPtr>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xA36FAADB;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<DefaultInlArrayPod>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x441FC1CA;
+    static constexpr const size_t      SIZE        = 16;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<DefaultInlArrayStr>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x441FCF40;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 16, 32 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<DefaultInlArrayEnum>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xC81491DC;
+    static constexpr const size_t      SIZE        = 16;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<DefaultInlArrayArray>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xCA632FA6;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 16, 32 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<DefaultArrayPod>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x49F1A9E7;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<DefaultArrayStr>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x49F1B75D;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<DefaultArrayEnum>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x88237D99;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<DefaultArrayArray>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x8C4F9303;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<DefaultWithOtherDataBefore>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xA3FE2050;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<issue_40_1>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x7447F53C;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 12, 24 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<issue_40_2>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x7447F53D;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 12, 24 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<with_alias_enum>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xF589E359;
+    static constexpr const size_t      SIZE        = 16;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<BugTest4>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x897698F2;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<BugTest5>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x897698F3;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<PtrHolder>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x5E4C46D4;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<PtrArray>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x406E0855;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<circular_array_ptr_holder>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x1CD266A5;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<circular_array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x91DB4AB3;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 12, 24 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<str_before_array_bug_arr_type>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x28519FEB;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<str_before_array_bug>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x9533E3E6;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 12, 24 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<bug_array_alignment_struct>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xF604479E;
+    static constexpr const size_t      SIZE        = 24;
+    static constexpr const size_t      ALIGNMENT   = 8;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<bug_alignment_struct>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xD34F93E0;
+    static constexpr const size_t      SIZE        = 384;
+    static constexpr const size_t      ALIGNMENT   = 128;
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<bug_array_alignment>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x5C74D3FA;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<test_array_pad_1>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x717C6DE2;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 12, 24 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<test_array_pad>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xAC2E57B2;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<test_inline_array_size_from_enum>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xF1AAF73D;
+    static constexpr const size_t      SIZE        = 40;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<test_inline_array_of_unions>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x68A11BCB;
+    static constexpr const size_t      SIZE        = 168;
+    static constexpr const size_t      ALIGNMENT   = 8;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<single_int>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x4DB5F3EC;
+    static constexpr const size_t      SIZE        = 4;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<struct_with_a_bitfield>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xD58CEA22;
+    static constexpr const size_t      SIZE        = 16;
+    static constexpr const size_t      ALIGNMENT   = 8;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<struct_with_some_defaults>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xBBA359AA;
+    static constexpr const size_t      SIZE        = 20;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<struct_with_one_member_and_default>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x555F266E;
+    static constexpr const size_t      SIZE        = 4;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<single_default_uint32>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xDCCFDE6A;
+    static constexpr const size_t      SIZE        = 4;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<test_inline_array_default_struct1>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x647D10D5;
+    static constexpr const size_t      SIZE        = 12;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<test_inline_array_default_struct2>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x647D10D6;
+    static constexpr const size_t      SIZE        = 12;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<vector2_type>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x1271A166;
+    static constexpr const size_t      SIZE        = 8;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<member_with_array_of_vector>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x59535DF7;
+    static constexpr const size_t      SIZE        = 16;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<struct_with_member_with_array_of_vector>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x03687D76;
+    static constexpr const size_t      SIZE        = 16;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<union_with_weird_members>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xD7D12468;
+    static constexpr const size_t      SIZE        = 32;
+    static constexpr const size_t      ALIGNMENT   = 8;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<test_union_inline_array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xF975B584;
+    static constexpr const size_t      SIZE        = 28;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<test_union_array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x50038066;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 12, 24 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<test_union_ptr>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x7FF4E33D;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<test_has_union_array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x6E33AAC1;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 12, 24 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<union_with_weird_members_event>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x13A3F1C9;
+    static constexpr const size_t      SIZE        = 40;
+    static constexpr const size_t      ALIGNMENT   = 8;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<struct_with_array_of_weird_unions>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xB3CBCA67;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<test_with_union_array>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x3E92AF01;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<parallel_pack_item>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x498FFAD9;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 52, 104 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<parallel_pack_root>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x4994D64E;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<test_lots_of_members>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x898C1BFF;
+    static constexpr const size_t      SIZE        = 80;
+    static constexpr const size_t      ALIGNMENT   = 1;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+inline void dl_serializer<unused>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<unused>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<unused>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+}
+
+inline void dl_serializer<Pods>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 1 );
+    w.write( pos + 2, inst + 2, 15 );
+    w.write( pos + 18, inst + 18, 18 );
+    w.write( pos + 40, inst + 40, 8 );
+}
+
+inline void dl_serializer<Pods>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<Pods>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 2, 2 );
+    s.swap_pod( inst + 4, 4 );
+    s.swap_pod( inst + 8, 8 );
+    s.swap_pod( inst + 18, 2 );
+    s.swap_pod( inst + 20, 4 );
+    s.swap_pod( inst + 24, 8 );
+    s.swap_pod( inst + 32, 4 );
+    s.swap_pod( inst + 40, 8 );
+}
+
+inline void dl_serializer<i8Array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 1 );
+}
+
+inline void dl_serializer<i8Array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<i8Array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 1 );
+        if( a != 0x0 )
+            s.swap_pods( a, 1, count );
+    }
+}
+
+inline void dl_serializer<i16Array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 2 );
+}
+
+inline void dl_serializer<i16Array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<i16Array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 2 );
+        if( a != 0x0 )
+            s.swap_pods( a, 2, count );
+    }
+}
+
+inline void dl_serializer<i32Array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<i32Array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<i32Array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 4 );
+        if( a != 0x0 )
+            s.swap_pods( a, 4, count );
+    }
+}
+
+inline void dl_serializer<i64Array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 8 );
+}
+
+inline void dl_serializer<i64Array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<i64Array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 8 );
+        if( a != 0x0 )
+            s.swap_pods( a, 8, count );
+    }
+}
+
+inline void dl_serializer<u8Array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 1 );
+}
+
+inline void dl_serializer<u8Array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<u8Array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 1 );
+        if( a != 0x0 )
+            s.swap_pods( a, 1, count );
+    }
+}
+
+inline void dl_serializer<u16Array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 2 );
+}
+
+inline void dl_serializer<u16Array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<u16Array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 2 );
+        if( a != 0x0 )
+            s.swap_pods( a, 2, count );
+    }
+}
+
+inline void dl_serializer<u32Array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<u32Array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<u32Array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 4 );
+        if( a != 0x0 )
+            s.swap_pods( a, 4, count );
+    }
+}
+
+inline void dl_serializer<u64Array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 8 );
+}
+
+inline void dl_serializer<u64Array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<u64Array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 8 );
+        if( a != 0x0 )
+            s.swap_pods( a, 8, count );
+    }
+}
+
+inline void dl_serializer<fp32Array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<fp32Array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<fp32Array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 4 );
+        if( a != 0x0 )
+            s.swap_pods( a, 4, count );
+    }
+}
+
+inline void dl_serializer<fp64Array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 8 );
+}
+
+inline void dl_serializer<fp64Array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<fp64Array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 8 );
+        if( a != 0x0 )
+            s.swap_pods( a, 8, count );
+    }
+}
+
+inline void dl_serializer<strArray>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_str_array( pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<strArray>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            p.patch( a + i * sizeof( char* ) );
+    }
+}
+
+inline void dl_serializer<strArray>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * sizeof( void* ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                s.swap_ptr( a + i * sizeof( char* ) );
+    }
+}
+
+inline void dl_serializer<ptrArray>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_ptr_array<Pods>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<ptrArray>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            dl_serializer_patch_ptr<Pods>( p, a + i * sizeof( void* ) );
+    }
+}
+
+inline void dl_serializer<ptrArray>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * sizeof( void* ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer_swap_ptr<Pods>( s, a + i * sizeof( void* ) );
+    }
+}
+
+inline void dl_serializer<enumArray>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<enumArray>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<enumArray>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 4 );
+        if( a != 0x0 )
+            s.swap_pods( a, 4, count );
+    }
+}
+
+inline void dl_serializer<default_empty_type>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<default_empty_type>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<default_empty_type>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+}
+
+inline void dl_serializer<type_with_meta>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 1 );
+}
+
+inline void dl_serializer<type_with_meta>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<type_with_meta>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+}
+
+inline void dl_serializer<test_union_simple>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    uint32_t type;
+    memcpy( &type, inst + 48, sizeof( uint32_t ) );
+    switch( type )
+    {
+        case 0x79CDAD32:
+            w.write( pos + 0, inst + 0, 4 );
+            break;
+        case 0x79CDAD33:
+            w.write( pos + 0, inst + 0, 4 );
+            break;
+        case 0x79CDAD34:
+            w.write( pos + 0, inst + 0, 1 );
+            w.write( pos + 2, inst + 2, 15 );
+            w.write( pos + 18, inst + 18, 18 );
+            w.write( pos + 40, inst + 40, 8 );
+            break;
+        default:
+            w.error = DL_ERROR_MALFORMED_DATA;
+            return;
+    }
+    w.write( pos + 48, &type, sizeof( uint32_t ) );
+}
+
+inline void dl_serializer<test_union_simple>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<test_union_simple>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    switch( s.swap_uint32( inst + 48 ) )
+    {
+        case 0x79CDAD32:
+            s.swap_pod( inst + 0, 4 );
+            break;
+        case 0x79CDAD33:
+            s.swap_pod( inst + 0, 4 );
+            break;
+        case 0x79CDAD34:
+            dl_serializer<Pods>::swap( s, inst + 0 );
+            break;
+        default:
+            s.error = DL_ERROR_MALFORMED_DATA;
+            break;
+    }
+}
+
+inline void dl_serializer<MorePods>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 1 );
+    w.write( pos + 2, inst + 2, 15 );
+    w.write( pos + 18, inst + 18, 18 );
+    w.write( pos + 40, inst + 40, 9 );
+    w.write( pos + 50, inst + 50, 15 );
+    w.write( pos + 66, inst + 66, 18 );
+    w.write( pos + 88, inst + 88, 8 );
+}
+
+inline void dl_serializer<MorePods>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<MorePods>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer<Pods>::swap( s, inst + 0 );
+    dl_serializer<Pods>::swap( s, inst + 48 );
+}
+
+inline void dl_serializer<Pods2>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 8 );
+}
+
+inline void dl_serializer<Pods2>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<Pods2>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+    s.swap_pod( inst + 4, 4 );
+}
+
+inline void dl_serializer<Pod2InStruct>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 16 );
+}
+
+inline void dl_serializer<Pod2InStruct>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<Pod2InStruct>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer<Pods2>::swap( s, inst + 0 );
+    dl_serializer<Pods2>::swap( s, inst + 8 );
+}
+
+inline void dl_serializer<PodPtr>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_ptr<Pods2>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<PodPtr>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    dl_serializer_patch_ptr<Pods2>( p, inst + 0 );
+}
+
+inline void dl_serializer<PodPtr>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer_swap_ptr<Pods2>( s, inst + 0 );
+}
+
+inline void dl_serializer<Pod2InStructInStruct>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 16 );
+}
+
+inline void dl_serializer<Pod2InStructInStruct>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<Pod2InStructInStruct>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer<Pod2InStruct>::swap( s, inst + 0 );
+}
+
+inline void dl_serializer<WithInlineArray>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 12 );
+}
+
+inline void dl_serializer<WithInlineArray>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<WithInlineArray>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pods( inst + 0, 4, 3 );
+}
+
+inline void dl_serializer<WithInlineStructArray>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 24 );
+}
+
+inline void dl_serializer<WithInlineStructArray>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<WithInlineStructArray>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    for( size_t i = 0; i < 3; ++i )
+        dl_serializer<Pods2>::swap( s, inst + 0 + i * dl_serializer<Pods2>::SIZE );
+}
+
+inline void dl_serializer<WithInlineStructStructArray>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 48 );
+}
+
+inline void dl_serializer<WithInlineStructStructArray>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<WithInlineStructStructArray>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    for( size_t i = 0; i < 2; ++i )
+        dl_serializer<WithInlineStructArray>::swap( s, inst + 0 + i * dl_serializer<WithInlineStructArray>::SIZE );
+}
+
+inline void dl_serializer<SubString>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_string( pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<SubString>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<SubString>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_ptr( inst + 0 );
+}
+
+inline void dl_serializer<InlineArrayWithSubString>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    for( size_t i = 0; i < 2; ++i )
+        dl_serializer<SubString>::store( w, pos + 0 + i * dl_serializer<SubString>::SIZE, inst + 0 + i * dl_serializer<SubString>::SIZE );
+}
+
+inline void dl_serializer<InlineArrayWithSubString>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    for( size_t i = 0; i < 2; ++i )
+        dl_serializer<SubString>::patch( p, inst + 0 + i * dl_serializer<SubString>::SIZE );
+}
+
+inline void dl_serializer<InlineArrayWithSubString>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    for( size_t i = 0; i < 2; ++i )
+        dl_serializer<SubString>::swap( s, inst + 0 + i * dl_serializer<SubString>::SIZE );
+}
+
+inline void dl_serializer<PodArray1>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<PodArray1>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<PodArray1>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 4 );
+        if( a != 0x0 )
+            s.swap_pods( a, 4, count );
+    }
+}
+
+inline void dl_serializer<PodArray2>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<PodArray1>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<PodArray2>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            dl_serializer<PodArray1>::patch( p, a + i * dl_serializer_align_up( dl_serializer<PodArray1>::SIZE, dl_serializer<PodArray1>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<PodArray2>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<PodArray1>::SIZE, dl_serializer<PodArray1>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<PodArray1>::swap( s, a + i * dl_serializer_align_up( dl_serializer<PodArray1>::SIZE, dl_serializer<PodArray1>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<StructArray1>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<Pods2>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<StructArray1>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<StructArray1>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<Pods2>::SIZE, dl_serializer<Pods2>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<Pods2>::swap( s, a + i * dl_serializer_align_up( dl_serializer<Pods2>::SIZE, dl_serializer<Pods2>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<StructArrayRecursive1>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<StructArrayRecursive2>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<StructArrayRecursive1>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            dl_serializer<StructArrayRecursive2>::patch( p, a + i * dl_serializer_align_up( dl_serializer<StructArrayRecursive2>::SIZE, dl_serializer<StructArrayRecursive2>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<StructArrayRecursive1>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<StructArrayRecursive2>::SIZE, dl_serializer<StructArrayRecursive2>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<StructArrayRecursive2>::swap( s, a + i * dl_serializer_align_up( dl_serializer<StructArrayRecursive2>::SIZE, dl_serializer<StructArrayRecursive2>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<StructArrayRecursive2>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<StructArrayRecursive1>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<StructArrayRecursive2>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            dl_serializer<StructArrayRecursive1>::patch( p, a + i * dl_serializer_align_up( dl_serializer<StructArrayRecursive1>::SIZE, dl_serializer<StructArrayRecursive1>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<StructArrayRecursive2>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<StructArrayRecursive1>::SIZE, dl_serializer<StructArrayRecursive1>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<StructArrayRecursive1>::swap( s, a + i * dl_serializer_align_up( dl_serializer<StructArrayRecursive1>::SIZE, dl_serializer<StructArrayRecursive1>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<Strings>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_string( pos + 0, inst + 0 );
+    w.store_string( pos + DL_SERIALIZER_PTR_SEL( 4, 8 ), inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<Strings>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+    p.patch( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<Strings>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_ptr( inst + 0 );
+    s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<StringInlineArray>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    for( size_t i = 0; i < 3; ++i )
+        w.store_string( pos + 0 + i * sizeof( char* ), inst + 0 + i * sizeof( char* ) );
+}
+
+inline void dl_serializer<StringInlineArray>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    for( size_t i = 0; i < 3; ++i )
+        p.patch( inst + 0 + i * sizeof( char* ) );
+}
+
+inline void dl_serializer<StringInlineArray>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    for( size_t i = 0; i < 3; ++i )
+        s.swap_ptr( inst + 0 + i * sizeof( char* ) );
+}
+
+inline void dl_serializer<StringArray>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_str_array( pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<StringArray>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            p.patch( a + i * sizeof( char* ) );
+    }
+}
+
+inline void dl_serializer<StringArray>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * sizeof( void* ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                s.swap_ptr( a + i * sizeof( char* ) );
+    }
+}
+
+inline void dl_serializer<TestBits>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 3 );
+}
+
+inline void dl_serializer<TestBits>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<TestBits>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        static const uint16_t fields[] = { 0, 1, 1, 2, 3, 3 };
+        s.swap_bitfield( inst + 0, 1, fields, 3 );
+    }
+    {
+        static const uint16_t fields[] = { 0, 1, 1, 2, 3, 3 };
+        s.swap_bitfield( inst + 2, 1, fields, 3 );
+    }
+}
+
+inline void dl_serializer<MoreBits>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<MoreBits>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<MoreBits>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        static const uint16_t fields[] = { 0, 15, 15, 7 };
+        s.swap_bitfield( inst + 0, 4, fields, 2 );
+    }
+}
+
+inline void dl_serializer<BitBitfield64>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 8 );
+}
+
+inline void dl_serializer<BitBitfield64>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<BitBitfield64>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        static const uint16_t fields[] = { 0, 7, 7, 9, 16, 16, 32, 32 };
+        s.swap_bitfield( inst + 0, 8, fields, 4 );
+    }
+}
+
+inline void dl_serializer<SimplePtr>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_ptr<Pods>( w, pos + 0, inst + 0 );
+    dl_serializer_store_ptr<Pods>( w, pos + DL_SERIALIZER_PTR_SEL( 4, 8 ), inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<SimplePtr>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    dl_serializer_patch_ptr<Pods>( p, inst + 0 );
+    dl_serializer_patch_ptr<Pods>( p, inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<SimplePtr>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer_swap_ptr<Pods>( s, inst + 0 );
+    dl_serializer_swap_ptr<Pods>( s, inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<PtrChain>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 4 );
+    dl_serializer_store_ptr<PtrChain>( w, pos + DL_SERIALIZER_PTR_SEL( 4, 8 ), inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<PtrChain>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    dl_serializer_patch_ptr<PtrChain>( p, inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<PtrChain>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+    dl_serializer_swap_ptr<PtrChain>( s, inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<DoublePtrChain>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 4 );
+    dl_serializer_store_ptr<DoublePtrChain>( w, pos + DL_SERIALIZER_PTR_SEL( 4, 8 ), inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+    dl_serializer_store_ptr<DoublePtrChain>( w, pos + DL_SERIALIZER_PTR_SEL( 8, 16 ), inst + DL_SERIALIZER_PTR_SEL( 8, 16 ) );
+}
+
+inline void dl_serializer<DoublePtrChain>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    dl_serializer_patch_ptr<DoublePtrChain>( p, inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+    dl_serializer_patch_ptr<DoublePtrChain>( p, inst + DL_SERIALIZER_PTR_SEL( 8, 16 ) );
+}
+
+inline void dl_serializer<DoublePtrChain>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+    dl_serializer_swap_ptr<DoublePtrChain>( s, inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+    dl_serializer_swap_ptr<DoublePtrChain>( s, inst + DL_SERIALIZER_PTR_SEL( 8, 16 ) );
+}
+
+inline void dl_serializer<inline_ptr_array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    for( size_t i = 0; i < 3; ++i )
+        dl_serializer_store_ptr<Pods2>( w, pos + 0 + i * sizeof( void* ), inst + 0 + i * sizeof( void* ) );
+}
+
+inline void dl_serializer<inline_ptr_array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    for( size_t i = 0; i < 3; ++i )
+        dl_serializer_patch_ptr<Pods2>( p, inst + 0 + i * sizeof( void* ) );
+}
+
+inline void dl_serializer<inline_ptr_array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    for( size_t i = 0; i < 3; ++i )
+        dl_serializer_swap_ptr<Pods2>( s, inst + 0 + i * sizeof( void* ) );
+}
+
+inline void dl_serializer<ptr_array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_ptr_array<Pods2>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<ptr_array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            dl_serializer_patch_ptr<Pods2>( p, a + i * sizeof( void* ) );
+    }
+}
+
+inline void dl_serializer<ptr_array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * sizeof( void* ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer_swap_ptr<Pods2>( s, a + i * sizeof( void* ) );
+    }
+}
+
+inline void dl_serializer<ptr_inline_array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_ptr<WithInlineArray>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<ptr_inline_array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    dl_serializer_patch_ptr<WithInlineArray>( p, inst + 0 );
+}
+
+inline void dl_serializer<ptr_inline_array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer_swap_ptr<WithInlineArray>( s, inst + 0 );
+}
+
+inline void dl_serializer<ptr_inline_array2>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_ptr<WithInlineStructArray>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<ptr_inline_array2>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    dl_serializer_patch_ptr<WithInlineStructArray>( p, inst + 0 );
+}
+
+inline void dl_serializer<ptr_inline_array2>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer_swap_ptr<WithInlineStructArray>( s, inst + 0 );
+}
+
+inline void dl_serializer<inline_array_pod_ptr>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    for( size_t i = 0; i < 2; ++i )
+        dl_serializer<PodPtr>::store( w, pos + 0 + i * dl_serializer<PodPtr>::SIZE, inst + 0 + i * dl_serializer<PodPtr>::SIZE );
+}
+
+inline void dl_serializer<inline_array_pod_ptr>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    for( size_t i = 0; i < 2; ++i )
+        dl_serializer<PodPtr>::patch( p, inst + 0 + i * dl_serializer<PodPtr>::SIZE );
+}
+
+inline void dl_serializer<inline_array_pod_ptr>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    for( size_t i = 0; i < 2; ++i )
+        dl_serializer<PodPtr>::swap( s, inst + 0 + i * dl_serializer<PodPtr>::SIZE );
+}
+
+inline void dl_serializer<ptr_struct_inline_array_ptr>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_ptr<inline_array_pod_ptr>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<ptr_struct_inline_array_ptr>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    dl_serializer_patch_ptr<inline_array_pod_ptr>( p, inst + 0 );
+}
+
+inline void dl_serializer<ptr_struct_inline_array_ptr>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer_swap_ptr<inline_array_pod_ptr>( s, inst + 0 );
+}
+
+inline void dl_serializer<A128BitAlignedType>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<A128BitAlignedType>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<A128BitAlignedType>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+}
+
+inline void dl_serializer<TestingEnum>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<TestingEnum>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<TestingEnum>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+}
+
+inline void dl_serializer<InlineArrayEnum>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 16 );
+}
+
+inline void dl_serializer<InlineArrayEnum>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<InlineArrayEnum>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pods( inst + 0, 4, 4 );
+}
+
+inline void dl_serializer<ArrayEnum>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<ArrayEnum>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<ArrayEnum>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 4 );
+        if( a != 0x0 )
+            s.swap_pods( a, 4, count );
+    }
+}
+
+inline void dl_serializer<PodsDefaults>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 1 );
+    w.write( pos + 2, inst + 2, 15 );
+    w.write( pos + 18, inst + 18, 18 );
+    w.write( pos + 40, inst + 40, 8 );
+}
+
+inline void dl_serializer<PodsDefaults>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<PodsDefaults>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 2, 2 );
+    s.swap_pod( inst + 4, 4 );
+    s.swap_pod( inst + 8, 8 );
+    s.swap_pod( inst + 18, 2 );
+    s.swap_pod( inst + 20, 4 );
+    s.swap_pod( inst + 24, 8 );
+    s.swap_pod( inst + 32, 4 );
+    s.swap_pod( inst + 40, 8 );
+}
+
+inline void dl_serializer<BitfieldDefaultsMulti>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 2 );
+}
+
+inline void dl_serializer<BitfieldDefaultsMulti>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<BitfieldDefaultsMulti>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        static const uint16_t fields[] = { 0, 1, 1, 1, 2, 2, 4, 2, 6, 2, 8, 2 };
+        s.swap_bitfield( inst + 0, 2, fields, 6 );
+    }
+}
+
+inline void dl_serializer<DefaultStr>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_string( pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<DefaultStr>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<DefaultStr>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_ptr( inst + 0 );
+}
+
+inline void dl_serializer<DefaultEnum>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<DefaultEnum>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<DefaultEnum>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+}
+
+inline void dl_serializer<DefaultStruct>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 8 );
+}
+
+inline void dl_serializer<DefaultStruct>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<DefaultStruct>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer<Pods2>::swap( s, inst + 0 );
+}
+
+inline void dl_serializer<DefaultPtr>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_ptr<Pods>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<DefaultPtr>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    dl_serializer_patch_ptr<Pods>( p, inst + 0 );
+}
+
+inline void dl_serializer<DefaultPtr>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer_swap_ptr<Pods>( s, inst + 0 );
+}
+
+inline void dl_serializer<DefaultInlArrayPod>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 16 );
+}
+
+inline void dl_serializer<DefaultInlArrayPod>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<DefaultInlArrayPod>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pods( inst + 0, 4, 4 );
+}
+
+inline void dl_serializer<DefaultInlArrayStr>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    for( size_t i = 0; i < 4; ++i )
+        w.store_string( pos + 0 + i * sizeof( char* ), inst + 0 + i * sizeof( char* ) );
+}
+
+inline void dl_serializer<DefaultInlArrayStr>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    for( size_t i = 0; i < 4; ++i )
+        p.patch( inst + 0 + i * sizeof( char* ) );
+}
+
+inline void dl_serializer<DefaultInlArrayStr>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    for( size_t i = 0; i < 4; ++i )
+        s.swap_ptr( inst + 0 + i * sizeof( char* ) );
+}
+
+inline void dl_serializer<DefaultInlArrayEnum>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 16 );
+}
+
+inline void dl_serializer<DefaultInlArrayEnum>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<DefaultInlArrayEnum>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pods( inst + 0, 4, 4 );
+}
+
+inline void dl_serializer<DefaultInlArrayArray>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    for( size_t i = 0; i < 2; ++i )
+        dl_serializer<PodArray1>::store( w, pos + 0 + i * dl_serializer<PodArray1>::SIZE, inst + 0 + i * dl_serializer<PodArray1>::SIZE );
+}
+
+inline void dl_serializer<DefaultInlArrayArray>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    for( size_t i = 0; i < 2; ++i )
+        dl_serializer<PodArray1>::patch( p, inst + 0 + i * dl_serializer<PodArray1>::SIZE );
+}
+
+inline void dl_serializer<DefaultInlArrayArray>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    for( size_t i = 0; i < 2; ++i )
+        dl_serializer<PodArray1>::swap( s, inst + 0 + i * dl_serializer<PodArray1>::SIZE );
+}
+
+inline void dl_serializer<DefaultArrayPod>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<DefaultArrayPod>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<DefaultArrayPod>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 4 );
+        if( a != 0x0 )
+            s.swap_pods( a, 4, count );
+    }
+}
+
+inline void dl_serializer<DefaultArrayStr>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_str_array( pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<DefaultArrayStr>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            p.patch( a + i * sizeof( char* ) );
+    }
+}
+
+inline void dl_serializer<DefaultArrayStr>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * sizeof( void* ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                s.swap_ptr( a + i * sizeof( char* ) );
+    }
+}
+
+inline void dl_serializer<DefaultArrayEnum>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<DefaultArrayEnum>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<DefaultArrayEnum>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 4 );
+        if( a != 0x0 )
+            s.swap_pods( a, 4, count );
+    }
+}
+
+inline void dl_serializer<DefaultArrayArray>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<PodArray1>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<DefaultArrayArray>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            dl_serializer<PodArray1>::patch( p, a + i * dl_serializer_align_up( dl_serializer<PodArray1>::SIZE, dl_serializer<PodArray1>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<DefaultArrayArray>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<PodArray1>::SIZE, dl_serializer<PodArray1>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<PodArray1>::swap( s, a + i * dl_serializer_align_up( dl_serializer<PodArray1>::SIZE, dl_serializer<PodArray1>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<DefaultWithOtherDataBefore>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_string( pos + 0, inst + 0 );
+    w.store_string( pos + DL_SERIALIZER_PTR_SEL( 4, 8 ), inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<DefaultWithOtherDataBefore>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+    p.patch( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<DefaultWithOtherDataBefore>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_ptr( inst + 0 );
+    s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<issue_40_1>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + DL_SERIALIZER_PTR_SEL( 8, 16 ), inst + DL_SERIALIZER_PTR_SEL( 8, 16 ), 4 );
+    w.store_str_array( pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<issue_40_1>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            p.patch( a + i * sizeof( char* ) );
+    }
+}
+
+inline void dl_serializer<issue_40_1>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * sizeof( void* ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                s.swap_ptr( a + i * sizeof( char* ) );
+    }
+    s.swap_pod( inst + DL_SERIALIZER_PTR_SEL( 8, 16 ), 4 );
+}
+
+inline void dl_serializer<issue_40_2>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer<issue_40_1>::store( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<issue_40_2>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    dl_serializer<issue_40_1>::patch( p, inst + 0 );
+}
+
+inline void dl_serializer<issue_40_2>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer<issue_40_1>::swap( s, inst + 0 );
+}
+
+inline void dl_serializer<with_alias_enum>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 16 );
+}
+
+inline void dl_serializer<with_alias_enum>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<with_alias_enum>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+    s.swap_pod( inst + 4, 4 );
+    s.swap_pod( inst + 8, 4 );
+    s.swap_pod( inst + 12, 4 );
+}
+
+inline void dl_serializer<BugTest4>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<StringArray>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<BugTest4>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            dl_serializer<StringArray>::patch( p, a + i * dl_serializer_align_up( dl_serializer<StringArray>::SIZE, dl_serializer<StringArray>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<BugTest4>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<StringArray>::SIZE, dl_serializer<StringArray>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<StringArray>::swap( s, a + i * dl_serializer_align_up( dl_serializer<StringArray>::SIZE, dl_serializer<StringArray>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<BugTest5>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<PtrChain>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<BugTest5>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            dl_serializer<PtrChain>::patch( p, a + i * dl_serializer_align_up( dl_serializer<PtrChain>::SIZE, dl_serializer<PtrChain>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<BugTest5>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<PtrChain>::SIZE, dl_serializer<PtrChain>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<PtrChain>::swap( s, a + i * dl_serializer_align_up( dl_serializer<PtrChain>::SIZE, dl_serializer<PtrChain>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<PtrHolder>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_ptr<Pods2>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<PtrHolder>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    dl_serializer_patch_ptr<Pods2>( p, inst + 0 );
+}
+
+inline void dl_serializer<PtrHolder>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer_swap_ptr<Pods2>( s, inst + 0 );
+}
+
+inline void dl_serializer<PtrArray>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<PtrHolder>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<PtrArray>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            dl_serializer<PtrHolder>::patch( p, a + i * dl_serializer_align_up( dl_serializer<PtrHolder>::SIZE, dl_serializer<PtrHolder>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<PtrArray>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<PtrHolder>::SIZE, dl_serializer<PtrHolder>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<PtrHolder>::swap( s, a + i * dl_serializer_align_up( dl_serializer<PtrHolder>::SIZE, dl_serializer<PtrHolder>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<circular_array_ptr_holder>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_ptr<circular_array>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<circular_array_ptr_holder>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    dl_serializer_patch_ptr<circular_array>( p, inst + 0 );
+}
+
+inline void dl_serializer<circular_array_ptr_holder>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer_swap_ptr<circular_array>( s, inst + 0 );
+}
+
+inline void dl_serializer<circular_array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 2 );
+    dl_serializer_store_struct_array<circular_array_ptr_holder>( w, pos + DL_SERIALIZER_PTR_SEL( 4, 8 ), inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<circular_array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) ); i < n; ++i )
+            dl_serializer<circular_array_ptr_holder>::patch( p, a + i * dl_serializer_align_up( dl_serializer<circular_array_ptr_holder>::SIZE, dl_serializer<circular_array_ptr_holder>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<circular_array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 2 );
+    {
+        uintptr_t offset = s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+        size_t    count  = s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<circular_array_ptr_holder>::SIZE, dl_serializer<circular_array_ptr_holder>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<circular_array_ptr_holder>::swap( s, a + i * dl_serializer_align_up( dl_serializer<circular_array_ptr_holder>::SIZE, dl_serializer<circular_array_ptr_holder>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<str_before_array_bug_arr_type>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_string( pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<str_before_array_bug_arr_type>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<str_before_array_bug_arr_type>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_ptr( inst + 0 );
+}
+
+inline void dl_serializer<str_before_array_bug>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_string( pos + 0, inst + 0 );
+    dl_serializer_store_struct_array<str_before_array_bug_arr_type>( w, pos + DL_SERIALIZER_PTR_SEL( 4, 8 ), inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<str_before_array_bug>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) ); i < n; ++i )
+            dl_serializer<str_before_array_bug_arr_type>::patch( p, a + i * dl_serializer_align_up( dl_serializer<str_before_array_bug_arr_type>::SIZE, dl_serializer<str_before_array_bug_arr_type>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<str_before_array_bug>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_ptr( inst + 0 );
+    {
+        uintptr_t offset = s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+        size_t    count  = s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<str_before_array_bug_arr_type>::SIZE, dl_serializer<str_before_array_bug_arr_type>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<str_before_array_bug_arr_type>::swap( s, a + i * dl_serializer_align_up( dl_serializer<str_before_array_bug_arr_type>::SIZE, dl_serializer<str_before_array_bug_arr_type>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<bug_array_alignment_struct>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 4 );
+    w.write( pos + 8, inst + 8, 12 );
+}
+
+inline void dl_serializer<bug_array_alignment_struct>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<bug_array_alignment_struct>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+    s.swap_pod( inst + 8, 8 );
+    s.swap_pod( inst + 16, 4 );
+}
+
+inline void dl_serializer<bug_alignment_struct>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 4 );
+    w.write( pos + 128, inst + 128, 4 );
+    dl_serializer_store_ptr<Pods2>( w, pos + 256, inst + 256 );
+}
+
+inline void dl_serializer<bug_alignment_struct>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    dl_serializer_patch_ptr<Pods2>( p, inst + 256 );
+}
+
+inline void dl_serializer<bug_alignment_struct>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+    dl_serializer<A128BitAlignedType>::swap( s, inst + 128 );
+    dl_serializer_swap_ptr<Pods2>( s, inst + 256 );
+}
+
+inline void dl_serializer<bug_array_alignment>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<bug_array_alignment_struct>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<bug_array_alignment>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<bug_array_alignment>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<bug_array_alignment_struct>::SIZE, dl_serializer<bug_array_alignment_struct>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<bug_array_alignment_struct>::swap( s, a + i * dl_serializer_align_up( dl_serializer<bug_array_alignment_struct>::SIZE, dl_serializer<bug_array_alignment_struct>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<test_array_pad_1>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + DL_SERIALIZER_PTR_SEL( 8, 16 ), inst + DL_SERIALIZER_PTR_SEL( 8, 16 ), 4 );
+    w.store_pod_array( pos + 0, inst + 0, 1 );
+}
+
+inline void dl_serializer<test_array_pad_1>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<test_array_pad_1>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 1 );
+        if( a != 0x0 )
+            s.swap_pods( a, 1, count );
+    }
+    s.swap_pod( inst + DL_SERIALIZER_PTR_SEL( 8, 16 ), 4 );
+}
+
+inline void dl_serializer<test_array_pad>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<test_array_pad_1>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<test_array_pad>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            dl_serializer<test_array_pad_1>::patch( p, a + i * dl_serializer_align_up( dl_serializer<test_array_pad_1>::SIZE, dl_serializer<test_array_pad_1>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<test_array_pad>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<test_array_pad_1>::SIZE, dl_serializer<test_array_pad_1>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<test_array_pad_1>::swap( s, a + i * dl_serializer_align_up( dl_serializer<test_array_pad_1>::SIZE, dl_serializer<test_array_pad_1>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<test_inline_array_size_from_enum>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 40 );
+}
+
+inline void dl_serializer<test_inline_array_size_from_enum>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<test_inline_array_size_from_enum>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pods( inst + 0, 4, 7 );
+    s.swap_pods( inst + 28, 4, 3 );
+}
+
+inline void dl_serializer<test_inline_array_of_unions>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 168 );
+}
+
+inline void dl_serializer<test_inline_array_of_unions>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<test_inline_array_of_unions>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    for( size_t i = 0; i < 3; ++i )
+        dl_serializer<test_union_simple>::swap( s, inst + 0 + i * dl_serializer<test_union_simple>::SIZE );
+}
+
+inline void dl_serializer<single_int>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<single_int>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<single_int>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+}
+
+inline void dl_serializer<struct_with_a_bitfield>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 13 );
+}
+
+inline void dl_serializer<struct_with_a_bitfield>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<struct_with_a_bitfield>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 8 );
+    s.swap_pod( inst + 8, 4 );
+    {
+        static const uint16_t fields[] = { 0, 1 };
+        s.swap_bitfield( inst + 12, 1, fields, 1 );
+    }
+}
+
+inline void dl_serializer<struct_with_some_defaults>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 20 );
+}
+
+inline void dl_serializer<struct_with_some_defaults>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<struct_with_some_defaults>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+    s.swap_pod( inst + 4, 4 );
+    s.swap_pod( inst + 8, 4 );
+    s.swap_pod( inst + 12, 4 );
+    s.swap_pod( inst + 16, 4 );
+}
+
+inline void dl_serializer<struct_with_one_member_and_default>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<struct_with_one_member_and_default>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<struct_with_one_member_and_default>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+}
+
+inline void dl_serializer<single_default_uint32>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<single_default_uint32>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<single_default_uint32>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+}
+
+inline void dl_serializer<test_inline_array_default_struct1>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 12 );
+}
+
+inline void dl_serializer<test_inline_array_default_struct1>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<test_inline_array_default_struct1>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    for( size_t i = 0; i < 3; ++i )
+        dl_serializer<single_default_uint32>::swap( s, inst + 0 + i * dl_serializer<single_default_uint32>::SIZE );
+}
+
+inline void dl_serializer<test_inline_array_default_struct2>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 12 );
+}
+
+inline void dl_serializer<test_inline_array_default_struct2>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<test_inline_array_default_struct2>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    for( size_t i = 0; i < 3; ++i )
+        dl_serializer<single_default_uint32>::swap( s, inst + 0 + i * dl_serializer<single_default_uint32>::SIZE );
+}
+
+inline void dl_serializer<vector2_type>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 8 );
+}
+
+inline void dl_serializer<vector2_type>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<vector2_type>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+    s.swap_pod( inst + 4, 4 );
+}
+
+inline void dl_serializer<member_with_array_of_vector>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 16 );
+}
+
+inline void dl_serializer<member_with_array_of_vector>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<member_with_array_of_vector>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    for( size_t i = 0; i < 2; ++i )
+        dl_serializer<vector2_type>::swap( s, inst + 0 + i * dl_serializer<vector2_type>::SIZE );
+}
+
+inline void dl_serializer<struct_with_member_with_array_of_vector>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 16 );
+}
+
+inline void dl_serializer<struct_with_member_with_array_of_vector>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<struct_with_member_with_array_of_vector>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer<member_with_array_of_vector>::swap( s, inst + 0 );
+}
+
+inline void dl_serializer<union_with_weird_members>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    uint32_t type;
+    memcpy( &type, inst + 24, sizeof( uint32_t ) );
+    switch( type )
+    {
+        case 0xD7D12469:
+            w.write( pos + 0, inst + 0, 13 );
+            break;
+        case 0xD7D1246A:
+            w.write( pos + 0, inst + 0, 20 );
+            break;
+        case 0xD7D1246B:
+            w.write( pos + 0, inst + 0, 4 );
+            break;
+        default:
+            w.error = DL_ERROR_MALFORMED_DATA;
+            return;
+    }
+    w.write( pos + 24, &type, sizeof( uint32_t ) );
+}
+
+inline void dl_serializer<union_with_weird_members>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<union_with_weird_members>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    switch( s.swap_uint32( inst + 24 ) )
+    {
+        case 0xD7D12469:
+            dl_serializer<struct_with_a_bitfield>::swap( s, inst + 0 );
+            break;
+        case 0xD7D1246A:
+            dl_serializer<struct_with_some_defaults>::swap( s, inst + 0 );
+            break;
+        case 0xD7D1246B:
+            dl_serializer<struct_with_one_member_and_default>::swap( s, inst + 0 );
+            break;
+        default:
+            s.error = DL_ERROR_MALFORMED_DATA;
+            break;
+    }
+}
+
+inline void dl_serializer<test_union_inline_array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    uint32_t type;
+    memcpy( &type, inst + 24, sizeof( uint32_t ) );
+    switch( type )
+    {
+        case 0xF975B585:
+            w.write( pos + 0, inst + 0, 4 );
+            break;
+        case 0xF975B586:
+            w.write( pos + 0, inst + 0, 24 );
+            break;
+        default:
+            w.error = DL_ERROR_MALFORMED_DATA;
+            return;
+    }
+    w.write( pos + 24, &type, sizeof( uint32_t ) );
+}
+
+inline void dl_serializer<test_union_inline_array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<test_union_inline_array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    switch( s.swap_uint32( inst + 24 ) )
+    {
+        case 0xF975B585:
+            s.swap_pod( inst + 0, 4 );
+            break;
+        case 0xF975B586:
+            s.swap_pods( inst + 0, 4, 6 );
+            break;
+        default:
+            s.error = DL_ERROR_MALFORMED_DATA;
+            break;
+    }
+}
+
+inline void dl_serializer<test_union_array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    uint32_t type;
+    memcpy( &type, inst + DL_SERIALIZER_PTR_SEL( 8, 16 ), sizeof( uint32_t ) );
+    switch( type )
+    {
+        case 0x50038067:
+            w.write( pos + 0, inst + 0, 4 );
+            break;
+        case 0x50038068:
+            w.store_pod_array( pos + 0, inst + 0, 4 );
+            break;
+        default:
+            w.error = DL_ERROR_MALFORMED_DATA;
+            return;
+    }
+    w.write( pos + DL_SERIALIZER_PTR_SEL( 8, 16 ), &type, sizeof( uint32_t ) );
+}
+
+inline void dl_serializer<test_union_array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    uint32_t type;
+    memcpy( &type, inst + DL_SERIALIZER_PTR_SEL( 8, 16 ), sizeof( uint32_t ) );
+    switch( type )
+    {
+        case 0x50038067:
+            break;
+        case 0x50038068:
+            p.patch( inst + 0 );
+            break;
+        default:
+            break;
+    }
+}
+
+inline void dl_serializer<test_union_array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    switch( s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 8, 16 ) ) )
+    {
+        case 0x50038067:
+            s.swap_pod( inst + 0, 4 );
+            break;
+        case 0x50038068:
+            {
+                uintptr_t offset = s.swap_ptr( inst + 0 );
+                size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+                unsigned char* a = s.subdata( offset, count * 4 );
+                if( a != 0x0 )
+                    s.swap_pods( a, 4, count );
+            }
+            break;
+        default:
+            s.error = DL_ERROR_MALFORMED_DATA;
+            break;
+    }
+}
+
+inline void dl_serializer<test_union_ptr>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    uint32_t type;
+    memcpy( &type, inst + DL_SERIALIZER_PTR_SEL( 4, 8 ), sizeof( uint32_t ) );
+    switch( type )
+    {
+        case 0x7FF4E33E:
+            dl_serializer_store_ptr<Pods>( w, pos + 0, inst + 0 );
+            break;
+        case 0x7FF4E33F:
+            dl_serializer_store_ptr<SubString>( w, pos + 0, inst + 0 );
+            break;
+        case 0x7FF4E340:
+            dl_serializer_store_ptr<WithInlineArray>( w, pos + 0, inst + 0 );
+            break;
+        default:
+            w.error = DL_ERROR_MALFORMED_DATA;
+            return;
+    }
+    w.write( pos + DL_SERIALIZER_PTR_SEL( 4, 8 ), &type, sizeof( uint32_t ) );
+}
+
+inline void dl_serializer<test_union_ptr>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    uint32_t type;
+    memcpy( &type, inst + DL_SERIALIZER_PTR_SEL( 4, 8 ), sizeof( uint32_t ) );
+    switch( type )
+    {
+        case 0x7FF4E33E:
+            dl_serializer_patch_ptr<Pods>( p, inst + 0 );
+            break;
+        case 0x7FF4E33F:
+            dl_serializer_patch_ptr<SubString>( p, inst + 0 );
+            break;
+        case 0x7FF4E340:
+            dl_serializer_patch_ptr<WithInlineArray>( p, inst + 0 );
+            break;
+        default:
+            break;
+    }
+}
+
+inline void dl_serializer<test_union_ptr>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    switch( s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) ) )
+    {
+        case 0x7FF4E33E:
+            dl_serializer_swap_ptr<Pods>( s, inst + 0 );
+            break;
+        case 0x7FF4E33F:
+            dl_serializer_swap_ptr<SubString>( s, inst + 0 );
+            break;
+        case 0x7FF4E340:
+            dl_serializer_swap_ptr<WithInlineArray>( s, inst + 0 );
+            break;
+        default:
+            s.error = DL_ERROR_MALFORMED_DATA;
+            break;
+    }
+}
+
+inline void dl_serializer<test_has_union_array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    uint32_t type;
+    memcpy( &type, inst + DL_SERIALIZER_PTR_SEL( 8, 16 ), sizeof( uint32_t ) );
+    switch( type )
+    {
+        case 0x6E33AAC2:
+            w.store_pod_array( pos + 0, inst + 0, 4 );
+            break;
+        case 0x6E33AAC3:
+            w.store_pod_array( pos + 0, inst + 0, 4 );
+            break;
+        default:
+            w.error = DL_ERROR_MALFORMED_DATA;
+            return;
+    }
+    w.write( pos + DL_SERIALIZER_PTR_SEL( 8, 16 ), &type, sizeof( uint32_t ) );
+}
+
+inline void dl_serializer<test_has_union_array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    uint32_t type;
+    memcpy( &type, inst + DL_SERIALIZER_PTR_SEL( 8, 16 ), sizeof( uint32_t ) );
+    switch( type )
+    {
+        case 0x6E33AAC2:
+            p.patch( inst + 0 );
+            break;
+        case 0x6E33AAC3:
+            p.patch( inst + 0 );
+            break;
+        default:
+            break;
+    }
+}
+
+inline void dl_serializer<test_has_union_array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    switch( s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 8, 16 ) ) )
+    {
+        case 0x6E33AAC2:
+            {
+                uintptr_t offset = s.swap_ptr( inst + 0 );
+                size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+                unsigned char* a = s.subdata( offset, count * 4 );
+                if( a != 0x0 )
+                    s.swap_pods( a, 4, count );
+            }
+            break;
+        case 0x6E33AAC3:
+            {
+                uintptr_t offset = s.swap_ptr( inst + 0 );
+                size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+                unsigned char* a = s.subdata( offset, count * 4 );
+                if( a != 0x0 )
+                    s.swap_pods( a, 4, count );
+            }
+            break;
+        default:
+            s.error = DL_ERROR_MALFORMED_DATA;
+            break;
+    }
+}
+
+inline void dl_serializer<union_with_weird_members_event>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 32, inst + 32, 4 );
+    dl_serializer<union_with_weird_members>::store( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<union_with_weird_members_event>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<union_with_weird_members_event>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer<union_with_weird_members>::swap( s, inst + 0 );
+    s.swap_pod( inst + 32, 4 );
+}
+
+inline void dl_serializer<struct_with_array_of_weird_unions>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<union_with_weird_members_event>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<struct_with_array_of_weird_unions>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<struct_with_array_of_weird_unions>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<union_with_weird_members_event>::SIZE, dl_serializer<union_with_weird_members_event>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<union_with_weird_members_event>::swap( s, a + i * dl_serializer_align_up( dl_serializer<union_with_weird_members_event>::SIZE, dl_serializer<union_with_weird_members_event>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<test_with_union_array>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<test_has_union_array>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<test_with_union_array>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            dl_serializer<test_has_union_array>::patch( p, a + i * dl_serializer_align_up( dl_serializer<test_has_union_array>::SIZE, dl_serializer<test_has_union_array>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<test_with_union_array>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<test_has_union_array>::SIZE, dl_serializer<test_has_union_array>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<test_has_union_array>::swap( s, a + i * dl_serializer_align_up( dl_serializer<test_has_union_array>::SIZE, dl_serializer<test_has_union_array>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<parallel_pack_item>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_string( pos + 0, inst + 0 );
+    w.store_pod_array( pos + DL_SERIALIZER_PTR_SEL( 4, 8 ), inst + DL_SERIALIZER_PTR_SEL( 4, 8 ), 1 );
+    w.store_pod_array( pos + DL_SERIALIZER_PTR_SEL( 12, 24 ), inst + DL_SERIALIZER_PTR_SEL( 12, 24 ), 8 );
+    w.store_str_array( pos + DL_SERIALIZER_PTR_SEL( 20, 40 ), inst + DL_SERIALIZER_PTR_SEL( 20, 40 ) );
+    dl_serializer_store_struct_array<PodArray1>( w, pos + DL_SERIALIZER_PTR_SEL( 28, 56 ), inst + DL_SERIALIZER_PTR_SEL( 28, 56 ) );
+    dl_serializer_store_ptr<Pods2>( w, pos + DL_SERIALIZER_PTR_SEL( 36, 72 ), inst + DL_SERIALIZER_PTR_SEL( 36, 72 ) );
+    w.store_string( pos + DL_SERIALIZER_PTR_SEL( 40, 80 ), inst + DL_SERIALIZER_PTR_SEL( 40, 80 ) );
+    w.store_pod_array( pos + DL_SERIALIZER_PTR_SEL( 44, 88 ), inst + DL_SERIALIZER_PTR_SEL( 44, 88 ), 4 );
+}
+
+inline void dl_serializer<parallel_pack_item>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+    p.patch( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+    p.patch( inst + DL_SERIALIZER_PTR_SEL( 12, 24 ) );
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + DL_SERIALIZER_PTR_SEL( 20, 40 ) );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + DL_SERIALIZER_PTR_SEL( 20, 40 ) ); i < n; ++i )
+            p.patch( a + i * sizeof( char* ) );
+    }
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + DL_SERIALIZER_PTR_SEL( 28, 56 ) );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + DL_SERIALIZER_PTR_SEL( 28, 56 ) ); i < n; ++i )
+            dl_serializer<PodArray1>::patch( p, a + i * dl_serializer_align_up( dl_serializer<PodArray1>::SIZE, dl_serializer<PodArray1>::ALIGNMENT ) );
+    }
+    dl_serializer_patch_ptr<Pods2>( p, inst + DL_SERIALIZER_PTR_SEL( 36, 72 ) );
+    p.patch( inst + DL_SERIALIZER_PTR_SEL( 40, 80 ) );
+    p.patch( inst + DL_SERIALIZER_PTR_SEL( 44, 88 ) );
+}
+
+inline void dl_serializer<parallel_pack_item>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_ptr( inst + 0 );
+    {
+        uintptr_t offset = s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+        size_t    count  = s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 1 );
+        if( a != 0x0 )
+            s.swap_pods( a, 1, count );
+    }
+    {
+        uintptr_t offset = s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 12, 24 ) );
+        size_t    count  = s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 12, 24 ) + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 8 );
+        if( a != 0x0 )
+            s.swap_pods( a, 8, count );
+    }
+    {
+        uintptr_t offset = s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 20, 40 ) );
+        size_t    count  = s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 20, 40 ) + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * sizeof( void* ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                s.swap_ptr( a + i * sizeof( char* ) );
+    }
+    {
+        uintptr_t offset = s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 28, 56 ) );
+        size_t    count  = s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 28, 56 ) + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<PodArray1>::SIZE, dl_serializer<PodArray1>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<PodArray1>::swap( s, a + i * dl_serializer_align_up( dl_serializer<PodArray1>::SIZE, dl_serializer<PodArray1>::ALIGNMENT ) );
+    }
+    dl_serializer_swap_ptr<Pods2>( s, inst + DL_SERIALIZER_PTR_SEL( 36, 72 ) );
+    s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 40, 80 ) );
+    {
+        uintptr_t offset = s.swap_ptr( inst + DL_SERIALIZER_PTR_SEL( 44, 88 ) );
+        size_t    count  = s.swap_uint32( inst + DL_SERIALIZER_PTR_SEL( 44, 88 ) + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 4 );
+        if( a != 0x0 )
+            s.swap_pods( a, 4, count );
+    }
+}
+
+inline void dl_serializer<parallel_pack_root>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<parallel_pack_item>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<parallel_pack_root>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            dl_serializer<parallel_pack_item>::patch( p, a + i * dl_serializer_align_up( dl_serializer<parallel_pack_item>::SIZE, dl_serializer<parallel_pack_item>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<parallel_pack_root>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<parallel_pack_item>::SIZE, dl_serializer<parallel_pack_item>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<parallel_pack_item>::swap( s, a + i * dl_serializer_align_up( dl_serializer<parallel_pack_item>::SIZE, dl_serializer<parallel_pack_item>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<test_lots_of_members>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 80 );
+}
+
+inline void dl_serializer<test_lots_of_members>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<test_lots_of_members>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+}
+
+#endif // __DL_AUTOGEN_SERIALIZERS_UNITTEST_SERIALIZERS_H_INCLUDED
+
@@ -0,0 +1,1350 @@
+0x7b, 0x0a, 0x09, 0x22, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75,
+0x6e, 0x69, 0x74, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x22, 0x2c, 0x0a, 0x0a, 0x09, 0x22, 0x63, 0x5f,
+0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x22, 0x3c,
+0x73, 0x74, 0x64, 0x69, 0x6f, 0x2e, 0x68, 0x3e, 0x22, 0x20, 0x5d, 0x2c, 0x20, 0x2f, 0x2f, 0x20,
+0x6a, 0x75, 0x73, 0x74, 0x20, 0x74, 0x65, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x2e, 0x2e, 0x2e, 0x20,
+0x6e, 0x6f, 0x74, 0x20, 0x61, 0x63, 0x74, 0x75, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x6e, 0x65, 0x65,
+0x64, 0x65, 0x64, 0x21, 0x0a, 0x0a, 0x09, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x73, 0x22, 0x20, 0x3a,
+0x20, 0x7b, 0x0a, 0x09, 0x09, 0x22, 0x54, 0x65, 0x73, 0x74, 0x45, 0x6e, 0x75, 0x6d, 0x31, 0x22,
+0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x22,
+0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x22, 0x54, 0x45, 0x53, 0x54, 0x45, 0x4e,
+0x55, 0x4d, 0x31, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x31, 0x22, 0x20, 0x3a, 0x20, 0x30, 0x2c,
+0x0a, 0x09, 0x09, 0x09, 0x09, 0x22, 0x54, 0x45, 0x53, 0x54, 0x45, 0x4e, 0x55, 0x4d, 0x31, 0x5f,
+0x56, 0x41, 0x4c, 0x55, 0x45, 0x32, 0x22, 0x20, 0x3a, 0x20, 0x31, 0x2c, 0x0a, 0x09, 0x09, 0x09,
+0x09, 0x22, 0x54, 0x45, 0x53, 0x54, 0x45, 0x4e, 0x55, 0x4d, 0x31, 0x5f, 0x56, 0x41, 0x4c, 0x55,
+0x45, 0x33, 0x22, 0x20, 0x3a, 0x20, 0x32, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x22, 0x54, 0x45,
+0x53, 0x54, 0x45, 0x4e, 0x55, 0x4d, 0x31, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x34, 0x22, 0x20,
+0x3a, 0x20, 0x33, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09,
+0x09, 0x22, 0x54, 0x65, 0x73, 0x74, 0x45, 0x6e, 0x75, 0x6d, 0x32, 0x22, 0x20, 0x3a, 0x20, 0x7b,
+0x0a, 0x09, 0x09, 0x09, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b,
+0x0a, 0x09, 0x09, 0x09, 0x09, 0x22, 0x54, 0x45, 0x53, 0x54, 0x45, 0x4e, 0x55, 0x4d, 0x32, 0x5f,
+0x56, 0x41, 0x4c, 0x55, 0x45, 0x31, 0x22, 0x20, 0x3a, 0x20, 0x37, 0x2c, 0x0a, 0x09, 0x09, 0x09,
+0x09, 0x22, 0x54, 0x45, 0x53, 0x54, 0x45, 0x4e, 0x55, 0x4d, 0x32, 0x5f, 0x56, 0x41, 0x4c, 0x55,
+0x45, 0x32, 0x22, 0x20, 0x3a, 0x20, 0x31, 0x33, 0x33, 0x37, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09,
+0x22, 0x54, 0x45, 0x53, 0x54, 0x45, 0x4e, 0x55, 0x4d, 0x32, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45,
+0x33, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x31, 0x33, 0x33, 0x38, 0x2c, 0x20, 0x22, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x77, 0x68, 0x69, 0x70, 0x70, 0x7a, 0x6f, 0x72, 0x65, 0x73, 0x21, 0x22,
+0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x22, 0x54, 0x45, 0x53, 0x54, 0x45, 0x4e, 0x55,
+0x4d, 0x32, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x34, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22,
+0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x31, 0x33, 0x33, 0x37, 0x2c, 0x20, 0x22,
+0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x77, 0x68, 0x6f, 0x70,
+0x70, 0x61, 0x21, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x7d, 0x2c,
+0x0a, 0x0a, 0x09, 0x09, 0x22, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x5f, 0x61, 0x6c, 0x69, 0x61, 0x73,
+0x5f, 0x65, 0x6e, 0x75, 0x6d, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x22,
+0x4d, 0x55, 0x4c, 0x54, 0x49, 0x5f, 0x41, 0x4c, 0x49, 0x41, 0x53, 0x31, 0x22, 0x20, 0x3a, 0x20,
+0x7b, 0x20, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x37, 0x2c, 0x20, 0x22,
+0x61, 0x6c, 0x69, 0x61, 0x73, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x22, 0x61, 0x6c,
+0x69, 0x61, 0x73, 0x31, 0x22, 0x2c, 0x20, 0x22, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x32, 0x22, 0x2c,
+0x20, 0x22, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x33, 0x22, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09,
+0x09, 0x09, 0x09, 0x22, 0x4d, 0x55, 0x4c, 0x54, 0x49, 0x5f, 0x41, 0x4c, 0x49, 0x41, 0x53, 0x32,
+0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x38, 0x2c, 0x20, 0x22, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b,
+0x20, 0x22, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x34, 0x22, 0x20, 0x5d, 0x20, 0x7d, 0x0a, 0x09, 0x09,
+0x09, 0x7d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x45, 0x6e, 0x75, 0x6d,
+0x57, 0x69, 0x74, 0x68, 0x4d, 0x65, 0x74, 0x61, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09,
+0x09, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x22, 0x54, 0x45, 0x53, 0x54, 0x45, 0x4e, 0x55, 0x4d, 0x57, 0x49, 0x54, 0x48, 0x4d,
+0x45, 0x54, 0x41, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x22, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x31, 0x33, 0x33, 0x37, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x09, 0x22, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x77, 0x68, 0x6f, 0x70, 0x70, 0x61, 0x21, 0x22, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x22,
+0x6d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x53, 0x75, 0x62, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67,
+0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x53, 0x74, 0x72, 0x22, 0x3a, 0x20, 0x22, 0x61, 0x70,
+0x61, 0x22, 0x20, 0x7d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x53, 0x75, 0x62, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20,
+0x22, 0x53, 0x74, 0x72, 0x22, 0x3a, 0x20, 0x22, 0x62, 0x61, 0x6e, 0x61, 0x6e, 0x22, 0x20, 0x7d,
+0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7d, 0x0a,
+0x09, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x74, 0x61, 0x64, 0x61,
+0x74, 0x61, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x53,
+0x75, 0x62, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x53,
+0x74, 0x72, 0x22, 0x3a, 0x20, 0x22, 0x61, 0x70, 0x61, 0x22, 0x20, 0x7d, 0x20, 0x7d, 0x2c, 0x0a,
+0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x53, 0x75, 0x62, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67,
+0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x53, 0x74, 0x72, 0x22, 0x3a, 0x20, 0x22, 0x62, 0x61,
+0x6e, 0x61, 0x6e, 0x22, 0x20, 0x7d, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09,
+0x7d, 0x0a, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x22, 0x74, 0x79, 0x70, 0x65, 0x73, 0x22, 0x20,
+0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x22, 0x75, 0x6e, 0x75, 0x73, 0x65, 0x64, 0x22, 0x20, 0x3a,
+0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b,
+0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d,
+0x62, 0x65, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e,
+0x74, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
+0x69, 0x6e, 0x20, 0x75, 0x6e, 0x69, 0x74, 0x74, 0x65, 0x73, 0x74, 0x73, 0x20, 0x74, 0x6f, 0x20,
+0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x73,
+0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x50, 0x6f, 0x64,
+0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x38, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x20, 0x20,
+0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x69, 0x31, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x22, 0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x33,
+0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e,
+0x74, 0x33, 0x32, 0x22, 0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x36, 0x34, 0x22, 0x2c, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x22, 0x20,
+0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x38, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x09,
+0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75,
+0x31, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75,
+0x69, 0x6e, 0x74, 0x31, 0x36, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x33, 0x32, 0x22, 0x2c, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32,
+0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x36, 0x34, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x22, 0x20, 0x7d, 0x2c, 0x0a,
+0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x66, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x66, 0x70, 0x33, 0x32, 0x22, 0x20, 0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b,
+0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x36, 0x34, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x36, 0x34, 0x22,
+0x20, 0x20, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a,
+0x09, 0x09, 0x22, 0x69, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x20, 0x20, 0x3a, 0x20,
+0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20,
+0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22,
+0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74,
+0x38, 0x5b, 0x5d, 0x22, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x31, 0x36, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22,
+0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20,
+0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5b, 0x5d, 0x22, 0x20, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d,
+0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x33, 0x32, 0x41, 0x72,
+0x72, 0x61, 0x79, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5b, 0x5d, 0x22, 0x20, 0x20, 0x7d,
+0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69,
+0x36, 0x34, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d,
+0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5b, 0x5d,
+0x22, 0x20, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x22, 0x75, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x20, 0x20, 0x3a, 0x20,
+0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20,
+0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22,
+0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e,
+0x74, 0x38, 0x5b, 0x5d, 0x22, 0x20, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x31, 0x36, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22,
+0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20,
+0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d,
+0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75, 0x33, 0x32, 0x41, 0x72,
+0x72, 0x61, 0x79, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5b, 0x5d, 0x22, 0x20, 0x7d,
+0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x75,
+0x36, 0x34, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d,
+0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5b,
+0x5d, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x22, 0x66, 0x70, 0x33, 0x32, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x3a, 0x20,
+0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20,
+0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22,
+0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x33,
+0x32, 0x5b, 0x5d, 0x22, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x66, 0x70, 0x36, 0x34, 0x41, 0x72, 0x72, 0x61, 0x79,
+0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20,
+0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x66, 0x70, 0x36, 0x34, 0x5b, 0x5d, 0x22, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d,
+0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x73, 0x74, 0x72, 0x41, 0x72,
+0x72, 0x61, 0x79, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5b, 0x5d, 0x22, 0x20, 0x7d,
+0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x70,
+0x74, 0x72, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d,
+0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x73, 0x2a, 0x5b, 0x5d,
+0x22, 0x20, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x22, 0x65, 0x6e, 0x75, 0x6d, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x3a, 0x20,
+0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20,
+0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22,
+0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x54, 0x65, 0x73,
+0x74, 0x45, 0x6e, 0x75, 0x6d, 0x31, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c,
+0x74, 0x5f, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20,
+0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x6d, 0x70, 0x74,
+0x79, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69,
+0x6e, 0x74, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22,
+0x20, 0x3a, 0x20, 0x30, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f, 0x6d, 0x65, 0x74, 0x61, 0x22, 0x20, 0x3a,
+0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20,
+0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x38, 0x22, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x09, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x74, 0x61, 0x64, 0x61,
+0x74, 0x61, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x53, 0x75, 0x62, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20,
+0x22, 0x53, 0x74, 0x72, 0x22, 0x3a, 0x20, 0x22, 0x61, 0x70, 0x61, 0x22, 0x20, 0x7d, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x53, 0x75, 0x62, 0x53, 0x74,
+0x72, 0x69, 0x6e, 0x67, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x53, 0x74, 0x72, 0x22, 0x3a,
+0x20, 0x22, 0x62, 0x61, 0x6e, 0x61, 0x6e, 0x22, 0x20, 0x7d, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09,
+0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x2c, 0x0a,
+0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61, 0x22, 0x20, 0x3a, 0x20,
+0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x53, 0x75, 0x62, 0x53, 0x74, 0x72, 0x69,
+0x6e, 0x67, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x53, 0x74, 0x72, 0x22, 0x3a, 0x20, 0x22,
+0x61, 0x70, 0x61, 0x22, 0x20, 0x7d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x53, 0x75, 0x62, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20,
+0x22, 0x53, 0x74, 0x72, 0x22, 0x3a, 0x20, 0x22, 0x62, 0x61, 0x6e, 0x61, 0x6e, 0x22, 0x20, 0x7d,
+0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x2c, 0x0a,
+0x0a, 0x09, 0x22, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09,
+0x09, 0x22, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x5f, 0x73, 0x69, 0x6d,
+0x70, 0x6c, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d,
+0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x74, 0x65, 0x6d, 0x31, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x74, 0x65, 0x6d, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x33, 0x32, 0x22, 0x20, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x69, 0x74, 0x65, 0x6d, 0x33, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x73, 0x22, 0x2c, 0x20, 0x22, 0x6d, 0x65, 0x74, 0x61,
+0x64, 0x61, 0x74, 0x61, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x53, 0x75, 0x62,
+0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x53, 0x74, 0x72,
+0x22, 0x3a, 0x20, 0x22, 0x69, 0x74, 0x65, 0x6d, 0x33, 0x22, 0x20, 0x7d, 0x20, 0x7d, 0x20, 0x5d,
+0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x74,
+0x61, 0x64, 0x61, 0x74, 0x61, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b,
+0x20, 0x22, 0x53, 0x75, 0x62, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22, 0x20, 0x3a, 0x20, 0x7b,
+0x20, 0x22, 0x53, 0x74, 0x72, 0x22, 0x3a, 0x20, 0x22, 0x61, 0x70, 0x61, 0x22, 0x20, 0x7d, 0x20,
+0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x53, 0x75, 0x62, 0x53, 0x74, 0x72,
+0x69, 0x6e, 0x67, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x53, 0x74, 0x72, 0x22, 0x3a, 0x20,
+0x22, 0x62, 0x61, 0x6e, 0x61, 0x6e, 0x22, 0x20, 0x7d, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d,
+0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x22, 0x4d, 0x6f, 0x72, 0x65, 0x50, 0x6f,
+0x64, 0x73, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d,
+0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x73, 0x31, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x73, 0x22, 0x20, 0x20, 0x7d,
+0x2c, 0x20, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50,
+0x6f, 0x64, 0x73, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x50, 0x6f, 0x64, 0x73, 0x22, 0x20, 0x7d, 0x20, 0x20, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a,
+0x09, 0x09, 0x22, 0x50, 0x6f, 0x64, 0x73, 0x32, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a,
+0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x49,
+0x6e, 0x74, 0x31, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x2c, 0x20, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x49, 0x6e, 0x74, 0x32, 0x22, 0x2c, 0x20, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32,
+0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x50, 0x6f, 0x64, 0x32,
+0x49, 0x6e, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d,
+0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x31, 0x22, 0x2c, 0x20, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x73, 0x32, 0x22,
+0x20, 0x7d, 0x2c, 0x20, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x50, 0x6f, 0x64, 0x32, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x73, 0x32, 0x22, 0x20, 0x7d, 0x20, 0x20, 0x5d, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x22, 0x50, 0x6f, 0x64, 0x50, 0x74, 0x72, 0x22, 0x20, 0x3a, 0x20, 0x7b,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b,
+0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x50, 0x74,
+0x72, 0x31, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x50, 0x6f, 0x64, 0x73, 0x32, 0x2a, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x0a,
+0x09, 0x09, 0x22, 0x50, 0x6f, 0x64, 0x32, 0x49, 0x6e, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x49,
+0x6e, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20,
+0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x70, 0x32,
+0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x32, 0x49, 0x6e, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x22,
+0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x57, 0x69, 0x74, 0x68, 0x49,
+0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d,
+0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x2c, 0x20, 0x20, 0x20,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x5b, 0x33, 0x5d, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22,
+0x57, 0x69, 0x74, 0x68, 0x49, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74,
+0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b,
+0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x41, 0x72, 0x72, 0x61, 0x79,
+0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x50, 0x6f, 0x64, 0x73, 0x32, 0x5b, 0x33, 0x5d, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c,
+0x0a, 0x09, 0x09, 0x22, 0x57, 0x69, 0x74, 0x68, 0x49, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x53, 0x74,
+0x72, 0x75, 0x63, 0x74, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22,
+0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a,
+0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x41,
+0x72, 0x72, 0x61, 0x79, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x57, 0x69, 0x74, 0x68, 0x49, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x53, 0x74,
+0x72, 0x75, 0x63, 0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 0x5b, 0x32, 0x5d, 0x22, 0x20, 0x7d, 0x20,
+0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x53, 0x75, 0x62, 0x53, 0x74, 0x72, 0x69,
+0x6e, 0x67, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x53, 0x74, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22,
+0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x49, 0x6e, 0x6c, 0x69, 0x6e,
+0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x57, 0x69, 0x74, 0x68, 0x53, 0x75, 0x62, 0x53, 0x74, 0x72,
+0x69, 0x6e, 0x67, 0x22, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d,
+0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x2c, 0x20, 0x20, 0x20,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x53, 0x75, 0x62, 0x53, 0x74,
+0x72, 0x69, 0x6e, 0x67, 0x5b, 0x32, 0x5d, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a,
+0x0a, 0x09, 0x09, 0x22, 0x50, 0x6f, 0x64, 0x41, 0x72, 0x72, 0x61, 0x79, 0x31, 0x22, 0x20, 0x20,
+0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20,
+0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x33, 0x32, 0x5f, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x20,
+0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x50, 0x6f, 0x64, 0x41, 0x72, 0x72, 0x61, 0x79,
+0x32, 0x22, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x73, 0x75, 0x62, 0x5f, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x41, 0x72, 0x72, 0x61, 0x79,
+0x31, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22,
+0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 0x31, 0x22, 0x20, 0x3a, 0x20,
+0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20,
+0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x41, 0x72, 0x72, 0x61,
+0x79, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f,
+0x64, 0x73, 0x32, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x20, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x0a,
+0x09, 0x09, 0x22, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 0x52, 0x65,
+0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x65, 0x31, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d,
+0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x2c, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74,
+0x41, 0x72, 0x72, 0x61, 0x79, 0x52, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x65, 0x32, 0x5b,
+0x5d, 0x22, 0x20, 0x7d, 0x20, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x53, 0x74,
+0x72, 0x75, 0x63, 0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 0x52, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69,
+0x76, 0x65, 0x32, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72,
+0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x41, 0x72, 0x72, 0x61, 0x79,
+0x52, 0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x65, 0x31, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x20,
+0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67,
+0x73, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b,
+0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x53, 0x74, 0x72, 0x31, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69,
+0x6e, 0x67, 0x22, 0x20, 0x7d, 0x2c, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x53, 0x74, 0x72, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20,
+0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x49, 0x6e, 0x6c, 0x69,
+0x6e, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61,
+0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e,
+0x67, 0x5b, 0x33, 0x5d, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22,
+0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22,
+0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5b, 0x5d, 0x22, 0x20, 0x7d,
+0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x54, 0x65, 0x73, 0x74, 0x42, 0x69,
+0x74, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62,
+0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x42, 0x69, 0x74, 0x31, 0x22, 0x2c, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65,
+0x6c, 0x64, 0x3a, 0x31, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x42, 0x69, 0x74, 0x32, 0x22, 0x2c, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65,
+0x6c, 0x64, 0x3a, 0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x42, 0x69, 0x74, 0x33, 0x22, 0x2c, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65,
+0x6c, 0x64, 0x3a, 0x33, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x61, 0x6b, 0x65, 0x5f, 0x69, 0x74,
+0x5f, 0x75, 0x6e, 0x65, 0x76, 0x65, 0x6e, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x42, 0x69,
+0x74, 0x34, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62,
+0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x3a, 0x31, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x42, 0x69,
+0x74, 0x35, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62,
+0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x3a, 0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x42, 0x69,
+0x74, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62,
+0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x3a, 0x33, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09,
+0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x4d, 0x6f, 0x72, 0x65, 0x42,
+0x69, 0x74, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d,
+0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x42, 0x69, 0x74, 0x31, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62, 0x69, 0x74, 0x66, 0x69,
+0x65, 0x6c, 0x64, 0x3a, 0x31, 0x35, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b,
+0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x42, 0x69, 0x74, 0x32, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62, 0x69, 0x74, 0x66,
+0x69, 0x65, 0x6c, 0x64, 0x3a, 0x37, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09,
+0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x42, 0x69, 0x74, 0x42, 0x69, 0x74, 0x66, 0x69,
+0x65, 0x6c, 0x64, 0x36, 0x34, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d,
+0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09,
+0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x61, 0x63, 0x6b,
+0x61, 0x67, 0x65, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x3a, 0x37, 0x22, 0x20, 0x7d, 0x2c, 0x0a,
+0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x46, 0x69, 0x6c, 0x65, 0x54, 0x79, 0x70, 0x65, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x3a, 0x39, 0x22,
+0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x50, 0x61, 0x74, 0x68, 0x48, 0x61, 0x73, 0x68, 0x22, 0x2c, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c,
+0x64, 0x3a, 0x31, 0x36, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x46, 0x69, 0x6c, 0x65, 0x48, 0x61, 0x73,
+0x68, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62, 0x69,
+0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x3a, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09,
+0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x53, 0x69, 0x6d, 0x70, 0x6c,
+0x65, 0x50, 0x74, 0x72, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65,
+0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b,
+0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x74, 0x72, 0x31, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x73,
+0x2a, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x74, 0x72, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79,
+0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x73, 0x2a, 0x22, 0x20, 0x7d, 0x0a,
+0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x50, 0x74,
+0x72, 0x43, 0x68, 0x61, 0x69, 0x6e, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22,
+0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09,
+0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x49, 0x6e, 0x74,
+0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69,
+0x6e, 0x74, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x4e, 0x65, 0x78, 0x74, 0x22, 0x2c, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x74, 0x72, 0x43, 0x68, 0x61,
+0x69, 0x6e, 0x2a, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c,
+0x0a, 0x0a, 0x09, 0x09, 0x22, 0x44, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x50, 0x74, 0x72, 0x43, 0x68,
+0x61, 0x69, 0x6e, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d,
+0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x49, 0x6e, 0x74, 0x22, 0x2c, 0x20,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x4e, 0x65, 0x78, 0x74, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79,
+0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x44, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x50, 0x74, 0x72,
+0x43, 0x68, 0x61, 0x69, 0x6e, 0x2a, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b,
+0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x72, 0x65, 0x76, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x44, 0x6f, 0x75, 0x62,
+0x6c, 0x65, 0x50, 0x74, 0x72, 0x43, 0x68, 0x61, 0x69, 0x6e, 0x2a, 0x22, 0x20, 0x7d, 0x0a, 0x09,
+0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x69, 0x6e, 0x6c,
+0x69, 0x6e, 0x65, 0x5f, 0x70, 0x74, 0x72, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x3a,
+0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20,
+0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x73, 0x32, 0x2a, 0x5b, 0x33, 0x5d, 0x22, 0x20, 0x7d,
+0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x70,
+0x74, 0x72, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09,
+0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09,
+0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61,
+0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50,
+0x6f, 0x64, 0x73, 0x32, 0x2a, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a,
+0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x70, 0x74, 0x72, 0x5f, 0x69, 0x6e, 0x6c, 0x69,
+0x6e, 0x65, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09,
+0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09,
+0x09, 0x09, 0x09, 0x7b, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x70, 0x74,
+0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x57, 0x69,
+0x74, 0x68, 0x49, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x2a, 0x22, 0x7d,
+0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x70, 0x74,
+0x72, 0x5f, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x32, 0x22,
+0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73,
+0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x70, 0x74, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x57, 0x69, 0x74, 0x68, 0x49, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x53,
+0x74, 0x72, 0x75, 0x63, 0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 0x2a, 0x22, 0x7d, 0x0a, 0x09, 0x09,
+0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x69, 0x6e, 0x6c, 0x69, 0x6e,
+0x65, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x70, 0x6f, 0x64, 0x5f, 0x70, 0x74, 0x72, 0x22,
+0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73,
+0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x6c, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x50, 0x74, 0x72, 0x5b, 0x32,
+0x5d, 0x22, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x22, 0x70, 0x74, 0x72, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5f, 0x69, 0x6e, 0x6c, 0x69,
+0x6e, 0x65, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x70, 0x74, 0x72, 0x22, 0x20, 0x3a, 0x20,
+0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a,
+0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x70, 0x74, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x70,
+0x6f, 0x64, 0x5f, 0x70, 0x74, 0x72, 0x2a, 0x22, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09,
+0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x41, 0x31, 0x32, 0x38, 0x42, 0x69, 0x74, 0x41,
+0x6c, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x54, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20,
+0x22, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x22, 0x20, 0x3a, 0x20, 0x31, 0x32, 0x38, 0x2c, 0x20, 0x22,
+0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x49, 0x6e, 0x74, 0x22, 0x2c, 0x20, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32,
+0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x3a, 0x20, 0x31, 0x33,
+0x33, 0x37, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x54, 0x65,
+0x73, 0x74, 0x69, 0x6e, 0x67, 0x45, 0x6e, 0x75, 0x6d, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22,
+0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x54, 0x68, 0x65, 0x45, 0x6e, 0x75, 0x6d,
+0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x54, 0x65, 0x73,
+0x74, 0x45, 0x6e, 0x75, 0x6d, 0x31, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x0a,
+0x09, 0x09, 0x22, 0x49, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x45, 0x6e,
+0x75, 0x6d, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73,
+0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x45, 0x6e, 0x75, 0x6d, 0x41, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x54, 0x65, 0x73, 0x74, 0x45, 0x6e, 0x75, 0x6d, 0x32, 0x5b,
+0x34, 0x5d, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x41, 0x72,
+0x72, 0x61, 0x79, 0x45, 0x6e, 0x75, 0x6d, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a,
+0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b,
+0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x45, 0x6e, 0x75,
+0x6d, 0x41, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x54, 0x65, 0x73, 0x74, 0x45, 0x6e, 0x75, 0x6d, 0x32, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x20,
+0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x74, 0x65, 0x73, 0x74, 0x69,
+0x6e, 0x67, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x68, 0x65, 0x72,
+0x65, 0x0a, 0x09, 0x09, 0x22, 0x50, 0x6f, 0x64, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x38, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x20, 0x20,
+0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x32, 0x20,
+0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x69, 0x31, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x22, 0x20, 0x20, 0x2c, 0x20, 0x22, 0x64, 0x65,
+0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x33, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x33,
+0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e,
+0x74, 0x33, 0x32, 0x22, 0x20, 0x20, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+0x22, 0x20, 0x3a, 0x20, 0x34, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x36, 0x34, 0x22, 0x2c, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x22, 0x20,
+0x20, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x35,
+0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x38, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x20, 0x2c, 0x20, 0x22, 0x64,
+0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x36, 0x20, 0x7d, 0x2c, 0x0a, 0x09,
+0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75,
+0x31, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75,
+0x69, 0x6e, 0x74, 0x31, 0x36, 0x22, 0x20, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c,
+0x74, 0x22, 0x20, 0x3a, 0x20, 0x37, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x33, 0x32, 0x22, 0x2c, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32,
+0x22, 0x20, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20,
+0x38, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x36, 0x34, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x22, 0x20, 0x2c, 0x20, 0x22,
+0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x39, 0x20, 0x7d, 0x2c, 0x0a,
+0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x66, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x66, 0x70, 0x33, 0x32, 0x22, 0x20, 0x20, 0x20, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75,
+0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x31, 0x30, 0x2e, 0x30, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x36,
+0x34, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x70,
+0x36, 0x34, 0x22, 0x20, 0x20, 0x20, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+0x22, 0x20, 0x3a, 0x20, 0x31, 0x31, 0x2e, 0x30, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a,
+0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x42, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c,
+0x64, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73, 0x4d, 0x75, 0x6c, 0x74, 0x69, 0x22, 0x20,
+0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22,
+0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x3a, 0x20, 0x22, 0x66, 0x31, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x3a, 0x31, 0x22, 0x2c, 0x20,
+0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x30, 0x20, 0x7d, 0x2c,
+0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a, 0x20, 0x22,
+0x66, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62,
+0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x3a, 0x31, 0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66,
+0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x31, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09,
+0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a, 0x20, 0x22, 0x66, 0x33, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62, 0x69, 0x74, 0x66, 0x69,
+0x65, 0x6c, 0x64, 0x3a, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+0x22, 0x20, 0x3a, 0x20, 0x30, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a, 0x20, 0x22, 0x66, 0x34, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79,
+0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x3a,
+0x32, 0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20,
+0x31, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x3a, 0x20, 0x22, 0x66, 0x35, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x3a, 0x32, 0x22, 0x2c, 0x20,
+0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x32, 0x20, 0x7d, 0x2c,
+0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a, 0x20, 0x22,
+0x66, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62,
+0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x3a, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66,
+0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x33, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d,
+0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x2f, 0x2a, 0x0a, 0x09, 0x09, 0x09, 0x41, 0x6e,
+0x64, 0x20, 0x61, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x63, 0x6f,
+0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x68, 0x65, 0x72, 0x65, 0x0a, 0x09, 0x09, 0x2a, 0x2f, 0x0a,
+0x09, 0x09, 0x22, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x53, 0x74, 0x72, 0x22, 0x20, 0x3a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73,
+0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x53, 0x74, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22, 0x2c, 0x20, 0x20, 0x20,
+0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x63, 0x6f,
+0x77, 0x62, 0x65, 0x6c, 0x6c, 0x73, 0x20, 0x66, 0x74, 0x77, 0x21, 0x22, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c,
+0x0a, 0x09, 0x09, 0x22, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x45, 0x6e, 0x75, 0x6d, 0x22,
+0x20, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72,
+0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x45, 0x6e, 0x75, 0x6d, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x54, 0x65, 0x73, 0x74, 0x45, 0x6e, 0x75, 0x6d, 0x31, 0x22,
+0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x54,
+0x45, 0x53, 0x54, 0x45, 0x4e, 0x55, 0x4d, 0x31, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x33, 0x22,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x22, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x53, 0x74, 0x72, 0x75,
+0x63, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79,
+0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x73, 0x32, 0x22, 0x2c, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x7b,
+0x20, 0x22, 0x49, 0x6e, 0x74, 0x31, 0x22, 0x20, 0x3a, 0x20, 0x31, 0x33, 0x2c, 0x20, 0x22, 0x49,
+0x6e, 0x74, 0x32, 0x22, 0x20, 0x3a, 0x20, 0x33, 0x37, 0x20, 0x7d, 0x20, 0x7d, 0x20, 0x5d, 0x20,
+0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x50, 0x74, 0x72,
+0x22, 0x20, 0x20, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62,
+0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x74, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x73, 0x2a, 0x22, 0x2c, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20,
+0x6e, 0x75, 0x6c, 0x6c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x5d,
+0x20, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x2f, 0x2a, 0x2a, 0x0a, 0x09, 0x09, 0x09, 0x61, 0x6e,
+0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x0a, 0x09, 0x09,
+0x2a, 0x2f, 0x0a, 0x09, 0x09, 0x22, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x49, 0x6e, 0x6c,
+0x41, 0x72, 0x72, 0x61, 0x79, 0x50, 0x6f, 0x64, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22,
+0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x41, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32,
+0x5b, 0x34, 0x5d, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c,
+0x74, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x31, 0x2c, 0x20, 0x33, 0x2c, 0x20, 0x33, 0x2c, 0x20,
+0x37, 0x20, 0x5d, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x44, 0x65,
+0x66, 0x61, 0x75, 0x6c, 0x74, 0x49, 0x6e, 0x6c, 0x41, 0x72, 0x72, 0x61, 0x79, 0x53, 0x74, 0x72,
+0x22, 0x20, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22,
+0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x41, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5b, 0x34, 0x5d, 0x22, 0x2c, 0x20, 0x20, 0x20,
+0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x22,
+0x63, 0x6f, 0x77, 0x22, 0x2c, 0x20, 0x22, 0x62, 0x65, 0x6c, 0x6c, 0x73, 0x22, 0x2c, 0x20, 0x22,
+0x61, 0x72, 0x65, 0x22, 0x2c, 0x20, 0x22, 0x63, 0x6f, 0x6f, 0x6c, 0x22, 0x20, 0x5d, 0x20, 0x7d,
+0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+0x49, 0x6e, 0x6c, 0x41, 0x72, 0x72, 0x61, 0x79, 0x45, 0x6e, 0x75, 0x6d, 0x22, 0x20, 0x3a, 0x20,
+0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20,
+0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x41, 0x72, 0x72, 0x22,
+0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x54, 0x65, 0x73,
+0x74, 0x45, 0x6e, 0x75, 0x6d, 0x31, 0x5b, 0x34, 0x5d, 0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66,
+0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x22, 0x54, 0x45, 0x53, 0x54, 0x45,
+0x4e, 0x55, 0x4d, 0x31, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x33, 0x22, 0x2c, 0x0a, 0x09, 0x09,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x22, 0x54, 0x45, 0x53, 0x54, 0x45, 0x4e, 0x55, 0x4d, 0x31, 0x5f, 0x56, 0x41, 0x4c,
+0x55, 0x45, 0x31, 0x22, 0x2c, 0x0a, 0x09, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x54, 0x45, 0x53, 0x54, 0x45,
+0x4e, 0x55, 0x4d, 0x31, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x32, 0x22, 0x2c, 0x0a, 0x09, 0x09,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x22, 0x54, 0x45, 0x53, 0x54, 0x45, 0x4e, 0x55, 0x4d, 0x31, 0x5f, 0x56, 0x41, 0x4c,
+0x55, 0x45, 0x34, 0x22, 0x20, 0x5d, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x22, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x49, 0x6e, 0x6c, 0x41, 0x72, 0x72, 0x61, 0x79,
+0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62,
+0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09,
+0x09, 0x09, 0x09, 0x09, 0x20, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x41, 0x72, 0x72, 0x22, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x20,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x41, 0x72,
+0x72, 0x61, 0x79, 0x31, 0x5b, 0x32, 0x5d, 0x22, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+0x09, 0x09, 0x09, 0x20, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a,
+0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x75, 0x33, 0x32, 0x5f, 0x61, 0x72, 0x72, 0x22, 0x20, 0x3a,
+0x20, 0x5b, 0x20, 0x31, 0x2c, 0x20, 0x33, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x20, 0x7b, 0x20, 0x22,
+0x75, 0x33, 0x32, 0x5f, 0x61, 0x72, 0x72, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x33, 0x2c, 0x20,
+0x37, 0x20, 0x5d, 0x20, 0x7d, 0x20, 0x5d, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+0x09, 0x7d, 0x0a, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x2f, 0x2f, 0x2f, 0x2a, 0x20, 0x68, 0x61, 0x72,
+0x64, 0x20, 0x6f, 0x6e, 0x65, 0x0a, 0x09, 0x09, 0x22, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+0x41, 0x72, 0x72, 0x61, 0x79, 0x50, 0x6f, 0x64, 0x22, 0x20, 0x20, 0x3a, 0x20, 0x20, 0x20, 0x20,
+0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20,
+0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x41, 0x72, 0x72, 0x22,
+0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e,
+0x74, 0x33, 0x32, 0x5b, 0x5d, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61,
+0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x31, 0x2c, 0x20, 0x33, 0x2c, 0x20, 0x33,
+0x2c, 0x20, 0x37, 0x20, 0x5d, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22,
+0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 0x53, 0x74, 0x72, 0x22,
+0x20, 0x20, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72,
+0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x41, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5b, 0x5d, 0x22, 0x2c, 0x20, 0x20,
+0x20, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20,
+0x22, 0x63, 0x6f, 0x77, 0x22, 0x2c, 0x20, 0x22, 0x62, 0x65, 0x6c, 0x6c, 0x73, 0x22, 0x2c, 0x20,
+0x22, 0x61, 0x72, 0x65, 0x22, 0x2c, 0x20, 0x22, 0x63, 0x6f, 0x6f, 0x6c, 0x22, 0x20, 0x5d, 0x20,
+0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c,
+0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 0x45, 0x6e, 0x75, 0x6d, 0x22, 0x20, 0x3a, 0x20, 0x20, 0x20,
+0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b,
+0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x41, 0x72, 0x72,
+0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x54, 0x65,
+0x73, 0x74, 0x45, 0x6e, 0x75, 0x6d, 0x31, 0x5b, 0x5d, 0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66,
+0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x22, 0x54, 0x45, 0x53, 0x54, 0x45,
+0x4e, 0x55, 0x4d, 0x31, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x33, 0x22, 0x2c, 0x0a, 0x09, 0x09,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x22, 0x54, 0x45, 0x53, 0x54, 0x45, 0x4e, 0x55, 0x4d, 0x31, 0x5f, 0x56, 0x41, 0x4c, 0x55,
+0x45, 0x31, 0x22, 0x2c, 0x0a, 0x09, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x54, 0x45, 0x53, 0x54, 0x45, 0x4e, 0x55,
+0x4d, 0x31, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x32, 0x22, 0x2c, 0x0a, 0x09, 0x09, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
+0x54, 0x45, 0x53, 0x54, 0x45, 0x4e, 0x55, 0x4d, 0x31, 0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x34,
+0x22, 0x20, 0x5d, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x44, 0x65,
+0x66, 0x61, 0x75, 0x6c, 0x74, 0x41, 0x72, 0x72, 0x61, 0x79, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22,
+0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a,
+0x20, 0x5b, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x41, 0x72, 0x72, 0x22, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x50, 0x6f, 0x64, 0x41, 0x72, 0x72, 0x61, 0x79, 0x31, 0x5b, 0x5d, 0x22, 0x2c, 0x0a, 0x09,
+0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22, 0x75, 0x33, 0x32, 0x5f, 0x61, 0x72, 0x72,
+0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x31, 0x2c, 0x20, 0x33, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x20,
+0x7b, 0x20, 0x22, 0x75, 0x33, 0x32, 0x5f, 0x61, 0x72, 0x72, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20,
+0x33, 0x2c, 0x20, 0x37, 0x20, 0x5d, 0x20, 0x7d, 0x20, 0x5d, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09,
+0x09, 0x09, 0x09, 0x20, 0x20, 0x7d, 0x0a, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x44, 0x65, 0x66,
+0x61, 0x75, 0x6c, 0x74, 0x57, 0x69, 0x74, 0x68, 0x4f, 0x74, 0x68, 0x65, 0x72, 0x44, 0x61, 0x74,
+0x61, 0x42, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09,
+0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x74, 0x31,
+0x22, 0x2c, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74,
+0x72, 0x69, 0x6e, 0x67, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x53, 0x74, 0x72, 0x22, 0x2c, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22,
+0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x77,
+0x68, 0x6f, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x69, 0x73, 0x73, 0x75, 0x65, 0x5f,
+0x34, 0x30, 0x5f, 0x31, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20,
+0x3a, 0x20, 0x5b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x73, 0x75, 0x62, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x31, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79,
+0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5b, 0x5d, 0x22,
+0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x73, 0x75, 0x62, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79,
+0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x20, 0x7d,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5d, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x22, 0x69, 0x73, 0x73, 0x75, 0x65, 0x5f, 0x34, 0x30, 0x5f, 0x32, 0x22, 0x20, 0x3a,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
+0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x31,
+0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x73, 0x73,
+0x75, 0x65, 0x5f, 0x34, 0x30, 0x5f, 0x31, 0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75,
+0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x65, 0x6d, 0x62,
+0x65, 0x72, 0x31, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x22, 0x61, 0x70, 0x61, 0x22, 0x20, 0x5d,
+0x2c, 0x20, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x32, 0x22, 0x3a, 0x20,
+0x31, 0x33, 0x33, 0x37, 0x20, 0x7d, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x77, 0x69, 0x74, 0x68, 0x5f, 0x61, 0x6c, 0x69, 0x61, 0x73,
+0x5f, 0x65, 0x6e, 0x75, 0x6d, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d,
+0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09,
+0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x31, 0x22, 0x2c,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x75, 0x6c, 0x74, 0x69,
+0x5f, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x5f, 0x65, 0x6e, 0x75, 0x6d, 0x22, 0x20, 0x7d, 0x2c, 0x0a,
+0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x65, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d,
+0x75, 0x6c, 0x74, 0x69, 0x5f, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x5f, 0x65, 0x6e, 0x75, 0x6d, 0x22,
+0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x65, 0x33, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x5f, 0x61, 0x6c, 0x69, 0x61, 0x73, 0x5f, 0x65,
+0x6e, 0x75, 0x6d, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x34, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79,
+0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x5f, 0x61, 0x6c, 0x69,
+0x61, 0x73, 0x5f, 0x65, 0x6e, 0x75, 0x6d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a,
+0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x42, 0x75, 0x67, 0x54, 0x65, 0x73, 0x74,
+0x34, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5f, 0x77,
+0x69, 0x74, 0x68, 0x5f, 0x73, 0x74, 0x72, 0x5f, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x41, 0x72,
+0x72, 0x61, 0x79, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09,
+0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x42, 0x75, 0x67, 0x54, 0x65, 0x73, 0x74, 0x35, 0x22,
+0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73,
+0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x61, 0x79, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x74, 0x72, 0x43, 0x68, 0x61, 0x69, 0x6e,
+0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a,
+0x0a, 0x09, 0x09, 0x22, 0x50, 0x74, 0x72, 0x48, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x22, 0x20, 0x3a,
+0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b,
+0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x70, 0x74, 0x72,
+0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64,
+0x73, 0x32, 0x2a, 0x22, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c,
+0x0a, 0x09, 0x09, 0x22, 0x50, 0x74, 0x72, 0x41, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x20, 0x3a,
+0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b,
+0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72,
+0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x74, 0x72,
+0x48, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c,
+0x0a, 0x0a, 0x09, 0x09, 0x22, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6c, 0x61, 0x72, 0x5f, 0x61, 0x72,
+0x72, 0x61, 0x79, 0x5f, 0x70, 0x74, 0x72, 0x5f, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x22, 0x20,
+0x3a, 0x20, 0x7b, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20,
+0x5b, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x70, 0x74,
+0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x63, 0x69,
+0x72, 0x63, 0x75, 0x6c, 0x61, 0x72, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2a, 0x22, 0x20, 0x7d,
+0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6c, 0x61,
+0x72, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09,
+0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x76, 0x61,
+0x6c, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69,
+0x6e, 0x74, 0x31, 0x36, 0x22, 0x20, 0x7d, 0x2c, 0x20, 0x2f, 0x2f, 0x20, 0x61, 0x6c, 0x69, 0x67,
+0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x2d, 0x62, 0x75, 0x67, 0x20, 0x68, 0x65, 0x72, 0x65, 0x2c, 0x20,
+0x70, 0x75, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20,
+0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20,
+0x69, 0x74, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x21, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72,
+0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x63, 0x69,
+0x72, 0x63, 0x75, 0x6c, 0x61, 0x72, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x70, 0x74, 0x72,
+0x5f, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09,
+0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x73, 0x74, 0x72, 0x5f,
+0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x62, 0x75, 0x67,
+0x5f, 0x61, 0x72, 0x72, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x20, 0x22,
+0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x22, 0x2c, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22,
+0x20, 0x7d, 0x20, 0x5d, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x73, 0x74, 0x72, 0x5f, 0x62,
+0x65, 0x66, 0x6f, 0x72, 0x65, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x62, 0x75, 0x67, 0x22,
+0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x20, 0x20, 0x20, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62,
+0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73,
+0x74, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3a, 0x20, 0x22, 0x73, 0x74,
+0x72, 0x69, 0x6e, 0x67, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61,
+0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3a, 0x20, 0x22, 0x73, 0x74,
+0x72, 0x5f, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x62,
+0x75, 0x67, 0x5f, 0x61, 0x72, 0x72, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x5b, 0x5d, 0x22, 0x7d, 0x0a,
+0x09, 0x09, 0x20, 0x20, 0x20, 0x20, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09,
+0x22, 0x62, 0x75, 0x67, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x61, 0x6c, 0x69, 0x67, 0x6e,
+0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x7b,
+0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20,
+0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x70, 0x74, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75,
+0x69, 0x6e, 0x74, 0x36, 0x34, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x73, 0x65, 0x64, 0x5f, 0x73,
+0x6f, 0x75, 0x72, 0x63, 0x65, 0x73, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09,
+0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x62, 0x75, 0x67, 0x5f, 0x61,
+0x6c, 0x69, 0x67, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x22,
+0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73,
+0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32,
+0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x3a, 0x20, 0x39, 0x30,
+0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x41, 0x31, 0x32, 0x38, 0x42, 0x69, 0x74, 0x41,
+0x6c, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x54, 0x79, 0x70, 0x65, 0x22, 0x2c, 0x20, 0x22, 0x64, 0x65,
+0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x3a, 0x20, 0x7b, 0x20, 0x7d, 0x20, 0x7d, 0x2c, 0x0a, 0x09,
+0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x70,
+0x74, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x73, 0x32, 0x2a, 0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66,
+0x61, 0x75, 0x6c, 0x74, 0x22, 0x3a, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x20, 0x7d, 0x0a, 0x09, 0x09,
+0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x62, 0x75, 0x67, 0x5f,
+0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x22,
+0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73,
+0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x63, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x73,
+0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62, 0x75, 0x67,
+0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x6d, 0x65, 0x6e, 0x74,
+0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09,
+0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x74, 0x65, 0x73, 0x74, 0x5f,
+0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x70, 0x61, 0x64, 0x5f, 0x31, 0x22, 0x20, 0x3a, 0x20, 0x7b,
+0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20,
+0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x70, 0x74, 0x72, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38,
+0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61,
+0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x2c, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x20, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a,
+0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x61, 0x72,
+0x72, 0x61, 0x79, 0x5f, 0x70, 0x61, 0x64, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09,
+0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x63, 0x6f,
+0x6d, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x73, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f,
+0x70, 0x61, 0x64, 0x5f, 0x31, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a,
+0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x69, 0x6e,
+0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f,
+0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x65, 0x6e, 0x75, 0x6d, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09,
+0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a,
+0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x61, 0x72, 0x72, 0x31, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5b, 0x54, 0x45, 0x53, 0x54, 0x45, 0x4e, 0x55, 0x4d, 0x32,
+0x5f, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x31, 0x5d, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09,
+0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72,
+0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e,
+0x74, 0x33, 0x32, 0x5b, 0x54, 0x45, 0x53, 0x54, 0x45, 0x4e, 0x55, 0x4d, 0x31, 0x5f, 0x56, 0x41,
+0x4c, 0x55, 0x45, 0x34, 0x5d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09,
+0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x69, 0x6e, 0x6c, 0x69,
+0x6e, 0x65, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x6f, 0x66, 0x5f, 0x75, 0x6e, 0x69, 0x6f,
+0x6e, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62,
+0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22,
+0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x75, 0x6e,
+0x69, 0x6f, 0x6e, 0x5f, 0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x5b, 0x33, 0x5d, 0x22, 0x20, 0x7d,
+0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x73,
+0x69, 0x6e, 0x67, 0x6c, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09,
+0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a,
+0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x76, 0x61, 0x6c, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09,
+0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5f, 0x77, 0x69,
+0x74, 0x68, 0x5f, 0x61, 0x5f, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x22, 0x20, 0x3a,
+0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x21, 0x20, 0x6e, 0x6f, 0x74, 0x5f, 0x72, 0x65, 0x6c, 0x6f, 0x61, 0x64, 0x61,
+0x62, 0x6c, 0x65, 0x22, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72,
+0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x09, 0x22, 0x6e, 0x61,
+0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x79, 0x5f, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62,
+0x6c, 0x65, 0x5f, 0x31, 0x22, 0x2c, 0x09, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75,
+0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x30, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b,
+0x09, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x79, 0x5f, 0x76, 0x61,
+0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x32, 0x22, 0x2c, 0x09, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x64,
+0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x30, 0x20, 0x7d, 0x2c, 0x0a, 0x09,
+0x09, 0x09, 0x09, 0x7b, 0x09, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d,
+0x79, 0x5f, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x33, 0x22, 0x2c, 0x09, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c,
+0x64, 0x3a, 0x31, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c,
+0x0a, 0x09, 0x09, 0x22, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f,
+0x73, 0x6f, 0x6d, 0x65, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73, 0x22, 0x20, 0x3a,
+0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20,
+0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x09, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x6f, 0x6d, 0x65, 0x5f, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62,
+0x6c, 0x65, 0x5f, 0x31, 0x22, 0x2c, 0x20, 0x09, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09,
+0x09, 0x7b, 0x09, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x6f, 0x6d,
+0x65, 0x5f, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x32, 0x22, 0x2c, 0x09, 0x09,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x33, 0x32, 0x22, 0x2c,
+0x09, 0x09, 0x09, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x30,
+0x2e, 0x35, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x09, 0x22, 0x6e, 0x61,
+0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x6f, 0x6d, 0x65, 0x5f, 0x76, 0x61, 0x72, 0x69,
+0x61, 0x62, 0x6c, 0x65, 0x5f, 0x33, 0x22, 0x2c, 0x09, 0x09, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x33, 0x32, 0x22, 0x2c, 0x09, 0x09, 0x09, 0x22, 0x64, 0x65,
+0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x30, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x09, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x6f,
+0x6d, 0x65, 0x5f, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x34, 0x22, 0x2c, 0x09,
+0x09, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x33, 0x32, 0x22,
+0x2c, 0x09, 0x09, 0x09, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20,
+0x32, 0x30, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x09, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x6f, 0x6d, 0x65, 0x5f, 0x76, 0x61, 0x72, 0x69, 0x61,
+0x62, 0x6c, 0x65, 0x5f, 0x35, 0x22, 0x2c, 0x09, 0x09, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x66, 0x70, 0x33, 0x32, 0x22, 0x2c, 0x09, 0x09, 0x09, 0x22, 0x64, 0x65, 0x66,
+0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x30, 0x2e, 0x31, 0x20, 0x7d, 0x0a, 0x09, 0x09,
+0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x73, 0x74, 0x72, 0x75, 0x63,
+0x74, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f, 0x6f, 0x6e, 0x65, 0x5f, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x5f, 0x61, 0x6e, 0x64, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a,
+0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20,
+0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x09, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x64, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x22,
+0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x30, 0x20, 0x7d, 0x0a, 0x09,
+0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x73, 0x69, 0x6e, 0x67,
+0x6c, 0x65, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x33,
+0x32, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x22,
+0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x31, 0x33, 0x33, 0x37, 0x20,
+0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22,
+0x74, 0x65, 0x73, 0x74, 0x5f, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x61, 0x72, 0x72, 0x61,
+0x79, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+0x31, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x5f, 0x64,
+0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5b, 0x33, 0x5d,
+0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x5b,
+0x5d, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09,
+0x09, 0x22, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x61, 0x72,
+0x72, 0x61, 0x79, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x73, 0x74, 0x72, 0x75,
+0x63, 0x74, 0x32, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d,
+0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65,
+0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5b,
+0x33, 0x5d, 0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a,
+0x20, 0x5b, 0x7b, 0x22, 0x75, 0x22, 0x20, 0x3a, 0x20, 0x37, 0x33, 0x33, 0x31, 0x7d, 0x5d, 0x20,
+0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09, 0x09, 0x22,
+0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x32, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a,
+0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x78, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x66, 0x70, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x79, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x0a,
+0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d,
+0x62, 0x65, 0x72, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x6f,
+0x66, 0x5f, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09,
+0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09,
+0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x76,
+0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x32, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x5b, 0x32, 0x5d, 0x22,
+0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22,
+0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f, 0x6d, 0x65, 0x6d, 0x62,
+0x65, 0x72, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x6f, 0x66,
+0x5f, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09,
+0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x62,
+0x65, 0x72, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x6f, 0x66,
+0x5f, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a,
+0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x22, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x73,
+0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x22, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x5f, 0x77,
+0x69, 0x74, 0x68, 0x5f, 0x77, 0x65, 0x69, 0x72, 0x64, 0x5f, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72,
+0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e,
+0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x70, 0x61, 0x77, 0x6e, 0x5f, 0x70, 0x61,
+0x72, 0x74, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x22, 0x2c, 0x09, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f,
+0x61, 0x5f, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09,
+0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x64,
+0x65, 0x63, 0x61, 0x79, 0x22, 0x2c, 0x09, 0x09, 0x09, 0x09, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f,
+0x73, 0x6f, 0x6d, 0x65, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x68, 0x69, 0x64, 0x65, 0x5f, 0x61, 0x6c, 0x6c, 0x5f, 0x6d, 0x65, 0x73, 0x68, 0x65,
+0x73, 0x22, 0x2c, 0x09, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74,
+0x72, 0x75, 0x63, 0x74, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f, 0x6f, 0x6e, 0x65, 0x5f, 0x6d, 0x65,
+0x6d, 0x62, 0x65, 0x72, 0x5f, 0x61, 0x6e, 0x64, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x0a, 0x09,
+0x09, 0x22, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x5f, 0x69, 0x6e, 0x6c,
+0x69, 0x6e, 0x65, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09,
+0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a,
+0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x69, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20,
+0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09,
+0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x6c,
+0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x69, 0x6e, 0x74, 0x33, 0x32, 0x5b, 0x36, 0x5d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d,
+0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x75, 0x6e,
+0x69, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09,
+0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a,
+0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x69, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x69, 0x6e, 0x74, 0x33, 0x32, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5b,
+0x5d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09,
+0x09, 0x22, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x5f, 0x70, 0x74, 0x72,
+0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72,
+0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61,
+0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x70, 0x31, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x73, 0x2a, 0x22, 0x20, 0x7d, 0x2c, 0x0a,
+0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x70, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x53,
+0x75, 0x62, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x2a, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x70, 0x33,
+0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x57, 0x69, 0x74,
+0x68, 0x49, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x2a, 0x22, 0x20, 0x7d,
+0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x74, 0x65,
+0x73, 0x74, 0x5f, 0x68, 0x61, 0x73, 0x5f, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72,
+0x61, 0x79, 0x22, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65,
+0x72, 0x73, 0x22, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61,
+0x6d, 0x65, 0x22, 0x3a, 0x20, 0x22, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x73, 0x22, 0x2c, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x33, 0x32, 0x5b, 0x5d, 0x22, 0x20,
+0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x73, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x3a, 0x20, 0x22, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x0a,
+0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x22, 0x75, 0x6e, 0x69,
+0x6f, 0x6e, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f, 0x77, 0x65, 0x69, 0x72, 0x64, 0x5f, 0x6d, 0x65,
+0x6d, 0x62, 0x65, 0x72, 0x73, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x7b,
+0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20,
+0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x09, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x22, 0x2c, 0x09, 0x09, 0x09, 0x09, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x5f, 0x77, 0x69,
+0x74, 0x68, 0x5f, 0x77, 0x65, 0x69, 0x72, 0x64, 0x5f, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73,
+0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x09, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x64, 0x65, 0x6c, 0x61, 0x79, 0x22, 0x2c, 0x09, 0x09, 0x09, 0x09,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x66, 0x70, 0x33, 0x32, 0x22, 0x2c,
+0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x30, 0x20, 0x7d,
+0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x73, 0x74,
+0x72, 0x75, 0x63, 0x74, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f,
+0x6f, 0x66, 0x5f, 0x77, 0x65, 0x69, 0x72, 0x64, 0x5f, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x73, 0x22,
+0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73,
+0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5f, 0x61, 0x72, 0x72, 0x61,
+0x79, 0x22, 0x2c, 0x09, 0x09, 0x09, 0x09, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20,
+0x22, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f, 0x77, 0x65, 0x69, 0x72,
+0x64, 0x5f, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x5f, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x5b,
+0x5d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09,
+0x09, 0x22, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x77, 0x69, 0x74, 0x68, 0x5f, 0x75, 0x6e, 0x69, 0x6f,
+0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x22, 0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09,
+0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x70, 0x72,
+0x6f, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x74, 0x65, 0x73, 0x74, 0x5f, 0x68, 0x61, 0x73, 0x5f, 0x75, 0x6e,
+0x69, 0x6f, 0x6e, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x0a, 0x09,
+0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x70, 0x61, 0x72, 0x61,
+0x6c, 0x6c, 0x65, 0x6c, 0x5f, 0x70, 0x61, 0x63, 0x6b, 0x5f, 0x69, 0x74, 0x65, 0x6d, 0x22, 0x20,
+0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22,
+0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x22,
+0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x62, 0x79, 0x74, 0x65, 0x73, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x5b, 0x5d, 0x22,
+0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x36, 0x34, 0x73, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5b, 0x5d,
+0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x73, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x22,
+0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x5b,
+0x5d, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73, 0x75, 0x62, 0x22, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f, 0x64, 0x41, 0x72, 0x72,
+0x61, 0x79, 0x31, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x70, 0x74, 0x72, 0x22, 0x2c, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x50, 0x6f,
+0x64, 0x73, 0x32, 0x2a, 0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22,
+0x20, 0x3a, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b,
+0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x64, 0x65, 0x66, 0x5f, 0x73,
+0x74, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x73,
+0x74, 0x72, 0x69, 0x6e, 0x67, 0x22, 0x2c, 0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+0x22, 0x20, 0x3a, 0x20, 0x22, 0x63, 0x6f, 0x77, 0x62, 0x65, 0x6c, 0x6c, 0x73, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x64, 0x65, 0x66, 0x5f, 0x61, 0x72, 0x72, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5b, 0x5d, 0x22, 0x2c,
+0x20, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x20, 0x3a, 0x20, 0x5b, 0x20, 0x31,
+0x2c, 0x20, 0x33, 0x2c, 0x20, 0x33, 0x2c, 0x20, 0x37, 0x20, 0x5d, 0x20, 0x7d, 0x0a, 0x09, 0x09,
+0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x70, 0x61, 0x72, 0x61, 0x6c,
+0x6c, 0x65, 0x6c, 0x5f, 0x70, 0x61, 0x63, 0x6b, 0x5f, 0x72, 0x6f, 0x6f, 0x74, 0x22, 0x20, 0x3a,
+0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22, 0x20,
+0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x70, 0x61, 0x72, 0x61, 0x6c, 0x6c, 0x65, 0x6c, 0x5f, 0x70,
+0x61, 0x63, 0x6b, 0x5f, 0x69, 0x74, 0x65, 0x6d, 0x5b, 0x5d, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09,
+0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x22, 0x74, 0x65, 0x73, 0x74, 0x5f,
+0x6c, 0x6f, 0x74, 0x73, 0x5f, 0x6f, 0x66, 0x5f, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x22,
+0x20, 0x3a, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73,
+0x22, 0x20, 0x3a, 0x20, 0x5b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x30, 0x30, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x30, 0x31, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x30, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x30, 0x33, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x30, 0x34, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x30, 0x35, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x30, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x30, 0x37, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x30, 0x38, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x30, 0x39, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x31, 0x30, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x31, 0x31, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x31, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x31, 0x33, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x31, 0x34, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x31, 0x35, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x31, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x31, 0x37, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x31, 0x38, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x31, 0x39, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x32, 0x30, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x32, 0x31, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x32, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x32, 0x33, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x32, 0x34, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x32, 0x35, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x32, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x32, 0x37, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x32, 0x38, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x32, 0x39, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x33, 0x30, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x33, 0x31, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x33, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x33, 0x33, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x33, 0x34, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x33, 0x35, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x33, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x33, 0x37, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x33, 0x38, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x33, 0x39, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x34, 0x30, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x34, 0x31, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x34, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x34, 0x33, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x34, 0x34, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x34, 0x35, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x34, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x34, 0x37, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x34, 0x38, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x34, 0x39, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x35, 0x30, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x35, 0x31, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x35, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x35, 0x33, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x35, 0x34, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x35, 0x35, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x35, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x35, 0x37, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x35, 0x38, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x35, 0x39, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x36, 0x30, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x36, 0x31, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x36, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x36, 0x33, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x36, 0x34, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x36, 0x35, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x36, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x36, 0x37, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x36, 0x38, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x36, 0x39, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x37, 0x30, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x37, 0x31, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x37, 0x32, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x37, 0x33, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x37, 0x34, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x37, 0x35, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d,
+0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x37, 0x36, 0x22, 0x2c, 0x20, 0x22, 0x74,
+0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d,
+0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a,
+0x20, 0x22, 0x6d, 0x65, 0x6d, 0x37, 0x37, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22,
+0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09,
+0x09, 0x09, 0x7b, 0x20, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65,
+0x6d, 0x37, 0x38, 0x22, 0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22,
+0x75, 0x69, 0x6e, 0x74, 0x38, 0x22, 0x20, 0x7d, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7b, 0x20,
+0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x6d, 0x65, 0x6d, 0x37, 0x39, 0x22,
+0x2c, 0x20, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x20, 0x3a, 0x20, 0x22, 0x75, 0x69, 0x6e, 0x74,
+0x38, 0x22, 0x20, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x5d, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d,
+0x0a, 0x7d, 0x0a
\ No newline at end of file
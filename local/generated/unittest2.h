@@ -0,0 +1,374 @@
+/* Auto generated header for dl type library */
+#ifndef __DL_AUTOGEN_HEADER_UNITTEST2_H_INCLUDED
+#define __DL_AUTOGEN_HEADER_UNITTEST2_H_INCLUDED
+
+#include <stdint.h>
+
+#include <stddef.h> // for size_t and offsetof
+
+#ifndef __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+#define __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+
+#  if !defined(__cplusplus)
+#    define DL_SIZED_ENUM_SUPPORTED 0
+#  else
+#    if defined(_MSC_VER)
+#      if _MSC_VER < 1900
+#        define DL_SIZED_ENUM_SUPPORTED 0
+#      else
+#        define DL_SIZED_ENUM_SUPPORTED 0
+#      endif
+#    else
+       // this would need more work but it is good enough for now
+#      define DL_SIZED_ENUM_SUPPORTED 1
+#    endif
+#  endif
+
+   /// ... DL_C_STRUCT ...
+   /// The macro DL_C_STRUCT is used on external types to add struct in c
+   /// where it is needed. In c++ this is skipped as it is not needed and
+   /// could be something else such as a class or typedef.
+#  if defined(__cplusplus)
+#    define DL_C_STRUCT
+#  else
+#    define DL_C_STRUCT struct
+#  endif
+
+   /// ... DL_C_ENUM ...
+   /// Same concept as DL_C_STRUCT
+#  if defined(__cplusplus)
+#    define DL_C_ENUM
+#  else
+#    define DL_C_ENUM enum
+#  endif
+
+   /// ... DL_ALIGN() ...
+#  if defined(_MSC_VER)
+#    define DL_ALIGN(x) __declspec(align(x))
+#  elif defined(__GNUC__)
+#    define DL_ALIGN(x) __attribute__((aligned(x)))
+#  else
+#    error "Unsupported compiler"
+#  endif
+
+   /// ... DL_ALIGNOF() ...
+#  if defined(__clang__)
+#    if __has_feature(cxx_alignof)
+#      define DL_ALIGNOF(type) alignof(type)
+#    elif __has_feature(c_alignof)
+#      define DL_ALIGNOF(type) _Alignof(type)
+#    endif
+#  elif defined(__GNUC__)
+#    define DL_ALIGNOF(type) __alignof__(type)
+#  endif
+#  if defined(_MSC_VER )
+#    define DL_ALIGNOF(type) __alignof(type)
+#  endif
+
+#  ifndef DL_ALIGNOF
+#    define DL_ALIGNOF(type) ((sizeof(type) > 1)? offsetof(struct { char c; type x; }, x) : 1)
+#  endif
+
+   // ... DL_STATIC_ASSERT() ...
+   // ... clang ...
+#  if defined( __clang__ )
+#    if defined( __cplusplus ) && __has_feature(cxx_static_assert)
+#      define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+#    elif __has_feature(c_static_assert)
+#      define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#    endif
+   // ... msvc ...
+#  elif defined( _MSC_VER ) && ( defined(_MSC_VER) && (_MSC_VER >= 1600) )
+#    define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+   // ... gcc ...
+#  elif defined( __cplusplus )
+#    if __cplusplus >= 201103L || ( defined(_MSC_VER) && (_MSC_VER >= 1600) )
+#      define DL_STATIC_ASSERT( cond, msg ) static_assert( cond, msg )
+#    endif
+#  elif defined( __STDC__ )
+#    if defined( __STDC_VERSION__ )
+#      if __STDC_VERSION__ >= 201112L
+#        define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#      else
+#        define DL_STATIC_ASSERT( cond, msg ) _Static_assert( cond, msg )
+#      endif
+#    endif
+#  endif
+#  if !defined(DL_STATIC_ASSERT)
+#    define DL_STATIC_ASSERT(x,y) // default to non-implemented.
+#  endif
+
+   // ... DL_DATA_ASSERT() ...
+#  if !defined(DL_DATA_ASSERT)
+#    define DL_DATA_ASSERT(x) // default to non-implemented.
+#  endif
+
+   // ... DL_DECLARE_ARRAY ...
+#  if defined(__cplusplus)
+	  template <typename T>
+	  struct dl_array
+	  {
+		   inline const T& operator[](size_t i) const
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline T& operator[](size_t i)
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const T* begin() const
+		   {
+		       return data;
+		   }
+		   inline const T* end() const
+		   {
+		       return data + count;
+		   }
+		   inline T* begin()
+		   {
+		       return data;
+		   }
+		   inline T* end()
+		   {
+		       return data + count;
+		   }
+		   T* data;
+		   uint32_t count;
+	   };
+	   template <>
+	   struct dl_array<const char*> {
+		   inline const char*& operator[](size_t i) const
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const char*& operator[](size_t i)
+		   {
+		       DL_DATA_ASSERT(i < count);
+		       return data[i];
+		   }
+		   inline const char* const* begin() const
+		   {
+		       return data;
+		   }
+		   inline const char* const* end() const
+		   {
+		       return data + count;
+		   }
+		   inline const char** begin()
+		   {
+		       return data;
+		   }
+		   inline const char** end()
+		   {
+		       return data + count;
+		   }
+		   const char** data;
+		   uint32_t count;
+	   };
+#	 define DL_DECLARE_ARRAY(type) dl_array<type>
+#  else
+#	 define DL_DECLARE_ARRAY(type)  \
+       struct              \
+       {                   \
+           type* data;     \
+           uint32_t count; \
+       }
+#  endif
+#endif // __DL_AUTOGEN_HEADER_DL_ALIGN_DEFINED
+
+//----------------------------------------------
+//                   INCLUDES                   
+//----------------------------------------------
+
+#include "../../tests/dl_test_included.h"
+
+
+//----------------------------------------------
+//                   TYPEID:s                   
+//----------------------------------------------
+
+// ENUMS
+#define extern_enum_TYPE_ID (0xBB444EEA)
+
+// TYPES
+#define BugTest1_InArray_TYPE_ID (0x63A8C284)
+#define BugTest1_TYPE_ID (0x897698EF)
+#define BugTest2_WithMat_TYPE_ID (0x05BF836D)
+#define BugTest2_TYPE_ID (0x897698F0)
+#define BugTest3_StructWithPtr_TYPE_ID (0x6F27A087)
+#define BugTest3_TYPE_ID (0x897698F1)
+#define per_bug_1_TYPE_ID (0x4ABF50D4)
+#define per_bug_TYPE_ID (0xA517D624)
+#define bug_with_substr_2_TYPE_ID (0x73E6EA6C)
+#define bug_with_substr_TYPE_ID (0x578E1DFB)
+#define vec3_test_TYPE_ID (0x1C269050)
+#define no_verify_memeber_test_TYPE_ID (0xDE30A88C)
+#define no_verify_size_align_test_TYPE_ID (0xAAEC70B4)
+#define alias_test_TYPE_ID (0x07397AA9)
+#define complex_member_TYPE_ID (0x8F88EB2F)
+#define big_array_test_TYPE_ID (0x610E758F)
+
+
+//----------------------------------------------
+//                   ENUMS:s                    
+//----------------------------------------------
+
+DL_STATIC_ASSERT(sizeof(DL_C_ENUM extern_enum) == 4, "size of external enum extern_enum do not match what was specified in tld.");
+DL_STATIC_ASSERT(extern_value1 == 0, "value of enum-value do not match what was specified in tld.");
+DL_STATIC_ASSERT(extern_value2 == 1, "value of enum-value do not match what was specified in tld.");
+DL_STATIC_ASSERT(extern_value3 == 2, "value of enum-value do not match what was specified in tld.");
+DL_STATIC_ASSERT(extern_value4 == 3, "value of enum-value do not match what was specified in tld.");
+
+//----------------------------------------------
+//                   TYPES:s                    
+//----------------------------------------------
+
+// verify that extern type 'vec3_test' match the actual type
+DL_STATIC_ASSERT( sizeof(DL_C_STRUCT vec3_test) == 12, "size of external type vec3_test do not match what was specified in tld." );
+DL_STATIC_ASSERT( DL_ALIGNOF(DL_C_STRUCT vec3_test) == 4, "alignment of external type vec3_test do not match what was specified in tld." );
+DL_STATIC_ASSERT( sizeof(((struct vec3_test*) 0)->x) == 4, "sizeof of member vec3_test::x in external type do not match what was specified in tld." );
+DL_STATIC_ASSERT( offsetof(struct vec3_test, x) == 0, "offset of member vec3_test::x in external type do not match what was specified in tld." );
+DL_STATIC_ASSERT( sizeof(((struct vec3_test*) 0)->y) == 4, "sizeof of member vec3_test::y in external type do not match what was specified in tld." );
+DL_STATIC_ASSERT( offsetof(struct vec3_test, y) == 4, "offset of member vec3_test::y in external type do not match what was specified in tld." );
+DL_STATIC_ASSERT( sizeof(((struct vec3_test*) 0)->z) == 4, "sizeof of member vec3_test::z in external type do not match what was specified in tld." );
+DL_STATIC_ASSERT( offsetof(struct vec3_test, z) == 8, "offset of member vec3_test::z in external type do not match what was specified in tld." );
+// verify that extern type 'no_verify_memeber_test' match the actual type
+DL_STATIC_ASSERT( sizeof(DL_C_STRUCT no_verify_memeber_test) == 12, "size of external type no_verify_memeber_test do not match what was specified in tld." );
+DL_STATIC_ASSERT( DL_ALIGNOF(DL_C_STRUCT no_verify_memeber_test) == 4, "alignment of external type no_verify_memeber_test do not match what was specified in tld." );
+// no_verify_memeber_test::x is marked as 'verify : false' so size and offset will not be verified
+// no_verify_memeber_test::y is marked as 'verify : false' so size and offset will not be verified
+// no_verify_memeber_test::z is marked as 'verify : false' so size and offset will not be verified
+// 'no_verify_size_align_test' is marked as 'verify : false' so size and align will not be verified
+DL_STATIC_ASSERT( sizeof(((struct no_verify_size_align_test*) 0)->a) == 4, "sizeof of member no_verify_size_align_test::a in external type do not match what was specified in tld." );
+DL_STATIC_ASSERT( offsetof(struct no_verify_size_align_test, a) == 0, "offset of member no_verify_size_align_test::a in external type do not match what was specified in tld." );
+DL_STATIC_ASSERT( sizeof(((struct no_verify_size_align_test*) 0)->b) == 4, "sizeof of member no_verify_size_align_test::b in external type do not match what was specified in tld." );
+DL_STATIC_ASSERT( offsetof(struct no_verify_size_align_test, b) == 4, "offset of member no_verify_size_align_test::b in external type do not match what was specified in tld." );
+DL_STATIC_ASSERT( sizeof(((struct no_verify_size_align_test*) 0)->c) == 4, "sizeof of member no_verify_size_align_test::c in external type do not match what was specified in tld." );
+DL_STATIC_ASSERT( offsetof(struct no_verify_size_align_test, c) == 8, "offset of member no_verify_size_align_test::c in external type do not match what was specified in tld." );
+struct BugTest1_InArray
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x63A8C284;
+#endif // defined( __cplusplus )
+
+    DL_ALIGN(8) uint64_t u64_1; 
+    DL_ALIGN(8) uint64_t u64_2; 
+    uint16_t u16; 
+};
+
+struct BugTest1
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x897698EF;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct BugTest1_InArray) Arr;
+ };
+
+struct BugTest2_WithMat
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x05BF836D;
+#endif // defined( __cplusplus )
+
+    uint32_t iSubModel; 
+    float Transform[16];
+};
+
+struct BugTest2
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x897698F0;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct BugTest2_WithMat) Instances;
+ };
+
+struct BugTest3_StructWithPtr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x6F27A087;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint32_t) arr;
+ };
+
+struct BugTest3
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x897698F1;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT BugTest3_StructWithPtr sub;
+};
+
+struct per_bug_1
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x4ABF50D4;
+#endif // defined( __cplusplus )
+
+    const char* str; 
+};
+
+struct per_bug
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0xA517D624;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct per_bug_1) arr;
+ };
+
+struct bug_with_substr_2
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x73E6EA6C;
+#endif // defined( __cplusplus )
+
+    const char* str; 
+};
+
+struct bug_with_substr
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x578E1DFB;
+#endif // defined( __cplusplus )
+
+    const char* str; 
+    DL_C_STRUCT bug_with_substr_2 sub;
+};
+
+struct alias_test
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x07397AA9;
+#endif // defined( __cplusplus )
+
+    DL_C_STRUCT vec3_test m1;
+    DL_C_STRUCT vec3_test m2;
+};
+
+struct complex_member
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x8F88EB2F;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(uint32_t) dynamic_arr;
+ };
+
+struct big_array_test
+{
+#if defined( __cplusplus )
+    static constexpr const uint32_t TYPE_ID = 0x610E758F;
+#endif // defined( __cplusplus )
+
+    DL_DECLARE_ARRAY(struct complex_member) members;
+ };
+
+#endif // __DL_AUTOGEN_HEADER_UNITTEST2_H_INCLUDED
+
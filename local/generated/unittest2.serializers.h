@@ -0,0 +1,534 @@
+/* Auto generated c++ serializers for dl type library */
+#ifndef __DL_AUTOGEN_SERIALIZERS_UNITTEST2_SERIALIZERS_H_INCLUDED
+#define __DL_AUTOGEN_SERIALIZERS_UNITTEST2_SERIALIZERS_H_INCLUDED
+
+// ... include after the header generated for the same type library with dl_context_write_type_library_c_header() ...
+#include <dl/dl_serializer.h>
+
+template <>
+struct dl_serializer<BugTest1_InArray>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x63A8C284;
+    static constexpr const size_t      SIZE        = 24;
+    static constexpr const size_t      ALIGNMENT   = 8;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<BugTest1>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x897698EF;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<BugTest2_WithMat>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x05BF836D;
+    static constexpr const size_t      SIZE        = 68;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<BugTest2>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x897698F0;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<BugTest3_StructWithPtr>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x6F27A087;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<BugTest3>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x897698F1;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<per_bug_1>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x4ABF50D4;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<per_bug>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xA517D624;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<bug_with_substr_2>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x73E6EA6C;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<bug_with_substr>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x578E1DFB;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<vec3_test>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x1C269050;
+    static constexpr const size_t      SIZE        = 12;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<no_verify_memeber_test>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xDE30A88C;
+    static constexpr const size_t      SIZE        = 12;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<no_verify_size_align_test>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0xAAEC70B4;
+    static constexpr const size_t      SIZE        = 12;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<alias_test>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x07397AA9;
+    static constexpr const size_t      SIZE        = 24;
+    static constexpr const size_t      ALIGNMENT   = 4;
+    static constexpr const bool        HAS_SUBDATA = false;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<complex_member>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x8F88EB2F;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+template <>
+struct dl_serializer<big_array_test>
+{
+    static constexpr const dl_typeid_t TYPE_ID     = 0x610E758F;
+    static constexpr const size_t      SIZE        = DL_SERIALIZER_PTR_SEL( 8, 16 );
+    static constexpr const size_t      ALIGNMENT   = DL_SERIALIZER_PTR_SEL( 4, 8 );
+    static constexpr const bool        HAS_SUBDATA = true;
+
+    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );
+    static void patch( dl_serializer_patcher& p, unsigned char* inst );
+    static void swap ( dl_serializer_swapper& s, unsigned char* inst );
+};
+
+inline void dl_serializer<BugTest1_InArray>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 18 );
+}
+
+inline void dl_serializer<BugTest1_InArray>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<BugTest1_InArray>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 8 );
+    s.swap_pod( inst + 8, 8 );
+    s.swap_pod( inst + 16, 2 );
+}
+
+inline void dl_serializer<BugTest1>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<BugTest1_InArray>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<BugTest1>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<BugTest1>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<BugTest1_InArray>::SIZE, dl_serializer<BugTest1_InArray>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<BugTest1_InArray>::swap( s, a + i * dl_serializer_align_up( dl_serializer<BugTest1_InArray>::SIZE, dl_serializer<BugTest1_InArray>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<BugTest2_WithMat>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 68 );
+}
+
+inline void dl_serializer<BugTest2_WithMat>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<BugTest2_WithMat>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+    s.swap_pods( inst + 4, 4, 16 );
+}
+
+inline void dl_serializer<BugTest2>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<BugTest2_WithMat>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<BugTest2>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<BugTest2>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<BugTest2_WithMat>::SIZE, dl_serializer<BugTest2_WithMat>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<BugTest2_WithMat>::swap( s, a + i * dl_serializer_align_up( dl_serializer<BugTest2_WithMat>::SIZE, dl_serializer<BugTest2_WithMat>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<BugTest3_StructWithPtr>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<BugTest3_StructWithPtr>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<BugTest3_StructWithPtr>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 4 );
+        if( a != 0x0 )
+            s.swap_pods( a, 4, count );
+    }
+}
+
+inline void dl_serializer<BugTest3>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer<BugTest3_StructWithPtr>::store( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<BugTest3>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    dl_serializer<BugTest3_StructWithPtr>::patch( p, inst + 0 );
+}
+
+inline void dl_serializer<BugTest3>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer<BugTest3_StructWithPtr>::swap( s, inst + 0 );
+}
+
+inline void dl_serializer<per_bug_1>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_string( pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<per_bug_1>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<per_bug_1>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_ptr( inst + 0 );
+}
+
+inline void dl_serializer<per_bug>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<per_bug_1>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<per_bug>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            dl_serializer<per_bug_1>::patch( p, a + i * dl_serializer_align_up( dl_serializer<per_bug_1>::SIZE, dl_serializer<per_bug_1>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<per_bug>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<per_bug_1>::SIZE, dl_serializer<per_bug_1>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<per_bug_1>::swap( s, a + i * dl_serializer_align_up( dl_serializer<per_bug_1>::SIZE, dl_serializer<per_bug_1>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<bug_with_substr_2>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_string( pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<bug_with_substr_2>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<bug_with_substr_2>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_ptr( inst + 0 );
+}
+
+inline void dl_serializer<bug_with_substr>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_string( pos + 0, inst + 0 );
+    dl_serializer<bug_with_substr_2>::store( w, pos + DL_SERIALIZER_PTR_SEL( 4, 8 ), inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<bug_with_substr>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+    dl_serializer<bug_with_substr_2>::patch( p, inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<bug_with_substr>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_ptr( inst + 0 );
+    dl_serializer<bug_with_substr_2>::swap( s, inst + DL_SERIALIZER_PTR_SEL( 4, 8 ) );
+}
+
+inline void dl_serializer<vec3_test>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 12 );
+}
+
+inline void dl_serializer<vec3_test>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<vec3_test>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+    s.swap_pod( inst + 4, 4 );
+    s.swap_pod( inst + 8, 4 );
+}
+
+inline void dl_serializer<no_verify_memeber_test>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 12 );
+}
+
+inline void dl_serializer<no_verify_memeber_test>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<no_verify_memeber_test>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+    s.swap_pod( inst + 4, 4 );
+    s.swap_pod( inst + 8, 4 );
+}
+
+inline void dl_serializer<no_verify_size_align_test>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 12 );
+}
+
+inline void dl_serializer<no_verify_size_align_test>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<no_verify_size_align_test>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    s.swap_pod( inst + 0, 4 );
+    s.swap_pod( inst + 4, 4 );
+    s.swap_pod( inst + 8, 4 );
+}
+
+inline void dl_serializer<alias_test>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.write( pos + 0, inst + 0, 24 );
+}
+
+inline void dl_serializer<alias_test>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    (void)p; (void)inst;
+}
+
+inline void dl_serializer<alias_test>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    dl_serializer<vec3_test>::swap( s, inst + 0 );
+    dl_serializer<vec3_test>::swap( s, inst + 12 );
+}
+
+inline void dl_serializer<complex_member>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    w.store_pod_array( pos + 0, inst + 0, 4 );
+}
+
+inline void dl_serializer<complex_member>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    p.patch( inst + 0 );
+}
+
+inline void dl_serializer<complex_member>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * 4 );
+        if( a != 0x0 )
+            s.swap_pods( a, 4, count );
+    }
+}
+
+inline void dl_serializer<big_array_test>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )
+{
+    dl_serializer_store_struct_array<complex_member>( w, pos + 0, inst + 0 );
+}
+
+inline void dl_serializer<big_array_test>::patch( dl_serializer_patcher& p, unsigned char* inst )
+{
+    {
+        unsigned char* a = (unsigned char*)p.patch( inst + 0 );
+        for( size_t i = 0, n = dl_serializer_read_count( inst + 0 ); i < n; ++i )
+            dl_serializer<complex_member>::patch( p, a + i * dl_serializer_align_up( dl_serializer<complex_member>::SIZE, dl_serializer<complex_member>::ALIGNMENT ) );
+    }
+}
+
+inline void dl_serializer<big_array_test>::swap( dl_serializer_swapper& s, unsigned char* inst )
+{
+    (void)s; (void)inst;
+    {
+        uintptr_t offset = s.swap_ptr( inst + 0 );
+        size_t    count  = s.swap_uint32( inst + 0 + sizeof( void* ) );
+        unsigned char* a = s.subdata( offset, count * dl_serializer_align_up( dl_serializer<complex_member>::SIZE, dl_serializer<complex_member>::ALIGNMENT ) );
+        if( a != 0x0 )
+            for( size_t i = 0; i < count; ++i )
+                dl_serializer<complex_member>::swap( s, a + i * dl_serializer_align_up( dl_serializer<complex_member>::SIZE, dl_serializer<complex_member>::ALIGNMENT ) );
+    }
+}
+
+#endif // __DL_AUTOGEN_SERIALIZERS_UNITTEST2_SERIALIZERS_H_INCLUDED
+
@@ -2,6 +2,7 @@
 #include "dl_swap.h"
 #include "dl_binary_writer.h"
 #include "dl_patch_ptr.h"
+#include "dl_validate.h"
 
 #include <dl/dl.h>
 
@@ -23,23 +24,81 @@ dl_error_t dl_context_create( dl_ctx_t* dl_ctx, dl_create_params_t* create_param
 	ctx->error_msg_func = create_params->error_msg_func;
 	ctx->error_msg_ctx  = create_params->error_msg_ctx;
 
+	ctx->parallel_for_func = create_params->parallel_for_func;
+	ctx->parallel_ctx      = create_params->parallel_ctx;
+
 	*dl_ctx = ctx;
 
 	return DL_ERROR_OK;
 }
 
+dl_error_t dl_context_freeze( dl_ctx_t dl_ctx )
+{
+	dl_ctx->frozen = true;
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_context_create_workspace( dl_ctx_t dl_ctx, dl_create_params_t* create_params, dl_ctx_t* out_workspace )
+{
+	if( !dl_ctx->frozen )
+	{
+		dl_log_error( dl_ctx, "workspaces can only be created from a frozen context, see dl_context_freeze()" );
+		return DL_ERROR_UNSUPPORTED_OPERATION;
+	}
+
+	dl_allocator alloc = dl_ctx->alloc;
+	if( create_params != 0x0 )
+		dl_allocator_initialize( &alloc, create_params->alloc_func, create_params->realloc_func, create_params->free_func, create_params->alloc_ctx );
+
+	dl_context* ws = (dl_context*)dl_alloc( &alloc, sizeof( dl_context ) );
+	if( ws == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+
+	// ... share all type-data with the frozen ctx, only allocator and callbacks are the workspace own ...
+	memcpy( ws, dl_ctx, sizeof( dl_context ) );
+	memcpy( &ws->alloc, &alloc, sizeof( dl_allocator ) );
+	ws->workspace_of = dl_ctx->workspace_of != 0x0 ? dl_ctx->workspace_of : dl_ctx;
+
+	if( create_params != 0x0 )
+	{
+		ws->error_msg_func    = create_params->error_msg_func;
+		ws->error_msg_ctx     = create_params->error_msg_ctx;
+		ws->parallel_for_func = create_params->parallel_for_func;
+		ws->parallel_ctx      = create_params->parallel_ctx;
+	}
+
+	*out_workspace = ws;
+	return DL_ERROR_OK;
+}
+
 dl_error_t dl_context_destroy(dl_ctx_t dl_ctx)
 {
-	dl_free( &dl_ctx->alloc, dl_ctx->type_ids );
-	dl_free( &dl_ctx->alloc, dl_ctx->type_descs );
-	dl_free( &dl_ctx->alloc, dl_ctx->enum_ids );
-	dl_free( &dl_ctx->alloc, dl_ctx->enum_descs );
-	dl_free( &dl_ctx->alloc, dl_ctx->member_descs );
-	dl_free( &dl_ctx->alloc, dl_ctx->enum_value_descs );
-	dl_free( &dl_ctx->alloc, dl_ctx->enum_alias_descs );
-	dl_free( &dl_ctx->alloc, dl_ctx->typedata_strings );
-	dl_free( &dl_ctx->alloc, dl_ctx->default_data );
-	dl_free( &dl_ctx->alloc, dl_ctx->c_includes );
+	if( dl_ctx->workspace_of != 0x0 )
+	{
+		// ... a workspace do not own anything but itself ...
+		dl_free( &dl_ctx->alloc, dl_ctx );
+		return DL_ERROR_OK;
+	}
+
+	if( dl_ctx->inplace_typelib == 0x0 )
+	{
+		dl_free( &dl_ctx->alloc, dl_ctx->type_ids );
+		dl_free( &dl_ctx->alloc, dl_ctx->type_descs );
+		dl_free( &dl_ctx->alloc, dl_ctx->enum_ids );
+		dl_free( &dl_ctx->alloc, dl_ctx->enum_descs );
+		dl_free( &dl_ctx->alloc, dl_ctx->member_descs );
+		dl_free( &dl_ctx->alloc, dl_ctx->enum_value_descs );
+		dl_free( &dl_ctx->alloc, dl_ctx->enum_alias_descs );
+		dl_free( &dl_ctx->alloc, dl_ctx->typedata_strings );
+		dl_free( &dl_ctx->alloc, dl_ctx->default_data );
+		dl_free( &dl_ctx->alloc, dl_ctx->c_includes );
+	}
+	dl_free( &dl_ctx->alloc, dl_ctx->modules );
+	dl_free( &dl_ctx->alloc, dl_ctx->type_hots );
+	dl_free( &dl_ctx->alloc, dl_ctx->member_hots );
+	dl_free( &dl_ctx->alloc, dl_ctx->type_defaults );
+	dl_free( &dl_ctx->alloc, dl_ctx->default_templates );
+	dl_free( &dl_ctx->alloc, dl_ctx->default_members );
 	for( size_t i = 0; i < dl_ctx->metadatas_count; ++i)
 		dl_free( &dl_ctx->alloc, dl_ctx->metadatas[i] );
 	dl_free( &dl_ctx->alloc, dl_ctx->metadatas );
@@ -75,6 +134,14 @@ dl_error_t dl_instance_load( dl_ctx_t             dl_ctx,          dl_typeid_t
                              void*                instance,        size_t instance_size,
                              const unsigned char* packed_instance, size_t packed_instance_size,
                              size_t*              consumed )
+{
+	return dl_instance_load_ex( dl_ctx, type_id, instance, instance_size, packed_instance, packed_instance_size, DL_LOAD_FLAGS_NONE, consumed );
+}
+
+dl_error_t dl_instance_load_ex( dl_ctx_t             dl_ctx,          dl_typeid_t  type_id,
+                                void*                instance,        size_t       instance_size,
+                                const unsigned char* packed_instance, size_t       packed_instance_size,
+                                unsigned int         flags,           size_t*      consumed )
 {
 	dl_data_header* header = (dl_data_header*)packed_instance;
 
@@ -96,11 +163,19 @@ dl_error_t dl_instance_load( dl_ctx_t             dl_ctx,          dl_typeid_t
 
 	DL_ASSERT( (uint8_t*)instance + header->instance_size > packed_instance || (uint8_t*)instance < packed_instance + header->instance_size );
 	size_t header_offset = dl_internal_align_up( sizeof( dl_data_header ), root_type->alignment[DL_PTR_SIZE_HOST] );
+
+	if( ( flags & DL_LOAD_FLAGS_VALIDATE ) && !dl_internal_instance_fits_host( header, packed_instance_size, header_offset ) )
+		return DL_ERROR_MALFORMED_DATA;
+
 	memcpy( instance, packed_instance + header_offset, header->instance_size );
 
 	if (consumed)
 		*consumed = (size_t)header->instance_size + header_offset;
 
+	// ... validating patch each ptr as it is found to be valid, the ptr-chain is not used ...
+	if( flags & DL_LOAD_FLAGS_VALIDATE )
+		return dl_internal_validate_instance( dl_ctx, header, root_type, (uint8_t*)instance, true );
+
 	if( header->not_using_ptr_chain_patching )
 		dl_internal_patch_instance( dl_ctx, root_type, (uint8_t*)instance, 0x0, (uintptr_t)instance - header_offset );
 	else
@@ -112,6 +187,14 @@ dl_error_t dl_instance_load( dl_ctx_t             dl_ctx,          dl_typeid_t
 dl_error_t DL_DLL_EXPORT dl_instance_load_inplace( dl_ctx_t       dl_ctx,          dl_typeid_t type_id,
 												   unsigned char* packed_instance, size_t      packed_instance_size,
 												   void**         loaded_instance, size_t*     consumed)
+{
+	return dl_instance_load_inplace_ex( dl_ctx, type_id, packed_instance, packed_instance_size, DL_LOAD_FLAGS_NONE, loaded_instance, consumed );
+}
+
+dl_error_t dl_instance_load_inplace_ex( dl_ctx_t       dl_ctx,          dl_typeid_t  type_id,
+                                        unsigned char* packed_instance, size_t       packed_instance_size,
+                                        unsigned int   flags,
+                                        void**         loaded_instance, size_t*      consumed )
 {
 	dl_data_header* header = (dl_data_header*)packed_instance;
 
@@ -126,11 +209,18 @@ dl_error_t DL_DLL_EXPORT dl_instance_load_inplace( dl_ctx_t       dl_ctx,
 		return DL_ERROR_TYPE_NOT_FOUND;
 
 	size_t header_offset = dl_internal_align_up( sizeof( dl_data_header ), root_type->alignment[DL_PTR_SIZE_HOST] );
+
+	if( ( flags & DL_LOAD_FLAGS_VALIDATE ) && !dl_internal_instance_fits_host( header, packed_instance_size, header_offset ) )
+		return DL_ERROR_MALFORMED_DATA;
+
 	*loaded_instance = packed_instance + header_offset;
 
 	if( consumed )
 		*consumed = header->instance_size + header_offset;
 
+	if( flags & DL_LOAD_FLAGS_VALIDATE )
+		return dl_internal_validate_instance( dl_ctx, header, root_type, (uint8_t*)*loaded_instance, true );
+
 	if( header->version == DL_INSTANCE_VERSION && !header->not_using_ptr_chain_patching )
 	{
 		return dl_ptr_chain_patching( header, (uint8_t*)*loaded_instance, root_type );
@@ -142,6 +232,27 @@ dl_error_t DL_DLL_EXPORT dl_instance_load_inplace( dl_ctx_t       dl_ctx,
 	return DL_ERROR_OK;
 }
 
+dl_error_t dl_instance_validate( dl_ctx_t dl_ctx, dl_typeid_t type_id, const unsigned char* packed_instance, size_t packed_instance_size )
+{
+	const dl_data_header* header = (const dl_data_header*)packed_instance;
+
+	if( packed_instance_size < sizeof(dl_data_header) ) return DL_ERROR_MALFORMED_DATA;
+	if( header->id == DL_INSTANCE_ID_SWAPED )           return DL_ERROR_ENDIAN_MISMATCH;
+	if( header->id != DL_INSTANCE_ID )                  return DL_ERROR_MALFORMED_DATA;
+	if( header->version != DL_INSTANCE_VERSION )        return DL_ERROR_VERSION_MISMATCH;
+	if( header->root_instance_type != type_id )         return DL_ERROR_TYPE_MISMATCH;
+
+	const dl_type_desc* root_type = dl_internal_find_type( dl_ctx, header->root_instance_type );
+	if( root_type == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	size_t header_offset = dl_internal_align_up( sizeof( dl_data_header ), root_type->alignment[DL_PTR_SIZE_HOST] );
+	if( !dl_internal_instance_fits_host( header, packed_instance_size, header_offset ) )
+		return DL_ERROR_MALFORMED_DATA;
+
+	return dl_internal_validate_instance( dl_ctx, header, root_type, (uint8_t*)packed_instance + header_offset, false );
+}
+
 struct CDLBinStoreContext
 {
 	CDLBinStoreContext( uint8_t* out_data, size_t out_data_size, bool is_dummy, dl_allocator alloc )
@@ -224,9 +335,9 @@ static void dl_internal_store_string( const uint8_t* instance, CDLBinStoreContex
 	dl_binary_writer_write( &store_ctx->writer, &offset, sizeof(uintptr_t) );
 }
 
-static dl_error_t dl_internal_instance_store( dl_ctx_t dl_ctx, const dl_type_desc* type, uint8_t* instance, CDLBinStoreContext* store_ctx );
+static dl_error_t dl_internal_instance_store( dl_ctx_t dl_ctx, const dl_type_hot* type, uint8_t* instance, CDLBinStoreContext* store_ctx );
 
-static dl_error_t dl_internal_store_ptr( dl_ctx_t dl_ctx, uint8_t* instance, const dl_type_desc* sub_type, CDLBinStoreContext* store_ctx )
+static dl_error_t dl_internal_store_ptr( dl_ctx_t dl_ctx, uint8_t* instance, const dl_type_hot* sub_type, CDLBinStoreContext* store_ctx )
 {
 	uint8_t* data = *(uint8_t**)instance;
 	uintptr_t offset = store_ctx->FindWrittenPtr( data );
@@ -241,9 +352,8 @@ static dl_error_t dl_internal_store_ptr( dl_ctx_t dl_ctx, uint8_t* instance, con
 		uintptr_t pos = dl_binary_writer_tell( &store_ctx->writer );
 		dl_binary_writer_seek_end( &store_ctx->writer );
 
-		// const dl_type_desc* sub_type = dl_internal_find_type( dl_ctx, member->type_id );
-		uintptr_t size = dl_internal_align_up( sub_type->size[DL_PTR_SIZE_HOST], sub_type->alignment[DL_PTR_SIZE_HOST] );
-		dl_binary_writer_align( &store_ctx->writer, sub_type->alignment[DL_PTR_SIZE_HOST] );
+		uintptr_t size = dl_internal_align_up( sub_type->size, sub_type->alignment );
+		dl_binary_writer_align( &store_ctx->writer, sub_type->alignment );
 
 		offset = dl_binary_writer_tell( &store_ctx->writer );
 
@@ -265,13 +375,13 @@ static dl_error_t dl_internal_store_ptr( dl_ctx_t dl_ctx, uint8_t* instance, con
 	return DL_ERROR_OK;
 }
 
-static dl_error_t dl_internal_store_array( dl_ctx_t dl_ctx, dl_type_storage_t storage_type, const dl_type_desc* sub_type, uint8_t* instance, uint32_t count, uintptr_t size, CDLBinStoreContext* store_ctx )
+static dl_error_t dl_internal_store_array( dl_ctx_t dl_ctx, dl_type_storage_t storage_type, const dl_type_hot* sub_type, uint8_t* instance, uint32_t count, uintptr_t size, CDLBinStoreContext* store_ctx )
 {
 	switch( storage_type )
 	{
 		case DL_TYPE_STORAGE_STRUCT:
 		{
-			uintptr_t size_ = sub_type->size[DL_PTR_SIZE_HOST];
+			uintptr_t size_ = sub_type->size;
 			if( sub_type->flags & DL_TYPE_FLAG_HAS_SUBDATA )
 			{
 				for (uint32_t elem = 0; elem < count; ++elem)
@@ -304,7 +414,13 @@ static dl_error_t dl_internal_store_array( dl_ctx_t dl_ctx, dl_type_storage_t st
 	return DL_ERROR_OK;
 }
 
-static dl_error_t dl_internal_store_member( dl_ctx_t dl_ctx, const dl_member_desc* member, uint8_t* instance, CDLBinStoreContext* store_ctx )
+static dl_error_t dl_internal_store_member_subtype_missing( dl_ctx_t dl_ctx, const dl_member_hot* member )
+{
+	dl_log_error( dl_ctx, "Could not find subtype for member %s", dl_internal_member_name( dl_ctx, dl_internal_member_desc_of( dl_ctx, member ) ) );
+	return DL_ERROR_TYPE_NOT_FOUND;
+}
+
+static dl_error_t dl_internal_store_member( dl_ctx_t dl_ctx, const dl_member_hot* member, uint8_t* instance, CDLBinStoreContext* store_ctx )
 {
 	dl_type_atom_t    atom_type    = member->AtomType();
 	dl_type_storage_t storage_type = member->StorageType();
@@ -317,13 +433,9 @@ static dl_error_t dl_internal_store_member( dl_ctx_t dl_ctx, const dl_member_des
 			{
 				case DL_TYPE_STORAGE_STRUCT:
 				{
-					const dl_type_desc* sub_type = dl_internal_find_type( dl_ctx, member->type_id );
-					if( sub_type == 0x0 )
-					{
-						dl_log_error( dl_ctx, "Could not find subtype for member %s", dl_internal_member_name( dl_ctx, member ) );
-						return DL_ERROR_TYPE_NOT_FOUND;
-					}
-					dl_error_t err = dl_internal_instance_store(dl_ctx, sub_type, instance, store_ctx);
+					if( member->subtype == 0x0 )
+						return dl_internal_store_member_subtype_missing( dl_ctx, member );
+					dl_error_t err = dl_internal_instance_store(dl_ctx, member->subtype, instance, store_ctx);
 					if (DL_ERROR_OK != err)
 						return err;
 				}
@@ -333,20 +445,15 @@ static dl_error_t dl_internal_store_member( dl_ctx_t dl_ctx, const dl_member_des
 					break;
 				case DL_TYPE_STORAGE_PTR:
 				{
-					const dl_type_desc* sub_type = dl_internal_find_type( dl_ctx, member->type_id );
-					if( sub_type == 0x0 )
-					{
-						dl_log_error( dl_ctx, "Could not find subtype for member %s", dl_internal_member_name( dl_ctx, member ) );
-						return DL_ERROR_TYPE_NOT_FOUND;
-					}
-					dl_error_t err = dl_internal_store_ptr( dl_ctx, instance, sub_type, store_ctx );
+					if( member->subtype == 0x0 )
+						return dl_internal_store_member_subtype_missing( dl_ctx, member );
+					dl_error_t err = dl_internal_store_ptr( dl_ctx, instance, member->subtype, store_ctx );
 					if (DL_ERROR_OK != err)
 						return err;
 				}
 				break;
 				default: // default is a standard pod-type
-					DL_ASSERT( member->IsSimplePod() );
-					dl_binary_writer_write( &store_ctx->writer, instance, member->size[DL_PTR_SIZE_HOST] );
+					dl_binary_writer_write( &store_ctx->writer, instance, member->size );
 					break;
 			}
 		}
@@ -354,28 +461,23 @@ static dl_error_t dl_internal_store_member( dl_ctx_t dl_ctx, const dl_member_des
 
 		case DL_TYPE_ATOM_INLINE_ARRAY:
 		{
-			const dl_type_desc* sub_type = 0x0;
 			uint32_t count = member->inline_array_cnt();
 			if( storage_type == DL_TYPE_STORAGE_STRUCT ||
 				storage_type == DL_TYPE_STORAGE_PTR )
 			{
-				sub_type = dl_internal_find_type(dl_ctx, member->type_id);
-				if (sub_type == 0x0)
-				{
-					dl_log_error(dl_ctx, "Could not find subtype for member %s", dl_internal_member_name(dl_ctx, member));
-					return DL_ERROR_TYPE_NOT_FOUND;
-				}
+				if( member->subtype == 0x0 )
+					return dl_internal_store_member_subtype_missing( dl_ctx, member );
 			}
 			else if( storage_type != DL_TYPE_STORAGE_STR )
-				count = member->size[DL_PTR_SIZE_HOST];
+				count = member->size;
 
-			return dl_internal_store_array( dl_ctx, storage_type, sub_type, instance, count, 1, store_ctx );
+			return dl_internal_store_array( dl_ctx, storage_type, member->subtype, instance, count, 1, store_ctx );
 		}
 
 		case DL_TYPE_ATOM_ARRAY:
 		{
 			uintptr_t size = 0;
-			const dl_type_desc* sub_type = 0x0;
+			const dl_type_hot* sub_type = member->subtype;
 
 			uint8_t* data_ptr = instance;
 			uint32_t count    = *(uint32_t*)( data_ptr + sizeof(void*) );
@@ -386,21 +488,20 @@ static dl_error_t dl_internal_store_member( dl_ctx_t dl_ctx, const dl_member_des
 				offset = DL_NULL_PTR_OFFSET[ DL_PTR_SIZE_HOST ];
 			else
 			{
+				if( ( storage_type == DL_TYPE_STORAGE_STRUCT || storage_type == DL_TYPE_STORAGE_PTR ) && sub_type == 0x0 )
+					return dl_internal_store_member_subtype_missing( dl_ctx, member );
+
 				uintptr_t pos = dl_binary_writer_tell( &store_ctx->writer );
 				dl_binary_writer_seek_end( &store_ctx->writer );
 
 				switch(storage_type)
 				{
 					case DL_TYPE_STORAGE_STRUCT:
-						sub_type = dl_internal_find_type( dl_ctx, member->type_id );
-						size = dl_internal_align_up( sub_type->size[DL_PTR_SIZE_HOST], sub_type->alignment[DL_PTR_SIZE_HOST] );
-						dl_binary_writer_align( &store_ctx->writer, sub_type->alignment[DL_PTR_SIZE_HOST] );
+						size = dl_internal_align_up( sub_type->size, sub_type->alignment );
+						dl_binary_writer_align( &store_ctx->writer, sub_type->alignment );
 						break;
-					case DL_TYPE_STORAGE_PTR:
-						sub_type = dl_internal_find_type( dl_ctx, member->type_id );
-						/*fallthrough*/
 					default:
-						size = dl_pod_size( member->StorageType() );
+						size = dl_pod_size( storage_type );
 						dl_binary_writer_align( &store_ctx->writer, size );
 				}
 
@@ -429,7 +530,7 @@ static dl_error_t dl_internal_store_member( dl_ctx_t dl_ctx, const dl_member_des
 		return DL_ERROR_OK;
 
 		case DL_TYPE_ATOM_BITFIELD:
-			dl_binary_writer_write( &store_ctx->writer, instance, member->size[DL_PTR_SIZE_HOST] );
+			dl_binary_writer_write( &store_ctx->writer, instance, member->size );
 		break;
 
 		default:
@@ -440,27 +541,26 @@ static dl_error_t dl_internal_store_member( dl_ctx_t dl_ctx, const dl_member_des
 	return DL_ERROR_OK;
 }
 
-static dl_error_t dl_internal_instance_store( dl_ctx_t dl_ctx, const dl_type_desc* type, uint8_t* instance, CDLBinStoreContext* store_ctx )
+static dl_error_t dl_internal_instance_store( dl_ctx_t dl_ctx, const dl_type_hot* type, uint8_t* instance, CDLBinStoreContext* store_ctx )
 {
 	bool last_was_bitfield = false;
 
-	dl_binary_writer_align( &store_ctx->writer, type->alignment[DL_PTR_SIZE_HOST] );
+	dl_binary_writer_align( &store_ctx->writer, type->alignment );
 
 	uintptr_t instance_pos = dl_binary_writer_tell( &store_ctx->writer );
 	if( type->flags & DL_TYPE_FLAG_IS_UNION )
 	{
-		size_t type_offset = dl_internal_union_type_offset( dl_ctx, type, DL_PTR_SIZE_HOST );
-
-		// find member index from union type ...
-		uint32_t union_type = *((uint32_t*)(instance + type_offset));
-		const dl_member_desc* member = dl_internal_union_type_to_member(dl_ctx, type, union_type);
-		if (member == nullptr)
+		// find member from union type ...
+		size_t   type_offset = type->union_type_offset[DL_PTR_SIZE_HOST];
+		uint32_t union_type  = *((uint32_t*)(instance + type_offset));
+		const dl_member_hot* member = dl_internal_union_type_to_member_hot( dl_ctx, type, union_type );
+		if( member == 0x0 )
 		{
-			dl_log_error(dl_ctx, "Could not find union type %X for type %s", union_type, dl_internal_type_name(dl_ctx, type));
+			dl_log_error(dl_ctx, "Could not find union type %X for type %s", union_type, dl_internal_type_name(dl_ctx, dl_internal_type_desc_of( dl_ctx, type )));
 			return DL_ERROR_MALFORMED_DATA;
 		}
 
-		dl_error_t err = dl_internal_store_member( dl_ctx, member, instance + member->offset[DL_PTR_SIZE_HOST], store_ctx );
+		dl_error_t err = dl_internal_store_member( dl_ctx, member, instance + member->offset, store_ctx );
 		if( err != DL_ERROR_OK )
 			return err;
 
@@ -471,12 +571,12 @@ static dl_error_t dl_internal_instance_store( dl_ctx_t dl_ctx, const dl_type_des
 	{
 		for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
 		{
-			const dl_member_desc* member = dl_get_type_member( dl_ctx, type, member_index );
+			const dl_member_hot* member = type->members + member_index;
 
 			if( !last_was_bitfield || member->AtomType() != DL_TYPE_ATOM_BITFIELD )
 			{
-				dl_binary_writer_seek_set( &store_ctx->writer, instance_pos + member->offset[DL_PTR_SIZE_HOST] );
-				dl_error_t err = dl_internal_store_member( dl_ctx, member, instance + member->offset[DL_PTR_SIZE_HOST], store_ctx );
+				dl_binary_writer_seek_set( &store_ctx->writer, instance_pos + member->offset );
+				dl_error_t err = dl_internal_store_member( dl_ctx, member, instance + member->offset, store_ctx );
 				if( err != DL_ERROR_OK )
 					return err;
 			}
@@ -494,7 +594,8 @@ dl_error_t dl_instance_store( dl_ctx_t       dl_ctx,     dl_typeid_t type_id,
 	if( out_buffer_size > 0 && out_buffer_size <= sizeof(dl_data_header) )
 		return DL_ERROR_BUFFER_TOO_SMALL;
 
-	const dl_type_desc* type = dl_internal_find_type( dl_ctx, type_id );
+	const dl_type_desc* type_desc = dl_internal_find_type( dl_ctx, type_id );
+	const dl_type_hot*  type      = type_desc != 0x0 ? dl_internal_type_hot( dl_ctx, type_desc ) : 0x0;
 	if( type == 0x0 )
 		return DL_ERROR_TYPE_NOT_FOUND;
 
@@ -502,7 +603,7 @@ dl_error_t dl_instance_store( dl_ctx_t       dl_ctx,     dl_typeid_t type_id,
 	CDLBinStoreContext store_context( out_buffer, out_buffer_size, store_ctx_is_dummy, dl_ctx->alloc );
 
 	dl_data_header* header = (dl_data_header*)out_buffer;
-	size_t header_plus_alignment = dl_internal_align_up( sizeof( dl_data_header ), type->alignment[DL_PTR_SIZE_HOST] );
+	size_t header_plus_alignment = dl_internal_align_up( sizeof( dl_data_header ), type->alignment );
 	if( out_buffer_size > 0 )
 	{
 		if( instance == out_buffer + header_plus_alignment )
@@ -518,7 +619,7 @@ dl_error_t dl_instance_store( dl_ctx_t       dl_ctx,     dl_typeid_t type_id,
 	dl_binary_writer_seek_set( &store_context.writer, header_plus_alignment );
 	dl_binary_writer_update_needed_size( &store_context.writer );
 
-	dl_binary_writer_reserve( &store_context.writer, type->size[DL_PTR_SIZE_HOST] );
+	dl_binary_writer_reserve( &store_context.writer, type->size );
 	store_context.AddWrittenPtr( instance, header_plus_alignment ); // if pointer refers to root-node, it can be found at offset "sizeof(dl_data_header)" plus alignment
 
 	dl_error_t err = dl_internal_instance_store( dl_ctx, type, (uint8_t*)instance, &store_context );
@@ -557,11 +658,6 @@ dl_error_t dl_instance_store( dl_ctx_t       dl_ctx,     dl_typeid_t type_id,
 	return err;
 }
 
-dl_error_t dl_instance_calc_size( dl_ctx_t dl_ctx, dl_typeid_t type, const void* instance, size_t* out_size )
-{
-	return dl_instance_store( dl_ctx, type, instance, 0x0, 0, out_size );
-}
-
 const char* dl_error_to_string( dl_error_t error )
 {
 #define DL_ERR_TO_STR(ERR) case ERR: return #ERR
@@ -597,6 +693,9 @@ const char* dl_error_to_string( dl_error_t error )
 		DL_ERR_TO_STR(DL_ERROR_UTIL_FILE_NOT_FOUND);
 		DL_ERR_TO_STR(DL_ERROR_UTIL_FILE_TYPE_MISMATCH);
 
+		DL_ERR_TO_STR(DL_ERROR_ARCHIVE_ENTRY_NOT_FOUND);
+		DL_ERR_TO_STR(DL_ERROR_MEMBER_NOT_FOUND);
+
 		DL_ERR_TO_STR(DL_ERROR_INTERNAL_ERROR);
 		default: return "Unknown error!";
 	}
@@ -607,7 +706,7 @@ dl_error_t dl_instance_get_info( const unsigned char* packed_instance, size_t pa
 {
 	dl_data_header* header = (dl_data_header*)packed_instance;
 
-	if( packed_instance_size < sizeof(dl_data_header) && header->id != DL_INSTANCE_ID_SWAPED && header->id != DL_INSTANCE_ID )
+	if( packed_instance_size < sizeof(dl_data_header) || ( header->id != DL_INSTANCE_ID_SWAPED && header->id != DL_INSTANCE_ID ) )
 		return DL_ERROR_MALFORMED_DATA;
 	if( header->version != DL_INSTANCE_VERSION && header->version != DL_INSTANCE_VERSION_SWAPED )
 		return DL_ERROR_VERSION_MISMATCH;
@@ -0,0 +1,313 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include "dl_types.h"
+
+#include <dl/dl.h>
+#include <dl/dl_archive.h>
+
+#include <algorithm>
+
+struct dl_archive_sort_item
+{
+	uint32_t    name_hash;
+	dl_typeid_t type;
+	uint32_t    input;
+};
+
+static bool dl_archive_sort_item_less( const dl_archive_sort_item& a, const dl_archive_sort_item& b )
+{
+	if( a.name_hash != b.name_hash )
+		return a.name_hash < b.name_hash;
+	if( a.type != b.type )
+		return a.type < b.type;
+	return a.input < b.input;
+}
+
+static inline uint32_t dl_archive_swap32( uint32_t val, bool swap ) { return swap ? dl_swap_endian_uint32( val ) : val; }
+static inline uint64_t dl_archive_swap64( uint64_t val, bool swap ) { return swap ? dl_swap_endian_uint64( val ) : val; }
+
+dl_error_t dl_archive_write( dl_ctx_t                  dl_ctx,
+                             const dl_archive_input_t* instances,   unsigned int instance_count,
+                             unsigned int              alignment,
+                             unsigned char*            out_archive, size_t       out_archive_size,
+                             size_t*                   produced_bytes )
+{
+	if( alignment < 16 || ( alignment & ( alignment - 1 ) ) != 0 )
+	{
+		dl_log_error( dl_ctx, "archive alignment need to be a power of 2 >= 16, got %u", alignment );
+		return DL_ERROR_INVALID_PARAMETER;
+	}
+
+	dl_archive_sort_item* items = (dl_archive_sort_item*)dl_alloc( &dl_ctx->alloc, sizeof( dl_archive_sort_item ) * ( instance_count + 1 ) );
+	if( items == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+
+	// ... validate all instances and calculate the size of the archive ...
+	dl_error_t  err          = DL_ERROR_OK;
+	dl_endian_t endian       = DL_ENDIAN_HOST;
+	size_t      strings_size = 0;
+	for( unsigned int i = 0; i < instance_count; ++i )
+	{
+		const dl_archive_input_t* input = instances + i;
+		dl_instance_info_t info;
+		err = dl_instance_get_info( input->packed_instance, input->packed_instance_size, &info );
+		if( err != DL_ERROR_OK )
+		{
+			dl_log_error( dl_ctx, "archive instance '%s' is not a packed instance", input->name );
+			break;
+		}
+
+		// ... the root is placed after the header aligned relative to the start of the instance ...
+		const dl_type_desc* root_type = dl_internal_find_type( dl_ctx, info.root_type );
+		if( root_type == 0x0 )
+		{
+			dl_log_error( dl_ctx, "archive instance '%s' is of a type not loaded in the context", input->name );
+			err = DL_ERROR_TYPE_NOT_FOUND;
+			break;
+		}
+		uint32_t root_alignment = root_type->alignment[ info.ptrsize == 4 ? DL_PTR_SIZE_32BIT : DL_PTR_SIZE_64BIT ];
+		if( root_alignment > alignment )
+		{
+			dl_log_error( dl_ctx, "archive instance '%s' need an alignment of %u but the archive is aligned to %u", input->name, root_alignment, alignment );
+			err = DL_ERROR_BAD_ALIGNMENT;
+			break;
+		}
+
+		if( i == 0 )
+			endian = info.endian;
+		else if( info.endian != endian )
+		{
+			dl_log_error( dl_ctx, "archive instance '%s' is not packed with the same endian as the other instances", input->name );
+			err = DL_ERROR_ENDIAN_MISMATCH;
+			break;
+		}
+
+		items[i].name_hash = dl_internal_hash_string( input->name );
+		items[i].type      = info.root_type;
+		items[i].input     = i;
+		strings_size += strlen( input->name ) + 1;
+	}
+
+	if( err != DL_ERROR_OK )
+	{
+		dl_free( &dl_ctx->alloc, items );
+		return err;
+	}
+
+	std::sort( items, items + instance_count, dl_archive_sort_item_less );
+
+	for( unsigned int i = 1; i < instance_count; ++i )
+	{
+		if( items[i].name_hash != items[i - 1].name_hash || items[i].type != items[i - 1].type )
+			continue;
+
+		// ... equal hash and type, only an error if the names are equal as well ...
+		for( unsigned int j = i; j > 0 && items[j - 1].name_hash == items[i].name_hash && items[j - 1].type == items[i].type; --j )
+		{
+			if( strcmp( instances[ items[i].input ].name, instances[ items[j - 1].input ].name ) == 0 )
+			{
+				dl_log_error( dl_ctx, "archive instance '%s' is added twice with the same type", instances[ items[i].input ].name );
+				dl_free( &dl_ctx->alloc, items );
+				return DL_ERROR_INVALID_PARAMETER;
+			}
+		}
+	}
+
+	size_t strings_offset = sizeof( dl_archive_header ) + sizeof( dl_archive_index_entry ) * instance_count;
+	size_t total_size     = dl_internal_align_up( strings_offset + strings_size, alignment );
+	for( unsigned int i = 0; i < instance_count; ++i )
+		total_size = dl_internal_align_up( total_size + instances[ items[i].input ].packed_instance_size, alignment );
+
+	if( produced_bytes )
+		*produced_bytes = total_size;
+
+	if( out_archive_size == 0 )
+	{
+		dl_free( &dl_ctx->alloc, items );
+		return DL_ERROR_OK;
+	}
+
+	if( out_archive_size < total_size )
+	{
+		dl_free( &dl_ctx->alloc, items );
+		return DL_ERROR_BUFFER_TOO_SMALL;
+	}
+
+	// ... header and index is written in the endian of the instances ...
+	bool swap = endian != DL_ENDIAN_HOST;
+	memset( out_archive, 0x0, total_size );
+
+	dl_archive_header* header = (dl_archive_header*)out_archive;
+	header->id             = dl_archive_swap32( DL_ARCHIVE_ID, swap );
+	header->version        = dl_archive_swap32( DL_ARCHIVE_VERSION, swap );
+	header->entry_count    = dl_archive_swap32( instance_count, swap );
+	header->alignment      = dl_archive_swap32( alignment, swap );
+	header->strings_offset = dl_archive_swap64( strings_offset, swap );
+	header->strings_size   = dl_archive_swap64( strings_size, swap );
+	header->size           = dl_archive_swap64( total_size, swap );
+
+	dl_archive_index_entry* index = (dl_archive_index_entry*)( out_archive + sizeof( dl_archive_header ) );
+	char*  strings    = (char*)out_archive + strings_offset;
+	size_t string_pos = 0;
+	size_t data_pos   = dl_internal_align_up( strings_offset + strings_size, alignment );
+	for( unsigned int i = 0; i < instance_count; ++i )
+	{
+		const dl_archive_input_t* input = instances + items[i].input;
+		size_t name_len = strlen( input->name ) + 1;
+		memcpy( strings + string_pos, input->name, name_len );
+		memcpy( out_archive + data_pos, input->packed_instance, input->packed_instance_size );
+
+		index[i].name_hash = dl_archive_swap32( items[i].name_hash, swap );
+		index[i].type      = dl_archive_swap32( items[i].type, swap );
+		index[i].name      = dl_archive_swap32( (uint32_t)string_pos, swap );
+		index[i].flags     = 0;
+		index[i].offset    = dl_archive_swap64( data_pos, swap );
+		index[i].size      = dl_archive_swap64( input->packed_instance_size, swap );
+
+		string_pos += name_len;
+		data_pos    = dl_internal_align_up( data_pos + input->packed_instance_size, alignment );
+	}
+
+	dl_free( &dl_ctx->alloc, items );
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_archive_open( unsigned char* archive_data, size_t archive_size, dl_archive_t* out_archive )
+{
+	if( archive_size < sizeof( dl_archive_header ) )
+		return DL_ERROR_MALFORMED_DATA;
+
+	const dl_archive_header* header = (const dl_archive_header*)archive_data;
+	if( header->id == DL_ARCHIVE_ID_SWAPED )
+		return DL_ERROR_ENDIAN_MISMATCH;
+	if( header->id != DL_ARCHIVE_ID )
+		return DL_ERROR_MALFORMED_DATA;
+	if( header->version != DL_ARCHIVE_VERSION )
+		return DL_ERROR_VERSION_MISMATCH;
+	if( header->alignment < 16 || ( header->alignment & ( header->alignment - 1 ) ) != 0 )
+		return DL_ERROR_MALFORMED_DATA;
+	if( !dl_internal_is_align( archive_data, header->alignment ) )
+		return DL_ERROR_BAD_ALIGNMENT;
+
+	// ... index and names need to be in the archive and the last name terminated, entries are checked as they are read ...
+	uint64_t index_end = sizeof( dl_archive_header ) + (uint64_t)sizeof( dl_archive_index_entry ) * header->entry_count;
+	if( header->size > archive_size ||
+		header->strings_offset < index_end ||
+		header->strings_offset > header->size ||
+		header->strings_size > header->size - header->strings_offset )
+		return DL_ERROR_MALFORMED_DATA;
+	if( header->entry_count > 0 && ( header->strings_size == 0 || archive_data[ header->strings_offset + header->strings_size - 1 ] != '\0' ) )
+		return DL_ERROR_MALFORMED_DATA;
+
+	// ... entries are written with no flags set, an entry marked as loaded was patched by dl_archive_load_inplace on
+	//     memory that was opened before and its ptrs can not be trusted, possibly from another process ...
+	const dl_archive_index_entry* index = (const dl_archive_index_entry*)( archive_data + sizeof( dl_archive_header ) );
+	for( uint32_t i = 0; i < header->entry_count; ++i )
+		if( index[i].flags != 0 )
+			return DL_ERROR_MALFORMED_DATA;
+
+	out_archive->data        = archive_data;
+	out_archive->size        = (size_t)header->size;
+	out_archive->entry_count = header->entry_count;
+	out_archive->alignment   = header->alignment;
+	return DL_ERROR_OK;
+}
+
+static inline const dl_archive_index_entry* dl_archive_index( const dl_archive_t* archive )
+{
+	return (const dl_archive_index_entry*)( archive->data + sizeof( dl_archive_header ) );
+}
+
+dl_error_t dl_archive_get_entry( const dl_archive_t* archive, unsigned int index, dl_archive_entry_t* out_entry )
+{
+	if( index >= archive->entry_count )
+		return DL_ERROR_INVALID_PARAMETER;
+
+	const dl_archive_header*      header = (const dl_archive_header*)archive->data;
+	const dl_archive_index_entry* entry  = dl_archive_index( archive ) + index;
+	if( entry->name >= header->strings_size ||
+		entry->offset > archive->size ||
+		entry->size > archive->size - entry->offset ||
+		!dl_internal_is_align( archive->data + entry->offset, archive->alignment ) )
+		return DL_ERROR_MALFORMED_DATA;
+
+	out_entry->name                 = (const char*)archive->data + header->strings_offset + entry->name;
+	out_entry->name_hash            = entry->name_hash;
+	out_entry->type                 = entry->type;
+	out_entry->packed_instance      = archive->data + entry->offset;
+	out_entry->packed_instance_size = (size_t)entry->size;
+	out_entry->loaded               = ( entry->flags & DL_ARCHIVE_ENTRY_FLAG_LOADED ) ? 1 : 0;
+	return DL_ERROR_OK;
+}
+
+// ... index of the entry named name of type, or of any type if type is 0, archive->entry_count if not found ...
+static dl_error_t dl_archive_find_index( const dl_archive_t* archive, const char* name, dl_typeid_t type, unsigned int* out_index, dl_archive_entry_t* out_entry )
+{
+	uint32_t name_hash = dl_internal_hash_string( name );
+
+	// ... lower bound of name_hash and type, type 0 is the lowest type so it find the first entry with name_hash ...
+	const dl_archive_index_entry* index = dl_archive_index( archive );
+	unsigned int first = 0;
+	unsigned int count = archive->entry_count;
+	while( count > 0 )
+	{
+		unsigned int step = count / 2;
+		const dl_archive_index_entry* it = index + first + step;
+		if( it->name_hash < name_hash || ( it->name_hash == name_hash && it->type < type ) )
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else
+			count = step;
+	}
+
+	// ... step over entries with colliding names ...
+	for( unsigned int i = first; i < archive->entry_count && index[i].name_hash == name_hash; ++i )
+	{
+		if( type != 0 && index[i].type != type )
+			break;
+
+		dl_error_t err = dl_archive_get_entry( archive, i, out_entry );
+		if( err != DL_ERROR_OK )
+			return err;
+		if( strcmp( out_entry->name, name ) == 0 )
+		{
+			*out_index = i;
+			return DL_ERROR_OK;
+		}
+	}
+	return DL_ERROR_ARCHIVE_ENTRY_NOT_FOUND;
+}
+
+dl_error_t dl_archive_find( const dl_archive_t* archive, const char* name, dl_typeid_t type, dl_archive_entry_t* out_entry )
+{
+	unsigned int index;
+	return dl_archive_find_index( archive, name, type, &index, out_entry );
+}
+
+dl_error_t dl_archive_load_inplace( dl_ctx_t dl_ctx, const dl_archive_t* archive, const char* name, dl_typeid_t type, void** loaded_instance )
+{
+	unsigned int       index;
+	dl_archive_entry_t entry;
+	dl_error_t err = dl_archive_find_index( archive, name, type, &index, &entry );
+	if( err != DL_ERROR_OK )
+		return err;
+
+	// ... an entry is only patched once, later loads return the instance patched by the first load ...
+	dl_archive_index_entry* index_entry = (dl_archive_index_entry*)dl_archive_index( archive ) + index;
+	if( entry.loaded )
+	{
+		const dl_type_desc* root_type = dl_internal_find_type( dl_ctx, entry.type );
+		if( root_type == 0x0 )
+			return DL_ERROR_TYPE_NOT_FOUND;
+		*loaded_instance = entry.packed_instance + dl_internal_align_up( sizeof( dl_data_header ), root_type->alignment[DL_PTR_SIZE_HOST] );
+		return DL_ERROR_OK;
+	}
+
+	err = dl_instance_load_inplace( dl_ctx, entry.type, entry.packed_instance, entry.packed_instance_size, loaded_instance, 0x0 );
+	if( err != DL_ERROR_OK )
+		return err;
+	index_entry->flags |= DL_ARCHIVE_ENTRY_FLAG_LOADED;
+	return DL_ERROR_OK;
+}
@@ -0,0 +1,260 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include "dl_types.h"
+#include "dl_ptr_map.h"
+
+#include <dl/dl.h>
+
+/*
+	Size of a stored instance calculated without storing it.
+
+	dl_instance_store place the root after the header and then append the subdata of the instance to the end of the
+	buffer, depth first in member order, each block aligned as its type. The size only depend on that sequence of
+	aligned appends so only the members that have subdata is visited, structs and arrays without subdata is added as
+	their precomputed size. Ptrs is stored once per address and strings once per content, as by dl_instance_store.
+	Structs containing unions is still visited to report invalid union-types the same way as dl_instance_store.
+*/
+
+struct dl_calc_size_string
+{
+	const char* str;
+	size_t      next; ///< 1 + index of next string with the same key in dl_calc_size_ctx::strings, 0 if last.
+};
+
+struct dl_calc_size_ctx
+{
+	explicit dl_calc_size_ctx( dl_ctx_t dl_ctx )
+		: ctx( dl_ctx )
+		, written( dl_ctx->alloc )
+		, visit( dl_ctx->alloc )
+		, string_keys( dl_ctx->alloc )
+		, strings( dl_ctx->alloc )
+	{
+	}
+
+	dl_ctx_t   ctx;
+	size_t     end;          ///< end of the stored instance so far.
+	bool       merge_strings;
+	dl_ptr_map written;      ///< address of structs pointed to that is already stored.
+	dl_ptr_map visit;        ///< type -> DL_CALC_SIZE_VISIT_*, if instances of the type need to be visited.
+	dl_ptr_map string_keys;  ///< hash of string -> index of first string with that hash in strings.
+
+	CArrayStatic<dl_calc_size_string, 128> strings;
+};
+
+enum
+{
+	DL_CALC_SIZE_VISIT_NO  = 1,
+	DL_CALC_SIZE_VISIT_YES = 2
+};
+
+static bool dl_calc_size_need_visit( dl_calc_size_ctx* sctx, const dl_type_hot* type )
+{
+	if( type->flags & ( DL_TYPE_FLAG_HAS_SUBDATA | DL_TYPE_FLAG_IS_UNION ) )
+		return true;
+
+	uintptr_t visit;
+	if( sctx->visit.find( (uintptr_t)type, &visit ) )
+		return visit == DL_CALC_SIZE_VISIT_YES;
+
+	// ... a type without subdata only need a visit if it embed a union ...
+	bool need_visit = false;
+	for( uint32_t member_index = 0; member_index < type->member_count && !need_visit; ++member_index )
+	{
+		const dl_member_hot* member = type->members + member_index;
+		if( member->StorageType() == DL_TYPE_STORAGE_STRUCT && member->subtype != 0x0 )
+			need_visit = dl_calc_size_need_visit( sctx, member->subtype );
+	}
+	sctx->visit.insert( (uintptr_t)type, need_visit ? DL_CALC_SIZE_VISIT_YES : DL_CALC_SIZE_VISIT_NO );
+	return need_visit;
+}
+
+static inline void dl_calc_size_append( dl_calc_size_ctx* sctx, size_t size, size_t alignment )
+{
+	sctx->end = dl_internal_align_up( sctx->end, alignment ) + size;
+}
+
+static void dl_calc_size_str( dl_calc_size_ctx* sctx, const uint8_t* instance )
+{
+	const char* str = *(const char* const*)instance;
+	if( str == 0x0 )
+		return;
+
+	size_t length = strlen( str );
+	if( sctx->merge_strings )
+	{
+		uintptr_t key = (uintptr_t)dl_internal_hash_buffer( (const uint8_t*)str, length ) | 1; // 0 is not a valid key.
+		uintptr_t first;
+		bool      found = sctx->string_keys.find( key, &first );
+		for( size_t next = found ? (size_t)first + 1 : 0; next != 0; next = sctx->strings[next - 1].next )
+			if( strcmp( sctx->strings[next - 1].str, str ) == 0 )
+				return;
+
+		// ... a new string with an already seen key is linked in after the first string with that key ...
+		dl_calc_size_string entry = { str, found ? sctx->strings[first].next : 0 };
+		sctx->strings.Add( entry );
+		if( found )
+			sctx->strings[first].next = sctx->strings.Len();
+		else
+			sctx->string_keys.insert( key, sctx->strings.Len() - 1 );
+	}
+	sctx->end += length + 1;
+}
+
+static dl_error_t dl_calc_size_struct( dl_calc_size_ctx* sctx, const dl_type_hot* type, const uint8_t* instance );
+
+static dl_error_t dl_calc_size_ptr( dl_calc_size_ctx* sctx, const dl_type_hot* subtype, const uint8_t* instance )
+{
+	const uint8_t* ptr = *(const uint8_t* const*)instance;
+	uintptr_t      unused;
+	if( ptr == 0x0 || sctx->written.find( (uintptr_t)ptr, &unused ) )
+		return DL_ERROR_OK;
+
+	sctx->written.insert( (uintptr_t)ptr, 1 );
+	dl_calc_size_append( sctx, dl_internal_align_up( subtype->size, subtype->alignment ), subtype->alignment );
+	return dl_calc_size_struct( sctx, subtype, ptr );
+}
+
+static dl_error_t dl_calc_size_elements( dl_calc_size_ctx* sctx, dl_type_storage_t storage, const dl_type_hot* subtype, const uint8_t* data, uint32_t count )
+{
+	switch( storage )
+	{
+		case DL_TYPE_STORAGE_STR:
+			for( uint32_t index = 0; index < count; ++index )
+				dl_calc_size_str( sctx, data + index * sizeof( void* ) );
+			return DL_ERROR_OK;
+
+		case DL_TYPE_STORAGE_PTR:
+			for( uint32_t index = 0; index < count; ++index )
+			{
+				dl_error_t err = dl_calc_size_ptr( sctx, subtype, data + index * sizeof( void* ) );
+				if( DL_ERROR_OK != err )
+					return err;
+			}
+			return DL_ERROR_OK;
+
+		case DL_TYPE_STORAGE_STRUCT:
+			if( dl_calc_size_need_visit( sctx, subtype ) )
+			{
+				for( uint32_t index = 0; index < count; ++index )
+				{
+					dl_error_t err = dl_calc_size_struct( sctx, subtype, data + index * subtype->size );
+					if( DL_ERROR_OK != err )
+						return err;
+				}
+			}
+			return DL_ERROR_OK;
+
+		default:
+			return DL_ERROR_OK;
+	}
+}
+
+static dl_error_t dl_calc_size_subtype_missing( dl_ctx_t dl_ctx, const dl_member_hot* member )
+{
+	dl_log_error( dl_ctx, "Could not find subtype for member %s", dl_internal_member_name( dl_ctx, dl_internal_member_desc_of( dl_ctx, member ) ) );
+	return DL_ERROR_TYPE_NOT_FOUND;
+}
+
+static dl_error_t dl_calc_size_member( dl_calc_size_ctx* sctx, const dl_member_hot* member, const uint8_t* instance )
+{
+	dl_type_storage_t storage = member->StorageType();
+	dl_type_atom_t    atom    = member->AtomType();
+	if( storage < DL_TYPE_STORAGE_STR )
+	{
+		if( atom == DL_TYPE_ATOM_ARRAY )
+		{
+			uint32_t count = *(const uint32_t*)( instance + sizeof( void* ) );
+			if( count > 0 )
+				dl_calc_size_append( sctx, count * dl_pod_size( storage ), dl_pod_size( storage ) );
+		}
+		return DL_ERROR_OK;
+	}
+
+	if( storage != DL_TYPE_STORAGE_STR && member->subtype == 0x0 )
+	{
+		// ... empty arrays is stored without looking at their type ...
+		if( atom == DL_TYPE_ATOM_ARRAY && *(const uint32_t*)( instance + sizeof( void* ) ) == 0 )
+			return DL_ERROR_OK;
+		return dl_calc_size_subtype_missing( sctx->ctx, member );
+	}
+
+	switch( atom )
+	{
+		case DL_TYPE_ATOM_POD:
+			return dl_calc_size_elements( sctx, storage, member->subtype, instance, 1 );
+
+		case DL_TYPE_ATOM_INLINE_ARRAY:
+			return dl_calc_size_elements( sctx, storage, member->subtype, instance, member->inline_array_cnt() );
+
+		case DL_TYPE_ATOM_ARRAY:
+		{
+			uint32_t count = *(const uint32_t*)( instance + sizeof( void* ) );
+			if( count == 0 )
+				return DL_ERROR_OK;
+
+			if( storage == DL_TYPE_STORAGE_STRUCT )
+				dl_calc_size_append( sctx, count * dl_internal_align_up( member->subtype->size, member->subtype->alignment ), member->subtype->alignment );
+			else
+				dl_calc_size_append( sctx, count * sizeof( void* ), sizeof( void* ) );
+			return dl_calc_size_elements( sctx, storage, member->subtype, *(const uint8_t* const*)instance, count );
+		}
+
+		default:
+			return DL_ERROR_OK;
+	}
+}
+
+static dl_error_t dl_calc_size_struct( dl_calc_size_ctx* sctx, const dl_type_hot* type, const uint8_t* instance )
+{
+	if( !dl_calc_size_need_visit( sctx, type ) )
+		return DL_ERROR_OK;
+
+	if( type->flags & DL_TYPE_FLAG_IS_UNION )
+	{
+		uint32_t union_type = *(const uint32_t*)( instance + type->union_type_offset[DL_PTR_SIZE_HOST] );
+		const dl_member_hot* member = dl_internal_union_type_to_member_hot( sctx->ctx, type, union_type );
+		if( member == 0x0 )
+		{
+			dl_log_error( sctx->ctx, "Could not find union type %X for type %s", union_type, dl_internal_type_name( sctx->ctx, dl_internal_type_desc_of( sctx->ctx, type ) ) );
+			return DL_ERROR_MALFORMED_DATA;
+		}
+		return dl_calc_size_member( sctx, member, instance + member->offset );
+	}
+
+	for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+	{
+		const dl_member_hot* member = type->members + member_index;
+		dl_error_t err = dl_calc_size_member( sctx, member, instance + member->offset );
+		if( DL_ERROR_OK != err )
+			return err;
+	}
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_instance_calc_size_ex( dl_ctx_t dl_ctx, dl_typeid_t type_id, const void* instance, unsigned int flags, size_t* out_size )
+{
+	const dl_type_desc* type_desc = dl_internal_find_type( dl_ctx, type_id );
+	const dl_type_hot*  type      = type_desc != 0x0 ? dl_internal_type_hot( dl_ctx, type_desc ) : 0x0;
+	if( type == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	dl_calc_size_ctx sctx( dl_ctx );
+	sctx.end           = dl_internal_align_up( sizeof( dl_data_header ), type->alignment ) + type->size;
+	sctx.merge_strings = ( flags & DL_CALC_SIZE_FLAGS_UPPER_BOUND ) == 0;
+
+	// ... ptrs to the root is stored as ptrs to the root ...
+	sctx.written.insert( (uintptr_t)instance, 1 );
+
+	dl_error_t err = dl_calc_size_struct( &sctx, type, (const uint8_t*)instance );
+	if( DL_ERROR_OK != err )
+		return err;
+
+	*out_size = sctx.end;
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_instance_calc_size( dl_ctx_t dl_ctx, dl_typeid_t type, const void* instance, size_t* out_size )
+{
+	return dl_instance_calc_size_ex( dl_ctx, type, instance, DL_CALC_SIZE_FLAGS_NONE, out_size );
+}
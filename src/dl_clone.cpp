@@ -0,0 +1,244 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include "dl_types.h"
+#include "dl_ptr_map.h"
+
+#include <dl/dl.h>
+
+struct dl_clone_item
+{
+	const dl_type_hot* type;
+	const uint8_t*     src;
+	size_t             dst;
+	uint32_t           count;
+};
+
+struct dl_clone_ctx
+{
+	explicit dl_clone_ctx( dl_ctx_t dl_ctx )
+		: ctx( dl_ctx )
+		, copied( dl_ctx->alloc )
+		, strings( dl_ctx->alloc )
+		, work( dl_ctx->alloc )
+	{
+	}
+
+	dl_ctx_t   ctx;
+	uint8_t*   out;
+	size_t     out_size;
+	size_t     pos;     ///< bytes produced in out, also when out is too small.
+	dl_ptr_map copied;  ///< address of struct or string in the instance -> position of the copy in out.
+	dl_ptr_map strings; ///< hash of string -> address of the first string copied with that hash.
+
+	CArrayStatic<dl_clone_item, 64> work; ///< arrays and structs pointed to that is copied but not patched.
+};
+
+// ... reserve size bytes in out and copy them from src if out is large enough ...
+static inline size_t dl_clone_copy( dl_clone_ctx* cctx, const void* src, size_t size, size_t alignment )
+{
+	size_t dst = dl_internal_align_up( cctx->pos, alignment );
+	cctx->pos = dst + size;
+	if( cctx->pos <= cctx->out_size )
+		memcpy( cctx->out + dst, src, size );
+	return dst;
+}
+
+static inline void dl_clone_write_ptr( dl_clone_ctx* cctx, size_t dst, size_t target, bool null )
+{
+	if( dst + sizeof( void* ) <= cctx->out_size )
+		*(uint8_t**)( cctx->out + dst ) = null ? 0x0 : cctx->out + target;
+}
+
+static void dl_clone_str( dl_clone_ctx* cctx, const uint8_t* src, size_t dst )
+{
+	const char* str = *(const char* const*)src;
+	if( str == 0x0 )
+	{
+		dl_clone_write_ptr( cctx, dst, 0, true );
+		return;
+	}
+
+	uintptr_t copy;
+	if( !cctx->copied.find( (uintptr_t)str, &copy ) )
+	{
+		// ... equal strings at different addresses is merged as by dl_instance_store ...
+		size_t    len  = strlen( str );
+		uintptr_t hash = (uintptr_t)dl_internal_hash_buffer( (const uint8_t*)str, len ) | 1; // 0 is not a valid key.
+		uintptr_t same;
+		if( !cctx->strings.find( hash, &same ) || strcmp( (const char*)same, str ) != 0 || !cctx->copied.find( same, &copy ) )
+		{
+			copy = dl_clone_copy( cctx, str, len + 1, 1 );
+			cctx->strings.insert( hash, (uintptr_t)str );
+		}
+		cctx->copied.insert( (uintptr_t)str, copy );
+	}
+	dl_clone_write_ptr( cctx, dst, copy, false );
+}
+
+static void dl_clone_ptr( dl_clone_ctx* cctx, const dl_type_hot* subtype, const uint8_t* src, size_t dst )
+{
+	const uint8_t* ptr = *(const uint8_t* const*)src;
+	if( ptr == 0x0 )
+	{
+		dl_clone_write_ptr( cctx, dst, 0, true );
+		return;
+	}
+
+	uintptr_t copy;
+	if( !cctx->copied.find( (uintptr_t)ptr, &copy ) )
+	{
+		copy = dl_clone_copy( cctx, ptr, subtype->size, subtype->alignment );
+		cctx->copied.insert( (uintptr_t)ptr, copy );
+		if( subtype->flags & DL_TYPE_FLAG_HAS_SUBDATA )
+		{
+			dl_clone_item item = { subtype, ptr, copy, 1 };
+			cctx->work.Add( item );
+		}
+	}
+	dl_clone_write_ptr( cctx, dst, copy, false );
+}
+
+static dl_error_t dl_clone_struct( dl_clone_ctx* cctx, const dl_type_hot* type, const uint8_t* src, size_t dst );
+
+static void dl_clone_elements( dl_clone_ctx* cctx, dl_type_storage_t storage, const dl_type_hot* subtype, const uint8_t* src, size_t dst, uint32_t count )
+{
+	switch( storage )
+	{
+		case DL_TYPE_STORAGE_STR:
+			for( uint32_t index = 0; index < count; ++index )
+				dl_clone_str( cctx, src + index * sizeof( void* ), dst + index * sizeof( void* ) );
+			break;
+		case DL_TYPE_STORAGE_PTR:
+			for( uint32_t index = 0; index < count; ++index )
+				dl_clone_ptr( cctx, subtype, src + index * sizeof( void* ), dst + index * sizeof( void* ) );
+			break;
+		case DL_TYPE_STORAGE_STRUCT:
+			if( subtype->flags & DL_TYPE_FLAG_HAS_SUBDATA )
+			{
+				dl_clone_item item = { subtype, src, dst, count };
+				cctx->work.Add( item );
+			}
+			break;
+		default:
+			break;
+	}
+}
+
+static dl_error_t dl_clone_subtype_missing( dl_ctx_t dl_ctx, const dl_member_hot* member )
+{
+	dl_log_error( dl_ctx, "Could not find subtype for member %s", dl_internal_member_name( dl_ctx, dl_internal_member_desc_of( dl_ctx, member ) ) );
+	return DL_ERROR_TYPE_NOT_FOUND;
+}
+
+static dl_error_t dl_clone_member( dl_clone_ctx* cctx, const dl_member_hot* member, const uint8_t* src, size_t dst )
+{
+	dl_type_storage_t storage = member->StorageType();
+	if( ( storage == DL_TYPE_STORAGE_STRUCT || storage == DL_TYPE_STORAGE_PTR ) && member->subtype == 0x0 )
+		return dl_clone_subtype_missing( cctx->ctx, member );
+
+	switch( member->AtomType() )
+	{
+		case DL_TYPE_ATOM_POD:
+			switch( storage )
+			{
+				case DL_TYPE_STORAGE_STR:    dl_clone_str( cctx, src, dst ); break;
+				case DL_TYPE_STORAGE_PTR:    dl_clone_ptr( cctx, member->subtype, src, dst ); break;
+				case DL_TYPE_STORAGE_STRUCT: return dl_clone_struct( cctx, member->subtype, src, dst );
+				default:
+					break;
+			}
+			break;
+
+		case DL_TYPE_ATOM_INLINE_ARRAY:
+			dl_clone_elements( cctx, storage, member->subtype, src, dst, member->inline_array_cnt() );
+			break;
+
+		case DL_TYPE_ATOM_ARRAY:
+		{
+			const uint8_t* data  = *(const uint8_t* const*)src;
+			uint32_t       count = *(const uint32_t*)( src + sizeof( void* ) );
+			if( data == 0x0 || count == 0 )
+			{
+				dl_clone_write_ptr( cctx, dst, 0, true );
+				break;
+			}
+
+			size_t elem_size = storage == DL_TYPE_STORAGE_STRUCT ? dl_internal_align_up( member->subtype->size, member->subtype->alignment ) : dl_pod_size( storage );
+			size_t alignment = storage == DL_TYPE_STORAGE_STRUCT ? member->subtype->alignment : elem_size;
+			size_t array_dst = dl_clone_copy( cctx, data, elem_size * count, alignment );
+			dl_clone_write_ptr( cctx, dst, array_dst, false );
+			dl_clone_elements( cctx, storage, member->subtype, data, array_dst, count );
+		}
+		break;
+
+		default:
+			break;
+	}
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_clone_struct( dl_clone_ctx* cctx, const dl_type_hot* type, const uint8_t* src, size_t dst )
+{
+	if( ( type->flags & DL_TYPE_FLAG_HAS_SUBDATA ) == 0 )
+		return DL_ERROR_OK;
+
+	if( type->flags & DL_TYPE_FLAG_IS_UNION )
+	{
+		uint32_t union_type = *(const uint32_t*)( src + type->union_type_offset[DL_PTR_SIZE_HOST] );
+		const dl_member_hot* member = dl_internal_union_type_to_member_hot( cctx->ctx, type, union_type );
+		if( member == 0x0 )
+		{
+			dl_log_error( cctx->ctx, "Could not find union type %X for type %s", union_type, dl_internal_type_name( cctx->ctx, dl_internal_type_desc_of( cctx->ctx, type ) ) );
+			return DL_ERROR_MALFORMED_DATA;
+		}
+		return dl_clone_member( cctx, member, src, dst );
+	}
+
+	for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+	{
+		const dl_member_hot* member = type->members + member_index;
+		dl_error_t err = dl_clone_member( cctx, member, src + member->offset, dst + member->offset );
+		if( DL_ERROR_OK != err )
+			return err;
+	}
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_instance_clone( dl_ctx_t    dl_ctx,     dl_typeid_t type_id,
+                              const void* instance,
+                              void*       out_buffer, size_t      out_buffer_size,
+                              size_t*     produced_bytes )
+{
+	const dl_type_desc* type_desc = dl_internal_find_type( dl_ctx, type_id );
+	const dl_type_hot*  type      = type_desc != 0x0 ? dl_internal_type_hot( dl_ctx, type_desc ) : 0x0;
+	if( type == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	dl_clone_ctx cctx( dl_ctx );
+	cctx.out      = (uint8_t*)out_buffer;
+	cctx.out_size = out_buffer_size;
+	cctx.pos      = 0;
+
+	// ... ptrs to the root instance point to the root of the clone ...
+	size_t root = dl_clone_copy( &cctx, instance, type->size, 1 );
+	cctx.copied.insert( (uintptr_t)instance, root );
+
+	dl_error_t err = dl_clone_struct( &cctx, type, (const uint8_t*)instance, root );
+	while( DL_ERROR_OK == err && cctx.work.Len() > 0 )
+	{
+		dl_clone_item item   = cctx.work.Pop();
+		size_t        stride = dl_internal_align_up( item.type->size, item.type->alignment );
+		for( uint32_t index = 0; index < item.count && DL_ERROR_OK == err; ++index )
+			err = dl_clone_struct( &cctx, item.type, item.src + index * stride, item.dst + index * stride );
+	}
+	if( DL_ERROR_OK != err )
+		return err;
+
+	if( produced_bytes )
+		*produced_bytes = cctx.pos;
+
+	if( out_buffer_size > 0 && cctx.pos > out_buffer_size )
+		return DL_ERROR_BUFFER_TOO_SMALL;
+
+	return DL_ERROR_OK;
+}
@@ -0,0 +1,397 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include "dl_types.h"
+#include "dl_ptr_map.h"
+
+#include <dl/dl.h>
+
+#include <stdio.h> // snprintf
+
+struct dl_compare_item
+{
+	const dl_type_hot* type;
+	const uint8_t*     a;
+	const uint8_t*     b;
+	uint32_t           node; ///< last node of the path to the item in dl_compare_ctx::nodes, UINT32_MAX for the root.
+};
+
+struct dl_compare_node
+{
+	uint32_t    parent; ///< only used for nodes in dl_compare_ctx::nodes.
+	const char* name;   ///< name of member, 0x0 if the node is an array element.
+	uint32_t    index;  ///< index of array element.
+};
+
+struct dl_compare_ctx
+{
+	explicit dl_compare_ctx( dl_ctx_t dl_ctx )
+		: ctx( dl_ctx )
+		, seen_a( dl_ctx->alloc )
+		, seen_b( dl_ctx->alloc )
+		, work( dl_ctx->alloc )
+		, nodes( dl_ctx->alloc )
+		, path( dl_ctx->alloc )
+	{
+	}
+
+	dl_ctx_t   ctx;
+	bool       track_path;
+	int        result;
+	uint32_t   base;   ///< node of the item currently compared.
+	dl_ptr_map seen_a; ///< struct pointed to in a -> index of item in work where it was first reached.
+	dl_ptr_map seen_b; ///< same as seen_a for b.
+
+	CArrayStatic<dl_compare_item, 64> work;  ///< pairs of structs pointed to, compared in the order they are reached.
+	CArrayStatic<dl_compare_node, 64> nodes; ///< path to the items in work, only filled in if track_path.
+	CArrayStatic<dl_compare_node, 32> path;  ///< path from the current item to the member compared.
+};
+
+template <typename T>
+static inline int dl_compare_value( T a, T b )
+{
+	return a < b ? -1 : ( b < a ? 1 : 0 );
+}
+
+// ... fp-values are compared by value with nan ordered after all other values ...
+template <typename T>
+static inline int dl_compare_fp( T a, T b )
+{
+	if( a < b ) return -1;
+	if( b < a ) return 1;
+	if( a == b ) return 0;
+	if( ( a != a ) != ( b != b ) )
+		return a != a ? 1 : -1;
+	return memcmp( &a, &b, sizeof( T ) );
+}
+
+static int dl_compare_pod( dl_type_storage_t storage, const uint8_t* a, const uint8_t* b )
+{
+	switch( storage )
+	{
+		case DL_TYPE_STORAGE_INT8:
+		case DL_TYPE_STORAGE_ENUM_INT8:   return dl_compare_value( *(const int8_t*)a,   *(const int8_t*)b );
+		case DL_TYPE_STORAGE_INT16:
+		case DL_TYPE_STORAGE_ENUM_INT16:  return dl_compare_value( *(const int16_t*)a,  *(const int16_t*)b );
+		case DL_TYPE_STORAGE_INT32:
+		case DL_TYPE_STORAGE_ENUM_INT32:  return dl_compare_value( *(const int32_t*)a,  *(const int32_t*)b );
+		case DL_TYPE_STORAGE_INT64:
+		case DL_TYPE_STORAGE_ENUM_INT64:  return dl_compare_value( *(const int64_t*)a,  *(const int64_t*)b );
+		case DL_TYPE_STORAGE_UINT8:
+		case DL_TYPE_STORAGE_ENUM_UINT8:  return dl_compare_value( *(const uint8_t*)a,  *(const uint8_t*)b );
+		case DL_TYPE_STORAGE_UINT16:
+		case DL_TYPE_STORAGE_ENUM_UINT16: return dl_compare_value( *(const uint16_t*)a, *(const uint16_t*)b );
+		case DL_TYPE_STORAGE_UINT32:
+		case DL_TYPE_STORAGE_ENUM_UINT32: return dl_compare_value( *(const uint32_t*)a, *(const uint32_t*)b );
+		case DL_TYPE_STORAGE_UINT64:
+		case DL_TYPE_STORAGE_ENUM_UINT64: return dl_compare_value( *(const uint64_t*)a, *(const uint64_t*)b );
+		case DL_TYPE_STORAGE_FP32:        return dl_compare_fp( *(const float*)a,  *(const float*)b );
+		case DL_TYPE_STORAGE_FP64:        return dl_compare_fp( *(const double*)a, *(const double*)b );
+		default:
+			DL_ASSERT( false && "unhandled storage in compare" );
+			return 0;
+	}
+}
+
+static inline void dl_compare_push( dl_compare_ctx* cctx, const char* name, uint32_t index )
+{
+	if( cctx->track_path )
+	{
+		dl_compare_node node = { UINT32_MAX, name, index };
+		cctx->path.Add( node );
+	}
+}
+
+static inline void dl_compare_pop( dl_compare_ctx* cctx )
+{
+	if( cctx->track_path )
+		cctx->path.Pop();
+}
+
+static void dl_compare_str( dl_compare_ctx* cctx, const uint8_t* a, const uint8_t* b )
+{
+	const char* str_a = *(const char* const*)a;
+	const char* str_b = *(const char* const*)b;
+	if( str_a == str_b )
+		return;
+	if( str_a == 0x0 || str_b == 0x0 )
+		cctx->result = str_a == 0x0 ? -1 : 1;
+	else
+		cctx->result = dl_compare_value( strcmp( str_a, str_b ), 0 );
+}
+
+static void dl_compare_ptr( dl_compare_ctx* cctx, const dl_type_hot* subtype, const uint8_t* a, const uint8_t* b )
+{
+	const uint8_t* ptr_a = *(const uint8_t* const*)a;
+	const uint8_t* ptr_b = *(const uint8_t* const*)b;
+	if( ptr_a == 0x0 || ptr_b == 0x0 )
+	{
+		if( ptr_a != ptr_b )
+			cctx->result = ptr_a == 0x0 ? -1 : 1;
+		return;
+	}
+
+	// ... the instances are equal only if the ptrs point to structs that was first reached at the same place in both ...
+	uintptr_t item_a, item_b;
+	bool seen_a = cctx->seen_a.find( (uintptr_t)ptr_a, &item_a );
+	bool seen_b = cctx->seen_b.find( (uintptr_t)ptr_b, &item_b );
+	if( seen_a || seen_b )
+	{
+		cctx->result = dl_compare_value( seen_a ? item_a : UINTPTR_MAX, seen_b ? item_b : UINTPTR_MAX );
+		return;
+	}
+
+	dl_compare_item item = { subtype, ptr_a, ptr_b, cctx->base };
+	if( cctx->track_path )
+	{
+		for( size_t i = 0; i < cctx->path.Len(); ++i )
+		{
+			dl_compare_node node = cctx->path[i];
+			node.parent = item.node;
+			cctx->nodes.Add( node );
+			item.node = (uint32_t)cctx->nodes.Len() - 1;
+		}
+	}
+	cctx->seen_a.insert( (uintptr_t)ptr_a, cctx->work.Len() );
+	cctx->seen_b.insert( (uintptr_t)ptr_b, cctx->work.Len() );
+	cctx->work.Add( item );
+}
+
+static dl_error_t dl_compare_struct( dl_compare_ctx* cctx, const dl_type_hot* type, const uint8_t* a, const uint8_t* b );
+
+static dl_error_t dl_compare_elements( dl_compare_ctx* cctx, dl_type_storage_t storage, const dl_type_hot* subtype, const uint8_t* a, const uint8_t* b, uint32_t count )
+{
+	switch( storage )
+	{
+		case DL_TYPE_STORAGE_STR:
+		case DL_TYPE_STORAGE_PTR:
+			for( uint32_t index = 0; index < count && cctx->result == 0; ++index )
+			{
+				dl_compare_push( cctx, 0x0, index );
+				if( storage == DL_TYPE_STORAGE_STR )
+					dl_compare_str( cctx, a + index * sizeof( void* ), b + index * sizeof( void* ) );
+				else
+					dl_compare_ptr( cctx, subtype, a + index * sizeof( void* ), b + index * sizeof( void* ) );
+				if( cctx->result == 0 )
+					dl_compare_pop( cctx );
+			}
+			return DL_ERROR_OK;
+
+		case DL_TYPE_STORAGE_STRUCT:
+		{
+			size_t stride = dl_internal_align_up( subtype->size, subtype->alignment );
+			if( ( subtype->flags & DL_TYPE_FLAG_HAS_SUBDATA ) == 0 && memcmp( a, b, stride * count ) == 0 )
+				return DL_ERROR_OK;
+
+			for( uint32_t index = 0; index < count; ++index )
+			{
+				dl_compare_push( cctx, 0x0, index );
+				dl_error_t err = dl_compare_struct( cctx, subtype, a + index * stride, b + index * stride );
+				if( DL_ERROR_OK != err || cctx->result != 0 )
+					return err;
+				dl_compare_pop( cctx );
+			}
+			return DL_ERROR_OK;
+		}
+
+		default:
+		{
+			// ... pods only need to be compared one by one if the run differ ...
+			size_t elem_size = dl_pod_size( storage );
+			if( memcmp( a, b, elem_size * count ) == 0 )
+				return DL_ERROR_OK;
+
+			for( uint32_t index = 0; index < count; ++index )
+			{
+				cctx->result = dl_compare_pod( storage, a + index * elem_size, b + index * elem_size );
+				if( cctx->result != 0 )
+				{
+					dl_compare_push( cctx, 0x0, index );
+					break;
+				}
+			}
+			return DL_ERROR_OK;
+		}
+	}
+}
+
+static dl_error_t dl_compare_subtype_missing( dl_ctx_t dl_ctx, const dl_member_hot* member )
+{
+	dl_log_error( dl_ctx, "Could not find subtype for member %s", dl_internal_member_name( dl_ctx, dl_internal_member_desc_of( dl_ctx, member ) ) );
+	return DL_ERROR_TYPE_NOT_FOUND;
+}
+
+static dl_error_t dl_compare_member( dl_compare_ctx* cctx, const dl_member_hot* member, const uint8_t* a, const uint8_t* b )
+{
+	dl_type_storage_t storage = member->StorageType();
+	if( ( storage == DL_TYPE_STORAGE_STRUCT || storage == DL_TYPE_STORAGE_PTR ) && member->subtype == 0x0 )
+		return dl_compare_subtype_missing( cctx->ctx, member );
+
+	switch( member->AtomType() )
+	{
+		case DL_TYPE_ATOM_POD:
+			switch( storage )
+			{
+				case DL_TYPE_STORAGE_STR:    dl_compare_str( cctx, a, b ); break;
+				case DL_TYPE_STORAGE_PTR:    dl_compare_ptr( cctx, member->subtype, a, b ); break;
+				case DL_TYPE_STORAGE_STRUCT: return dl_compare_struct( cctx, member->subtype, a, b );
+				default:                     cctx->result = dl_compare_pod( storage, a, b ); break;
+			}
+			return DL_ERROR_OK;
+
+		case DL_TYPE_ATOM_BITFIELD:
+		{
+			uint64_t bits   = ( (uint32_t)member->type & DL_TYPE_BITFIELD_SIZE_MASK ) >> DL_TYPE_BITFIELD_SIZE_MIN_BIT;
+			uint64_t offset = dl_bf_offset( DL_ENDIAN_HOST,
+			                                member->size,
+			                                ( (uint32_t)member->type & DL_TYPE_BITFIELD_OFFSET_MASK ) >> DL_TYPE_BITFIELD_OFFSET_MIN_BIT,
+			                                (unsigned int)bits );
+			uint64_t value_a = 0, value_b = 0;
+			memcpy( &value_a, a, member->size );
+			memcpy( &value_b, b, member->size );
+			cctx->result = dl_compare_value( DL_EXTRACT_BITS( value_a, offset, bits ), DL_EXTRACT_BITS( value_b, offset, bits ) );
+			return DL_ERROR_OK;
+		}
+
+		case DL_TYPE_ATOM_INLINE_ARRAY:
+			return dl_compare_elements( cctx, storage, member->subtype, a, b, member->inline_array_cnt() );
+
+		case DL_TYPE_ATOM_ARRAY:
+		{
+			// ... arrays of different length is ordered by length ...
+			uint32_t count_a = *(const uint32_t*)( a + sizeof( void* ) );
+			uint32_t count_b = *(const uint32_t*)( b + sizeof( void* ) );
+			cctx->result = dl_compare_value( count_a, count_b );
+			if( cctx->result != 0 || count_a == 0 )
+				return DL_ERROR_OK;
+
+			const uint8_t* data_a = *(const uint8_t* const*)a;
+			const uint8_t* data_b = *(const uint8_t* const*)b;
+			if( data_a == 0x0 || data_b == 0x0 )
+			{
+				if( data_a != data_b )
+					cctx->result = data_a == 0x0 ? -1 : 1;
+				return DL_ERROR_OK;
+			}
+			return dl_compare_elements( cctx, storage, member->subtype, data_a, data_b, count_a );
+		}
+
+		default:
+			DL_ASSERT( false && "unhandled atom in compare" );
+			return DL_ERROR_INTERNAL_ERROR;
+	}
+}
+
+static const dl_member_hot* dl_compare_union_member( dl_ctx_t dl_ctx, const dl_type_hot* type, uint32_t union_type )
+{
+	const dl_member_hot* member = dl_internal_union_type_to_member_hot( dl_ctx, type, union_type );
+	if( member == 0x0 )
+		dl_log_error( dl_ctx, "Could not find union type %X for type %s", union_type, dl_internal_type_name( dl_ctx, dl_internal_type_desc_of( dl_ctx, type ) ) );
+	return member;
+}
+
+static dl_error_t dl_compare_struct( dl_compare_ctx* cctx, const dl_type_hot* type, const uint8_t* a, const uint8_t* b )
+{
+	if( ( type->flags & DL_TYPE_FLAG_HAS_SUBDATA ) == 0 && memcmp( a, b, type->size ) == 0 )
+		return DL_ERROR_OK;
+
+	const dl_member_hot* members      = type->members;
+	uint32_t             member_count = type->member_count;
+	if( type->flags & DL_TYPE_FLAG_IS_UNION )
+	{
+		// ... unions with different members set is ordered by type-tag ...
+		uint32_t union_type_a = *(const uint32_t*)( a + type->union_type_offset[DL_PTR_SIZE_HOST] );
+		uint32_t union_type_b = *(const uint32_t*)( b + type->union_type_offset[DL_PTR_SIZE_HOST] );
+		members = dl_compare_union_member( cctx->ctx, type, union_type_a );
+		if( members == 0x0 || dl_compare_union_member( cctx->ctx, type, union_type_b ) == 0x0 )
+			return DL_ERROR_MALFORMED_DATA;
+
+		cctx->result = dl_compare_value( union_type_a, union_type_b );
+		if( cctx->result != 0 )
+			return DL_ERROR_OK;
+		member_count = 1;
+	}
+
+	for( uint32_t member_index = 0; member_index < member_count; ++member_index )
+	{
+		const dl_member_hot* member = members + member_index;
+		dl_compare_push( cctx, dl_internal_member_name( cctx->ctx, dl_internal_member_desc_of( cctx->ctx, member ) ), 0 );
+		dl_error_t err = dl_compare_member( cctx, member, a + member->offset, b + member->offset );
+		if( DL_ERROR_OK != err || cctx->result != 0 )
+			return err;
+		dl_compare_pop( cctx );
+	}
+	return DL_ERROR_OK;
+}
+
+static void dl_compare_write_node( const dl_compare_node& node, char* out_path, size_t out_path_size, size_t* pos )
+{
+	int written;
+	if( node.name != 0x0 )
+		written = snprintf( out_path + *pos, out_path_size - *pos, "%s%s", *pos > 0 ? "." : "", node.name );
+	else
+		written = snprintf( out_path + *pos, out_path_size - *pos, "[%u]", node.index );
+	if( written > 0 )
+		*pos += (size_t)written < out_path_size - *pos ? (size_t)written : out_path_size - *pos - 1;
+}
+
+static void dl_compare_write_path( dl_compare_ctx* cctx, char* out_path, size_t out_path_size )
+{
+	// ... the nodes are linked from the member to the root, collect them to write them from the root ...
+	CArrayStatic<uint32_t, 32> prefix( cctx->ctx->alloc );
+	for( uint32_t node = cctx->base; node != UINT32_MAX; node = cctx->nodes[node].parent )
+		prefix.Add( node );
+
+	size_t pos = 0;
+	out_path[0] = '\0';
+	while( prefix.Len() > 0 )
+		dl_compare_write_node( cctx->nodes[prefix.Pop()], out_path, out_path_size, &pos );
+	for( size_t i = 0; i < cctx->path.Len(); ++i )
+		dl_compare_write_node( cctx->path[i], out_path, out_path_size, &pos );
+}
+
+dl_error_t dl_instance_compare( dl_ctx_t    dl_ctx,     dl_typeid_t type_id,
+                                const void* instance_a, const void* instance_b,
+                                int*        out_result,
+                                char*       out_diff_path, size_t out_diff_path_size )
+{
+	const dl_type_desc* type_desc = dl_internal_find_type( dl_ctx, type_id );
+	const dl_type_hot*  type      = type_desc != 0x0 ? dl_internal_type_hot( dl_ctx, type_desc ) : 0x0;
+	if( type == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	if( out_diff_path != 0x0 && out_diff_path_size > 0 )
+		out_diff_path[0] = '\0';
+
+	*out_result = 0;
+	if( instance_a == instance_b )
+		return DL_ERROR_OK;
+
+	dl_compare_ctx cctx( dl_ctx );
+	cctx.track_path = out_diff_path != 0x0 && out_diff_path_size > 0;
+	cctx.result     = 0;
+	cctx.base       = UINT32_MAX;
+
+	// ... ptrs to the root instances is compared as any other ptrs ...
+	dl_compare_item root = { type, (const uint8_t*)instance_a, (const uint8_t*)instance_b, UINT32_MAX };
+	cctx.seen_a.insert( (uintptr_t)instance_a, 0 );
+	cctx.seen_b.insert( (uintptr_t)instance_b, 0 );
+	cctx.work.Add( root );
+
+	for( size_t item_index = 0; item_index < cctx.work.Len(); ++item_index )
+	{
+		dl_compare_item item = cctx.work[item_index];
+		cctx.base = item.node;
+		dl_error_t err = dl_compare_struct( &cctx, item.type, item.a, item.b );
+		if( DL_ERROR_OK != err )
+			return err;
+
+		if( cctx.result != 0 )
+		{
+			if( cctx.track_path )
+				dl_compare_write_path( &cctx, out_diff_path, out_diff_path_size );
+			*out_result = cctx.result;
+			break;
+		}
+	}
+	return DL_ERROR_OK;
+}
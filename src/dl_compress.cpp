@@ -0,0 +1,233 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include "dl_types.h"
+#include "dl_lz.h"
+
+#include <dl/dl.h>
+#include <dl/dl_compress.h>
+
+static const unsigned int DL_COMPRESSED_DEFAULT_BLOCK_SIZE = 64 * 1024;
+static const unsigned int DL_COMPRESSED_MIN_BLOCK_SIZE     = 256;
+
+static inline uint32_t dl_compressed_swap32( uint32_t val, bool swap ) { return swap ? dl_swap_endian_uint32( val ) : val; }
+static inline uint64_t dl_compressed_swap64( uint64_t val, bool swap ) { return swap ? dl_swap_endian_uint64( val ) : val; }
+
+dl_error_t dl_instance_compress( dl_ctx_t             dl_ctx,
+                                 const unsigned char* packed_instance, size_t       packed_instance_size,
+                                 unsigned int         block_size,
+                                 unsigned char*       out_buffer,      size_t       out_buffer_size,
+                                 size_t*              produced_bytes )
+{
+	if( block_size == 0 )
+		block_size = DL_COMPRESSED_DEFAULT_BLOCK_SIZE;
+	if( block_size < DL_COMPRESSED_MIN_BLOCK_SIZE )
+	{
+		dl_log_error( dl_ctx, "compressed block size need to be at least %u, got %u", DL_COMPRESSED_MIN_BLOCK_SIZE, block_size );
+		return DL_ERROR_INVALID_PARAMETER;
+	}
+
+	dl_instance_info_t info;
+	dl_error_t err = dl_instance_get_info( packed_instance, packed_instance_size, &info );
+	if( DL_ERROR_OK != err )
+		return err;
+
+	size_t block_count = ( packed_instance_size + block_size - 1 ) / block_size;
+	if( block_count > 0xFFFFFFFF )
+		return DL_ERROR_INVALID_PARAMETER;
+
+	uint8_t* scratch = (uint8_t*)dl_alloc( &dl_ctx->alloc, sizeof( uint32_t ) * DL_LZ_HASH_TABLE_SIZE + block_size );
+	if( scratch == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	uint32_t* hash_table = (uint32_t*)scratch;
+	uint8_t*  block_data = scratch + sizeof( uint32_t ) * DL_LZ_HASH_TABLE_SIZE;
+
+	// ... header and block-table is written in the endian of the instance ...
+	bool   swap      = info.endian != DL_ENDIAN_HOST;
+	size_t table_end = sizeof( dl_compressed_header ) + sizeof( dl_compressed_block ) * block_count;
+	size_t pos       = table_end;
+	for( size_t i = 0; i < block_count; ++i )
+	{
+		const uint8_t* raw      = packed_instance + i * block_size;
+		size_t         raw_size = packed_instance_size - i * block_size < block_size ? packed_instance_size - i * block_size : block_size;
+
+		// ... only keep the compressed block if it is smaller than the raw data ...
+		size_t         compressed_size = dl_lz_compress( raw, raw_size, block_data, raw_size - 1, hash_table );
+		const uint8_t* data            = compressed_size != 0 ? block_data : raw;
+		size_t         data_size       = compressed_size != 0 ? compressed_size : raw_size;
+
+		if( pos + data_size <= out_buffer_size )
+			memcpy( out_buffer + pos, data, data_size );
+
+		if( table_end <= out_buffer_size )
+		{
+			dl_compressed_block block;
+			block.offset = dl_compressed_swap64( pos, swap );
+			block.size   = dl_compressed_swap32( (uint32_t)data_size, swap );
+			block.flags  = dl_compressed_swap32( compressed_size != 0 ? 0 : (uint32_t)DL_COMPRESSED_BLOCK_RAW, swap );
+			memcpy( out_buffer + sizeof( dl_compressed_header ) + sizeof( dl_compressed_block ) * i, &block, sizeof( block ) );
+		}
+
+		pos += data_size;
+	}
+
+	dl_free( &dl_ctx->alloc, scratch );
+
+	if( produced_bytes )
+		*produced_bytes = pos;
+
+	if( out_buffer_size == 0 )
+		return DL_ERROR_OK;
+
+	if( out_buffer_size < pos )
+		return DL_ERROR_BUFFER_TOO_SMALL;
+
+	dl_compressed_header header;
+	header.id            = dl_compressed_swap32( DL_COMPRESSED_ID, swap );
+	header.version       = dl_compressed_swap32( DL_COMPRESSED_VERSION, swap );
+	header.block_size    = dl_compressed_swap32( block_size, swap );
+	header.block_count   = dl_compressed_swap32( (uint32_t)block_count, swap );
+	header.instance_size = dl_compressed_swap64( packed_instance_size, swap );
+	memcpy( out_buffer, &header, sizeof( header ) );
+	return DL_ERROR_OK;
+}
+
+/**
+ * Read and validate header of compressed instance, the returned header is in host endian.
+ */
+static dl_error_t dl_compressed_read_header( const unsigned char* compressed, size_t compressed_size, dl_compressed_header* header, bool* swap )
+{
+	if( compressed_size < sizeof( dl_compressed_header ) )
+		return DL_ERROR_MALFORMED_DATA;
+
+	memcpy( header, compressed, sizeof( dl_compressed_header ) );
+	if( header->id != DL_COMPRESSED_ID && header->id != DL_COMPRESSED_ID_SWAPED )
+		return DL_ERROR_MALFORMED_DATA;
+
+	*swap = header->id == DL_COMPRESSED_ID_SWAPED;
+	header->version       = dl_compressed_swap32( header->version, *swap );
+	header->block_size    = dl_compressed_swap32( header->block_size, *swap );
+	header->block_count   = dl_compressed_swap32( header->block_count, *swap );
+	header->instance_size = dl_compressed_swap64( header->instance_size, *swap );
+
+	if( header->version != DL_COMPRESSED_VERSION )
+		return DL_ERROR_VERSION_MISMATCH;
+	if( header->block_size < DL_COMPRESSED_MIN_BLOCK_SIZE )
+		return DL_ERROR_MALFORMED_DATA;
+	if( header->instance_size > (uint64_t)(size_t)-1 ||
+		header->block_count != ( header->instance_size + header->block_size - 1 ) / header->block_size )
+		return DL_ERROR_MALFORMED_DATA;
+	if( sizeof( dl_compressed_header ) + (uint64_t)sizeof( dl_compressed_block ) * header->block_count > compressed_size )
+		return DL_ERROR_MALFORMED_DATA;
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_compressed_decompress_block( const unsigned char* compressed, size_t compressed_size, const dl_compressed_header* header, bool swap, uint32_t block_index, unsigned char* out_instance )
+{
+	dl_compressed_block block;
+	memcpy( &block, compressed + sizeof( dl_compressed_header ) + sizeof( dl_compressed_block ) * block_index, sizeof( block ) );
+	block.offset = dl_compressed_swap64( block.offset, swap );
+	block.size   = dl_compressed_swap32( block.size, swap );
+	block.flags  = dl_compressed_swap32( block.flags, swap );
+
+	if( block.offset > compressed_size || block.size > compressed_size - block.offset )
+		return DL_ERROR_MALFORMED_DATA;
+
+	size_t raw_offset = (size_t)block_index * header->block_size;
+	size_t raw_size   = (size_t)header->instance_size - raw_offset;
+	if( raw_size > header->block_size )
+		raw_size = header->block_size;
+
+	const uint8_t* data = compressed + block.offset;
+	if( block.flags & DL_COMPRESSED_BLOCK_RAW )
+	{
+		if( block.size != raw_size )
+			return DL_ERROR_MALFORMED_DATA;
+		memcpy( out_instance + raw_offset, data, raw_size );
+		return DL_ERROR_OK;
+	}
+
+	if( !dl_lz_decompress( data, block.size, out_instance + raw_offset, raw_size ) )
+		return DL_ERROR_MALFORMED_DATA;
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_compressed_get_info( const unsigned char* compressed, size_t compressed_size, dl_compressed_info_t* out_info )
+{
+	dl_compressed_header header;
+	bool swap;
+	dl_error_t err = dl_compressed_read_header( compressed, compressed_size, &header, &swap );
+	if( DL_ERROR_OK != err )
+		return err;
+
+	out_info->instance_size = (size_t)header.instance_size;
+	out_info->block_size    = header.block_size;
+	out_info->block_count   = header.block_count;
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_compressed_decompress_blocks( const unsigned char* compressed,   size_t       compressed_size,
+                                            unsigned int         first_block,  unsigned int block_count,
+                                            unsigned char*       out_instance, size_t       out_instance_size )
+{
+	dl_compressed_header header;
+	bool swap;
+	dl_error_t err = dl_compressed_read_header( compressed, compressed_size, &header, &swap );
+	if( DL_ERROR_OK != err )
+		return err;
+
+	if( first_block > header.block_count || block_count > header.block_count - first_block )
+		return DL_ERROR_INVALID_PARAMETER;
+	if( block_count == 0 )
+		return DL_ERROR_OK;
+
+	uint64_t end = (uint64_t)( first_block + block_count ) * header.block_size;
+	if( end > header.instance_size )
+		end = header.instance_size;
+	if( out_instance_size < end )
+		return DL_ERROR_BUFFER_TOO_SMALL;
+
+	for( uint32_t i = first_block; i < first_block + block_count; ++i )
+	{
+		err = dl_compressed_decompress_block( compressed, compressed_size, &header, swap, i, out_instance );
+		if( DL_ERROR_OK != err )
+			return err;
+	}
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_compressed_decompress_range( const unsigned char* compressed,   size_t compressed_size,
+                                           size_t               offset,       size_t size,
+                                           unsigned char*       out_instance, size_t out_instance_size )
+{
+	dl_compressed_info_t info;
+	dl_error_t err = dl_compressed_get_info( compressed, compressed_size, &info );
+	if( DL_ERROR_OK != err )
+		return err;
+
+	if( offset > info.instance_size || size > info.instance_size - offset )
+		return DL_ERROR_INVALID_PARAMETER;
+	if( size == 0 )
+		return DL_ERROR_OK;
+
+	unsigned int first_block = (unsigned int)( offset / info.block_size );
+	unsigned int last_block  = (unsigned int)( ( offset + size - 1 ) / info.block_size );
+	return dl_compressed_decompress_blocks( compressed, compressed_size, first_block, last_block - first_block + 1, out_instance, out_instance_size );
+}
+
+dl_error_t dl_instance_decompress( const unsigned char* compressed,   size_t  compressed_size,
+                                   unsigned char*       out_instance, size_t  out_instance_size,
+                                   size_t*              produced_bytes )
+{
+	dl_compressed_info_t info;
+	dl_error_t err = dl_compressed_get_info( compressed, compressed_size, &info );
+	if( DL_ERROR_OK != err )
+		return err;
+
+	if( produced_bytes )
+		*produced_bytes = info.instance_size;
+
+	if( out_instance_size == 0 )
+		return DL_ERROR_OK;
+
+	return dl_compressed_decompress_blocks( compressed, compressed_size, 0, info.block_count, out_instance, out_instance_size );
+}
@@ -275,9 +275,9 @@ static dl_error_t dl_internal_convert_collect_instances_from_member( dl_ctx_t
 					dl_internal_convert_collect_instances_from_str( member_data, base_data, convert_ctx );
 				break;
 				case DL_TYPE_STORAGE_PTR:
-					return dl_internal_convert_collect_instances_from_ptr( ctx, dl_internal_find_type(ctx, member->type_id), member_data, base_data, convert_ctx );
+					return dl_internal_convert_collect_instances_from_ptr( ctx, dl_internal_member_type(ctx, member), member_data, base_data, convert_ctx );
 				case DL_TYPE_STORAGE_STRUCT:
-					return dl_internal_convert_collect_instances(ctx, dl_internal_find_type(ctx, member->type_id), member_data, base_data, convert_ctx);
+					return dl_internal_convert_collect_instances(ctx, dl_internal_member_type(ctx, member), member_data, base_data, convert_ctx);
 				break;
 				default:
 					break;
@@ -292,7 +292,7 @@ static dl_error_t dl_internal_convert_collect_instances_from_member( dl_ctx_t
 					return dl_internal_convert_collect_instances_from_struct_array( ctx,
 																			 member_data,
 																			 member->inline_array_cnt(),
-																			 dl_internal_find_type(ctx, member->type_id),
+																			 dl_internal_member_type(ctx, member),
 																			 base_data,
 																			 convert_ctx );
 					break;
@@ -306,7 +306,7 @@ static dl_error_t dl_internal_convert_collect_instances_from_member( dl_ctx_t
 					return dl_internal_convert_collect_instances_from_ptr_array( ctx,
 																		  member_data,
 																		  member->inline_array_cnt(),
-																		  dl_internal_find_type(ctx, member->type_id),
+																		  dl_internal_member_type(ctx, member),
 																		  base_data,
 																		  convert_ctx );
 					break;
@@ -338,7 +338,7 @@ static dl_error_t dl_internal_convert_collect_instances_from_member( dl_ctx_t
 					dl_internal_convert_collect_instances_from_str_array(array_data, array_count, base_data, convert_ctx);
 					break;
 				case DL_TYPE_STORAGE_PTR:
-					sub_type = dl_internal_find_type(ctx, member->type_id);
+					sub_type = dl_internal_member_type(ctx, member);
 					err = dl_internal_convert_collect_instances_from_ptr_array( ctx,
 																				array_data,
 																				array_count,
@@ -348,7 +348,7 @@ static dl_error_t dl_internal_convert_collect_instances_from_member( dl_ctx_t
 					if( DL_ERROR_OK != err ) return err;
 					break;
 				case DL_TYPE_STORAGE_STRUCT:
-					sub_type = dl_internal_find_type(ctx, member->type_id);
+					sub_type = dl_internal_member_type(ctx, member);
 					err = dl_internal_convert_collect_instances_from_struct_array( ctx,
 																				   array_data,
 																				   array_count,
@@ -390,6 +390,8 @@ static dl_error_t dl_internal_convert_collect_instances( dl_ctx_t            dl_
 
 		// find member index from union type ...
 		uint32_t union_type = *((uint32_t*)(instance + type_offset));
+		if( convert_ctx.src_endian != DL_ENDIAN_HOST )
+			union_type = dl_swap_endian_uint32( union_type );
 		const dl_member_desc* member = dl_internal_union_type_to_member(dl_ctx, type, union_type);
 		if (member == nullptr)
 			return DL_ERROR_MALFORMED_DATA;
@@ -503,7 +505,7 @@ static dl_error_t dl_internal_convert_write_member( dl_ctx_t              ctx,
 			{
 				case DL_TYPE_STORAGE_STRUCT:
 				{
-					const dl_type_desc* sub_type = dl_internal_find_type(ctx, member->type_id);
+					const dl_type_desc* sub_type = dl_internal_member_type(ctx, member);
 					if(sub_type == 0x0)
 						return DL_ERROR_TYPE_NOT_FOUND;
 					return dl_internal_convert_write_struct( ctx, member_data, sub_type, conv_ctx, writer );
@@ -529,7 +531,7 @@ static dl_error_t dl_internal_convert_write_member( dl_ctx_t              ctx,
 			{
 				case DL_TYPE_STORAGE_STRUCT:
 				{
-					const dl_type_desc* sub_type = dl_internal_find_type(ctx, member->type_id);
+					const dl_type_desc* sub_type = dl_internal_member_type(ctx, member);
 					if(sub_type == 0x0)
 						return DL_ERROR_TYPE_NOT_FOUND;
 
@@ -644,6 +646,8 @@ static dl_error_t dl_internal_convert_write_struct( dl_ctx_t            dl_ctx,
 		size_t tgt_type_offset = dl_internal_union_type_offset( dl_ctx, type, conv_ctx.target_ptr_size );
 
 		uint32_t union_type = *((uint32_t*)(instance + src_type_offset));
+		if( conv_ctx.src_endian != DL_ENDIAN_HOST )
+			union_type = dl_swap_endian_uint32( union_type );
 		const dl_member_desc* member = dl_internal_union_type_to_member(dl_ctx, type, union_type);
 		if (member == nullptr)
 			return DL_ERROR_MALFORMED_DATA;
@@ -656,7 +660,7 @@ static dl_error_t dl_internal_convert_write_struct( dl_ctx_t            dl_ctx,
 
 		dl_binary_writer_seek_set( writer, pos + tgt_type_offset );
 		dl_binary_writer_align( writer, 4 );
-		dl_binary_writer_write_uint32( writer, union_type );
+		dl_binary_writer_write_uint32( writer, conv_ctx.tgt_endian != DL_ENDIAN_HOST ? dl_swap_endian_uint32( union_type ) : union_type );
 	}
 	else
 	{
@@ -850,6 +854,8 @@ dl_error_t dl_internal_convert_no_header( dl_ctx_t            dl_ctx,
 			new_header->not_using_ptr_chain_patching = 0;
 		size_t header_offset      = dl_internal_align_up( sizeof( dl_data_header ), root_type->alignment[DL_PTR_SIZE_HOST] );
 		new_header->instance_size = uint32_t( *needed_size - header_offset );
+		if( conv_ctx.tgt_endian != DL_ENDIAN_HOST )
+			new_header->instance_size = dl_swap_endian_uint32( new_header->instance_size );
 
 		if( conv_ctx.m_lPatchOffset.Len() )
 		{
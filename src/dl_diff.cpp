@@ -0,0 +1,945 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include "dl_types.h"
+#include "dl_ptr_map.h"
+
+#include <dl/dl.h>
+#include <dl/dl_diff.h>
+
+/*
+	A patch is a dl_diff_header followed by the diff of the root instance, all counts and indices are written as
+	LEB128-varints.
+
+	struct   - { member_index + 1, member }* 0
+	           only changed members are written. For unions the member written is the member set in the new instance,
+	           if the old instance has another member set the union is cleared before the member is applied.
+	member   - value for pod-, bitfield-, string-, ptr- and struct-members.
+	           elements for inline arrays.
+	           DL_DIFF_ARRAY_SAME_COUNT elements or
+	           DL_DIFF_ARRAY_SPLICE count, tail, elements for arrays, see dl_diff_array().
+	elements - { run_count, skip, value * run_count }* 0
+	           changed elements in runs, skip is the number of unchanged elements since the end of the last run.
+	           run_count is at most DL_DIFF_MAX_RUN so that it is always written as one byte.
+	value    - raw bytes for pods and bitfields.
+	           struct for structs.
+	           length + 1 and the chars for strings, 0 for null.
+	           dl_diff_ptr_op and for DL_DIFF_PTR_REF the index of the pointer or for DL_DIFF_PTR_OLD/DL_DIFF_PTR_NEW a struct.
+
+	The value a member or element is diffed against is always the value at the same place in the old instance or zero,
+	the same value the patch is applied to when applying it.
+*/
+
+enum dl_diff_array_mode
+{
+	DL_DIFF_ARRAY_SAME_COUNT = 0, // array has the same count in old and new, only changed elements are written.
+	DL_DIFF_ARRAY_SPLICE     = 1, // elements between an unchanged head and tail is replaced.
+};
+
+enum dl_diff_ptr_op
+{
+	DL_DIFF_PTR_NULL = 0, // ptr is null.
+	DL_DIFF_PTR_REF  = 1, // ptr to the root, index 0, or an instance already in the patch, by the order of DL_DIFF_PTR_OLD/DL_DIFF_PTR_NEW in the patch.
+	DL_DIFF_PTR_OLD  = 2, // ptr to a copy of the instance pointed to by the old ptr with a struct-diff applied.
+	DL_DIFF_PTR_NEW  = 3, // ptr to a zeroed instance with a struct-diff applied.
+};
+
+static const uint32_t DL_DIFF_MAX_RUN = 0x7F; // max elements in one run, the run_count of an open run is updated in place.
+
+struct dl_diff_writer
+{
+	uint8_t* data;
+	size_t   size;
+	size_t   pos;
+};
+
+static inline void dl_diff_write( dl_diff_writer* writer, const void* data, size_t size )
+{
+	if( writer->pos + size <= writer->size )
+		memcpy( writer->data + writer->pos, data, size );
+	writer->pos += size;
+}
+
+static DL_FORCEINLINE void dl_diff_write_uint8( dl_diff_writer* writer, uint8_t value )
+{
+	if( writer->pos < writer->size )
+		writer->data[writer->pos] = value;
+	++writer->pos;
+}
+
+static DL_FORCEINLINE void dl_diff_write_varint( dl_diff_writer* writer, uint64_t value )
+{
+	while( value >= 0x80 )
+	{
+		dl_diff_write_uint8( writer, (uint8_t)( value | 0x80 ) );
+		value >>= 7;
+	}
+	dl_diff_write_uint8( writer, (uint8_t)value );
+}
+
+static inline bool dl_diff_is_zero( const uint8_t* data, size_t size )
+{
+	for( size_t i = 0; i < size; ++i )
+		if( data[i] != 0 )
+			return false;
+	return true;
+}
+
+static inline size_t dl_diff_elem_size( dl_type_storage_t storage, const dl_type_hot* subtype )
+{
+	return storage == DL_TYPE_STORAGE_STRUCT ? subtype->size : dl_pod_size( storage );
+}
+
+static inline uint32_t dl_diff_inline_array_count( const dl_member_hot* member )
+{
+	dl_type_storage_t storage = member->StorageType();
+	if( storage == DL_TYPE_STORAGE_STRUCT || storage == DL_TYPE_STORAGE_STR || storage == DL_TYPE_STORAGE_PTR )
+		return member->inline_array_cnt();
+	return (uint32_t)( member->size / dl_pod_size( storage ) );
+}
+
+static dl_error_t dl_diff_subtype_missing( dl_ctx_t dl_ctx, const dl_member_hot* member )
+{
+	dl_log_error( dl_ctx, "Could not find subtype for member %s", dl_internal_member_name( dl_ctx, dl_internal_member_desc_of( dl_ctx, member ) ) );
+	return DL_ERROR_TYPE_NOT_FOUND;
+}
+
+static bool dl_diff_struct_equal( dl_ctx_t dl_ctx, const dl_type_hot* type, const uint8_t* a, const uint8_t* b );
+
+// ... true if a diff between the values would be empty ...
+static bool dl_diff_value_equal( dl_ctx_t dl_ctx, dl_type_storage_t storage, const dl_type_hot* subtype, size_t size, const uint8_t* a, const uint8_t* b )
+{
+	switch( storage )
+	{
+		case DL_TYPE_STORAGE_STRUCT:
+			return subtype != 0x0 && dl_diff_struct_equal( dl_ctx, subtype, a, b );
+		case DL_TYPE_STORAGE_STR:
+		{
+			const char* str_a = *(const char* const*)a;
+			const char* str_b = *(const char* const*)b;
+			if( str_a == 0x0 || str_b == 0x0 )
+				return str_a == str_b;
+			return strcmp( str_a, str_b ) == 0;
+		}
+		case DL_TYPE_STORAGE_PTR:
+			// ... pointers are always written to the patch to keep track of instances pointed to more than once ...
+			return *(void* const*)a == 0x0 && *(void* const*)b == 0x0;
+		default:
+			return memcmp( a, b, size ) == 0;
+	}
+}
+
+static bool dl_diff_elements_equal( dl_ctx_t dl_ctx, dl_type_storage_t storage, const dl_type_hot* subtype, size_t elem_size, const uint8_t* a, const uint8_t* b, uint32_t count )
+{
+	if( storage != DL_TYPE_STORAGE_STR && storage != DL_TYPE_STORAGE_PTR && memcmp( a, b, elem_size * count ) == 0 )
+		return true;
+	if( storage != DL_TYPE_STORAGE_STRUCT && storage != DL_TYPE_STORAGE_STR && storage != DL_TYPE_STORAGE_PTR )
+		return false;
+
+	for( uint32_t i = 0; i < count; ++i )
+		if( !dl_diff_value_equal( dl_ctx, storage, subtype, elem_size, a + i * elem_size, b + i * elem_size ) )
+			return false;
+	return true;
+}
+
+static bool dl_diff_member_equal( dl_ctx_t dl_ctx, const dl_member_hot* member, const uint8_t* a, const uint8_t* b )
+{
+	dl_type_storage_t storage = member->StorageType();
+	if( ( storage == DL_TYPE_STORAGE_STRUCT || storage == DL_TYPE_STORAGE_PTR ) && member->subtype == 0x0 )
+		return false;
+
+	switch( member->AtomType() )
+	{
+		case DL_TYPE_ATOM_POD:
+		case DL_TYPE_ATOM_BITFIELD:
+			return dl_diff_value_equal( dl_ctx, storage, member->subtype, member->size, a, b );
+		case DL_TYPE_ATOM_INLINE_ARRAY:
+			return dl_diff_elements_equal( dl_ctx, storage, member->subtype, dl_diff_elem_size( storage, member->subtype ), a, b, dl_diff_inline_array_count( member ) );
+		case DL_TYPE_ATOM_ARRAY:
+		{
+			uint32_t count = *(const uint32_t*)( a + sizeof( void* ) );
+			if( count != *(const uint32_t*)( b + sizeof( void* ) ) )
+				return false;
+			if( count == 0 )
+				return true;
+			return dl_diff_elements_equal( dl_ctx, storage, member->subtype, dl_diff_elem_size( storage, member->subtype ), *(const uint8_t* const*)a, *(const uint8_t* const*)b, count );
+		}
+		default:
+			DL_ASSERT( false && "Invalid ATOM-type!" );
+			return false;
+	}
+}
+
+static bool dl_diff_struct_equal( dl_ctx_t dl_ctx, const dl_type_hot* type, const uint8_t* a, const uint8_t* b )
+{
+	if( ( type->flags & DL_TYPE_FLAG_HAS_SUBDATA ) == 0 && memcmp( a, b, type->size ) == 0 )
+		return true;
+
+	if( type->flags & DL_TYPE_FLAG_IS_UNION )
+	{
+		uint32_t type_offset = type->union_type_offset[DL_PTR_SIZE_HOST];
+		uint32_t union_type  = *(const uint32_t*)( a + type_offset );
+		if( union_type != *(const uint32_t*)( b + type_offset ) )
+			return false;
+		const dl_member_hot* member = dl_internal_union_type_to_member_hot( dl_ctx, type, union_type );
+		return member != 0x0 && dl_diff_member_equal( dl_ctx, member, a + member->offset, b + member->offset );
+	}
+
+	for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+	{
+		const dl_member_hot* member = type->members + member_index;
+		if( !dl_diff_member_equal( dl_ctx, member, a + member->offset, b + member->offset ) )
+			return false;
+	}
+	return true;
+}
+
+struct dl_diff_ctx
+{
+	explicit dl_diff_ctx( dl_ctx_t ctx )
+		: dl_ctx( ctx )
+		, written_ptrs( ctx->alloc )
+		, written_ptr_count( 0 )
+		, compare_bytes( ctx->alloc )
+	{
+	}
+
+	dl_ctx_t       dl_ctx;
+	dl_diff_writer writer;
+	dl_ptr_map     written_ptrs;      // instances pointed to in the new instance already written to the patch -> index in patch.
+	uint32_t       written_ptr_count;
+	dl_ptr_map     compare_bytes;     // type -> DL_DIFF_COMPARE_BYTES_*, see dl_diff_compare_bytes().
+};
+
+enum
+{
+	DL_DIFF_COMPARE_BYTES_NO  = 1,
+	DL_DIFF_COMPARE_BYTES_YES = 2
+};
+
+/*
+	Instances of a type without ptrs or unions that are equal byte by byte are unchanged without diffing them, arrays
+	and strings that point to the same data has the same content. Ptrs are always written to the patch and unions are
+	diffed to report invalid union-types. Arrays of structs are not looked into to not follow types that contain
+	themselves, these are always diffed.
+*/
+static bool dl_diff_compare_bytes( dl_diff_ctx* diff, const dl_type_hot* type )
+{
+	if( type->flags & DL_TYPE_FLAG_IS_UNION )
+		return false;
+	if( ( type->flags & DL_TYPE_FLAG_HAS_SUBDATA ) == 0 )
+		return true;
+
+	uintptr_t compare;
+	if( diff->compare_bytes.find( (uintptr_t)type, &compare ) )
+		return compare == DL_DIFF_COMPARE_BYTES_YES;
+
+	bool compare_bytes = true;
+	for( uint32_t member_index = 0; member_index < type->member_count && compare_bytes; ++member_index )
+	{
+		const dl_member_hot* member = type->members + member_index;
+		switch( member->StorageType() )
+		{
+			case DL_TYPE_STORAGE_PTR:
+				compare_bytes = false;
+				break;
+			case DL_TYPE_STORAGE_STRUCT:
+				compare_bytes = member->subtype != 0x0 && member->AtomType() != DL_TYPE_ATOM_ARRAY && dl_diff_compare_bytes( diff, member->subtype );
+				break;
+			default:
+				break;
+		}
+	}
+	diff->compare_bytes.insert( (uintptr_t)type, compare_bytes ? DL_DIFF_COMPARE_BYTES_YES : DL_DIFF_COMPARE_BYTES_NO );
+	return compare_bytes;
+}
+
+static dl_error_t dl_diff_struct( dl_diff_ctx* diff, const dl_type_hot* type, const uint8_t* old_instance, const uint8_t* new_instance, bool* changed );
+
+static dl_error_t dl_diff_ptr( dl_diff_ctx* diff, const dl_type_hot* subtype, const uint8_t* old_value, const uint8_t* new_value )
+{
+	const uint8_t* new_ptr = *(const uint8_t* const*)new_value;
+	if( new_ptr == 0x0 )
+	{
+		dl_diff_write_uint8( &diff->writer, DL_DIFF_PTR_NULL );
+		return DL_ERROR_OK;
+	}
+
+	uintptr_t index;
+	if( diff->written_ptrs.find( (uintptr_t)new_ptr, &index ) )
+	{
+		dl_diff_write_uint8( &diff->writer, DL_DIFF_PTR_REF );
+		dl_diff_write_varint( &diff->writer, index );
+		return DL_ERROR_OK;
+	}
+
+	// ... added before the diff of the instance so that ptrs back to it is written as refs ...
+	diff->written_ptrs.insert( (uintptr_t)new_ptr, diff->written_ptr_count++ );
+
+	const uint8_t* old_ptr = old_value != 0x0 ? *(const uint8_t* const*)old_value : 0x0;
+	dl_diff_write_uint8( &diff->writer, old_ptr != 0x0 ? DL_DIFF_PTR_OLD : DL_DIFF_PTR_NEW );
+	bool changed;
+	return dl_diff_struct( diff, subtype, old_ptr, new_ptr, &changed );
+}
+
+// ... write the complete value, old_value is 0x0 if diffed against zero, changed is set if the value differ from old_value.
+//     unchanged strings and pods are only written if force is set ...
+static dl_error_t dl_diff_value( dl_diff_ctx* diff, dl_type_storage_t storage, const dl_type_hot* subtype, size_t size, const uint8_t* old_value, const uint8_t* new_value, bool force, bool* changed )
+{
+	switch( storage )
+	{
+		case DL_TYPE_STORAGE_STRUCT:
+			return dl_diff_struct( diff, subtype, old_value, new_value, changed );
+		case DL_TYPE_STORAGE_STR:
+		{
+			const char* str     = *(const char* const*)new_value;
+			const char* old_str = old_value != 0x0 ? *(const char* const*)old_value : 0x0;
+			if( str == 0x0 )
+			{
+				*changed = old_str != 0x0;
+				dl_diff_write_varint( &diff->writer, 0 );
+			}
+			else
+			{
+				*changed = old_str == 0x0 || strcmp( old_str, str ) != 0;
+				if( !*changed && !force )
+					return DL_ERROR_OK;
+				size_t len = strlen( str );
+				dl_diff_write_varint( &diff->writer, len + 1 );
+				dl_diff_write( &diff->writer, str, len );
+			}
+			return DL_ERROR_OK;
+		}
+		case DL_TYPE_STORAGE_PTR:
+			// ... pointers are always written to the patch to keep track of instances pointed to more than once ...
+			*changed = *(void* const*)new_value != 0x0 || ( old_value != 0x0 && *(void* const*)old_value != 0x0 );
+			return dl_diff_ptr( diff, subtype, old_value, new_value );
+		default:
+			*changed = old_value != 0x0 ? memcmp( old_value, new_value, size ) != 0 : !dl_diff_is_zero( new_value, size );
+			if( *changed || force )
+				dl_diff_write( &diff->writer, new_value, size );
+			return DL_ERROR_OK;
+	}
+}
+
+/*
+	Write runs of changed elements. Element i is diffed against element i of old_data if i < old_count and against
+	zero otherwise, elements diffed against zero are always written if write_added is set.
+
+	Each element is diffed once, written to the patch and removed again if it turned out to not have changed, the same
+	way as members in dl_diff_write_member(). Elements that are equal byte by byte are skipped without being diffed when
+	dl_diff_compare_bytes() allows it.
+*/
+static dl_error_t dl_diff_elements( dl_diff_ctx* diff, dl_type_storage_t storage, const dl_type_hot* subtype, size_t elem_size,
+                                    const uint8_t* old_data, uint32_t old_count, const uint8_t* new_data, uint32_t count,
+                                    bool write_added, bool* changed )
+{
+	*changed = false;
+
+	bool flat = storage != DL_TYPE_STORAGE_PTR && ( storage != DL_TYPE_STORAGE_STRUCT || dl_diff_compare_bytes( diff, subtype ) );
+	if( flat && count > 0 && old_count >= count && memcmp( old_data, new_data, elem_size * count ) == 0 )
+	{
+		dl_diff_write_varint( &diff->writer, 0 );
+		return DL_ERROR_OK;
+	}
+
+	uint32_t last_end  = 0; // end of the last written run.
+	uint32_t run_count = 0; // elements in the open run, 0 if no run is open.
+	size_t   run_pos   = 0; // pos of run_count of the open run.
+	for( uint32_t elem = 0; elem < count; ++elem )
+	{
+		const uint8_t* old_elem = elem < old_count ? old_data + elem * elem_size : 0x0;
+		const uint8_t* new_elem = new_data + elem * elem_size;
+		bool           force    = write_added && old_elem == 0x0;
+
+		if( flat && !force && ( old_elem != 0x0 ? memcmp( old_elem, new_elem, elem_size ) == 0 : dl_diff_is_zero( new_elem, elem_size ) ) )
+		{
+			run_count = 0;
+			continue;
+		}
+
+		size_t pos     = diff->writer.pos;
+		bool   new_run = run_count == 0 || run_count == DL_DIFF_MAX_RUN;
+		if( new_run )
+		{
+			dl_diff_write_uint8( &diff->writer, 1 );
+			dl_diff_write_varint( &diff->writer, elem - last_end );
+		}
+
+		bool elem_changed = false;
+		dl_error_t err = dl_diff_value( diff, storage, subtype, elem_size, old_elem, new_elem, force, &elem_changed );
+		if( err != DL_ERROR_OK )
+			return err;
+
+		if( !elem_changed && !force )
+		{
+			diff->writer.pos = pos;
+			run_count = 0;
+			continue;
+		}
+
+		if( new_run )
+		{
+			run_pos   = pos;
+			run_count = 1;
+		}
+		else
+		{
+			++run_count;
+			if( run_pos < diff->writer.size )
+				diff->writer.data[run_pos] = (uint8_t)run_count;
+		}
+		last_end = elem + 1;
+		*changed = true;
+	}
+
+	dl_diff_write_varint( &diff->writer, 0 );
+	return DL_ERROR_OK;
+}
+
+/*
+	Arrays with the same count only write the changed elements. Arrays that change count write the count, the number
+	of unchanged elements at the end of the array and the elements before these as with the same count, diffed against
+	the element at the same index in the old array or against zero if the old array has no element there. Elements
+	diffed against zero are always written to give a patch at least one byte per added element.
+	An insert or remove of elements therefore only write the inserted elements and the elements between them and the
+	unchanged tail that moved.
+*/
+static dl_error_t dl_diff_array( dl_diff_ctx* diff, const dl_member_hot* member, const uint8_t* old_value, const uint8_t* new_value, bool* changed )
+{
+	dl_type_storage_t storage   = member->StorageType();
+	size_t            elem_size = dl_diff_elem_size( storage, member->subtype );
+
+	const uint8_t* new_data  = *(const uint8_t* const*)new_value;
+	uint32_t       new_count = *(const uint32_t*)( new_value + sizeof( void* ) );
+	const uint8_t* old_data  = old_value != 0x0 ? *(const uint8_t* const*)old_value : 0x0;
+	uint32_t       old_count = old_value != 0x0 ? *(const uint32_t*)( old_value + sizeof( void* ) ) : 0;
+
+	if( old_count == new_count )
+	{
+		dl_diff_write_uint8( &diff->writer, DL_DIFF_ARRAY_SAME_COUNT );
+		return dl_diff_elements( diff, storage, member->subtype, elem_size, old_data, old_count, new_data, new_count, false, changed );
+	}
+
+	*changed = true;
+
+	// ... the tail is not written to the patch so it is the only part of the array that is compared and not diffed ...
+	uint32_t min_count = old_count < new_count ? old_count : new_count;
+	uint32_t tail = 0;
+	while( tail < min_count && dl_diff_value_equal( diff->dl_ctx, storage, member->subtype, elem_size, old_data + ( old_count - tail - 1 ) * elem_size, new_data + ( new_count - tail - 1 ) * elem_size ) )
+		++tail;
+
+	dl_diff_write_uint8( &diff->writer, DL_DIFF_ARRAY_SPLICE );
+	dl_diff_write_varint( &diff->writer, new_count );
+	dl_diff_write_varint( &diff->writer, tail );
+
+	bool elements_changed;
+	return dl_diff_elements( diff, storage, member->subtype, elem_size, old_data, old_count - tail, new_data, new_count - tail, true, &elements_changed );
+}
+
+// ... write the complete member, changed is set to false if the member do not need to be written ...
+static dl_error_t dl_diff_member( dl_diff_ctx* diff, const dl_member_hot* member, const uint8_t* old_value, const uint8_t* new_value, bool force, bool* changed )
+{
+	dl_type_storage_t storage = member->StorageType();
+	if( ( storage == DL_TYPE_STORAGE_STRUCT || storage == DL_TYPE_STORAGE_PTR ) && member->subtype == 0x0 )
+		return dl_diff_subtype_missing( diff->dl_ctx, member );
+
+	switch( member->AtomType() )
+	{
+		case DL_TYPE_ATOM_POD:
+		case DL_TYPE_ATOM_BITFIELD:
+			return dl_diff_value( diff, storage, member->subtype, member->size, old_value, new_value, force, changed );
+		case DL_TYPE_ATOM_INLINE_ARRAY:
+		{
+			uint32_t count = dl_diff_inline_array_count( member );
+			return dl_diff_elements( diff, storage, member->subtype, dl_diff_elem_size( storage, member->subtype ), old_value, old_value != 0x0 ? count : 0, new_value, count, false, changed );
+		}
+		case DL_TYPE_ATOM_ARRAY:
+			return dl_diff_array( diff, member, old_value, new_value, changed );
+		default:
+			DL_ASSERT( false && "Invalid ATOM-type!" );
+			return DL_ERROR_INTERNAL_ERROR;
+	}
+}
+
+// ... write member_index + 1 and the member if it changed or if forced to ...
+static dl_error_t dl_diff_write_member( dl_diff_ctx* diff, const dl_type_hot* type, const dl_member_hot* member, const uint8_t* old_instance, const uint8_t* new_instance, bool force, bool* changed )
+{
+	size_t pos = diff->writer.pos;
+	dl_diff_write_varint( &diff->writer, (uint64_t)( member - type->members ) + 1 );
+
+	bool member_changed = false;
+	dl_error_t err = dl_diff_member( diff, member, old_instance != 0x0 ? old_instance + member->offset : 0x0, new_instance + member->offset, force, &member_changed );
+	if( err != DL_ERROR_OK )
+		return err;
+
+	if( member_changed || force )
+		*changed = true;
+	else
+		diff->writer.pos = pos;
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_diff_struct( dl_diff_ctx* diff, const dl_type_hot* type, const uint8_t* old_instance, const uint8_t* new_instance, bool* changed )
+{
+	*changed = false;
+
+	if( old_instance != 0x0 && memcmp( old_instance, new_instance, type->size ) == 0 && dl_diff_compare_bytes( diff, type ) )
+	{
+		dl_diff_write_varint( &diff->writer, 0 );
+		return DL_ERROR_OK;
+	}
+
+	if( type->flags & DL_TYPE_FLAG_IS_UNION )
+	{
+		uint32_t type_offset = type->union_type_offset[DL_PTR_SIZE_HOST];
+		uint32_t union_type  = *(const uint32_t*)( new_instance + type_offset );
+		const dl_member_hot* member = dl_internal_union_type_to_member_hot( diff->dl_ctx, type, union_type );
+		if( member == 0x0 )
+		{
+			dl_log_error( diff->dl_ctx, "Could not find union type %X for type %s", union_type, dl_internal_type_name( diff->dl_ctx, dl_internal_type_desc_of( diff->dl_ctx, type ) ) );
+			return DL_ERROR_MALFORMED_DATA;
+		}
+
+		// ... a member switched to is diffed against zero as the union is cleared when switching member ...
+		bool same_member = old_instance != 0x0 && *(const uint32_t*)( old_instance + type_offset ) == union_type;
+		dl_error_t err = dl_diff_write_member( diff, type, member, same_member ? old_instance : 0x0, new_instance, !same_member, changed );
+		if( err != DL_ERROR_OK )
+			return err;
+	}
+	else
+	{
+		bool last_was_bitfield = false;
+		for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+		{
+			const dl_member_hot* member = type->members + member_index;
+
+			// ... bitfields following each other share storage, written as one pod by the first of them ...
+			if( !last_was_bitfield || member->AtomType() != DL_TYPE_ATOM_BITFIELD )
+			{
+				dl_error_t err = dl_diff_write_member( diff, type, member, old_instance, new_instance, false, changed );
+				if( err != DL_ERROR_OK )
+					return err;
+			}
+
+			last_was_bitfield = member->AtomType() == DL_TYPE_ATOM_BITFIELD;
+		}
+	}
+
+	dl_diff_write_varint( &diff->writer, 0 );
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_instance_diff( dl_ctx_t       dl_ctx,       dl_typeid_t type,
+                             const void*    old_instance, const void* new_instance,
+                             unsigned char* out_patch,    size_t      out_patch_size,
+                             size_t*        produced_bytes )
+{
+	const dl_type_desc* type_desc = dl_internal_find_type( dl_ctx, type );
+	const dl_type_hot*  type_hot  = type_desc != 0x0 ? dl_internal_type_hot( dl_ctx, type_desc ) : 0x0;
+	if( type_hot == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	dl_diff_ctx diff( dl_ctx );
+	diff.writer.data = out_patch;
+	diff.writer.size = out_patch_size;
+	diff.writer.pos  = 0;
+
+	dl_diff_header header;
+	header.id        = DL_DIFF_ID;
+	header.version   = DL_DIFF_VERSION;
+	header.root_type = type;
+	dl_diff_write( &diff.writer, &header, sizeof( header ) );
+
+	// ... the root is always the first instance, so ptrs back to it is written as refs ...
+	diff.written_ptrs.insert( (uintptr_t)new_instance, diff.written_ptr_count++ );
+
+	bool changed;
+	dl_error_t err = dl_diff_struct( &diff, type_hot, (const uint8_t*)old_instance, (const uint8_t*)new_instance, &changed );
+	if( err != DL_ERROR_OK )
+		return err;
+
+	if( produced_bytes )
+		*produced_bytes = diff.writer.pos;
+
+	if( out_patch_size > 0 && diff.writer.pos > out_patch_size )
+		return DL_ERROR_BUFFER_TOO_SMALL;
+	return DL_ERROR_OK;
+}
+
+struct dl_diff_reader
+{
+	const uint8_t* data;
+	size_t         size;
+	size_t         pos;
+};
+
+static inline bool dl_diff_read( dl_diff_reader* reader, void* out, size_t size )
+{
+	if( size > reader->size - reader->pos )
+		return false;
+	memcpy( out, reader->data + reader->pos, size );
+	reader->pos += size;
+	return true;
+}
+
+static inline bool dl_diff_read_varint( dl_diff_reader* reader, uint64_t* out )
+{
+	uint64_t value = 0;
+	for( unsigned int shift = 0; shift < 64 && reader->pos < reader->size; shift += 7 )
+	{
+		uint8_t byte = reader->data[reader->pos++];
+		value |= (uint64_t)( byte & 0x7F ) << shift;
+		if( ( byte & 0x80 ) == 0 )
+		{
+			*out = value;
+			return true;
+		}
+	}
+	return false;
+}
+
+struct dl_diff_block
+{
+	dl_diff_block* next;
+	size_t         size;
+	size_t         used;
+};
+
+/*
+	State while applying a patch. The new instance is built in memory allocated from blocks owned by the apply-ctx,
+	everything not changed by the patch is still referring to the old instance and is copied from there when the new
+	instance is stored.
+*/
+struct dl_diff_apply_ctx
+{
+	explicit dl_diff_apply_ctx( dl_ctx_t ctx )
+		: dl_ctx( ctx )
+		, ptrs( 0x0 )
+		, ptr_count( 0 )
+		, ptr_capacity( 0 )
+		, blocks( 0x0 )
+	{
+	}
+
+	~dl_diff_apply_ctx()
+	{
+		if( ptrs != 0x0 )
+			dl_free( &dl_ctx->alloc, ptrs );
+		while( blocks != 0x0 )
+		{
+			dl_diff_block* next = blocks->next;
+			dl_free( &dl_ctx->alloc, blocks );
+			blocks = next;
+		}
+	}
+
+	dl_ctx_t       dl_ctx;
+	dl_diff_reader reader;
+	uint8_t**      ptrs;         // instances created by DL_DIFF_PTR_OLD and DL_DIFF_PTR_NEW, in patch-order.
+	size_t         ptr_count;
+	size_t         ptr_capacity;
+	dl_diff_block* blocks;
+
+private:
+	dl_diff_apply_ctx( const dl_diff_apply_ctx& );
+	dl_diff_apply_ctx& operator=( const dl_diff_apply_ctx& );
+};
+
+static uint8_t* dl_diff_alloc( dl_diff_apply_ctx* apply, size_t size, size_t alignment )
+{
+	dl_diff_block* block = apply->blocks;
+	if( block != 0x0 )
+	{
+		uint8_t* data = (uint8_t*)( block + 1 );
+		uint8_t* mem  = dl_internal_align_up( data + block->used, alignment );
+		if( mem + size <= data + block->size )
+		{
+			block->used = (size_t)( mem + size - data );
+			return mem;
+		}
+	}
+
+	size_t block_size = size + alignment > 64 * 1024 ? size + alignment : 64 * 1024;
+	block = (dl_diff_block*)dl_alloc( &apply->dl_ctx->alloc, sizeof( dl_diff_block ) + block_size );
+	if( block == 0x0 )
+		return 0x0;
+	block->next   = apply->blocks;
+	block->size   = block_size;
+	apply->blocks = block;
+
+	uint8_t* data = (uint8_t*)( block + 1 );
+	uint8_t* mem  = dl_internal_align_up( data, alignment );
+	block->used = (size_t)( mem + size - data );
+	return mem;
+}
+
+static bool dl_diff_add_ptr( dl_diff_apply_ctx* apply, uint8_t* ptr )
+{
+	if( apply->ptr_count == apply->ptr_capacity )
+	{
+		size_t capacity = apply->ptr_capacity == 0 ? 64 : apply->ptr_capacity * 2;
+		uint8_t** ptrs = (uint8_t**)dl_realloc( &apply->dl_ctx->alloc, apply->ptrs, capacity * sizeof( uint8_t* ), apply->ptr_capacity * sizeof( uint8_t* ) );
+		if( ptrs == 0x0 )
+			return false;
+		apply->ptrs         = ptrs;
+		apply->ptr_capacity = capacity;
+	}
+	apply->ptrs[apply->ptr_count++] = ptr;
+	return true;
+}
+
+static dl_error_t dl_diff_apply_struct( dl_diff_apply_ctx* apply, const dl_type_hot* type, uint8_t* instance );
+
+static dl_error_t dl_diff_apply_ptr( dl_diff_apply_ctx* apply, const dl_type_hot* subtype, uint8_t* value )
+{
+	uint8_t op;
+	if( !dl_diff_read( &apply->reader, &op, sizeof( op ) ) )
+		return DL_ERROR_MALFORMED_DATA;
+
+	switch( op )
+	{
+		case DL_DIFF_PTR_NULL:
+			*(uint8_t**)value = 0x0;
+			return DL_ERROR_OK;
+		case DL_DIFF_PTR_REF:
+		{
+			uint64_t index;
+			if( !dl_diff_read_varint( &apply->reader, &index ) || index >= apply->ptr_count )
+				return DL_ERROR_MALFORMED_DATA;
+			*(uint8_t**)value = apply->ptrs[index];
+			return DL_ERROR_OK;
+		}
+		case DL_DIFF_PTR_OLD:
+		case DL_DIFF_PTR_NEW:
+		{
+			uint8_t* old_ptr = *(uint8_t**)value;
+			if( op == DL_DIFF_PTR_OLD && old_ptr == 0x0 )
+				return DL_ERROR_MALFORMED_DATA;
+
+			uint8_t* instance = dl_diff_alloc( apply, subtype->size, subtype->alignment );
+			if( instance == 0x0 || !dl_diff_add_ptr( apply, instance ) )
+				return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+			if( op == DL_DIFF_PTR_OLD )
+				memcpy( instance, old_ptr, subtype->size );
+			else
+				memset( instance, 0x0, subtype->size );
+
+			*(uint8_t**)value = instance;
+			return dl_diff_apply_struct( apply, subtype, instance );
+		}
+		default:
+			return DL_ERROR_MALFORMED_DATA;
+	}
+}
+
+static dl_error_t dl_diff_apply_value( dl_diff_apply_ctx* apply, dl_type_storage_t storage, const dl_type_hot* subtype, size_t size, uint8_t* value )
+{
+	switch( storage )
+	{
+		case DL_TYPE_STORAGE_STRUCT:
+			return dl_diff_apply_struct( apply, subtype, value );
+		case DL_TYPE_STORAGE_STR:
+		{
+			uint64_t len;
+			if( !dl_diff_read_varint( &apply->reader, &len ) )
+				return DL_ERROR_MALFORMED_DATA;
+			if( len == 0 )
+			{
+				*(char**)value = 0x0;
+				return DL_ERROR_OK;
+			}
+			if( len - 1 > apply->reader.size - apply->reader.pos )
+				return DL_ERROR_MALFORMED_DATA;
+
+			char* str = (char*)dl_diff_alloc( apply, (size_t)len, 1 );
+			if( str == 0x0 )
+				return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+			dl_diff_read( &apply->reader, str, (size_t)len - 1 );
+			str[len - 1] = '\0';
+			*(char**)value = str;
+			return DL_ERROR_OK;
+		}
+		case DL_TYPE_STORAGE_PTR:
+			return dl_diff_apply_ptr( apply, subtype, value );
+		default:
+			return dl_diff_read( &apply->reader, value, size ) ? DL_ERROR_OK : DL_ERROR_MALFORMED_DATA;
+	}
+}
+
+static dl_error_t dl_diff_apply_elements( dl_diff_apply_ctx* apply, dl_type_storage_t storage, const dl_type_hot* subtype, size_t elem_size, uint8_t* data, uint32_t count )
+{
+	uint64_t elem = 0;
+	while( true )
+	{
+		uint64_t run_count;
+		uint64_t skip;
+		if( !dl_diff_read_varint( &apply->reader, &run_count ) )
+			return DL_ERROR_MALFORMED_DATA;
+		if( run_count == 0 )
+			return DL_ERROR_OK;
+		if( !dl_diff_read_varint( &apply->reader, &skip ) || skip > count - elem || run_count > count - elem - skip )
+			return DL_ERROR_MALFORMED_DATA;
+
+		for( elem += skip; run_count > 0; --run_count, ++elem )
+		{
+			dl_error_t err = dl_diff_apply_value( apply, storage, subtype, elem_size, data + elem * elem_size );
+			if( err != DL_ERROR_OK )
+				return err;
+		}
+	}
+}
+
+static dl_error_t dl_diff_apply_array( dl_diff_apply_ctx* apply, const dl_member_hot* member, uint8_t* value )
+{
+	dl_type_storage_t storage   = member->StorageType();
+	size_t            elem_size = dl_diff_elem_size( storage, member->subtype );
+	size_t            alignment = storage == DL_TYPE_STORAGE_STRUCT ? member->subtype->alignment : elem_size;
+
+	const uint8_t* old_data  = *(const uint8_t* const*)value;
+	uint32_t       old_count = *(const uint32_t*)( value + sizeof( void* ) );
+
+	uint8_t mode;
+	if( !dl_diff_read( &apply->reader, &mode, sizeof( mode ) ) )
+		return DL_ERROR_MALFORMED_DATA;
+
+	if( mode == DL_DIFF_ARRAY_SAME_COUNT )
+	{
+		if( old_count == 0 )
+			return dl_diff_apply_elements( apply, storage, member->subtype, elem_size, 0x0, 0 );
+
+		uint8_t* data = dl_diff_alloc( apply, old_count * elem_size, alignment );
+		if( data == 0x0 )
+			return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+		memcpy( data, old_data, old_count * elem_size );
+		*(uint8_t**)value = data;
+		return dl_diff_apply_elements( apply, storage, member->subtype, elem_size, data, old_count );
+	}
+
+	if( mode != DL_DIFF_ARRAY_SPLICE )
+		return DL_ERROR_MALFORMED_DATA;
+
+	uint64_t new_count, tail;
+	if( !dl_diff_read_varint( &apply->reader, &new_count ) ||
+		!dl_diff_read_varint( &apply->reader, &tail ) )
+		return DL_ERROR_MALFORMED_DATA;
+	if( new_count > UINT32_MAX || tail > old_count || tail > new_count )
+		return DL_ERROR_MALFORMED_DATA;
+
+	// ... each added element is at least one byte in the patch, keeps a broken patch from allocating huge arrays ...
+	uint64_t old_front = old_count - tail;
+	uint64_t new_front = new_count - tail;
+	uint64_t kept      = old_front < new_front ? old_front : new_front;
+	if( new_front - kept > apply->reader.size - apply->reader.pos )
+		return DL_ERROR_MALFORMED_DATA;
+
+	uint8_t* data = 0x0;
+	if( new_count > 0 )
+	{
+		data = dl_diff_alloc( apply, (size_t)new_count * elem_size, alignment );
+		if( data == 0x0 )
+			return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+		if( kept > 0 )
+			memcpy( data, old_data, (size_t)kept * elem_size );
+		if( new_front > kept )
+			memset( data + kept * elem_size, 0x0, (size_t)( new_front - kept ) * elem_size );
+		if( tail > 0 )
+			memcpy( data + new_front * elem_size, old_data + old_front * elem_size, (size_t)tail * elem_size );
+	}
+
+	dl_error_t err = dl_diff_apply_elements( apply, storage, member->subtype, elem_size, data, (uint32_t)new_front );
+	if( err != DL_ERROR_OK )
+		return err;
+
+	*(uint8_t**)value = data;
+	*(uint32_t*)( value + sizeof( void* ) ) = (uint32_t)new_count;
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_diff_apply_member( dl_diff_apply_ctx* apply, const dl_member_hot* member, uint8_t* value )
+{
+	dl_type_storage_t storage = member->StorageType();
+	if( ( storage == DL_TYPE_STORAGE_STRUCT || storage == DL_TYPE_STORAGE_PTR ) && member->subtype == 0x0 )
+		return dl_diff_subtype_missing( apply->dl_ctx, member );
+
+	switch( member->AtomType() )
+	{
+		case DL_TYPE_ATOM_POD:
+		case DL_TYPE_ATOM_BITFIELD:
+			return dl_diff_apply_value( apply, storage, member->subtype, member->size, value );
+		case DL_TYPE_ATOM_INLINE_ARRAY:
+			return dl_diff_apply_elements( apply, storage, member->subtype, dl_diff_elem_size( storage, member->subtype ), value, dl_diff_inline_array_count( member ) );
+		case DL_TYPE_ATOM_ARRAY:
+			return dl_diff_apply_array( apply, member, value );
+		default:
+			DL_ASSERT( false && "Invalid ATOM-type!" );
+			return DL_ERROR_INTERNAL_ERROR;
+	}
+}
+
+static dl_error_t dl_diff_apply_struct( dl_diff_apply_ctx* apply, const dl_type_hot* type, uint8_t* instance )
+{
+	while( true )
+	{
+		uint64_t member_index;
+		if( !dl_diff_read_varint( &apply->reader, &member_index ) || member_index > type->member_count )
+			return DL_ERROR_MALFORMED_DATA;
+		if( member_index == 0 )
+			return DL_ERROR_OK;
+
+		const dl_member_hot* member = type->members + member_index - 1;
+		if( type->flags & DL_TYPE_FLAG_IS_UNION )
+		{
+			// ... type is typeid + member_index + 1, see dl_internal_union_type_to_member() ...
+			uint32_t  union_type = apply->dl_ctx->type_ids[ type - apply->dl_ctx->type_hots ] + (uint32_t)member_index;
+			uint32_t* type_ptr   = (uint32_t*)( instance + type->union_type_offset[DL_PTR_SIZE_HOST] );
+			if( *type_ptr != union_type )
+			{
+				memset( instance, 0x0, type->size );
+				*type_ptr = union_type;
+			}
+		}
+
+		dl_error_t err = dl_diff_apply_member( apply, member, instance + member->offset );
+		if( err != DL_ERROR_OK )
+			return err;
+	}
+}
+
+dl_error_t dl_instance_apply_diff( dl_ctx_t             dl_ctx,       dl_typeid_t type,
+                                   const void*          old_instance,
+                                   const unsigned char* patch,        size_t      patch_size,
+                                   unsigned char*       out_buffer,   size_t      out_buffer_size,
+                                   size_t*              produced_bytes )
+{
+	dl_diff_header header;
+	if( patch_size < sizeof( header ) )
+		return DL_ERROR_MALFORMED_DATA;
+	memcpy( &header, patch, sizeof( header ) );
+	if( header.id == DL_DIFF_ID_SWAPED )      return DL_ERROR_ENDIAN_MISMATCH;
+	if( header.id != DL_DIFF_ID )             return DL_ERROR_MALFORMED_DATA;
+	if( header.version != DL_DIFF_VERSION )   return DL_ERROR_VERSION_MISMATCH;
+	if( header.root_type != type )            return DL_ERROR_TYPE_MISMATCH;
+
+	const dl_type_desc* type_desc = dl_internal_find_type( dl_ctx, type );
+	const dl_type_hot*  type_hot  = type_desc != 0x0 ? dl_internal_type_hot( dl_ctx, type_desc ) : 0x0;
+	if( type_hot == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	dl_diff_apply_ctx apply( dl_ctx );
+	apply.reader.data = patch;
+	apply.reader.size = patch_size;
+	apply.reader.pos  = sizeof( header );
+
+	uint8_t* root = dl_diff_alloc( &apply, type_hot->size, type_hot->alignment );
+	if( root == 0x0 || !dl_diff_add_ptr( &apply, root ) )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	memcpy( root, old_instance, type_hot->size );
+
+	dl_error_t err = dl_diff_apply_struct( &apply, type_hot, root );
+	if( err != DL_ERROR_OK )
+		return err;
+	if( apply.reader.pos != apply.reader.size )
+		return DL_ERROR_MALFORMED_DATA;
+
+	return dl_instance_store( dl_ctx, type, root, out_buffer, out_buffer_size, produced_bytes );
+}
@@ -0,0 +1,419 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include "dl_types.h"
+#include "dl_ptr_map.h"
+#include "dl_hash64.h"
+
+#include <dl/dl.h>
+
+/*
+	The hash is calculated over a stream of the values in the instance that do not depend on how the instance is
+	laid out in memory, so that instances that dl_instance_compare find equal get the same hash:
+
+	- integers, enums and fp-values as their value in little endian, with -0.0 as 0.0.
+	- bitfields as their value in an uint64.
+	- strings as an uint64 with length + 1, followed by the characters. Null is 0.
+	- ptrs as an uint64 with 1 + the order in which the struct pointed to was first reached, the root is 1. Null is 0.
+	- arrays as an uint32 with the count, followed by the elements.
+	- unions as an uint32 with the type-tag, followed by the member that is set.
+
+	The root is hashed first and then the structs pointed to in the order they was first reached.
+
+	Loaded and packed instances is walked by the same code, ptrs is read as offsets from base with base 0 for loaded
+	instances.
+*/
+
+struct dl_hash_item
+{
+	const dl_type_hot* type;
+	uintptr_t          offset;
+};
+
+struct dl_hash_ctx
+{
+	explicit dl_hash_ctx( dl_ctx_t dl_ctx )
+		: ctx( dl_ctx )
+		, seen( dl_ctx->alloc )
+		, work( dl_ctx->alloc )
+	{
+	}
+
+	dl_ctx_t        ctx;
+	dl_hash64_state state;
+	uintptr_t       base;        ///< ptrs is offsets from base, 0 for loaded instances.
+	uintptr_t       begin;       ///< offset of the root instance, only used for packed instances.
+	uintptr_t       end;         ///< offset of the end of the instance, only used for packed instances.
+	uintptr_t       offset_mask; ///< mask to get the offset from a stored ptr, removes the offset to the next ptr in the ptr-chain.
+	bool            packed;
+	dl_ptr_map      seen;        ///< offset of struct pointed to -> index of item in work where it was first reached.
+
+	CArrayStatic<dl_hash_item, 64> work;
+};
+
+static inline const uint8_t* dl_hash_data( dl_hash_ctx* hctx, uintptr_t offset )
+{
+	return (const uint8_t*)( hctx->base + offset );
+}
+
+static inline uintptr_t dl_hash_read_ptr( dl_hash_ctx* hctx, uintptr_t offset )
+{
+	return *(const uintptr_t*)dl_hash_data( hctx, offset ) & hctx->offset_mask;
+}
+
+static inline bool dl_hash_in_range( dl_hash_ctx* hctx, uintptr_t offset, uint64_t size )
+{
+	return !hctx->packed || ( offset >= hctx->begin && offset <= hctx->end && size <= hctx->end - offset );
+}
+
+static dl_error_t dl_hash_check_range( dl_hash_ctx* hctx, uintptr_t offset, uint64_t size )
+{
+	if( dl_hash_in_range( hctx, offset, size ) )
+		return DL_ERROR_OK;
+	dl_log_error( hctx->ctx, "malformed instance, data at offset " DL_UINT64_FMT_STR " is outside of instance", (uint64_t)offset );
+	return DL_ERROR_MALFORMED_DATA;
+}
+
+static inline void dl_hash_uint( dl_hash_ctx* hctx, uint64_t value, size_t size )
+{
+	if( DL_ENDIAN_HOST == DL_ENDIAN_LITTLE )
+	{
+		dl_hash64_update( &hctx->state, &value, size );
+		return;
+	}
+
+	uint8_t bytes[8];
+	for( size_t i = 0; i < size; ++i )
+		bytes[i] = (uint8_t)( value >> ( i * 8 ) );
+	dl_hash64_update( &hctx->state, bytes, size );
+}
+
+static inline uint64_t dl_hash_read_uint( const uint8_t* data, size_t size )
+{
+	switch( size )
+	{
+		case 1:  return *(const uint8_t*)data;
+		case 2:  return *(const uint16_t*)data;
+		case 4:  return *(const uint32_t*)data;
+		default: return *(const uint64_t*)data;
+	}
+}
+
+// ... read a pod as its bits, with -0.0 as 0.0 for fp-values ...
+static inline uint64_t dl_hash_read_pod( dl_type_storage_t storage, const uint8_t* data, size_t size )
+{
+	uint64_t value = dl_hash_read_uint( data, size );
+	if( storage == DL_TYPE_STORAGE_FP32 && ( value & 0x7FFFFFFFULL ) == 0 )
+		return 0;
+	if( storage == DL_TYPE_STORAGE_FP64 && ( value & 0x7FFFFFFFFFFFFFFFULL ) == 0 )
+		return 0;
+	return value;
+}
+
+// ... fp-values is hashed with -0.0 as 0.0, runs that contain -0.0 is copied in chunks to replace it, T is an uint of the same size ...
+template <typename T>
+static void dl_hash_fp_run( dl_hash_ctx* hctx, const uint8_t* data, uint32_t count )
+{
+	const T sign_mask = (T)1 << ( sizeof( T ) * 8 - 1 );
+	const T* values   = (const T*)data;
+
+	bool has_neg_zero = false;
+	for( uint32_t index = 0; index < count; ++index )
+		has_neg_zero |= values[index] == sign_mask;
+	if( !has_neg_zero )
+	{
+		dl_hash64_update( &hctx->state, data, count * sizeof( T ) );
+		return;
+	}
+
+	const uint32_t chunk_count = 64;
+	T chunk[chunk_count];
+	for( uint32_t start = 0; start < count; start += chunk_count )
+	{
+		uint32_t elems = count - start < chunk_count ? count - start : chunk_count;
+		for( uint32_t index = 0; index < elems; ++index )
+			chunk[index] = values[start + index] == sign_mask ? 0 : values[start + index];
+		dl_hash64_update( &hctx->state, chunk, elems * sizeof( T ) );
+	}
+}
+
+static void dl_hash_pods( dl_hash_ctx* hctx, dl_type_storage_t storage, const uint8_t* data, uint32_t count )
+{
+	size_t size = dl_pod_size( storage );
+	if( DL_ENDIAN_HOST != DL_ENDIAN_LITTLE )
+	{
+		for( uint32_t index = 0; index < count; ++index )
+			dl_hash_uint( hctx, dl_hash_read_pod( storage, data + index * size, size ), size );
+		return;
+	}
+
+	switch( storage )
+	{
+		case DL_TYPE_STORAGE_FP32: dl_hash_fp_run<uint32_t>( hctx, data, count ); break;
+		case DL_TYPE_STORAGE_FP64: dl_hash_fp_run<uint64_t>( hctx, data, count ); break;
+		default:
+			// ... integers is already laid out as in the hashed stream ...
+			dl_hash64_update( &hctx->state, data, size * count );
+			break;
+	}
+}
+
+static dl_error_t dl_hash_str( dl_hash_ctx* hctx, uintptr_t offset )
+{
+	uintptr_t str = dl_hash_read_ptr( hctx, offset );
+	if( str == 0 )
+	{
+		dl_hash_uint( hctx, 0, sizeof( uint64_t ) );
+		return DL_ERROR_OK;
+	}
+
+	size_t len;
+	if( hctx->packed )
+	{
+		const void* terminator = dl_hash_in_range( hctx, str, 0 ) ? memchr( dl_hash_data( hctx, str ), '\0', hctx->end - str ) : 0x0;
+		if( terminator == 0x0 )
+		{
+			dl_log_error( hctx->ctx, "malformed instance, string at offset " DL_UINT64_FMT_STR " is not terminated", (uint64_t)str );
+			return DL_ERROR_MALFORMED_DATA;
+		}
+		len = (size_t)( (const uint8_t*)terminator - dl_hash_data( hctx, str ) );
+	}
+	else
+		len = strlen( (const char*)str );
+
+	dl_hash_uint( hctx, (uint64_t)len + 1, sizeof( uint64_t ) );
+	dl_hash64_update( &hctx->state, dl_hash_data( hctx, str ), len );
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_hash_ptr( dl_hash_ctx* hctx, const dl_type_hot* subtype, uintptr_t offset )
+{
+	uintptr_t ptr = dl_hash_read_ptr( hctx, offset );
+	if( ptr == 0 )
+	{
+		dl_hash_uint( hctx, 0, sizeof( uint64_t ) );
+		return DL_ERROR_OK;
+	}
+
+	uintptr_t item;
+	if( !hctx->seen.find( ptr, &item ) )
+	{
+		dl_error_t err = dl_hash_check_range( hctx, ptr, subtype->size );
+		if( DL_ERROR_OK != err )
+			return err;
+
+		item = hctx->work.Len();
+		hctx->seen.insert( ptr, item );
+		dl_hash_item next = { subtype, ptr };
+		hctx->work.Add( next );
+	}
+	dl_hash_uint( hctx, (uint64_t)item + 1, sizeof( uint64_t ) );
+	return DL_ERROR_OK;
+}
+
+// ... a struct is flat if the hashed stream of it is the bytes of the struct, no padding and only integer-members ...
+static bool dl_hash_is_flat( const dl_type_hot* type )
+{
+	if( ( type->flags & ( DL_TYPE_FLAG_HAS_SUBDATA | DL_TYPE_FLAG_IS_UNION ) ) != 0 || DL_ENDIAN_HOST != DL_ENDIAN_LITTLE )
+		return false;
+
+	uint32_t offset = 0;
+	for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+	{
+		const dl_member_hot* member  = type->members + member_index;
+		dl_type_storage_t    storage = member->StorageType();
+		dl_type_atom_t       atom    = member->AtomType();
+		if( ( atom != DL_TYPE_ATOM_POD && atom != DL_TYPE_ATOM_INLINE_ARRAY ) || member->offset != offset )
+			return false;
+		if( storage == DL_TYPE_STORAGE_FP32 || storage == DL_TYPE_STORAGE_FP64 || storage >= DL_TYPE_STORAGE_STR )
+			return false;
+		offset += member->size;
+	}
+	return offset == dl_internal_align_up( type->size, type->alignment );
+}
+
+static dl_error_t dl_hash_struct( dl_hash_ctx* hctx, const dl_type_hot* type, uintptr_t offset );
+
+static dl_error_t dl_hash_elements( dl_hash_ctx* hctx, dl_type_storage_t storage, const dl_type_hot* subtype, uintptr_t offset, uint32_t count )
+{
+	switch( storage )
+	{
+		case DL_TYPE_STORAGE_STR:
+		case DL_TYPE_STORAGE_PTR:
+			for( uint32_t index = 0; index < count; ++index )
+			{
+				uintptr_t  elem = offset + index * sizeof( void* );
+				dl_error_t err  = storage == DL_TYPE_STORAGE_STR ? dl_hash_str( hctx, elem ) : dl_hash_ptr( hctx, subtype, elem );
+				if( DL_ERROR_OK != err )
+					return err;
+			}
+			return DL_ERROR_OK;
+
+		case DL_TYPE_STORAGE_STRUCT:
+		{
+			size_t stride = dl_internal_align_up( subtype->size, subtype->alignment );
+			if( dl_hash_is_flat( subtype ) )
+			{
+				dl_hash64_update( &hctx->state, dl_hash_data( hctx, offset ), stride * count );
+				return DL_ERROR_OK;
+			}
+
+			for( uint32_t index = 0; index < count; ++index )
+			{
+				dl_error_t err = dl_hash_struct( hctx, subtype, offset + index * stride );
+				if( DL_ERROR_OK != err )
+					return err;
+			}
+			return DL_ERROR_OK;
+		}
+
+		default:
+			dl_hash_pods( hctx, storage, dl_hash_data( hctx, offset ), count );
+			return DL_ERROR_OK;
+	}
+}
+
+static dl_error_t dl_hash_subtype_missing( dl_ctx_t dl_ctx, const dl_member_hot* member )
+{
+	dl_log_error( dl_ctx, "Could not find subtype for member %s", dl_internal_member_name( dl_ctx, dl_internal_member_desc_of( dl_ctx, member ) ) );
+	return DL_ERROR_TYPE_NOT_FOUND;
+}
+
+static dl_error_t dl_hash_member( dl_hash_ctx* hctx, const dl_member_hot* member, uintptr_t offset )
+{
+	dl_type_storage_t storage = member->StorageType();
+	if( ( storage == DL_TYPE_STORAGE_STRUCT || storage == DL_TYPE_STORAGE_PTR ) && member->subtype == 0x0 )
+		return dl_hash_subtype_missing( hctx->ctx, member );
+
+	switch( member->AtomType() )
+	{
+		case DL_TYPE_ATOM_POD:
+			return dl_hash_elements( hctx, storage, member->subtype, offset, 1 );
+
+		case DL_TYPE_ATOM_BITFIELD:
+		{
+			uint64_t bits   = ( (uint32_t)member->type & DL_TYPE_BITFIELD_SIZE_MASK ) >> DL_TYPE_BITFIELD_SIZE_MIN_BIT;
+			uint64_t start  = dl_bf_offset( DL_ENDIAN_HOST,
+			                                member->size,
+			                                ( (uint32_t)member->type & DL_TYPE_BITFIELD_OFFSET_MASK ) >> DL_TYPE_BITFIELD_OFFSET_MIN_BIT,
+			                                (unsigned int)bits );
+			uint64_t value  = dl_hash_read_uint( dl_hash_data( hctx, offset ), member->size );
+			dl_hash_uint( hctx, DL_EXTRACT_BITS( value, start, bits ), sizeof( uint64_t ) );
+			return DL_ERROR_OK;
+		}
+
+		case DL_TYPE_ATOM_INLINE_ARRAY:
+			return dl_hash_elements( hctx, storage, member->subtype, offset, member->inline_array_cnt() );
+
+		case DL_TYPE_ATOM_ARRAY:
+		{
+			uint32_t  count = *(const uint32_t*)dl_hash_data( hctx, offset + sizeof( void* ) );
+			uintptr_t data  = dl_hash_read_ptr( hctx, offset );
+			dl_hash_uint( hctx, count, sizeof( uint32_t ) );
+			if( count == 0 || data == 0 )
+				return DL_ERROR_OK;
+
+			size_t     elem_size = storage == DL_TYPE_STORAGE_STRUCT ? dl_internal_align_up( member->subtype->size, member->subtype->alignment ) : dl_pod_size( storage );
+			dl_error_t err       = dl_hash_check_range( hctx, data, (uint64_t)elem_size * count );
+			if( DL_ERROR_OK != err )
+				return err;
+			return dl_hash_elements( hctx, storage, member->subtype, data, count );
+		}
+
+		default:
+			DL_ASSERT( false && "unhandled atom in hash" );
+			return DL_ERROR_INTERNAL_ERROR;
+	}
+}
+
+static dl_error_t dl_hash_struct( dl_hash_ctx* hctx, const dl_type_hot* type, uintptr_t offset )
+{
+	if( type->flags & DL_TYPE_FLAG_IS_UNION )
+	{
+		uint32_t union_type = *(const uint32_t*)dl_hash_data( hctx, offset + type->union_type_offset[DL_PTR_SIZE_HOST] );
+		const dl_member_hot* member = dl_internal_union_type_to_member_hot( hctx->ctx, type, union_type );
+		if( member == 0x0 )
+		{
+			dl_log_error( hctx->ctx, "Could not find union type %X for type %s", union_type, dl_internal_type_name( hctx->ctx, dl_internal_type_desc_of( hctx->ctx, type ) ) );
+			return DL_ERROR_MALFORMED_DATA;
+		}
+		dl_hash_uint( hctx, union_type, sizeof( uint32_t ) );
+		return dl_hash_member( hctx, member, offset + member->offset );
+	}
+
+	for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+	{
+		const dl_member_hot* member = type->members + member_index;
+		dl_error_t err = dl_hash_member( hctx, member, offset + member->offset );
+		if( DL_ERROR_OK != err )
+			return err;
+	}
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_hash_walk( dl_hash_ctx* hctx, dl_typeid_t type_id, const dl_type_hot* type, uintptr_t root, uint64_t* out_hash )
+{
+	dl_hash64_init( &hctx->state, 0 );
+	dl_hash_uint( hctx, type_id, sizeof( uint32_t ) );
+
+	// ... ptrs to the root is hashed as any other ptr ...
+	dl_hash_item item = { type, root };
+	hctx->seen.insert( root, 0 );
+	hctx->work.Add( item );
+
+	for( size_t item_index = 0; item_index < hctx->work.Len(); ++item_index )
+	{
+		item = hctx->work[item_index];
+		dl_error_t err = dl_hash_struct( hctx, item.type, item.offset );
+		if( DL_ERROR_OK != err )
+			return err;
+	}
+
+	*out_hash = dl_hash64_digest( &hctx->state, 0 );
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_instance_hash( dl_ctx_t dl_ctx, dl_typeid_t type_id, const void* instance, uint64_t* out_hash )
+{
+	const dl_type_desc* type_desc = dl_internal_find_type( dl_ctx, type_id );
+	const dl_type_hot*  type      = type_desc != 0x0 ? dl_internal_type_hot( dl_ctx, type_desc ) : 0x0;
+	if( type == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	dl_hash_ctx hctx( dl_ctx );
+	hctx.base        = 0;
+	hctx.begin       = 0;
+	hctx.end         = 0;
+	hctx.offset_mask = ~(uintptr_t)0;
+	hctx.packed      = false;
+	return dl_hash_walk( &hctx, type_id, type, (uintptr_t)instance, out_hash );
+}
+
+dl_error_t dl_instance_hash_packed( dl_ctx_t             dl_ctx,          dl_typeid_t type_id,
+                                    const unsigned char* packed_instance, size_t      packed_instance_size,
+                                    uint64_t*            out_hash )
+{
+	const dl_data_header* header = (const dl_data_header*)packed_instance;
+
+	if( packed_instance_size < sizeof(dl_data_header) ) return DL_ERROR_MALFORMED_DATA;
+	if( header->id == DL_INSTANCE_ID_SWAPED )           return DL_ERROR_ENDIAN_MISMATCH;
+	if( header->id != DL_INSTANCE_ID )                  return DL_ERROR_MALFORMED_DATA;
+	if( header->version != DL_INSTANCE_VERSION )        return DL_ERROR_VERSION_MISMATCH;
+	if( header->root_instance_type != type_id )         return DL_ERROR_TYPE_MISMATCH;
+
+	const dl_type_desc* type_desc = dl_internal_find_type( dl_ctx, type_id );
+	const dl_type_hot*  type      = type_desc != 0x0 ? dl_internal_type_hot( dl_ctx, type_desc ) : 0x0;
+	if( type == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	size_t header_offset = dl_internal_align_up( sizeof( dl_data_header ), type->alignment );
+	if( !dl_internal_instance_fits_host( header, packed_instance_size, header_offset ) || header->instance_size < type->size )
+		return DL_ERROR_MALFORMED_DATA;
+
+	dl_hash_ctx hctx( dl_ctx );
+	hctx.base        = (uintptr_t)packed_instance;
+	hctx.begin       = header_offset;
+	hctx.end         = header_offset + header->instance_size;
+	hctx.offset_mask = header->not_using_ptr_chain_patching ? ~(uintptr_t)0 : ( (uintptr_t)1 << ( sizeof( uintptr_t ) * 4 ) ) - 1;
+	hctx.packed      = true;
+	return dl_hash_walk( &hctx, type_id, type, header_offset, out_hash );
+}
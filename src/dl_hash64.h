@@ -0,0 +1,143 @@
+#ifndef DL_HASH64_H_INCLUDED
+#define DL_HASH64_H_INCLUDED
+
+#include "dl_types.h"
+#include "dl_swap.h"
+
+/**
+ * Streaming 64 bit hash, an implementation of the XXH64 algorithm.
+ *
+ * Input is consumed 32 bytes at the time in 4 independent lanes, so long runs of data is hashed at close to memory
+ * speed while small updates are only copied to a buffer. The result do not depend on how the input is split between
+ * calls to dl_hash64_update() and is the same on hosts of all endianness. This hash is used for hashes that are
+ * stored or compared between runs and is not affected by DL_HASH_BUFFER.
+ */
+struct dl_hash64_state
+{
+	uint64_t lanes[4];
+	uint64_t total;
+	uint8_t  buffer[32];
+	uint32_t buffered;
+};
+
+#define DL_HASH64_PRIME1 11400714785074694791ULL
+#define DL_HASH64_PRIME2 14029467366897019727ULL
+#define DL_HASH64_PRIME3 1609587929392839161ULL
+#define DL_HASH64_PRIME4 9650029242287828579ULL
+#define DL_HASH64_PRIME5 2870177450012600261ULL
+
+static DL_FORCEINLINE uint64_t dl_hash64_rotl( uint64_t value, int bits )
+{
+	return ( value << bits ) | ( value >> ( 64 - bits ) );
+}
+
+static DL_FORCEINLINE uint64_t dl_hash64_read64( const uint8_t* data )
+{
+	uint64_t value;
+	memcpy( &value, data, sizeof( value ) );
+	return DL_ENDIAN_HOST == DL_ENDIAN_LITTLE ? value : dl_swap_endian_uint64( value );
+}
+
+static DL_FORCEINLINE uint32_t dl_hash64_read32( const uint8_t* data )
+{
+	uint32_t value;
+	memcpy( &value, data, sizeof( value ) );
+	return DL_ENDIAN_HOST == DL_ENDIAN_LITTLE ? value : dl_swap_endian_uint32( value );
+}
+
+static DL_FORCEINLINE uint64_t dl_hash64_round( uint64_t acc, uint64_t input )
+{
+	return dl_hash64_rotl( acc + input * DL_HASH64_PRIME2, 31 ) * DL_HASH64_PRIME1;
+}
+
+static DL_FORCEINLINE uint64_t dl_hash64_merge_round( uint64_t acc, uint64_t lane )
+{
+	return ( acc ^ dl_hash64_round( 0, lane ) ) * DL_HASH64_PRIME1 + DL_HASH64_PRIME4;
+}
+
+static DL_FORCEINLINE void dl_hash64_stripe( uint64_t* lanes, const uint8_t* data )
+{
+	lanes[0] = dl_hash64_round( lanes[0], dl_hash64_read64( data ) );
+	lanes[1] = dl_hash64_round( lanes[1], dl_hash64_read64( data + 8 ) );
+	lanes[2] = dl_hash64_round( lanes[2], dl_hash64_read64( data + 16 ) );
+	lanes[3] = dl_hash64_round( lanes[3], dl_hash64_read64( data + 24 ) );
+}
+
+static inline void dl_hash64_init( dl_hash64_state* state, uint64_t seed )
+{
+	state->lanes[0] = seed + DL_HASH64_PRIME1 + DL_HASH64_PRIME2;
+	state->lanes[1] = seed + DL_HASH64_PRIME2;
+	state->lanes[2] = seed;
+	state->lanes[3] = seed - DL_HASH64_PRIME1;
+	state->total    = 0;
+	state->buffered = 0;
+}
+
+static DL_FORCEINLINE void dl_hash64_update( dl_hash64_state* state, const void* data, size_t size )
+{
+	const uint8_t* in  = (const uint8_t*)data;
+	const uint8_t* end = in + size;
+	state->total += size;
+
+	if( state->buffered + size < 32 )
+	{
+		memcpy( state->buffer + state->buffered, in, size );
+		state->buffered += (uint32_t)size;
+		return;
+	}
+
+	if( state->buffered > 0 )
+	{
+		size_t fill = 32 - state->buffered;
+		memcpy( state->buffer + state->buffered, in, fill );
+		dl_hash64_stripe( state->lanes, state->buffer );
+		in += fill;
+		state->buffered = 0;
+	}
+
+	uint64_t lanes[4] = { state->lanes[0], state->lanes[1], state->lanes[2], state->lanes[3] };
+	for( ; end - in >= 32; in += 32 )
+		dl_hash64_stripe( lanes, in );
+	memcpy( state->lanes, lanes, sizeof( lanes ) );
+
+	memcpy( state->buffer, in, (size_t)( end - in ) );
+	state->buffered = (uint32_t)( end - in );
+}
+
+static inline uint64_t dl_hash64_digest( const dl_hash64_state* state, uint64_t seed )
+{
+	uint64_t hash;
+	if( state->total >= 32 )
+	{
+		const uint64_t* lanes = state->lanes;
+		hash = dl_hash64_rotl( lanes[0], 1 ) + dl_hash64_rotl( lanes[1], 7 ) + dl_hash64_rotl( lanes[2], 12 ) + dl_hash64_rotl( lanes[3], 18 );
+		hash = dl_hash64_merge_round( hash, lanes[0] );
+		hash = dl_hash64_merge_round( hash, lanes[1] );
+		hash = dl_hash64_merge_round( hash, lanes[2] );
+		hash = dl_hash64_merge_round( hash, lanes[3] );
+	}
+	else
+		hash = seed + DL_HASH64_PRIME5;
+	hash += state->total;
+
+	const uint8_t* in  = state->buffer;
+	const uint8_t* end = in + state->buffered;
+	for( ; end - in >= 8; in += 8 )
+		hash = dl_hash64_rotl( hash ^ dl_hash64_round( 0, dl_hash64_read64( in ) ), 27 ) * DL_HASH64_PRIME1 + DL_HASH64_PRIME4;
+	if( end - in >= 4 )
+	{
+		hash = dl_hash64_rotl( hash ^ ( (uint64_t)dl_hash64_read32( in ) * DL_HASH64_PRIME1 ), 23 ) * DL_HASH64_PRIME2 + DL_HASH64_PRIME3;
+		in += 4;
+	}
+	for( ; in < end; ++in )
+		hash = dl_hash64_rotl( hash ^ ( *in * DL_HASH64_PRIME5 ), 11 ) * DL_HASH64_PRIME1;
+
+	hash ^= hash >> 33;
+	hash *= DL_HASH64_PRIME2;
+	hash ^= hash >> 29;
+	hash *= DL_HASH64_PRIME3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+#endif // DL_HASH64_H_INCLUDED
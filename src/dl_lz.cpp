@@ -0,0 +1,197 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include "dl_lz.h"
+
+/*
+	Each sequence is a token, with the literal length in the high 4 bits and match length - 4 in the low 4 bits,
+	where 15 mean that the length continue in the following bytes as a sum of bytes until a byte that is not 255.
+	The token is followed by the literals, a 2 byte little-endian offset back in the decompressed data and the rest
+	of the match length. The last sequence is only literals.
+*/
+
+static const size_t DL_LZ_MIN_MATCH     = 4;
+static const size_t DL_LZ_LAST_LITERALS = 5;  // the last 5 bytes of a block is always literals.
+static const size_t DL_LZ_MF_LIMIT      = 12; // the last match need to start at least 12 bytes before end of block.
+static const size_t DL_LZ_MAX_OFFSET    = 65535;
+static const size_t DL_LZ_HASH_BITS     = 14;
+
+static inline uint32_t dl_lz_read32( const uint8_t* ptr )
+{
+	uint32_t val;
+	memcpy( &val, ptr, sizeof( val ) );
+	return val;
+}
+
+static inline uint32_t dl_lz_hash( uint32_t seq )
+{
+	return ( seq * 2654435761U ) >> ( 32 - DL_LZ_HASH_BITS );
+}
+
+static inline uint8_t* dl_lz_write_length( uint8_t* op, size_t len )
+{
+	for( ; len >= 255; len -= 255 )
+		*op++ = 255;
+	*op++ = (uint8_t)len;
+	return op;
+}
+
+// ... match_len 0 write the last sequence, returns 0x0 if the sequence do not fit ...
+static uint8_t* dl_lz_write_sequence( uint8_t* op, uint8_t* op_end, const uint8_t* literals, size_t literal_len, size_t offset, size_t match_len )
+{
+	size_t worst_case = 1 + literal_len / 255 + 1 + literal_len + 2 + match_len / 255 + 1;
+	if( worst_case > (size_t)( op_end - op ) )
+		return 0x0;
+
+	uint8_t* token = op++;
+	*token = (uint8_t)( ( literal_len >= 15 ? 15 : literal_len ) << 4 );
+	if( literal_len >= 15 )
+		op = dl_lz_write_length( op, literal_len - 15 );
+	memcpy( op, literals, literal_len );
+	op += literal_len;
+
+	if( match_len == 0 )
+		return op;
+
+	*op++ = (uint8_t)( offset & 0xFF );
+	*op++ = (uint8_t)( offset >> 8 );
+
+	size_t len = match_len - DL_LZ_MIN_MATCH;
+	*token = (uint8_t)( *token | ( len >= 15 ? 15 : len ) );
+	if( len >= 15 )
+		op = dl_lz_write_length( op, len - 15 );
+	return op;
+}
+
+size_t dl_lz_compress( const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size, uint32_t* hash_table )
+{
+	uint8_t*       op     = dst;
+	uint8_t*       op_end = dst + dst_size;
+	const uint8_t* ip     = src;
+	const uint8_t* anchor = src;
+	const uint8_t* end    = src + src_size;
+
+	if( src_size > DL_LZ_MF_LIMIT )
+	{
+		memset( hash_table, 0x0, sizeof( uint32_t ) * DL_LZ_HASH_TABLE_SIZE );
+
+		const uint8_t* mf_limit    = end - DL_LZ_MF_LIMIT;
+		const uint8_t* match_limit = end - DL_LZ_LAST_LITERALS;
+		size_t misses = 0;
+
+		while( ip < mf_limit )
+		{
+			uint32_t       seq  = dl_lz_read32( ip );
+			uint32_t       hash = dl_lz_hash( seq );
+			const uint8_t* ref  = src + hash_table[hash];
+			hash_table[hash] = (uint32_t)( ip - src );
+
+			if( ref >= ip || (size_t)( ip - ref ) > DL_LZ_MAX_OFFSET || dl_lz_read32( ref ) != seq )
+			{
+				// ... step faster over data that do not compress ...
+				ip += 1 + ( misses++ >> 6 );
+				continue;
+			}
+			misses = 0;
+
+			while( ip > anchor && ref > src && ip[-1] == ref[-1] )
+			{
+				--ip;
+				--ref;
+			}
+
+			size_t match_len = DL_LZ_MIN_MATCH;
+			while( ip + match_len < match_limit && ip[match_len] == ref[match_len] )
+				++match_len;
+
+			op = dl_lz_write_sequence( op, op_end, anchor, (size_t)( ip - anchor ), (size_t)( ip - ref ), match_len );
+			if( op == 0x0 )
+				return 0;
+
+			ip    += match_len;
+			anchor = ip;
+			if( ip < mf_limit )
+				hash_table[ dl_lz_hash( dl_lz_read32( ip - 2 ) ) ] = (uint32_t)( ip - 2 - src );
+		}
+	}
+
+	op = dl_lz_write_sequence( op, op_end, anchor, (size_t)( end - anchor ), 0, 0 );
+	if( op == 0x0 )
+		return 0;
+	return (size_t)( op - dst );
+}
+
+static inline bool dl_lz_read_length( const uint8_t** ip, const uint8_t* ip_end, size_t* len )
+{
+	uint8_t byte;
+	do
+	{
+		if( *ip >= ip_end )
+			return false;
+		byte = *(*ip)++;
+		*len += byte;
+	}
+	while( byte == 255 );
+	return true;
+}
+
+bool dl_lz_decompress( const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size )
+{
+	const uint8_t* ip     = src;
+	const uint8_t* ip_end = src + src_size;
+	uint8_t*       op     = dst;
+	uint8_t*       op_end = dst + dst_size;
+
+	while( true )
+	{
+		if( ip >= ip_end )
+			return false;
+		uint8_t token = *ip++;
+
+		size_t literal_len = (size_t)( token >> 4 );
+		if( literal_len == 15 && !dl_lz_read_length( &ip, ip_end, &literal_len ) )
+			return false;
+		if( literal_len > (size_t)( ip_end - ip ) || literal_len > (size_t)( op_end - op ) )
+			return false;
+		memcpy( op, ip, literal_len );
+		ip += literal_len;
+		op += literal_len;
+
+		if( ip == ip_end )
+			return op == op_end;
+
+		if( ip_end - ip < 2 )
+			return false;
+		size_t offset = (size_t)ip[0] | ( (size_t)ip[1] << 8 );
+		ip += 2;
+		if( offset == 0 || offset > (size_t)( op - dst ) )
+			return false;
+
+		size_t match_len = (size_t)( token & 15 );
+		if( match_len == 15 && !dl_lz_read_length( &ip, ip_end, &match_len ) )
+			return false;
+		match_len += DL_LZ_MIN_MATCH;
+		if( match_len > (size_t)( op_end - op ) )
+			return false;
+
+		const uint8_t* match = op - offset;
+		if( offset >= match_len )
+		{
+			memcpy( op, match, match_len );
+			op += match_len;
+		}
+		else
+		{
+			// ... overlapping match, repeats the last offset bytes. Everything from match to op is whole periods of the
+			//     repeated bytes so it can be copied as one chunk, doubling the chunk each time ...
+			uint8_t* match_end = op + match_len;
+			while( op < match_end )
+			{
+				size_t chunk = (size_t)( op - match );
+				if( chunk > (size_t)( match_end - op ) )
+					chunk = (size_t)( match_end - op );
+				memcpy( op, match, chunk );
+				op += chunk;
+			}
+		}
+	}
+}
@@ -0,0 +1,39 @@
+#ifndef DL_LZ_H_INCLUDED
+#define DL_LZ_H_INCLUDED
+
+#include "dl_types.h"
+
+/**
+ * Small LZ77-codec used to compress blocks of packed instances, the format is the LZ4 block-format. Each call
+ * compress one independent block, no state is shared between blocks.
+ */
+
+/**
+ * Number of entries in the hash-table passed to dl_lz_compress.
+ */
+static const size_t DL_LZ_HASH_TABLE_SIZE = 1 << 14;
+
+/**
+ * Compress a block.
+ *
+ * @param src data to compress.
+ * @param src_size size of src.
+ * @param dst buffer to write compressed data to.
+ * @param dst_size size of dst.
+ * @param hash_table scratch memory of DL_LZ_HASH_TABLE_SIZE entries, do not need to be initialized.
+ * @return size of compressed data or 0 if it did not fit in dst.
+ */
+size_t dl_lz_compress( const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size, uint32_t* hash_table );
+
+/**
+ * Decompress a block compressed with dl_lz_compress.
+ *
+ * @param src compressed data.
+ * @param src_size size of src.
+ * @param dst buffer to decompress to.
+ * @param dst_size size of the decompressed data, need to be exactly the size the data was compressed from.
+ * @return false if src is not a valid compressed block or do not decompress to exactly dst_size bytes.
+ */
+bool dl_lz_decompress( const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size );
+
+#endif // DL_LZ_H_INCLUDED
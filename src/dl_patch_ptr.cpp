@@ -11,7 +11,7 @@ static uintptr_t dl_internal_patch_ptr( uint8_t* ptrptr, uintptr_t patch_distanc
 }
 
 static void dl_internal_patch_struct( dl_ctx_t            ctx,
-									  const dl_type_desc* type,
+									  const dl_type_hot*  type,
 									  uint8_t*            struct_data,
 									  uintptr_t           base_address,
 									  uintptr_t           patch_distance,
@@ -19,7 +19,7 @@ static void dl_internal_patch_struct( dl_ctx_t            ctx,
 									  dl_patched_ptrs*    patched_payloads );
 
 static void dl_internal_patch_ptr_instance( dl_ctx_t            ctx,
-		   	   	   	   	   	   	   	   	    const dl_type_desc* sub_type,
+		   	   	   	   	   	   	   	   	    const dl_type_hot*  sub_type,
 											uint8_t*            ptr_data,
 											uintptr_t           base_address,
 											uintptr_t           patch_distance,
@@ -48,7 +48,7 @@ static void dl_internal_patch_str_array( uint8_t* array_data, uint32_t count, ui
 static void dl_internal_patch_ptr_array( dl_ctx_t            ctx,
 								  	  	 uint8_t*            array_data,
 										 uint32_t            count,
-										 const dl_type_desc* sub_type,
+										 const dl_type_hot*  sub_type,
 										 uintptr_t           base_address,
 										 uintptr_t           patch_distance,
 										 dl_patched_ptrs*    patched_ptrs,
@@ -59,7 +59,7 @@ static void dl_internal_patch_ptr_array( dl_ctx_t            ctx,
 }
 
 static void dl_internal_patch_struct_array( dl_ctx_t            ctx,
-									 	 	const dl_type_desc* type,
+									 	 	const dl_type_hot*  type,
 											uint8_t*            array_data,
 											uint32_t            count,
 											uintptr_t           base_address,
@@ -67,7 +67,7 @@ static void dl_internal_patch_struct_array( dl_ctx_t            ctx,
 											dl_patched_ptrs*    patched_ptrs,
 											dl_patched_ptrs*    patched_payloads )
 {
-	uint32_t size = dl_internal_align_up( type->size[DL_PTR_SIZE_HOST], type->alignment[DL_PTR_SIZE_HOST] );
+	uint32_t size = dl_internal_align_up( type->size, type->alignment );
 	for( uint32_t index = 0; index < count; ++index )
 	{
 		uint8_t* struct_data = array_data + index * size;
@@ -76,7 +76,7 @@ static void dl_internal_patch_struct_array( dl_ctx_t            ctx,
 }
 
 static void dl_internal_patch_member( dl_ctx_t              ctx,
-								      const dl_member_desc* member,
+								      const dl_member_hot*  member,
 								      uint8_t*              member_data,
 								      uintptr_t             base_address,
 								      uintptr_t             patch_distance,
@@ -98,7 +98,7 @@ static void dl_internal_patch_member( dl_ctx_t              ctx,
 				break;
 				case DL_TYPE_STORAGE_PTR:
 					dl_internal_patch_ptr_instance( ctx,
-													dl_internal_find_type( ctx, member->type_id ),
+													member->subtype,
 													member_data,
 													base_address,
 													patch_distance,
@@ -107,7 +107,7 @@ static void dl_internal_patch_member( dl_ctx_t              ctx,
 				break;
 				case DL_TYPE_STORAGE_STRUCT:
 					dl_internal_patch_struct( ctx,
-											  dl_internal_find_type( ctx, member->type_id ),
+											  member->subtype,
 											  member_data,
 											  base_address,
 											  patch_distance,
@@ -131,7 +131,7 @@ static void dl_internal_patch_member( dl_ctx_t              ctx,
 					dl_internal_patch_ptr_array( ctx,
 												 member_data,
 												 member->inline_array_cnt(),
-												 dl_internal_find_type( ctx, member->type_id ),
+												 member->subtype,
 												 base_address,
 												 patch_distance,
 												 patched_ptrs,
@@ -139,7 +139,7 @@ static void dl_internal_patch_member( dl_ctx_t              ctx,
 				break;
 				case DL_TYPE_STORAGE_STRUCT:
 					dl_internal_patch_struct_array( ctx,
-													dl_internal_find_type( ctx, member->type_id ),
+													member->subtype,
 													member_data,
 													member->inline_array_cnt(),
 													base_address,
@@ -174,7 +174,7 @@ static void dl_internal_patch_member( dl_ctx_t              ctx,
 						dl_internal_patch_ptr_array( ctx,
 													 array_data,
 													 count,
-													 dl_internal_find_type( ctx, member->type_id ),
+													 member->subtype,
 													 base_address,
 													 patch_distance,
 													 patched_ptrs,
@@ -182,7 +182,7 @@ static void dl_internal_patch_member( dl_ctx_t              ctx,
 					break;
 					case DL_TYPE_STORAGE_STRUCT:
 						dl_internal_patch_struct_array( ctx,
-														dl_internal_find_type( ctx, member->type_id ),
+														member->subtype,
 														array_data,
 														count,
 														base_address,
@@ -202,7 +202,7 @@ static void dl_internal_patch_member( dl_ctx_t              ctx,
 }
 
 static void dl_internal_patch_union( dl_ctx_t            ctx,
-									 const dl_type_desc* type,
+									 const dl_type_hot*  type,
 									 uint8_t*            union_data,
 									 uintptr_t           base_address,
 									 uintptr_t           patch_distance,
@@ -210,17 +210,19 @@ static void dl_internal_patch_union( dl_ctx_t            ctx,
 									 dl_patched_ptrs*    patched_payloads )
 {
 	DL_ASSERT(type->flags & DL_TYPE_FLAG_IS_UNION);
-	size_t type_offset = dl_internal_union_type_offset( ctx, type, DL_PTR_SIZE_HOST );
 
-	// find member index from union type ...
-	uint32_t union_type = *((uint32_t*)(union_data + type_offset));
-	const dl_member_desc* member = dl_internal_union_type_to_member(ctx, type, union_type);
-	DL_ASSERT(member->offset[DL_PTR_SIZE_HOST] == 0);
+	// find member from union type ...
+	uint32_t union_type = *((uint32_t*)(union_data + type->union_type_offset[DL_PTR_SIZE_HOST]));
+	const dl_member_hot* member = dl_internal_union_type_to_member_hot( ctx, type, union_type );
+	if( member == 0x0 )
+		return;
+
+	DL_ASSERT(member->offset == 0);
 	dl_internal_patch_member( ctx, member, union_data, base_address, patch_distance, patched_ptrs, patched_payloads );
 }
 
 static void dl_internal_patch_struct( dl_ctx_t            ctx,
-									  const dl_type_desc* type,
+									  const dl_type_hot*  type,
 									  uint8_t*            struct_data,
 									  uintptr_t           base_address,
 									  uintptr_t           patch_distance,
@@ -237,8 +239,8 @@ static void dl_internal_patch_struct( dl_ctx_t            ctx,
 		{
 			for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
 			{
-				const dl_member_desc* member = dl_get_type_member( ctx, type, member_index );
-				dl_internal_patch_member( ctx, member, struct_data + member->offset[DL_PTR_SIZE_HOST], base_address, patch_distance, patched_ptrs, patched_payloads );
+				const dl_member_hot* member = type->members + member_index;
+				dl_internal_patch_member( ctx, member, struct_data + member->offset, base_address, patch_distance, patched_ptrs, patched_payloads );
 			}
 		}
 	}
@@ -251,16 +253,35 @@ void dl_internal_patch_member( dl_ctx_t              ctx,
 							   uintptr_t             patch_distance,
 							   dl_patched_ptrs*      patched_ptrs )
 {
+	dl_member_hot temp_member;
+	const dl_member_hot* member_hot = &temp_member;
+	if( member >= ctx->member_descs && member < ctx->member_descs + ctx->member_hots_count )
+		member_hot = ctx->member_hots + ( member - ctx->member_descs );
+	else
+	{
+		// ... not a member of a loaded type, i.e. one used while loading a typelib ...
+		const dl_type_desc* sub_type = dl_internal_find_type( ctx, member->type_id );
+		temp_member.type     = member->type;
+		temp_member.offset   = member->offset[DL_PTR_SIZE_HOST];
+		temp_member.size     = member->size[DL_PTR_SIZE_HOST];
+		temp_member.subindex = sub_type != 0x0 ? (uint32_t)( sub_type - ctx->type_descs ) : UINT32_MAX;
+		temp_member.subtype  = sub_type != 0x0 ? dl_internal_type_hot( ctx, sub_type ) : 0x0;
+	}
+
 	dl_patched_ptrs patched(ctx->alloc);
-	dl_internal_patch_member( ctx, member, member_data, base_address, patch_distance, patched_ptrs, &patched );
+	dl_internal_patch_member( ctx, member_hot, member_data, base_address, patch_distance, patched_ptrs, &patched );
 }
 
 void dl_internal_patch_instance( dl_ctx_t            ctx,
-								 const dl_type_desc* type,
+								 const dl_type_desc* type_desc,
 								 uint8_t*            instance,
 								 uintptr_t           base_address,
 								 uintptr_t           patch_distance )
 {
+	const dl_type_hot* type = dl_internal_type_hot( ctx, type_desc );
+	if( type == 0x0 )
+		return;
+
 	dl_patched_ptrs patched(ctx->alloc);
 	patched.add( (uintptr_t)instance );
 
@@ -272,8 +293,8 @@ void dl_internal_patch_instance( dl_ctx_t            ctx,
 	{
 		for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
 		{
-			const dl_member_desc* member = dl_get_type_member( ctx, type, member_index );
-			uint8_t*   member_data = instance + member->offset[DL_PTR_SIZE_HOST];
+			const dl_member_hot* member = type->members + member_index;
+			uint8_t*   member_data = instance + member->offset;
 
 			dl_internal_patch_member( ctx, member, member_data, base_address, patch_distance, 0, &patched );
 		}
@@ -0,0 +1,817 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include "dl_path.h"
+#include "dl_ptr_map.h"
+
+#include <dl/dl.h>
+#include <dl/dl_path.h>
+
+static inline bool dl_path_is_name_char( char c )
+{
+	return ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' ) || ( c >= '0' && c <= '9' ) || c == '_';
+}
+
+static const dl_member_hot* dl_path_find_member( dl_ctx_t ctx, const dl_type_hot* type, const char* name, size_t name_len )
+{
+	for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+	{
+		const dl_member_hot* member      = type->members + member_index;
+		const char*          member_name = dl_internal_member_name( ctx, dl_internal_member_desc_of( ctx, member ) );
+		if( strncmp( member_name, name, name_len ) == 0 && member_name[name_len] == '\0' )
+			return member;
+	}
+	return 0x0;
+}
+
+static void dl_path_add_offset( CArrayStatic<dl_path_step, 16>* steps, uint32_t offset )
+{
+	if( offset == 0 )
+		return;
+
+	// ... members of members and elements of inline arrays is one step ...
+	size_t count = steps->Len();
+	if( count > 0 && (*steps)[count - 1].op == DL_PATH_OP_OFFSET )
+	{
+		(*steps)[count - 1].offset += offset;
+		return;
+	}
+
+	dl_path_step step = { DL_PATH_OP_OFFSET, offset, 0 };
+	steps->Add( step );
+}
+
+static inline uint32_t dl_path_elem_size( dl_type_storage_t storage, const dl_type_hot* subtype )
+{
+	return storage == DL_TYPE_STORAGE_STRUCT ? dl_internal_align_up( subtype->size, subtype->alignment ) : (uint32_t)dl_pod_size( storage );
+}
+
+dl_error_t dl_internal_path_compile( dl_ctx_t                        ctx,
+                                     const dl_type_hot*              type,
+                                     const char*                     path,
+                                     CArrayStatic<dl_path_step, 16>* steps,
+                                     dl_member_hot*                  value )
+{
+	memset( value, 0x0, sizeof( dl_member_hot ) );
+	value->type     = (dl_type_t)( ( DL_TYPE_ATOM_POD << DL_TYPE_ATOM_MIN_BIT ) | ( DL_TYPE_STORAGE_STRUCT << DL_TYPE_STORAGE_MIN_BIT ) );
+	value->size     = type->size;
+	value->subindex = (uint32_t)( type - ctx->type_hots );
+	value->subtype  = type;
+
+	const char* iter = path;
+	while( *iter != '\0' )
+	{
+		dl_type_atom_t    atom    = value->AtomType();
+		dl_type_storage_t storage = value->StorageType();
+
+		if( *iter == '[' )
+		{
+			++iter;
+			uint64_t index = 0;
+			const char* digits = iter;
+			for( ; *iter >= '0' && *iter <= '9' && index <= 0xFFFFFFFF; ++iter )
+				index = index * 10 + (uint64_t)( *iter - '0' );
+			if( iter == digits || *iter != ']' || index > 0xFFFFFFFF )
+			{
+				dl_log_error( ctx, "invalid index in member-path \"%s\"", path );
+				return DL_ERROR_INVALID_PARAMETER;
+			}
+			++iter;
+
+			if( atom != DL_TYPE_ATOM_ARRAY && atom != DL_TYPE_ATOM_INLINE_ARRAY )
+			{
+				dl_log_error( ctx, "indexing a member that is not an array in member-path \"%s\"", path );
+				return DL_ERROR_MEMBER_NOT_FOUND;
+			}
+			if( storage == DL_TYPE_STORAGE_STRUCT && value->subtype == 0x0 )
+				return DL_ERROR_TYPE_NOT_FOUND;
+
+			uint32_t elem_size = dl_path_elem_size( storage, value->subtype );
+			if( atom == DL_TYPE_ATOM_INLINE_ARRAY )
+			{
+				if( index >= value->size / elem_size )
+				{
+					dl_log_error( ctx, "index " DL_UINT64_FMT_STR " is outside of inline array in member-path \"%s\"", index, path );
+					return DL_ERROR_MEMBER_NOT_FOUND;
+				}
+				dl_path_add_offset( steps, (uint32_t)index * elem_size );
+			}
+			else
+			{
+				dl_path_step step = { DL_PATH_OP_ARRAY, elem_size, (uint32_t)index };
+				steps->Add( step );
+			}
+
+			value->type = (dl_type_t)( ( DL_TYPE_ATOM_POD << DL_TYPE_ATOM_MIN_BIT ) | ( storage << DL_TYPE_STORAGE_MIN_BIT ) );
+			value->size = elem_size;
+			continue;
+		}
+
+		if( iter != path )
+		{
+			if( *iter != '.' )
+			{
+				dl_log_error( ctx, "expected '.' or '[' at \"%s\" in member-path \"%s\"", iter, path );
+				return DL_ERROR_INVALID_PARAMETER;
+			}
+			++iter;
+		}
+
+		const char* name = iter;
+		while( dl_path_is_name_char( *iter ) )
+			++iter;
+		size_t name_len = (size_t)( iter - name );
+		if( name_len == 0 )
+		{
+			dl_log_error( ctx, "expected member name at \"%s\" in member-path \"%s\"", name, path );
+			return DL_ERROR_INVALID_PARAMETER;
+		}
+
+		if( atom != DL_TYPE_ATOM_POD || ( storage != DL_TYPE_STORAGE_STRUCT && storage != DL_TYPE_STORAGE_PTR ) )
+		{
+			dl_log_error( ctx, "member \"%.*s\" in member-path \"%s\" is not in a struct", (int)name_len, name, path );
+			return DL_ERROR_MEMBER_NOT_FOUND;
+		}
+
+		const dl_type_hot* struct_type = value->subtype;
+		if( struct_type == 0x0 )
+			return DL_ERROR_TYPE_NOT_FOUND;
+
+		const dl_member_hot* member = dl_path_find_member( ctx, struct_type, name, name_len );
+		if( member == 0x0 )
+		{
+			dl_log_error( ctx, "type %s has no member \"%.*s\", in member-path \"%s\"",
+			              dl_internal_type_name( ctx, dl_internal_type_desc_of( ctx, struct_type ) ), (int)name_len, name, path );
+			return DL_ERROR_MEMBER_NOT_FOUND;
+		}
+
+		if( storage == DL_TYPE_STORAGE_PTR )
+		{
+			dl_path_step step = { DL_PATH_OP_PTR, 0, 0 };
+			steps->Add( step );
+		}
+
+		if( struct_type->flags & DL_TYPE_FLAG_IS_UNION )
+		{
+			// ... type is typeid + member_index + 1, see dl_internal_union_type_to_member() ...
+			uint32_t     union_type = ctx->type_ids[ struct_type - ctx->type_hots ] + (uint32_t)( member - struct_type->members ) + 1;
+			dl_path_step step       = { DL_PATH_OP_UNION, struct_type->union_type_offset[DL_PTR_SIZE_HOST], union_type };
+			steps->Add( step );
+		}
+
+		dl_path_add_offset( steps, member->offset );
+		*value        = *member;
+		value->offset = 0;
+	}
+
+	return DL_ERROR_OK;
+}
+
+struct dl_path_load_item
+{
+	const dl_type_hot* type;
+	uintptr_t          src;
+	size_t             dst;
+	uint32_t           count;
+};
+
+struct dl_path_load_ctx
+{
+	explicit dl_path_load_ctx( dl_ctx_t dl_ctx )
+		: ctx( dl_ctx )
+		, copied( dl_ctx->alloc )
+		, work( dl_ctx->alloc )
+	{
+	}
+
+	dl_ctx_t       ctx;
+	const uint8_t* base;        ///< all offsets in the packed instance are relative to base.
+	uintptr_t      begin;       ///< offset of the root instance.
+	uintptr_t      end;         ///< offset of the end of the instance.
+	uintptr_t      offset_mask; ///< mask to get the offset from a stored ptr, removes the offset to the next ptr in the ptr-chain.
+	uint8_t*       out;
+	size_t         out_size;
+	size_t         pos;         ///< bytes produced in out, also when out is too small.
+	dl_ptr_map     copied;      ///< offset of struct or string in the packed instance -> position of copy in out.
+
+	CArrayStatic<dl_path_load_item, 64> work; ///< arrays and structs pointed to that is copied but not patched.
+};
+
+static inline bool dl_path_load_in_range( dl_path_load_ctx* lctx, uintptr_t offset, uint64_t size )
+{
+	return offset >= lctx->begin && offset <= lctx->end && size <= lctx->end - offset;
+}
+
+// ... offsets in the packed instance is not trusted to be aligned so all reads from it is done with memcpy ...
+static inline uintptr_t dl_path_load_read_ptr( dl_path_load_ctx* lctx, uintptr_t src )
+{
+	uintptr_t offset;
+	memcpy( &offset, lctx->base + src, sizeof( offset ) );
+	return offset & lctx->offset_mask;
+}
+
+static inline uint32_t dl_path_load_read_uint32( dl_path_load_ctx* lctx, uintptr_t src )
+{
+	uint32_t value;
+	memcpy( &value, lctx->base + src, sizeof( value ) );
+	return value;
+}
+
+static inline void dl_path_load_write_ptr( dl_path_load_ctx* lctx, size_t dst, size_t target, bool null )
+{
+	if( dst + sizeof( void* ) <= lctx->out_size )
+		*(uint8_t**)( lctx->out + dst ) = null ? 0x0 : lctx->out + target;
+}
+
+// ... reserve size bytes in out and copy them from offset in the packed instance if out is large enough ...
+static dl_error_t dl_path_load_copy( dl_path_load_ctx* lctx, uintptr_t offset, uint64_t size, size_t alignment, size_t* dst )
+{
+	if( !dl_path_load_in_range( lctx, offset, size ) )
+	{
+		dl_log_error( lctx->ctx, "malformed instance, data at offset " DL_UINT64_FMT_STR " is outside of instance", (uint64_t)offset );
+		return DL_ERROR_MALFORMED_DATA;
+	}
+
+	*dst = dl_internal_align_up( lctx->pos, alignment );
+	lctx->pos = *dst + (size_t)size;
+	if( lctx->pos <= lctx->out_size )
+		memcpy( lctx->out + *dst, lctx->base + offset, (size_t)size );
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_path_load_str( dl_path_load_ctx* lctx, uintptr_t src, size_t dst )
+{
+	uintptr_t offset = dl_path_load_read_ptr( lctx, src );
+	if( offset == 0 )
+	{
+		dl_path_load_write_ptr( lctx, dst, 0, true );
+		return DL_ERROR_OK;
+	}
+
+	uintptr_t copy;
+	if( !lctx->copied.find( offset, &copy ) )
+	{
+		const void* terminator = dl_path_load_in_range( lctx, offset, 0 ) ? memchr( lctx->base + offset, '\0', lctx->end - offset ) : 0x0;
+		if( terminator == 0x0 )
+		{
+			dl_log_error( lctx->ctx, "malformed instance, string at offset " DL_UINT64_FMT_STR " is not terminated", (uint64_t)offset );
+			return DL_ERROR_MALFORMED_DATA;
+		}
+
+		size_t str_dst;
+		dl_error_t err = dl_path_load_copy( lctx, offset, (uint64_t)( (const uint8_t*)terminator - ( lctx->base + offset ) ) + 1, 1, &str_dst );
+		if( DL_ERROR_OK != err )
+			return err;
+		copy = str_dst;
+		lctx->copied.insert( offset, copy );
+	}
+	dl_path_load_write_ptr( lctx, dst, copy, false );
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_path_load_ptr( dl_path_load_ctx* lctx, const dl_type_hot* subtype, uintptr_t src, size_t dst )
+{
+	uintptr_t offset = dl_path_load_read_ptr( lctx, src );
+	if( offset == 0 )
+	{
+		dl_path_load_write_ptr( lctx, dst, 0, true );
+		return DL_ERROR_OK;
+	}
+
+	uintptr_t copy;
+	if( !lctx->copied.find( offset, &copy ) )
+	{
+		size_t struct_dst;
+		dl_error_t err = dl_path_load_copy( lctx, offset, subtype->size, subtype->alignment, &struct_dst );
+		if( DL_ERROR_OK != err )
+			return err;
+		copy = struct_dst;
+		lctx->copied.insert( offset, copy );
+
+		if( subtype->flags & DL_TYPE_FLAG_HAS_SUBDATA )
+		{
+			dl_path_load_item item = { subtype, offset, struct_dst, 1 };
+			lctx->work.Add( item );
+		}
+	}
+	dl_path_load_write_ptr( lctx, dst, copy, false );
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_path_load_struct( dl_path_load_ctx* lctx, const dl_type_hot* type, uintptr_t src, size_t dst );
+
+static dl_error_t dl_path_load_elements( dl_path_load_ctx* lctx, dl_type_storage_t storage, const dl_type_hot* subtype, uintptr_t src, size_t dst, uint32_t count )
+{
+	switch( storage )
+	{
+		case DL_TYPE_STORAGE_STR:
+			for( uint32_t index = 0; index < count; ++index )
+			{
+				dl_error_t err = dl_path_load_str( lctx, src + index * sizeof( void* ), dst + index * sizeof( void* ) );
+				if( DL_ERROR_OK != err )
+					return err;
+			}
+			break;
+		case DL_TYPE_STORAGE_PTR:
+			for( uint32_t index = 0; index < count; ++index )
+			{
+				dl_error_t err = dl_path_load_ptr( lctx, subtype, src + index * sizeof( void* ), dst + index * sizeof( void* ) );
+				if( DL_ERROR_OK != err )
+					return err;
+			}
+			break;
+		case DL_TYPE_STORAGE_STRUCT:
+			if( subtype->flags & DL_TYPE_FLAG_HAS_SUBDATA )
+			{
+				dl_path_load_item item = { subtype, src, dst, count };
+				lctx->work.Add( item );
+			}
+			break;
+		default:
+			break;
+	}
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_path_load_member( dl_path_load_ctx* lctx, const dl_member_hot* member, uintptr_t src, size_t dst )
+{
+	dl_type_storage_t storage = member->StorageType();
+	if( ( storage == DL_TYPE_STORAGE_STRUCT || storage == DL_TYPE_STORAGE_PTR ) && member->subtype == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	switch( member->AtomType() )
+	{
+		case DL_TYPE_ATOM_POD:
+			switch( storage )
+			{
+				case DL_TYPE_STORAGE_STR:    return dl_path_load_str( lctx, src, dst );
+				case DL_TYPE_STORAGE_PTR:    return dl_path_load_ptr( lctx, member->subtype, src, dst );
+				case DL_TYPE_STORAGE_STRUCT: return dl_path_load_struct( lctx, member->subtype, src, dst );
+				default:
+					return DL_ERROR_OK;
+			}
+
+		case DL_TYPE_ATOM_INLINE_ARRAY:
+			return dl_path_load_elements( lctx, storage, member->subtype, src, dst, member->inline_array_cnt() );
+
+		case DL_TYPE_ATOM_ARRAY:
+		{
+			uintptr_t offset = dl_path_load_read_ptr( lctx, src );
+			uint32_t  count  = dl_path_load_read_uint32( lctx, src + sizeof( void* ) );
+			if( offset == 0 || count == 0 )
+			{
+				dl_path_load_write_ptr( lctx, dst, 0, true );
+				return DL_ERROR_OK;
+			}
+
+			uint32_t elem_size = dl_path_elem_size( storage, member->subtype );
+			size_t   alignment = storage == DL_TYPE_STORAGE_STRUCT ? member->subtype->alignment : elem_size;
+			size_t   array_dst;
+			dl_error_t err = dl_path_load_copy( lctx, offset, (uint64_t)elem_size * count, alignment, &array_dst );
+			if( DL_ERROR_OK != err )
+				return err;
+			dl_path_load_write_ptr( lctx, dst, array_dst, false );
+			return dl_path_load_elements( lctx, storage, member->subtype, offset, array_dst, count );
+		}
+
+		default:
+			return DL_ERROR_OK;
+	}
+}
+
+static dl_error_t dl_path_load_struct( dl_path_load_ctx* lctx, const dl_type_hot* type, uintptr_t src, size_t dst )
+{
+	if( ( type->flags & DL_TYPE_FLAG_HAS_SUBDATA ) == 0 )
+		return DL_ERROR_OK;
+
+	if( type->flags & DL_TYPE_FLAG_IS_UNION )
+	{
+		uint32_t union_type = dl_path_load_read_uint32( lctx, src + type->union_type_offset[DL_PTR_SIZE_HOST] );
+		const dl_member_hot* member = dl_internal_union_type_to_member_hot( lctx->ctx, type, union_type );
+		if( member == 0x0 )
+		{
+			dl_log_error( lctx->ctx, "malformed instance, invalid union type-tag at offset " DL_UINT64_FMT_STR, (uint64_t)src );
+			return DL_ERROR_MALFORMED_DATA;
+		}
+		return dl_path_load_member( lctx, member, src, dst );
+	}
+
+	for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+	{
+		const dl_member_hot* member = type->members + member_index;
+		dl_error_t err = dl_path_load_member( lctx, member, src + member->offset, dst + member->offset );
+		if( DL_ERROR_OK != err )
+			return err;
+	}
+	return DL_ERROR_OK;
+}
+
+// ... move src from the root instance to the value at the end of the path, only reading what the steps touch ...
+static dl_error_t dl_path_load_walk( dl_path_load_ctx* lctx, const char* path, CArrayStatic<dl_path_step, 16>* steps, uintptr_t* src )
+{
+	uintptr_t addr = lctx->begin;
+	for( size_t i = 0; i < steps->Len(); ++i )
+	{
+		const dl_path_step& step = (*steps)[i];
+		switch( step.op )
+		{
+			case DL_PATH_OP_OFFSET:
+				addr += step.offset;
+				break;
+			case DL_PATH_OP_PTR:
+				if( !dl_path_load_in_range( lctx, addr, sizeof( void* ) ) )
+					return DL_ERROR_MALFORMED_DATA;
+				addr = dl_path_load_read_ptr( lctx, addr );
+				if( addr == 0 )
+				{
+					dl_log_error( lctx->ctx, "null ptr in member-path \"%s\"", path );
+					return DL_ERROR_MEMBER_NOT_FOUND;
+				}
+				break;
+			case DL_PATH_OP_ARRAY:
+			{
+				if( !dl_path_load_in_range( lctx, addr, sizeof( void* ) + sizeof( uint32_t ) ) )
+					return DL_ERROR_MALFORMED_DATA;
+				uint32_t count = dl_path_load_read_uint32( lctx, addr + sizeof( void* ) );
+				if( step.index >= count )
+				{
+					dl_log_error( lctx->ctx, "index %u is outside of array with %u elements in member-path \"%s\"", step.index, count, path );
+					return DL_ERROR_MEMBER_NOT_FOUND;
+				}
+				addr = dl_path_load_read_ptr( lctx, addr ) + (uintptr_t)step.index * step.offset;
+				break;
+			}
+			case DL_PATH_OP_UNION:
+				if( !dl_path_load_in_range( lctx, addr + step.offset, sizeof( uint32_t ) ) )
+					return DL_ERROR_MALFORMED_DATA;
+				if( dl_path_load_read_uint32( lctx, addr + step.offset ) != step.index )
+				{
+					dl_log_error( lctx->ctx, "union member in member-path \"%s\" is not the member set in the union", path );
+					return DL_ERROR_MEMBER_NOT_FOUND;
+				}
+				break;
+		}
+	}
+	*src = addr;
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_instance_load_path( dl_ctx_t             dl_ctx,          dl_typeid_t type_id,
+                                  const char*          path,
+                                  void*                out_value,       size_t      out_value_size,
+                                  const unsigned char* packed_instance, size_t      packed_instance_size,
+                                  size_t*              produced_bytes )
+{
+	const dl_data_header* header = (const dl_data_header*)packed_instance;
+
+	if( packed_instance_size < sizeof(dl_data_header) ) return DL_ERROR_MALFORMED_DATA;
+	if( header->id == DL_INSTANCE_ID_SWAPED )           return DL_ERROR_ENDIAN_MISMATCH;
+	if( header->id != DL_INSTANCE_ID )                  return DL_ERROR_MALFORMED_DATA;
+	if( header->version != DL_INSTANCE_VERSION )        return DL_ERROR_VERSION_MISMATCH;
+	if( header->root_instance_type != type_id )         return DL_ERROR_TYPE_MISMATCH;
+
+	const dl_type_desc* root_type = dl_internal_find_type( dl_ctx, type_id );
+	const dl_type_hot*  root_hot  = root_type != 0x0 ? dl_internal_type_hot( dl_ctx, root_type ) : 0x0;
+	if( root_hot == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	size_t header_offset = dl_internal_align_up( sizeof( dl_data_header ), root_hot->alignment );
+	if( !dl_internal_instance_fits_host( header, packed_instance_size, header_offset ) )
+		return DL_ERROR_MALFORMED_DATA;
+
+	CArrayStatic<dl_path_step, 16> steps( dl_ctx->alloc );
+	dl_member_hot value;
+	dl_error_t err = dl_internal_path_compile( dl_ctx, root_hot, path, &steps, &value );
+	if( DL_ERROR_OK != err )
+		return err;
+	if( value.AtomType() == DL_TYPE_ATOM_BITFIELD )
+	{
+		dl_log_error( dl_ctx, "member-path \"%s\" end in a bitfield-member that can not be loaded by itself", path );
+		return DL_ERROR_UNSUPPORTED_OPERATION;
+	}
+
+	dl_path_load_ctx lctx( dl_ctx );
+	lctx.base        = packed_instance;
+	lctx.begin       = header_offset;
+	lctx.end         = header_offset + header->instance_size;
+	lctx.offset_mask = header->not_using_ptr_chain_patching ? ~(uintptr_t)0 : ( (uintptr_t)1 << ( sizeof( uintptr_t ) * 4 ) ) - 1;
+	lctx.out         = (uint8_t*)out_value;
+	lctx.out_size    = out_value_size;
+	lctx.pos         = 0;
+
+	uintptr_t src;
+	err = dl_path_load_walk( &lctx, path, &steps, &src );
+	if( DL_ERROR_OK != err )
+		return err;
+
+	size_t dst;
+	err = dl_path_load_copy( &lctx, src, value.size, 1, &dst );
+	if( DL_ERROR_OK != err )
+		return err;
+
+	// ... ptrs back to a loaded struct point to the loaded value ...
+	if( value.AtomType() == DL_TYPE_ATOM_POD && value.StorageType() == DL_TYPE_STORAGE_STRUCT )
+		lctx.copied.insert( src, dst );
+
+	err = dl_path_load_member( &lctx, &value, src, dst );
+	while( DL_ERROR_OK == err && lctx.work.Len() > 0 )
+	{
+		dl_path_load_item item   = lctx.work.Pop();
+		size_t            stride = dl_internal_align_up( item.type->size, item.type->alignment );
+		for( uint32_t index = 0; index < item.count && DL_ERROR_OK == err; ++index )
+			err = dl_path_load_struct( &lctx, item.type, item.src + index * stride, item.dst + index * stride );
+	}
+	if( DL_ERROR_OK != err )
+		return err;
+
+	if( produced_bytes )
+		*produced_bytes = lctx.pos;
+
+	if( out_value_size > 0 && lctx.pos > out_value_size )
+		return DL_ERROR_BUFFER_TOO_SMALL;
+
+	return DL_ERROR_OK;
+}
+
+struct dl_path
+{
+	dl_allocator   alloc;
+	dl_path_info_t info;
+	uint32_t       bits;       ///< bits in bitfield-member, size of member in bits for other members.
+	uint32_t       bit_offset; ///< offset of bitfield-member in the integer that hold it on host.
+	uint32_t       step_count;
+	dl_path_step*  steps;      ///< stored right after the dl_path in the same allocation.
+};
+
+dl_error_t dl_path_compile( dl_ctx_t dl_ctx, dl_typeid_t type_id, const char* path, dl_path_t* out_path )
+{
+	const dl_type_desc* type_desc = dl_internal_find_type( dl_ctx, type_id );
+	const dl_type_hot*  type      = type_desc != 0x0 ? dl_internal_type_hot( dl_ctx, type_desc ) : 0x0;
+	if( type == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	CArrayStatic<dl_path_step, 16> steps( dl_ctx->alloc );
+	dl_member_hot value;
+	dl_error_t err = dl_internal_path_compile( dl_ctx, type, path, &steps, &value );
+	if( DL_ERROR_OK != err )
+		return err;
+
+	dl_path* compiled = (dl_path*)dl_alloc( &dl_ctx->alloc, sizeof( dl_path ) + sizeof( dl_path_step ) * steps.Len() );
+	if( compiled == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+
+	dl_type_atom_t    atom    = value.AtomType();
+	dl_type_storage_t storage = value.StorageType();
+
+	compiled->alloc            = dl_ctx->alloc;
+	compiled->info.atom        = atom;
+	compiled->info.storage     = storage;
+	compiled->info.type_id     = 0;
+	compiled->info.size        = value.size;
+	compiled->info.array_count = 0;
+	compiled->info.generation  = dl_ctx->generation;
+	if( value.subindex != UINT32_MAX )
+	{
+		if( storage == DL_TYPE_STORAGE_STRUCT || storage == DL_TYPE_STORAGE_PTR )
+			compiled->info.type_id = dl_ctx->type_ids[value.subindex];
+		else if( storage >= DL_TYPE_STORAGE_ENUM_INT8 && storage <= DL_TYPE_STORAGE_ENUM_UINT64 )
+			compiled->info.type_id = dl_ctx->enum_ids[value.subindex];
+	}
+	if( atom == DL_TYPE_ATOM_INLINE_ARRAY )
+		compiled->info.array_count = value.size / dl_path_elem_size( storage, value.subtype );
+
+	compiled->bits       = value.size * 8;
+	compiled->bit_offset = 0;
+	if( atom == DL_TYPE_ATOM_BITFIELD )
+	{
+		compiled->bits       = ( (uint32_t)value.type & DL_TYPE_BITFIELD_SIZE_MASK ) >> DL_TYPE_BITFIELD_SIZE_MIN_BIT;
+		compiled->bit_offset = dl_bf_offset( DL_ENDIAN_HOST,
+		                                     value.size,
+		                                     ( (uint32_t)value.type & DL_TYPE_BITFIELD_OFFSET_MASK ) >> DL_TYPE_BITFIELD_OFFSET_MIN_BIT,
+		                                     compiled->bits );
+	}
+
+	compiled->step_count = (uint32_t)steps.Len();
+	compiled->steps      = (dl_path_step*)( compiled + 1 );
+	if( steps.Len() > 0 )
+		memcpy( compiled->steps, &steps[0], sizeof( dl_path_step ) * steps.Len() );
+
+	*out_path = compiled;
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_path_destroy( dl_path_t path )
+{
+	dl_allocator alloc = path->alloc;
+	dl_free( &alloc, path );
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_path_get_info( dl_path_t path, dl_path_info_t* out_info )
+{
+	*out_info = path->info;
+	return DL_ERROR_OK;
+}
+
+void* dl_path_resolve( dl_path_t path, void* instance )
+{
+	uint8_t* addr = (uint8_t*)instance;
+	for( uint32_t i = 0; i < path->step_count; ++i )
+	{
+		const dl_path_step& step = path->steps[i];
+		switch( step.op )
+		{
+			case DL_PATH_OP_OFFSET:
+				addr += step.offset;
+				break;
+			case DL_PATH_OP_PTR:
+				addr = *(uint8_t**)addr;
+				if( addr == 0x0 )
+					return 0x0;
+				break;
+			case DL_PATH_OP_ARRAY:
+				if( step.index >= *(uint32_t*)( addr + sizeof( void* ) ) )
+					return 0x0;
+				addr = *(uint8_t**)addr + (size_t)step.index * step.offset;
+				break;
+			case DL_PATH_OP_UNION:
+				if( *(uint32_t*)( addr + step.offset ) != step.index )
+					return 0x0;
+				break;
+		}
+	}
+	return addr;
+}
+
+static inline uint64_t dl_path_read_uint( const uint8_t* value, uint32_t size )
+{
+	switch( size )
+	{
+		case 1:  return *(const uint8_t*)value;
+		case 2:  return *(const uint16_t*)value;
+		case 4:  return *(const uint32_t*)value;
+		default: return *(const uint64_t*)value;
+	}
+}
+
+static inline void dl_path_write_uint( uint8_t* value, uint32_t size, uint64_t raw )
+{
+	switch( size )
+	{
+		case 1:  *(uint8_t*)value  = (uint8_t)raw;  break;
+		case 2:  *(uint16_t*)value = (uint16_t)raw; break;
+		case 4:  *(uint32_t*)value = (uint32_t)raw; break;
+		default: *(uint64_t*)value = raw;           break;
+	}
+}
+
+// ... resolve an integer-, enum- or bitfield-member ...
+static dl_error_t dl_path_resolve_int( dl_path_t path, const void* instance, uint8_t** value, bool* is_signed )
+{
+	dl_type_storage_t storage = path->info.storage;
+	bool is_int  = storage <= DL_TYPE_STORAGE_UINT64 || ( storage >= DL_TYPE_STORAGE_ENUM_INT8 && storage <= DL_TYPE_STORAGE_ENUM_UINT64 );
+	if( !is_int || ( path->info.atom != DL_TYPE_ATOM_POD && path->info.atom != DL_TYPE_ATOM_BITFIELD ) )
+		return DL_ERROR_TYPE_MISMATCH;
+
+	*value = (uint8_t*)dl_path_resolve( path, (void*)instance );
+	if( *value == 0x0 )
+		return DL_ERROR_MEMBER_NOT_FOUND;
+
+	*is_signed = storage <= DL_TYPE_STORAGE_INT64 || ( storage >= DL_TYPE_STORAGE_ENUM_INT8 && storage <= DL_TYPE_STORAGE_ENUM_INT64 );
+	return DL_ERROR_OK;
+}
+
+// ... read an integer-member, sign-extended to 64 bits if signed ...
+static dl_error_t dl_path_read_int( dl_path_t path, const void* instance, uint64_t* raw, bool* is_signed )
+{
+	uint8_t* value;
+	dl_error_t err = dl_path_resolve_int( path, instance, &value, is_signed );
+	if( DL_ERROR_OK != err )
+		return err;
+
+	*raw = dl_path_read_uint( value, path->info.size );
+	if( path->info.atom == DL_TYPE_ATOM_BITFIELD )
+		*raw = DL_EXTRACT_BITS( *raw, (uint64_t)path->bit_offset, (uint64_t)path->bits );
+	else if( *is_signed && path->bits < 64 )
+		*raw = (uint64_t)( (int64_t)( *raw << ( 64 - path->bits ) ) >> ( 64 - path->bits ) );
+	return DL_ERROR_OK;
+}
+
+// ... write an integer-member, raw is the value as two-complement 64 bit that is known to fit ...
+static void dl_path_write_int( dl_path_t path, uint8_t* value, uint64_t raw )
+{
+	if( path->info.atom == DL_TYPE_ATOM_BITFIELD )
+		raw = DL_INSERT_BITS( dl_path_read_uint( value, path->info.size ), raw, (uint64_t)path->bit_offset, (uint64_t)path->bits );
+	dl_path_write_uint( value, path->info.size, raw );
+}
+
+dl_error_t dl_path_get_int64( dl_path_t path, const void* instance, int64_t* out_value )
+{
+	uint64_t raw;
+	bool     is_signed;
+	dl_error_t err = dl_path_read_int( path, instance, &raw, &is_signed );
+	if( DL_ERROR_OK != err )
+		return err;
+	if( !is_signed && raw > (uint64_t)INT64_MAX )
+		return DL_ERROR_INVALID_PARAMETER;
+	*out_value = (int64_t)raw;
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_path_get_uint64( dl_path_t path, const void* instance, uint64_t* out_value )
+{
+	uint64_t raw;
+	bool     is_signed;
+	dl_error_t err = dl_path_read_int( path, instance, &raw, &is_signed );
+	if( DL_ERROR_OK != err )
+		return err;
+	if( is_signed && (int64_t)raw < 0 )
+		return DL_ERROR_INVALID_PARAMETER;
+	*out_value = raw;
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_path_set_uint64( dl_path_t path, void* instance, uint64_t value )
+{
+	uint8_t* member;
+	bool     is_signed;
+	dl_error_t err = dl_path_resolve_int( path, instance, &member, &is_signed );
+	if( DL_ERROR_OK != err )
+		return err;
+
+	uint32_t value_bits = is_signed ? path->bits - 1 : path->bits;
+	if( value_bits < 64 && value > DL_BITMASK( (uint64_t)value_bits ) )
+		return DL_ERROR_INVALID_PARAMETER;
+
+	dl_path_write_int( path, member, value );
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_path_set_int64( dl_path_t path, void* instance, int64_t value )
+{
+	if( value >= 0 )
+		return dl_path_set_uint64( path, instance, (uint64_t)value );
+
+	uint8_t* member;
+	bool     is_signed;
+	dl_error_t err = dl_path_resolve_int( path, instance, &member, &is_signed );
+	if( DL_ERROR_OK != err )
+		return err;
+
+	// ... -value need to fit in bits - 1, compared as unsigned to handle INT64_MIN ...
+	if( !is_signed || ( path->bits < 64 && (uint64_t)0 - (uint64_t)value > ( (uint64_t)1 << ( path->bits - 1 ) ) ) )
+		return DL_ERROR_INVALID_PARAMETER;
+
+	dl_path_write_int( path, member, (uint64_t)value );
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_path_resolve_pod( dl_path_t path, const void* instance, dl_type_storage_t storage, dl_type_storage_t storage2, uint8_t** value )
+{
+	if( path->info.atom != DL_TYPE_ATOM_POD || ( path->info.storage != storage && path->info.storage != storage2 ) )
+		return DL_ERROR_TYPE_MISMATCH;
+	*value = (uint8_t*)dl_path_resolve( path, (void*)instance );
+	return *value == 0x0 ? DL_ERROR_MEMBER_NOT_FOUND : DL_ERROR_OK;
+}
+
+dl_error_t dl_path_get_fp64( dl_path_t path, const void* instance, double* out_value )
+{
+	uint8_t* value;
+	dl_error_t err = dl_path_resolve_pod( path, instance, DL_TYPE_STORAGE_FP32, DL_TYPE_STORAGE_FP64, &value );
+	if( DL_ERROR_OK != err )
+		return err;
+	*out_value = path->info.storage == DL_TYPE_STORAGE_FP32 ? (double)*(float*)value : *(double*)value;
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_path_set_fp64( dl_path_t path, void* instance, double value )
+{
+	uint8_t* member;
+	dl_error_t err = dl_path_resolve_pod( path, instance, DL_TYPE_STORAGE_FP32, DL_TYPE_STORAGE_FP64, &member );
+	if( DL_ERROR_OK != err )
+		return err;
+	if( path->info.storage == DL_TYPE_STORAGE_FP32 )
+		*(float*)member = (float)value;
+	else
+		*(double*)member = value;
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_path_get_str( dl_path_t path, const void* instance, const char** out_value )
+{
+	uint8_t* value;
+	dl_error_t err = dl_path_resolve_pod( path, instance, DL_TYPE_STORAGE_STR, DL_TYPE_STORAGE_STR, &value );
+	if( DL_ERROR_OK != err )
+		return err;
+	*out_value = *(const char**)value;
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_path_set_str( dl_path_t path, void* instance, const char* value )
+{
+	uint8_t* member;
+	dl_error_t err = dl_path_resolve_pod( path, instance, DL_TYPE_STORAGE_STR, DL_TYPE_STORAGE_STR, &member );
+	if( DL_ERROR_OK != err )
+		return err;
+	*(const char**)member = value;
+	return DL_ERROR_OK;
+}
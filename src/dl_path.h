@@ -0,0 +1,48 @@
+#ifndef DL_PATH_H_INCLUDED
+#define DL_PATH_H_INCLUDED
+
+#include "dl_types.h"
+
+/*
+	A member-path is a list of member names separated by '.' with "[index]" to select an element of an array or
+	inline array, i.e. "header.version" or "items[3].name". Members of structs pointed to are reached through the
+	ptr-member, "next.value". An empty path is the instance itself.
+
+	A path is compiled against a type to a list of steps that is executed from the address of the instance, each
+	step move the address to the next member or element.
+*/
+
+enum dl_path_op
+{
+	DL_PATH_OP_OFFSET, ///< address += offset.
+	DL_PATH_OP_PTR,    ///< address = *(void**)address, fail on null.
+	DL_PATH_OP_ARRAY,  ///< address = array.data + index * offset, fail if index >= array.count.
+	DL_PATH_OP_UNION   ///< fail if the union type-tag at address + offset is not index.
+};
+
+struct dl_path_step
+{
+	uint32_t op;
+	uint32_t offset; ///< DL_PATH_OP_OFFSET bytes to add, DL_PATH_OP_ARRAY element size, DL_PATH_OP_UNION offset of type-tag.
+	uint32_t index;  ///< DL_PATH_OP_ARRAY element index, DL_PATH_OP_UNION expected type-tag.
+};
+
+/**
+ * Compile a member-path against a type.
+ *
+ * @param ctx dl-context containing type and all types used in it.
+ * @param type type of the instance the path start in.
+ * @param path member-path to compile.
+ * @param steps the compiled steps are added here.
+ * @param value set to a member describing the value at the end of the path, with offset 0. For elements of
+ *              arrays it is a member of the element type, for an empty path a struct-member of type.
+ * @return DL_ERROR_OK on success, DL_ERROR_INVALID_PARAMETER if path can not be parsed and
+ *         DL_ERROR_MEMBER_NOT_FOUND if a member do not exist or is not a struct, ptr or array where the path need one.
+ */
+dl_error_t dl_internal_path_compile( dl_ctx_t                           ctx,
+                                     const dl_type_hot*                 type,
+                                     const char*                        path,
+                                     CArrayStatic<dl_path_step, 16>*    steps,
+                                     dl_member_hot*                     value );
+
+#endif // DL_PATH_H_INCLUDED
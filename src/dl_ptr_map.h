@@ -0,0 +1,125 @@
+#ifndef DL_PTR_MAP_H_INCLUDED
+#define DL_PTR_MAP_H_INCLUDED
+
+#include "dl_types.h"
+
+/**
+ * Open addressing hash map from an address to a value, used to track pointers already seen while walking
+ * an instance without a linear search per pointer.
+ *
+ * Address 0 is used to mark empty slots and can not be stored in the map.
+ */
+struct dl_ptr_map
+{
+	struct entry
+	{
+		uintptr_t key;
+		uintptr_t value;
+	};
+
+	entry*       entries;
+	size_t       capacity; // always 0 or a power of 2
+	size_t       count;
+	dl_allocator alloc;
+
+	explicit dl_ptr_map( dl_allocator allocator )
+		: entries( 0x0 )
+		, capacity( 0 )
+		, count( 0 )
+		, alloc( allocator )
+	{
+	}
+
+	~dl_ptr_map()
+	{
+		if( entries != 0x0 )
+			dl_free( &alloc, entries );
+	}
+
+	static DL_FORCEINLINE size_t hash( uintptr_t key )
+	{
+		uint64_t h = (uint64_t)key * 0x9E3779B97F4A7C15ULL;
+		return (size_t)( h ^ ( h >> 32 ) );
+	}
+
+	/**
+	 * Find the value stored for key.
+	 *
+	 * @param key address to look up.
+	 * @param value set to the found value if key is in the map, can be 0x0.
+	 * @return true if key was found.
+	 */
+	bool find( uintptr_t key, uintptr_t* value ) const
+	{
+		DL_ASSERT( key != 0 );
+		if( count == 0 )
+			return false;
+
+		size_t mask = capacity - 1;
+		for( size_t i = hash( key ) & mask; entries[i].key != 0; i = ( i + 1 ) & mask )
+		{
+			if( entries[i].key == key )
+			{
+				if( value )
+					*value = entries[i].value;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * Insert key into the map if it is not already there.
+	 *
+	 * @param key address to insert.
+	 * @param value value to store for key.
+	 * @return true if key was inserted, false if it was already in the map, in that case the old value is kept.
+	 */
+	bool insert( uintptr_t key, uintptr_t value )
+	{
+		DL_ASSERT( key != 0 );
+		if( ( count + 1 ) * 4 > capacity * 3 )
+			grow();
+
+		size_t mask = capacity - 1;
+		size_t i    = hash( key ) & mask;
+		for( ; entries[i].key != 0; i = ( i + 1 ) & mask )
+			if( entries[i].key == key )
+				return false;
+
+		entries[i].key   = key;
+		entries[i].value = value;
+		++count;
+		return true;
+	}
+
+private:
+	void grow()
+	{
+		size_t old_capacity = capacity;
+		entry* old_entries  = entries;
+
+		capacity = old_capacity == 0 ? 64 : old_capacity * 2;
+		entries  = (entry*)dl_alloc( &alloc, sizeof( entry ) * capacity );
+		memset( entries, 0x0, sizeof( entry ) * capacity );
+
+		size_t mask = capacity - 1;
+		for( size_t old = 0; old < old_capacity; ++old )
+		{
+			if( old_entries[old].key == 0 )
+				continue;
+			size_t i = hash( old_entries[old].key ) & mask;
+			while( entries[i].key != 0 )
+				i = ( i + 1 ) & mask;
+			entries[i] = old_entries[old];
+		}
+
+		if( old_entries != 0x0 )
+			dl_free( &alloc, old_entries );
+	}
+
+	dl_ptr_map( const dl_ptr_map& );
+	dl_ptr_map& operator=( const dl_ptr_map& );
+};
+
+#endif // DL_PTR_MAP_H_INCLUDED
@@ -10,6 +10,7 @@ dl_error_t dl_reflect_context_info( dl_ctx_t dl_ctx, dl_type_context_info_t* inf
 {
 	info->num_types = dl_ctx->type_count;
 	info->num_enums = dl_ctx->enum_count;
+	info->generation = dl_ctx->generation;
 	return DL_ERROR_OK;
 }
 
@@ -141,6 +141,7 @@ struct dl_txt_pack_ctx
 	explicit dl_txt_pack_ctx(dl_allocator alloc)
 	    : subdata(alloc)
 	    , ptrs(alloc)
+	    , regions(0x0)
 	{
 	}
 
@@ -156,6 +157,16 @@ struct dl_txt_pack_ctx
 	}; 
 	CArrayStatic<SSubData, 256> subdata;
 	dl_patched_ptrs ptrs;
+
+	// ... a block of data appended at the end of the written data, in the order they were appended ...
+	struct SRegion
+	{
+		size_t unaligned_pos;
+		size_t pos;
+		size_t align;
+		size_t stitched_pos;
+	};
+	CArrayStatic<SRegion, 16>* regions; // only set when packing part of an array as a job, see dl_txt_pack_parallel_struct_array().
 };
 
 static void dl_txt_pack_eat_and_write_int8( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx )
@@ -253,30 +264,37 @@ static void dl_txt_pack_eat_and_write_string( dl_ctx_t dl_ctx, dl_txt_pack_ctx*
 	size_t curr = dl_binary_writer_tell( packctx->writer );
 	dl_binary_writer_seek_end( packctx->writer );
 	size_t strpos = dl_binary_writer_tell( packctx->writer );
-	for( int i = 0; i < str.len; ++i )
+	const char* iter = str.str;
+	const char* end  = str.str + str.len;
+	while( iter != end )
 	{
-		if( str.str[i] == '\\' )
+		// ... copy everything up to the next escape-sequence in one go ...
+		const char* esc = (const char*)memchr( iter, '\\', (size_t)( end - iter ) );
+		if( esc == 0x0 )
 		{
-			++i;
-			switch( str.str[i] )
-			{
-				case '\'':
-				case '\"':
-				case '\\':
-					dl_binary_writer_write_uint8( packctx->writer, (uint8_t)str.str[i] );
-					break;
-				case 'n': dl_binary_writer_write_uint8( packctx->writer, '\n' ); break;
-				case 'r': dl_binary_writer_write_uint8( packctx->writer, '\r' ); break;
-				case 't': dl_binary_writer_write_uint8( packctx->writer, '\t' ); break;
-				case 'b': dl_binary_writer_write_uint8( packctx->writer, '\b' ); break;
-				case 'f': dl_binary_writer_write_uint8( packctx->writer, '\f' ); break;
-					break;
-				default:
-					DL_ASSERT( false && "unhandled escape!" );
-			}
+			dl_binary_writer_write( packctx->writer, iter, (size_t)( end - iter ) );
+			break;
 		}
-		else
-			dl_binary_writer_write_uint8( packctx->writer, (uint8_t)str.str[i] );
+		if( esc != iter )
+			dl_binary_writer_write( packctx->writer, iter, (size_t)( esc - iter ) );
+
+		iter = esc + 1;
+		switch( *iter )
+		{
+			case '\'':
+			case '\"':
+			case '\\':
+				dl_binary_writer_write_uint8( packctx->writer, (uint8_t)*iter );
+				break;
+			case 'n': dl_binary_writer_write_uint8( packctx->writer, '\n' ); break;
+			case 'r': dl_binary_writer_write_uint8( packctx->writer, '\r' ); break;
+			case 't': dl_binary_writer_write_uint8( packctx->writer, '\t' ); break;
+			case 'b': dl_binary_writer_write_uint8( packctx->writer, '\b' ); break;
+			case 'f': dl_binary_writer_write_uint8( packctx->writer, '\f' ); break;
+			default:
+				DL_ASSERT( false && "unhandled escape!" );
+		}
+		++iter;
 	}
 	dl_binary_writer_write_uint8( packctx->writer, '\0' );
 	dl_binary_writer_seek_set( packctx->writer, curr );
@@ -338,6 +356,345 @@ static void dl_txt_pack_validate_c_symbol_key( dl_ctx_t dl_ctx, dl_txt_pack_ctx*
 
 static dl_error_t dl_txt_pack_eat_and_write_struct( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx, const dl_type_desc* type );
 
+/*
+	Parallel packing of big arrays of structs.
+
+	When a dl_parallel_for_func is set on the context, big arrays of structs are split into jobs of consecutive
+	elements. Each job packs its elements into a scratch-buffer of its own, with the elements first followed by
+	all data appended by the elements, and records where each array was appended since that is the only
+	appended data that is aligned.
+	The jobs are then stitched into the real output in order by appending the same regions the same way a serial
+	pack would have done and relocating all ptrs written by the job. This gives output identical to a serial pack.
+
+	If anything goes wrong, the array is just packed serially from the start again to get the same errors
+	reported as the serial pack.
+*/
+enum
+{
+	DL_TXT_PACK_PARALLEL_MIN_ARRAY_LENGTH = 1024,
+	DL_TXT_PACK_PARALLEL_MIN_JOB_ELEMENTS = 256,
+	DL_TXT_PACK_PARALLEL_MAX_JOBS         = 64
+};
+
+struct dl_txt_pack_array_job
+{
+	explicit dl_txt_pack_array_job( dl_allocator alloc )
+		: packctx( alloc )
+		, regions( alloc )
+		, scratch( 0x0 )
+		, err( DL_ERROR_OK )
+	{
+	}
+
+	const char*      begin;
+	uint32_t         first;
+	uint32_t         count;
+	dl_txt_pack_ctx  packctx;
+	CArrayStatic<dl_txt_pack_ctx::SRegion, 16> regions;
+	dl_binary_writer writer;
+	uint8_t*         scratch;
+	dl_error_t       err;
+};
+
+struct dl_txt_pack_array_jobs
+{
+	dl_ctx_t                dl_ctx;
+	const dl_type_desc*     type;
+	const char*             txt_start;
+	const char*             txt_end;
+	bool                    dummy;
+	dl_txt_pack_array_job** jobs;
+};
+
+/*
+	Skip one value in an array, respecting strings and comments, and return a ptr to the following ',' or ']'.
+	Returns 0x0 if the end of the text was reached.
+*/
+static const char* dl_txt_pack_skip_array_value( const char* iter, const char* end )
+{
+	int depth = 0;
+	while( true )
+	{
+		iter = dl_txt_skip_white( iter, end );
+		switch( *iter )
+		{
+			case '\0':
+				return 0x0;
+			case '"':
+			case '\'':
+			{
+				char quote = *iter++;
+				while( iter != end && *iter != quote )
+				{
+					if( *iter == '\\' && iter + 1 != end )
+						++iter;
+					++iter;
+				}
+				if( iter == end )
+					return 0x0;
+				++iter;
+			}
+			break;
+			case '{':
+			case '[':
+				++depth;
+				++iter;
+				break;
+			case '}':
+			case ']':
+				if( depth == 0 )
+					return iter;
+				--depth;
+				++iter;
+				break;
+			case ',':
+				if( depth == 0 )
+					return iter;
+				++iter;
+				break;
+			default:
+				++iter;
+				break;
+		}
+	}
+}
+
+static bool dl_txt_pack_array_job_pass( dl_ctx_t dl_ctx, dl_txt_pack_array_jobs* jobs, dl_txt_pack_array_job* job, dl_txt_pack_ctx* packctx, dl_binary_writer* writer )
+{
+	const dl_type_desc* type = jobs->type;
+	size_t type_size = type->size[DL_PTR_SIZE_HOST];
+	size_t elements_size = job->count * type_size;
+
+	packctx->writer         = writer;
+	packctx->read_ctx.start = jobs->txt_start;
+	packctx->read_ctx.end   = jobs->txt_end;
+	packctx->read_ctx.iter  = job->begin;
+	packctx->read_ctx.err   = DL_ERROR_OK;
+	packctx->subdata_pos    = 0x0;
+
+	dl_binary_writer_reserve( writer, elements_size );
+	if( packctx->regions )
+		packctx->regions->Add( { elements_size, elements_size, 1, 0 } );
+
+#if defined(_MSC_VER )
+#pragma warning(push)
+#pragma warning(disable:4611)
+#endif
+	if( setjmp( packctx->read_ctx.jumpbuf ) == 0 )
+#if defined(_MSC_VER )
+#pragma warning(pop)
+#endif
+	{
+		for( uint32_t i = 0; i < job->count; ++i )
+		{
+			if( i > 0 )
+				dl_txt_eat_char( dl_ctx, &packctx->read_ctx, ',' );
+			dl_binary_writer_seek_set( writer, i * type_size );
+			if( DL_ERROR_OK != dl_txt_pack_eat_and_write_struct( dl_ctx, packctx, type ) )
+				return false;
+		}
+		return true;
+	}
+	return false;
+}
+
+static void dl_txt_pack_array_job_func( void* job_data, unsigned int job_index )
+{
+	dl_txt_pack_array_jobs* jobs = (dl_txt_pack_array_jobs*)job_data;
+	dl_txt_pack_array_job*  job  = jobs->jobs[job_index];
+	dl_ctx_t dl_ctx = jobs->dl_ctx;
+
+	size_t scratch_size = 0;
+	if( !jobs->dummy )
+	{
+		// ... size of the scratch is not known up front, do a dummy pass first ...
+		dl_binary_writer size_writer;
+		dl_binary_writer_init( &size_writer, 0x0, 0, true, DL_ENDIAN_HOST, DL_ENDIAN_HOST, DL_PTR_SIZE_HOST );
+		dl_txt_pack_ctx size_packctx( dl_ctx->alloc );
+		if( !dl_txt_pack_array_job_pass( dl_ctx, jobs, job, &size_packctx, &size_writer ) )
+		{
+			job->err = size_packctx.read_ctx.err;
+			return;
+		}
+
+		scratch_size = dl_binary_writer_needed_size( &size_writer );
+		job->scratch = (uint8_t*)dl_alloc( &dl_ctx->alloc, scratch_size );
+		if( job->scratch == 0x0 )
+		{
+			job->err = DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+			return;
+		}
+		memset( job->scratch, 0x0, scratch_size );
+	}
+
+	dl_binary_writer_init( &job->writer, job->scratch, scratch_size, jobs->dummy, DL_ENDIAN_HOST, DL_ENDIAN_HOST, DL_PTR_SIZE_HOST );
+	job->packctx.regions = &job->regions;
+	if( !dl_txt_pack_array_job_pass( dl_ctx, jobs, job, &job->packctx, &job->writer ) )
+		job->err = job->packctx.read_ctx.err;
+}
+
+/*
+	Map a position in the scratch-buffer of a job to the position in the stitched output.
+*/
+static size_t dl_txt_pack_array_job_stitched_pos( dl_txt_pack_array_job* job, size_t elements_pos, size_t pos )
+{
+	CArrayStatic<dl_txt_pack_ctx::SRegion, 16>& regions = job->regions;
+	if( pos < regions[0].pos )
+		return elements_pos + pos;
+
+	// ... find last region starting at or before pos ...
+	size_t low  = 0;
+	size_t high = regions.Len();
+	while( high - low > 1 )
+	{
+		size_t mid = ( low + high ) / 2;
+		if( regions[mid].pos <= pos )
+			low = mid;
+		else
+			high = mid;
+	}
+	return regions[low].stitched_pos + ( pos - regions[low].pos );
+}
+
+static void dl_txt_pack_array_job_stitch( dl_txt_pack_ctx* packctx, dl_txt_pack_array_job* job, size_t elements_pos, size_t elements_size )
+{
+	dl_binary_writer* writer = packctx->writer;
+	uint8_t* scratch = job->scratch;
+
+	// ... copy elements to their place in the array ...
+	dl_binary_writer_seek_set( writer, elements_pos );
+	dl_binary_writer_write( writer, scratch, elements_size );
+
+	// ... append all regions exactly as a serial pack would have ...
+	size_t job_size = dl_binary_writer_needed_size( &job->writer );
+	CArrayStatic<dl_txt_pack_ctx::SRegion, 16>& regions = job->regions;
+	for( size_t i = 0; i < regions.Len(); ++i )
+	{
+		dl_txt_pack_ctx::SRegion& region = regions[i];
+		size_t region_end = i + 1 < regions.Len() ? regions[i + 1].unaligned_pos : job_size;
+
+		dl_binary_writer_seek_end( writer );
+		dl_binary_writer_align( writer, region.align );
+		region.stitched_pos = dl_binary_writer_tell( writer );
+		dl_binary_writer_write( writer, scratch ? scratch + region.pos : 0x0, region_end - region.pos );
+	}
+
+	// ... subdata-ptrs are patched when finalizing subdata, just move them ...
+	dl_txt_pack_ctx& jobctx = job->packctx;
+	CArrayStatic<uintptr_t, 256> subdata_ptrs( jobctx.ptrs.addresses.m_Allocator );
+	for( size_t i = 0; i < jobctx.subdata.Len(); ++i )
+	{
+		dl_txt_pack_ctx::SSubData sub = jobctx.subdata[i];
+		subdata_ptrs.Add( sub.patch_pos );
+		sub.patch_pos = dl_txt_pack_array_job_stitched_pos( job, elements_pos, sub.patch_pos );
+		packctx->subdata.Add( sub );
+	}
+	std::sort( subdata_ptrs.m_Ptr, subdata_ptrs.m_Ptr + subdata_ptrs.Len() );
+
+	if( writer->dummy )
+		return;
+
+	// ... relocate all other ptrs ...
+	CArrayStatic<uintptr_t, 256>& ptrs = jobctx.ptrs.addresses;
+	for( size_t i = 0; i < ptrs.Len(); ++i )
+	{
+		size_t patch_pos = dl_txt_pack_array_job_stitched_pos( job, elements_pos, ptrs[i] );
+		packctx->ptrs.add( patch_pos );
+
+		if( std::binary_search( subdata_ptrs.m_Ptr, subdata_ptrs.m_Ptr + subdata_ptrs.Len(), ptrs[i] ) )
+			continue;
+
+		uintptr_t value;
+		memcpy( &value, scratch + ptrs[i], sizeof( uintptr_t ) );
+		dl_binary_writer_seek_set( writer, patch_pos );
+		dl_binary_writer_write_pint( writer, dl_txt_pack_array_job_stitched_pos( job, elements_pos, value ) );
+	}
+}
+
+static bool dl_txt_pack_parallel_struct_array( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx, const dl_type_desc* type, size_t array_pos, uint32_t array_length )
+{
+	if( dl_ctx->parallel_for_func == 0x0 || packctx->regions != 0x0 || array_length < DL_TXT_PACK_PARALLEL_MIN_ARRAY_LENGTH )
+		return false;
+
+	uint32_t job_elements = ( array_length + DL_TXT_PACK_PARALLEL_MAX_JOBS - 1 ) / DL_TXT_PACK_PARALLEL_MAX_JOBS;
+	if( job_elements < DL_TXT_PACK_PARALLEL_MIN_JOB_ELEMENTS )
+		job_elements = DL_TXT_PACK_PARALLEL_MIN_JOB_ELEMENTS;
+	uint32_t job_count = ( array_length + job_elements - 1 ) / job_elements;
+
+	// ... find where each job starts in the text ...
+	const char* job_begin[DL_TXT_PACK_PARALLEL_MAX_JOBS];
+	const char* iter = packctx->read_ctx.iter;
+	const char* end  = packctx->read_ctx.end;
+	uint32_t found_elements = 0;
+	while( true )
+	{
+		iter = dl_txt_skip_white( iter, end );
+		if( *iter == ']' )
+			break;
+		if( found_elements == array_length )
+			return false;
+		if( found_elements % job_elements == 0 )
+			job_begin[found_elements / job_elements] = iter;
+		++found_elements;
+
+		iter = dl_txt_pack_skip_array_value( iter, end );
+		if( iter == 0x0 )
+			return false;
+		if( *iter == ']' )
+			break;
+		++iter;
+	}
+	if( found_elements != array_length )
+		return false;
+
+	// ... jobs report errors by falling back to the serial pack, so they should not log anything ...
+	dl_context job_ctx = *dl_ctx;
+	job_ctx.error_msg_func = 0x0;
+
+	dl_txt_pack_array_job* jobs[DL_TXT_PACK_PARALLEL_MAX_JOBS];
+	for( uint32_t i = 0; i < job_count; ++i )
+	{
+		jobs[i] = new ( dl_alloc( &dl_ctx->alloc, sizeof( dl_txt_pack_array_job ) ) ) dl_txt_pack_array_job( dl_ctx->alloc );
+		jobs[i]->begin = job_begin[i];
+		jobs[i]->first = i * job_elements;
+		jobs[i]->count = i + 1 < job_count ? job_elements : array_length - i * job_elements;
+	}
+
+	dl_txt_pack_array_jobs job_data = { &job_ctx, type, packctx->read_ctx.start, end, packctx->writer->dummy, jobs };
+	dl_ctx->parallel_for_func( dl_txt_pack_array_job_func, &job_data, job_count, dl_ctx->parallel_ctx );
+
+	bool ok = true;
+	const char* subdata_pos = packctx->subdata_pos;
+	for( uint32_t i = 0; i < job_count && ok; ++i )
+	{
+		ok = jobs[i]->err == DL_ERROR_OK;
+		if( ok && jobs[i]->packctx.subdata_pos )
+		{
+			ok = subdata_pos == 0x0; // "__subdata" set twice, let the serial pack report it.
+			subdata_pos = jobs[i]->packctx.subdata_pos;
+		}
+	}
+
+	if( ok )
+	{
+		size_t type_size = type->size[DL_PTR_SIZE_HOST];
+		for( uint32_t i = 0; i < job_count; ++i )
+			dl_txt_pack_array_job_stitch( packctx, jobs[i], array_pos + jobs[i]->first * type_size, jobs[i]->count * type_size );
+
+		packctx->subdata_pos   = subdata_pos;
+		packctx->read_ctx.iter = jobs[job_count - 1]->packctx.read_ctx.iter;
+	}
+
+	for( uint32_t i = 0; i < job_count; ++i )
+	{
+		if( jobs[i]->scratch )
+			dl_free( &dl_ctx->alloc, jobs[i]->scratch );
+		jobs[i]->~dl_txt_pack_array_job();
+		dl_free( &dl_ctx->alloc, jobs[i] );
+	}
+	return ok;
+}
+
 static dl_error_t dl_txt_pack_eat_and_write_array( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx, const dl_member_desc* member, uint32_t array_length )
 {
 	switch( member->StorageType() )
@@ -454,7 +811,7 @@ static dl_error_t dl_txt_pack_eat_and_write_array( dl_ctx_t dl_ctx, dl_txt_pack_
 		break;
 		case DL_TYPE_STORAGE_PTR:
 		{
-			const dl_type_desc* type = dl_internal_find_type( dl_ctx, member->type_id );
+			const dl_type_desc* type = dl_internal_member_type( dl_ctx, member );
 			size_t array_pos = dl_binary_writer_tell( packctx->writer );
 			for( uint32_t i = 0; i < array_length - 1; ++i )
 			{
@@ -466,8 +823,11 @@ static dl_error_t dl_txt_pack_eat_and_write_array( dl_ctx_t dl_ctx, dl_txt_pack_
 		break;
 		case DL_TYPE_STORAGE_STRUCT:
 		{
-			const dl_type_desc* type = dl_internal_find_type( dl_ctx, member->type_id );
+			const dl_type_desc* type = dl_internal_member_type( dl_ctx, member );
 			size_t array_pos = dl_binary_writer_tell( packctx->writer ); // TODO: this seek/set dance will only be needed if type has subptrs, optimize by making different code-paths?
+			if( dl_txt_pack_parallel_struct_array( dl_ctx, packctx, type, array_pos, array_length ) )
+				break;
+
 			for( uint32_t i = 0; i < array_length -1; ++i )
 			{
 				dl_binary_writer_seek_set( packctx->writer, array_pos + i * type->size[DL_PTR_SIZE_HOST] );
@@ -489,7 +849,7 @@ static dl_error_t dl_txt_pack_eat_and_write_array( dl_ctx_t dl_ctx, dl_txt_pack_
 		case DL_TYPE_STORAGE_ENUM_UINT32:
 		case DL_TYPE_STORAGE_ENUM_UINT64:
 		{
-			const dl_enum_desc* edesc = dl_internal_find_enum( dl_ctx, member->type_id );
+			const dl_enum_desc* edesc = dl_internal_member_enum( dl_ctx, member );
 			if( edesc == 0x0 )
 				dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_TYPE_NOT_FOUND, "couldn't find enum-type of <type_name_here>.%s", dl_internal_member_name( dl_ctx, member ) );
 
@@ -524,7 +884,7 @@ static void dl_txt_pack_array_item_size_align( dl_ctx_t dl_ctx,
 	{
 		case DL_TYPE_STORAGE_STRUCT:
 		{
-			const dl_type_desc* type = dl_internal_find_type( dl_ctx, member->type_id );
+			const dl_type_desc* type = dl_internal_member_type( dl_ctx, member );
 			*size = type->size[DL_PTR_SIZE_HOST];
 			*align = type->alignment[DL_PTR_SIZE_HOST];
 			break;
@@ -721,30 +1081,28 @@ static uint32_t dl_txt_pack_find_array_length( dl_ctx_t dl_ctx, dl_txt_pack_ctx*
 	return (uint32_t)-1;
 }
 
-static void dl_txt_pack_write_default_value( dl_ctx_t              dl_ctx,
-											 dl_txt_pack_ctx*      packctx,
-											 const dl_member_desc* member,
-											 size_t                member_pos )
+static void dl_txt_pack_write_default_inline( dl_ctx_t              dl_ctx,
+											  dl_binary_writer*     writer,
+											  const dl_member_desc* member,
+											  size_t                member_pos )
 {
 	uint8_t* member_default_value = dl_ctx->default_data + member->default_value_offset;
 
-	uint32_t member_size = member->size[DL_PTR_SIZE_HOST];
-
 	// ... handle bitfields differently since they take up sub-parts of bytes.
 	if(member->AtomType() == DL_TYPE_ATOM_BITFIELD)
 	{
 		uint32_t bf_bits = member->bitfield_bits();
 		uint32_t bf_offset = member->bitfield_offset();
 
-		dl_binary_writer_seek_set( packctx->writer, member_pos );
+		dl_binary_writer_seek_set( writer, member_pos );
 
 		uint64_t current_data = 0;
 		switch( member->StorageType() )
 		{
-			case DL_TYPE_STORAGE_UINT8:  current_data = (uint64_t)dl_binary_writer_read_uint8 ( packctx->writer ); break;
-			case DL_TYPE_STORAGE_UINT16: current_data = (uint64_t)dl_binary_writer_read_uint16( packctx->writer ); break;
-			case DL_TYPE_STORAGE_UINT32: current_data = (uint64_t)dl_binary_writer_read_uint32( packctx->writer ); break;
-			case DL_TYPE_STORAGE_UINT64: current_data = dl_binary_writer_read_uint64( packctx->writer ); break;
+			case DL_TYPE_STORAGE_UINT8:  current_data = (uint64_t)dl_binary_writer_read_uint8 ( writer ); break;
+			case DL_TYPE_STORAGE_UINT16: current_data = (uint64_t)dl_binary_writer_read_uint16( writer ); break;
+			case DL_TYPE_STORAGE_UINT32: current_data = (uint64_t)dl_binary_writer_read_uint32( writer ); break;
+			case DL_TYPE_STORAGE_UINT64: current_data = dl_binary_writer_read_uint64( writer ); break;
 			default:
 				DL_ASSERT( false && "This should not happen!" );
 				break;
@@ -764,14 +1122,14 @@ static void dl_txt_pack_write_default_value( dl_ctx_t              dl_ctx,
 		}
 		uint64_t default_value_extracted = DL_EXTRACT_BITS(default_value, dl_bf_offset( DL_ENDIAN_HOST, sizeof(uint8_t), bf_offset, bf_bits ), bf_bits);
 		uint64_t to_store = DL_INSERT_BITS( current_data, default_value_extracted, dl_bf_offset( DL_ENDIAN_HOST, sizeof(uint8_t), bf_offset, bf_bits ), bf_bits );
-		dl_binary_writer_seek_set( packctx->writer, member_pos );
+		dl_binary_writer_seek_set( writer, member_pos );
 
 		switch( member->StorageType() )
 		{
-			case DL_TYPE_STORAGE_UINT8:  dl_binary_writer_write_uint8 ( packctx->writer,  (uint8_t)to_store ); break;
-			case DL_TYPE_STORAGE_UINT16: dl_binary_writer_write_uint16( packctx->writer, (uint16_t)to_store ); break;
-			case DL_TYPE_STORAGE_UINT32: dl_binary_writer_write_uint32( packctx->writer, (uint32_t)to_store ); break;
-			case DL_TYPE_STORAGE_UINT64: dl_binary_writer_write_uint64( packctx->writer, (uint64_t)to_store ); break;
+			case DL_TYPE_STORAGE_UINT8:  dl_binary_writer_write_uint8 ( writer,  (uint8_t)to_store ); break;
+			case DL_TYPE_STORAGE_UINT16: dl_binary_writer_write_uint16( writer, (uint16_t)to_store ); break;
+			case DL_TYPE_STORAGE_UINT32: dl_binary_writer_write_uint32( writer, (uint32_t)to_store ); break;
+			case DL_TYPE_STORAGE_UINT64: dl_binary_writer_write_uint64( writer, (uint64_t)to_store ); break;
 			default:
 				DL_ASSERT( false && "This should not happen!" );
 				break;
@@ -780,9 +1138,20 @@ static void dl_txt_pack_write_default_value( dl_ctx_t              dl_ctx,
 	}
 	else
 	{
-		dl_binary_writer_seek_set( packctx->writer, member_pos );
-		dl_binary_writer_write( packctx->writer, member_default_value, member->size[DL_PTR_SIZE_HOST] );
+		dl_binary_writer_seek_set( writer, member_pos );
+		dl_binary_writer_write( writer, member_default_value, member->size[DL_PTR_SIZE_HOST] );
 	}
+}
+
+static void dl_txt_pack_write_default_value( dl_ctx_t              dl_ctx,
+											 dl_txt_pack_ctx*      packctx,
+											 const dl_member_desc* member,
+											 size_t                member_pos )
+{
+	dl_txt_pack_write_default_inline( dl_ctx, packctx->writer, member, member_pos );
+
+	uint8_t* member_default_value = dl_ctx->default_data + member->default_value_offset;
+	uint32_t member_size = member->size[DL_PTR_SIZE_HOST];
 
 	if( member_size != member->default_value_size )
 	{
@@ -799,6 +1168,94 @@ static void dl_txt_pack_write_default_value( dl_ctx_t              dl_ctx,
 	}
 }
 
+/*
+	Build dl_type_defaults for all types in dl_ctx that do not have them yet.
+	The template of a type is an instance with the inline part of all default values written, txt pack copies that
+	to each instance of the type it packs so that only members with subdata has to be handled one by one when not set.
+*/
+dl_error_t dl_internal_build_type_defaults( dl_ctx_t dl_ctx )
+{
+	unsigned int type_start = dl_ctx->type_defaults_count;
+	if( type_start == dl_ctx->type_count )
+		return DL_ERROR_OK;
+
+	// ... calculate sizes of all that is needed ...
+	size_t templates_size = dl_ctx->default_templates_size;
+	size_t members_count  = dl_ctx->default_members_count;
+	for( unsigned int i = type_start; i < dl_ctx->type_count; ++i )
+	{
+		const dl_type_desc* type = dl_ctx->type_descs + i;
+		if( type->flags & DL_TYPE_FLAG_IS_UNION )
+			continue;
+
+		for( uint32_t m = 0; m < type->member_count; ++m )
+		{
+			const dl_member_desc* member = dl_get_type_member( dl_ctx, type, m );
+			if( member->default_value_offset == UINT32_MAX || member->size[DL_PTR_SIZE_HOST] != member->default_value_size )
+				++members_count;
+		}
+		templates_size = dl_internal_align_up( templates_size, 8 ) + type->size[DL_PTR_SIZE_HOST];
+	}
+
+	dl_type_defaults* type_defaults = (dl_type_defaults*)dl_realloc( &dl_ctx->alloc, dl_ctx->type_defaults, dl_ctx->type_count * sizeof( dl_type_defaults ), type_start * sizeof( dl_type_defaults ) );
+	if( type_defaults == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	dl_ctx->type_defaults = type_defaults;
+
+	uint8_t* templates = (uint8_t*)dl_realloc( &dl_ctx->alloc, dl_ctx->default_templates, templates_size, dl_ctx->default_templates_size );
+	if( templates_size > 0 && templates == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	dl_ctx->default_templates = templates;
+
+	uint32_t* members = (uint32_t*)dl_realloc( &dl_ctx->alloc, dl_ctx->default_members, members_count * sizeof( uint32_t ), dl_ctx->default_members_count * sizeof( uint32_t ) );
+	if( members_count > 0 && members == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	dl_ctx->default_members = members;
+
+	// ... and build it ...
+	for( unsigned int i = type_start; i < dl_ctx->type_count; ++i )
+	{
+		const dl_type_desc* type = dl_ctx->type_descs + i;
+		dl_type_defaults* defaults = type_defaults + i;
+		defaults->template_offset = UINT32_MAX;
+		defaults->members_start   = (uint32_t)dl_ctx->default_members_count;
+		defaults->required_count  = 0;
+		defaults->subdata_count   = 0;
+		if( type->flags & DL_TYPE_FLAG_IS_UNION )
+			continue;
+
+		for( uint32_t m = 0; m < type->member_count; ++m )
+			if( dl_get_type_member( dl_ctx, type, m )->default_value_offset == UINT32_MAX )
+				members[dl_ctx->default_members_count + defaults->required_count++] = m;
+
+		size_t template_offset = dl_internal_align_up( dl_ctx->default_templates_size, 8 );
+		size_t type_size = type->size[DL_PTR_SIZE_HOST];
+		memset( templates + dl_ctx->default_templates_size, 0x0, template_offset + type_size - dl_ctx->default_templates_size );
+
+		dl_binary_writer writer;
+		dl_binary_writer_init( &writer, templates + template_offset, type_size, false, DL_ENDIAN_HOST, DL_ENDIAN_HOST, DL_PTR_SIZE_HOST );
+		for( uint32_t m = 0; m < type->member_count; ++m )
+		{
+			const dl_member_desc* member = dl_get_type_member( dl_ctx, type, m );
+			if( member->default_value_offset == UINT32_MAX )
+				continue;
+
+			dl_txt_pack_write_default_inline( dl_ctx, &writer, member, member->offset[DL_PTR_SIZE_HOST] );
+			if( member->size[DL_PTR_SIZE_HOST] != member->default_value_size )
+				members[dl_ctx->default_members_count + defaults->required_count + defaults->subdata_count++] = m;
+		}
+
+		if( defaults->required_count < type->member_count )
+			defaults->template_offset = (uint32_t)template_offset;
+
+		dl_ctx->default_templates_size = template_offset + type_size;
+		dl_ctx->default_members_count += defaults->required_count + defaults->subdata_count;
+	}
+
+	dl_ctx->type_defaults_count = dl_ctx->type_count;
+	return DL_ERROR_OK;
+}
+
 static dl_error_t dl_txt_pack_member( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx, size_t instance_pos, const dl_member_desc* member )
 {
 	size_t member_pos = instance_pos + member->offset[DL_PTR_SIZE_HOST];
@@ -821,8 +1278,8 @@ static dl_error_t dl_txt_pack_member( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx,
 				case DL_TYPE_STORAGE_FP32:   dl_txt_pack_eat_and_write_fp32( dl_ctx, packctx );   break;
 				case DL_TYPE_STORAGE_FP64:   dl_txt_pack_eat_and_write_fp64( dl_ctx, packctx );   break;
 				case DL_TYPE_STORAGE_STR:    dl_txt_pack_eat_and_write_string( dl_ctx, packctx ); break;
-				case DL_TYPE_STORAGE_PTR:    dl_txt_pack_eat_and_write_ptr( dl_ctx, packctx, dl_internal_find_type( dl_ctx, member->type_id ), member_pos ); break;
-				case DL_TYPE_STORAGE_STRUCT: return dl_txt_pack_eat_and_write_struct( dl_ctx, packctx, dl_internal_find_type( dl_ctx, member->type_id ) );
+				case DL_TYPE_STORAGE_PTR:    dl_txt_pack_eat_and_write_ptr( dl_ctx, packctx, dl_internal_member_type( dl_ctx, member ), member_pos ); break;
+				case DL_TYPE_STORAGE_STRUCT: return dl_txt_pack_eat_and_write_struct( dl_ctx, packctx, dl_internal_member_type( dl_ctx, member ) );
 				case DL_TYPE_STORAGE_ENUM_INT8:
 				case DL_TYPE_STORAGE_ENUM_INT16:
 				case DL_TYPE_STORAGE_ENUM_INT32:
@@ -833,7 +1290,7 @@ static dl_error_t dl_txt_pack_member( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx,
 				case DL_TYPE_STORAGE_ENUM_UINT64:
 				{
 					dl_txt_eat_white( &packctx->read_ctx );
-					const dl_enum_desc* edesc = dl_internal_find_enum( dl_ctx, member->type_id );
+					const dl_enum_desc* edesc = dl_internal_member_enum( dl_ctx, member );
 					if( edesc == 0x0 )
 						dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_TYPE_NOT_FOUND, "couldn't find enum-type of <type_name_here>.%s", dl_internal_member_name( dl_ctx, member ) );
 					dl_txt_pack_eat_and_write_enum( dl_ctx, packctx, edesc );
@@ -866,6 +1323,8 @@ static dl_error_t dl_txt_pack_member( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx,
 				dl_binary_writer_write_pint( packctx->writer, array_pos );
 				dl_binary_writer_write_uint32( packctx->writer, array_length );
 				dl_binary_writer_seek_end( packctx->writer );
+				if( packctx->regions )
+					packctx->regions->Add( { dl_binary_writer_tell( packctx->writer ), array_pos, element_align, 0 } );
 				dl_binary_writer_align( packctx->writer, element_align );
 				dl_binary_writer_reserve( packctx->writer, array_length * element_size );
 				dl_error_t err = dl_txt_pack_eat_and_write_array( dl_ctx, packctx, member, array_length );
@@ -896,7 +1355,7 @@ static dl_error_t dl_txt_pack_member( dl_ctx_t dl_ctx, dl_txt_pack_ctx* packctx,
 			{
 				case DL_TYPE_STORAGE_STRUCT:
 				{
-					const dl_type_desc* sub_type = dl_internal_find_type(dl_ctx, member->type_id);
+					const dl_type_desc* sub_type = dl_internal_member_type(dl_ctx, member);
 
 					// fill missing elements with defaults!
 					size_t current_member_array_position = member_pos + sub_type->size[DL_PTR_SIZE_HOST] * array_length;
@@ -1051,6 +1510,15 @@ static dl_error_t dl_txt_pack_eat_and_write_struct( dl_ctx_t dl_ctx, dl_txt_pack
 	size_t instance_pos = dl_binary_writer_tell( packctx->writer );
 	dl_binary_writer_reserve( packctx->writer, type->size[DL_PTR_SIZE_HOST] );
 
+	// ... start out with all default values if there is a template, types loaded while building a typelib from txt has none ...
+	size_t type_index = (size_t)( type - dl_ctx->type_descs );
+	const dl_type_defaults* defaults = type_index < dl_ctx->type_defaults_count ? dl_ctx->type_defaults + type_index : 0x0;
+	if( defaults && defaults->template_offset != UINT32_MAX )
+	{
+		dl_binary_writer_write( packctx->writer, dl_ctx->default_templates + defaults->template_offset, type->size[DL_PTR_SIZE_HOST] );
+		dl_binary_writer_seek_set( packctx->writer, instance_pos );
+	}
+
 	while( true )
 	{
 		// ... read all members ...
@@ -1121,6 +1589,29 @@ static dl_error_t dl_txt_pack_eat_and_write_struct( dl_ctx_t dl_ctx, dl_txt_pack
 		dl_binary_writer_seek_set( packctx->writer, instance_pos + type_offset );
 		dl_binary_writer_write_uint32( packctx->writer, dl_internal_typeid_of(dl_ctx, type) + member_index + 1 );
 	}
+	else if( defaults )
+	{
+		// ... inline default values are already written from the template, only missing members and subdata is left ...
+		const uint32_t* members = dl_ctx->default_members + defaults->members_start;
+		for( uint32_t i = 0; i < defaults->required_count; ++i )
+		{
+			if( members_set[members[i] / 64] & ( 1ULL << ( members[i] % 64 ) ) )
+				continue;
+
+			const dl_member_desc* member = dl_get_type_member( dl_ctx, type, members[i] );
+			dl_txt_read_failed( dl_ctx, &packctx->read_ctx, DL_ERROR_TXT_MISSING_MEMBER, "member %s.%s is not set and has no default value", dl_internal_type_name( dl_ctx, type ), dl_internal_member_name( dl_ctx, member ) );
+		}
+
+		members += defaults->required_count;
+		for( uint32_t i = 0; i < defaults->subdata_count; ++i )
+		{
+			if( members_set[members[i] / 64] & ( 1ULL << ( members[i] % 64 ) ) )
+				continue;
+
+			const dl_member_desc* member = dl_get_type_member( dl_ctx, type, members[i] );
+			dl_txt_pack_write_default_value( dl_ctx, packctx, member, instance_pos + member->offset[DL_PTR_SIZE_HOST] );
+		}
+	}
 	else
 	{
 		for( uint32_t i = 0; i < type->member_count; ++i )
@@ -3,12 +3,14 @@
 #include "dl_internal_util.h"
 #include "dl_types.h"
 #include "dl_binary_writer.h"
+#include "dl_ptr_map.h"
 #include <dl/dl_txt.h>
 
 struct dl_txt_unpack_ctx
 {
 	explicit dl_txt_unpack_ctx(dl_allocator alloc)
-		: ptrs(alloc)
+		: written_ptrs(alloc)
+		, ptr_stack(alloc)
 	{
 	}
 
@@ -18,9 +20,10 @@ struct dl_txt_unpack_ctx
 	struct SPtr
 	{
 		const uint8_t* ptr;
-		dl_typeid_t tid;
+		const dl_type_hot* type;
 	};
-	CArrayStatic<SPtr, 256> ptrs;
+	dl_ptr_map written_ptrs;          // all ptrs already written to "__subdata", including the root.
+	CArrayStatic<SPtr, 256> ptr_stack; // ptrs found but not yet written to "__subdata".
 	bool has_ptrs;
 };
 
@@ -30,11 +33,60 @@ static void dl_txt_unpack_write_indent( dl_binary_writer* writer, dl_txt_unpack_
 		dl_binary_writer_write_uint8( writer, ' ' );
 }
 
+static inline bool dl_txt_unpack_char_needs_escape( uint8_t c )
+{
+	return c < 0x20 || c == '\'' || c == '\"' || c == '\\';
+}
+
+/*
+	Find the first char in [str, end) that might need escaping, checking 8 chars at the time while there
+	is enough data left. A hit in the 8-char block is only a candidate, the exact char is found with the
+	scalar loop.
+*/
+static const char* dl_txt_unpack_find_escape( const char* str, const char* end )
+{
+	const uint64_t ONES = 0x0101010101010101ULL;
+	const uint64_t HIGH = 0x8080808080808080ULL;
+
+	while( end - str >= 8 )
+	{
+		uint64_t block;
+		memcpy( &block, str, sizeof(block) );
+
+		uint64_t squote = block ^ ( ONES * '\'' );
+		uint64_t dquote = block ^ ( ONES * '\"' );
+		uint64_t bslash = block ^ ( ONES * '\\' );
+		uint64_t hits = ( ( block  - ONES * 0x20 ) & ~block )  | // any byte < 0x20
+		                ( ( squote - ONES ) & ~squote ) |
+		                ( ( dquote - ONES ) & ~dquote ) |
+		                ( ( bslash - ONES ) & ~bslash );
+		if( hits & HIGH )
+			break;
+		str += 8;
+	}
+
+	while( str != end && !dl_txt_unpack_char_needs_escape( (uint8_t)*str ) )
+		++str;
+	return str;
+}
+
 static void dl_txt_unpack_write_string( dl_binary_writer* writer, const char* str )
 {
+	const char* end = str + strlen( str );
+
 	dl_binary_writer_write_uint8( writer, '\"' );
-	while( *str )
+	while( str != end )
 	{
+		// ... copy the run of chars that do not need any escaping in one go ...
+		const char* run_end = dl_txt_unpack_find_escape( str, end );
+		if( run_end != str )
+		{
+			dl_binary_writer_write( writer, str, (size_t)( run_end - str ) );
+			str = run_end;
+			if( str == end )
+				break;
+		}
+
 		switch( *str )
 		{
 			case '\'': dl_binary_writer_write( writer, "\\\'", 2 ); break;
@@ -45,7 +97,6 @@ static void dl_txt_unpack_write_string( dl_binary_writer* writer, const char* st
 			case '\t': dl_binary_writer_write( writer, "\\t", 2 ); break;
 			case '\b': dl_binary_writer_write( writer, "\\b", 2 ); break;
 			case '\f': dl_binary_writer_write( writer, "\\f", 2 ); break;
-			break;
 			default:
 				dl_binary_writer_write_uint8( writer, (uint8_t)*str );
 		}
@@ -171,12 +222,12 @@ static void dl_txt_unpack_ptr( dl_binary_writer* writer, dl_txt_unpack_ctx* unpa
 static dl_error_t dl_txt_unpack_struct( dl_ctx_t dl_ctx, dl_txt_unpack_ctx* unpack_ctx, dl_binary_writer* writer, const dl_type_desc* type, const uint8_t* struct_data );
 
 static dl_error_t dl_txt_unpack_array( dl_ctx_t dl_ctx,
-									   dl_txt_unpack_ctx* unpack_ctx,
-									   dl_binary_writer*  writer,
-									   dl_type_storage_t  storage,
-									   const uint8_t*     array_data,
-									   uint32_t           array_count,
-									   dl_typeid_t        tid )
+									   dl_txt_unpack_ctx*    unpack_ctx,
+									   dl_binary_writer*     writer,
+									   dl_type_storage_t     storage,
+									   const uint8_t*        array_data,
+									   uint32_t              array_count,
+									   const dl_member_desc* member )
 {
 	dl_error_t err;
 	dl_binary_writer_write_uint8( writer, '[' );
@@ -320,7 +371,7 @@ static dl_error_t dl_txt_unpack_array( dl_ctx_t dl_ctx,
 			dl_binary_writer_write( writer, "\n", 1 );
 			dl_txt_unpack_write_indent( writer, unpack_ctx );
 			unpack_ctx->indent += 2;
-			const dl_type_desc* type = dl_internal_find_type( dl_ctx, tid );
+			const dl_type_desc* type = dl_internal_member_type( dl_ctx, member );
 			for( uint32_t i = 0; i < array_count - 1; ++i )
 			{
 				err = dl_txt_unpack_struct( dl_ctx, unpack_ctx, writer, type, array_data + i * type->size[DL_PTR_SIZE_HOST] );
@@ -334,7 +385,7 @@ static dl_error_t dl_txt_unpack_array( dl_ctx_t dl_ctx,
 		}
 		case DL_TYPE_STORAGE_ENUM_INT8:
 		{
-			const dl_enum_desc* e = dl_internal_find_enum( dl_ctx, tid );
+			const dl_enum_desc* e = dl_internal_member_enum( dl_ctx, member );
 			DL_ASSERT( e != 0x0 );
 
 			int8_t* mem = (int8_t*)array_data;
@@ -348,7 +399,7 @@ static dl_error_t dl_txt_unpack_array( dl_ctx_t dl_ctx,
 		break;
 		case DL_TYPE_STORAGE_ENUM_UINT8:
 		{
-			const dl_enum_desc* e = dl_internal_find_enum( dl_ctx, tid );
+			const dl_enum_desc* e = dl_internal_member_enum( dl_ctx, member );
 			DL_ASSERT( e != 0x0 );
 
 			uint8_t* mem = (uint8_t*)array_data;
@@ -363,7 +414,7 @@ static dl_error_t dl_txt_unpack_array( dl_ctx_t dl_ctx,
 		break;
 		case DL_TYPE_STORAGE_ENUM_INT16:
 		{
-			const dl_enum_desc* e = dl_internal_find_enum( dl_ctx, tid );
+			const dl_enum_desc* e = dl_internal_member_enum( dl_ctx, member );
 			DL_ASSERT( e != 0x0 );
 
 			int16_t* mem = (int16_t*)array_data;
@@ -378,7 +429,7 @@ static dl_error_t dl_txt_unpack_array( dl_ctx_t dl_ctx,
 		break;
 		case DL_TYPE_STORAGE_ENUM_UINT16:
 		{
-			const dl_enum_desc* e = dl_internal_find_enum( dl_ctx, tid );
+			const dl_enum_desc* e = dl_internal_member_enum( dl_ctx, member );
 			DL_ASSERT( e != 0x0 );
 
 			uint16_t* mem = (uint16_t*)array_data;
@@ -393,7 +444,7 @@ static dl_error_t dl_txt_unpack_array( dl_ctx_t dl_ctx,
 		break;
 		case DL_TYPE_STORAGE_ENUM_INT32:
 		{
-			const dl_enum_desc* e = dl_internal_find_enum( dl_ctx, tid );
+			const dl_enum_desc* e = dl_internal_member_enum( dl_ctx, member );
 			DL_ASSERT( e != 0x0 );
 
 			int32_t* mem = (int32_t*)array_data;
@@ -408,7 +459,7 @@ static dl_error_t dl_txt_unpack_array( dl_ctx_t dl_ctx,
 		break;
 		case DL_TYPE_STORAGE_ENUM_UINT32:
 		{
-			const dl_enum_desc* e = dl_internal_find_enum( dl_ctx, tid );
+			const dl_enum_desc* e = dl_internal_member_enum( dl_ctx, member );
 			DL_ASSERT( e != 0x0 );
 
 			uint32_t* mem = (uint32_t*)array_data;
@@ -423,7 +474,7 @@ static dl_error_t dl_txt_unpack_array( dl_ctx_t dl_ctx,
 		break;
 		case DL_TYPE_STORAGE_ENUM_INT64:
 		{
-			const dl_enum_desc* e = dl_internal_find_enum( dl_ctx, tid );
+			const dl_enum_desc* e = dl_internal_member_enum( dl_ctx, member );
 			DL_ASSERT( e != 0x0 );
 
 			int64_t* mem = (int64_t*)array_data;
@@ -438,7 +489,7 @@ static dl_error_t dl_txt_unpack_array( dl_ctx_t dl_ctx,
 		break;
 		case DL_TYPE_STORAGE_ENUM_UINT64:
 		{
-			const dl_enum_desc* e = dl_internal_find_enum( dl_ctx, tid );
+			const dl_enum_desc* e = dl_internal_member_enum( dl_ctx, member );
 			DL_ASSERT( e != 0x0 );
 
 			uint64_t* mem = (uint64_t*)array_data;
@@ -480,14 +531,14 @@ static dl_error_t dl_txt_unpack_member( dl_ctx_t dl_ctx, dl_txt_unpack_ctx* unpa
 				case DL_TYPE_STORAGE_UINT64:      dl_txt_unpack_uint64( writer, *(uint64_t*)member_data ); break;
 				case DL_TYPE_STORAGE_FP32:        dl_txt_unpack_fp32  ( writer, *(float*)member_data ); break;
 				case DL_TYPE_STORAGE_FP64:        dl_txt_unpack_fp64  ( writer, *(double*)member_data ); break;
-				case DL_TYPE_STORAGE_ENUM_INT8:   dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_find_enum( dl_ctx, member->type_id ), (uint64_t)*( int8_t*)  member_data ); break;
-				case DL_TYPE_STORAGE_ENUM_UINT8:  dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_find_enum( dl_ctx, member->type_id ), (uint64_t)*(uint8_t*)  member_data ); break;
-				case DL_TYPE_STORAGE_ENUM_INT16:  dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_find_enum( dl_ctx, member->type_id ), (uint64_t)*( int16_t*) member_data ); break;
-				case DL_TYPE_STORAGE_ENUM_UINT16: dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_find_enum( dl_ctx, member->type_id ), (uint64_t)*(uint16_t*) member_data ); break;
-				case DL_TYPE_STORAGE_ENUM_INT32:  dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_find_enum( dl_ctx, member->type_id ), (uint64_t)*( int32_t*) member_data ); break;
-				case DL_TYPE_STORAGE_ENUM_UINT32: dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_find_enum( dl_ctx, member->type_id ), (uint64_t)*(uint32_t*) member_data ); break;
-				case DL_TYPE_STORAGE_ENUM_INT64:  dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_find_enum( dl_ctx, member->type_id ), (uint64_t)*( int64_t*) member_data ); break;
-				case DL_TYPE_STORAGE_ENUM_UINT64: dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_find_enum( dl_ctx, member->type_id ), (uint64_t)*(uint64_t*) member_data ); break;
+				case DL_TYPE_STORAGE_ENUM_INT8:   dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_member_enum( dl_ctx, member ), (uint64_t)*( int8_t*)  member_data ); break;
+				case DL_TYPE_STORAGE_ENUM_UINT8:  dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_member_enum( dl_ctx, member ), (uint64_t)*(uint8_t*)  member_data ); break;
+				case DL_TYPE_STORAGE_ENUM_INT16:  dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_member_enum( dl_ctx, member ), (uint64_t)*( int16_t*) member_data ); break;
+				case DL_TYPE_STORAGE_ENUM_UINT16: dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_member_enum( dl_ctx, member ), (uint64_t)*(uint16_t*) member_data ); break;
+				case DL_TYPE_STORAGE_ENUM_INT32:  dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_member_enum( dl_ctx, member ), (uint64_t)*( int32_t*) member_data ); break;
+				case DL_TYPE_STORAGE_ENUM_UINT32: dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_member_enum( dl_ctx, member ), (uint64_t)*(uint32_t*) member_data ); break;
+				case DL_TYPE_STORAGE_ENUM_INT64:  dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_member_enum( dl_ctx, member ), (uint64_t)*( int64_t*) member_data ); break;
+				case DL_TYPE_STORAGE_ENUM_UINT64: dl_txt_unpack_enum  ( dl_ctx, writer, dl_internal_member_enum( dl_ctx, member ), (uint64_t)*(uint64_t*) member_data ); break;
 				case DL_TYPE_STORAGE_STR:         dl_txt_unpack_write_string_or_null( writer, *(const char**)member_data ); break;
 				case DL_TYPE_STORAGE_PTR:
 				{
@@ -495,7 +546,7 @@ static dl_error_t dl_txt_unpack_member( dl_ctx_t dl_ctx, dl_txt_unpack_ctx* unpa
 					unpack_ctx->has_ptrs = true;
 				}
 				break;
-				case DL_TYPE_STORAGE_STRUCT: return dl_txt_unpack_struct( dl_ctx, unpack_ctx, writer, dl_internal_find_type( dl_ctx, member->type_id ), member_data );
+				case DL_TYPE_STORAGE_STRUCT: return dl_txt_unpack_struct( dl_ctx, unpack_ctx, writer, dl_internal_member_type( dl_ctx, member ), member_data );
 				default:
 					DL_ASSERT(false);
 			}
@@ -508,11 +559,11 @@ static dl_error_t dl_txt_unpack_member( dl_ctx_t dl_ctx, dl_txt_unpack_ctx* unpa
 			if( array_count == 0 )
 				dl_binary_writer_write( writer, "[]", 2 );
 			else
-				return dl_txt_unpack_array( dl_ctx, unpack_ctx, writer, member->StorageType(), array, array_count, member->type_id );
+				return dl_txt_unpack_array( dl_ctx, unpack_ctx, writer, member->StorageType(), array, array_count, member );
 		}
 		break;
 		case DL_TYPE_ATOM_INLINE_ARRAY:
-			return dl_txt_unpack_array( dl_ctx, unpack_ctx, writer, member->StorageType(), member_data, member->inline_array_cnt(), member->type_id );
+			return dl_txt_unpack_array( dl_ctx, unpack_ctx, writer, member->StorageType(), member_data, member->inline_array_cnt(), member );
 		case DL_TYPE_ATOM_BITFIELD:
 		{
 			uint64_t write_me  = 0;
@@ -538,57 +589,31 @@ static dl_error_t dl_txt_unpack_member( dl_ctx_t dl_ctx, dl_txt_unpack_ctx* unpa
 	return DL_ERROR_OK;
 }
 
-static dl_error_t dl_txt_unpack_write_subdata( dl_ctx_t dl_ctx, dl_txt_unpack_ctx* unpack_ctx, dl_binary_writer* writer, const dl_type_desc* type, const uint8_t* struct_data );
+static void dl_txt_unpack_gather_subdata( dl_ctx_t dl_ctx, dl_txt_unpack_ctx* unpack_ctx, const dl_type_hot* type, const uint8_t* struct_data );
 
-static dl_error_t dl_txt_unpack_write_subdata_ptr( dl_ctx_t            dl_ctx,
-												   dl_txt_unpack_ctx*  unpack_ctx,
-												   dl_binary_writer*   writer,
-												   const uint8_t*      ptrptr,
-												   const dl_type_desc* sub_type )
+static void dl_txt_unpack_gather_subdata_ptr( dl_txt_unpack_ctx* unpack_ctx, const uint8_t* ptrptr, const dl_type_hot* sub_type )
 {
 	const uint8_t* ptr = *(const uint8_t**)( ptrptr );
 	if( ptr == 0 )
-		return DL_ERROR_OK;
-
-	for (size_t i = 0; i < unpack_ctx->ptrs.Len(); ++i)
-		if( unpack_ctx->ptrs[i].ptr == ptr )
-			return DL_ERROR_OK;
+		return;
 
-	unpack_ctx->ptrs.Add( { ptr, 0 } );
+	// ... already written ptrs will be skipped when popped anyway, no need to push them ...
+	if( unpack_ctx->written_ptrs.find( (uintptr_t)ptr, 0x0 ) )
+		return;
 
-	dl_txt_unpack_write_indent( writer, unpack_ctx );
-	dl_txt_unpack_ptr( writer, unpack_ctx, ptr );
-	dl_binary_writer_write( writer, " : ", 3 );
-
-	dl_error_t err = dl_txt_unpack_struct( dl_ctx, unpack_ctx, writer, sub_type, ptr );
-	if( DL_ERROR_OK != err ) return err;
-
-	// TODO: extra , at last elem =/
-	dl_binary_writer_write( writer, ",\n", 2 );
-
-	return dl_txt_unpack_write_subdata( dl_ctx, unpack_ctx, writer, sub_type, ptr );
+	unpack_ctx->ptr_stack.Add( { ptr, sub_type } );
 }
 
-static dl_error_t dl_txt_unpack_write_subdata_ptr_array( dl_ctx_t            dl_ctx,
-											 			 dl_txt_unpack_ctx*  unpack_ctx,
-														 dl_binary_writer*   writer,
-														 const uint8_t*      array,
-														 uint32_t            array_count,
-														 const dl_type_desc* sub_type )
+static void dl_txt_unpack_gather_subdata_ptr_array( dl_txt_unpack_ctx* unpack_ctx,
+													const uint8_t*     array,
+													uint32_t           array_count,
+													const dl_type_hot* sub_type )
 {
 	for( uint32_t element = 0; element < array_count; ++element )
-	{
-		dl_error_t err = dl_txt_unpack_write_subdata_ptr( dl_ctx,
-														  unpack_ctx,
-														  writer,
-														  array + sizeof(void*) * element,
-														  sub_type );
-		if( DL_ERROR_OK != err ) return err;
-	}
-	return DL_ERROR_OK;
+		dl_txt_unpack_gather_subdata_ptr( unpack_ctx, array + sizeof(void*) * element, sub_type );
 }
 
-static dl_error_t dl_txt_unpack_write_member_subdata( dl_ctx_t dl_ctx, dl_txt_unpack_ctx* unpack_ctx, dl_binary_writer* writer, const dl_member_desc* member, const uint8_t* member_data )
+static void dl_txt_unpack_gather_member_subdata( dl_ctx_t dl_ctx, dl_txt_unpack_ctx* unpack_ctx, const dl_member_hot* member, const uint8_t* member_data )
 {
 	switch( member->AtomType() )
 	{
@@ -597,23 +622,12 @@ static dl_error_t dl_txt_unpack_write_member_subdata( dl_ctx_t dl_ctx, dl_txt_un
 			switch( member->StorageType() )
 			{
 				case DL_TYPE_STORAGE_PTR:
-					return dl_txt_unpack_write_subdata_ptr( dl_ctx,
-															unpack_ctx,
-															writer,
-															member_data,
-															dl_internal_find_type( dl_ctx, member->type_id ) );
+					dl_txt_unpack_gather_subdata_ptr( unpack_ctx, member_data, member->subtype );
 				break;
 
 				case DL_TYPE_STORAGE_STRUCT:
-				{
-					const dl_type_desc* subtype = dl_internal_find_type( dl_ctx, member->type_id );
-					if( subtype->flags & DL_TYPE_FLAG_HAS_SUBDATA )
-						return dl_txt_unpack_write_subdata( dl_ctx,
-															unpack_ctx,
-															writer,
-															subtype,
-															member_data );
-				}
+					if( member->subtype->flags & DL_TYPE_FLAG_HAS_SUBDATA )
+						dl_txt_unpack_gather_subdata( dl_ctx, unpack_ctx, member->subtype, member_data );
 				break;
 				default:
 					// ignore ...
@@ -626,23 +640,18 @@ static dl_error_t dl_txt_unpack_write_member_subdata( dl_ctx_t dl_ctx, dl_txt_un
 			switch( member->StorageType() )
 			{
 				case DL_TYPE_STORAGE_PTR:
-					return dl_txt_unpack_write_subdata_ptr_array( dl_ctx,
-																  unpack_ctx,
-																  writer,
-																  member_data,
-																  member->inline_array_cnt(),
-																  dl_internal_find_type( dl_ctx, member->type_id ) );
+					dl_txt_unpack_gather_subdata_ptr_array( unpack_ctx,
+															member_data,
+															member->inline_array_cnt(),
+															member->subtype );
 				break;
 				case DL_TYPE_STORAGE_STRUCT:
 				{
-					const dl_type_desc* subtype = dl_internal_find_type( dl_ctx, member->type_id );
+					const dl_type_hot* subtype = member->subtype;
 					if( subtype->flags & DL_TYPE_FLAG_HAS_SUBDATA )
 					{
 						for( uint32_t i = 0; i < member->inline_array_cnt(); ++i )
-						{
-							dl_error_t err = dl_txt_unpack_write_subdata( dl_ctx, unpack_ctx, writer, subtype, member_data + i * subtype->size[DL_PTR_SIZE_HOST] );
-							if( DL_ERROR_OK != err ) return err;
-						}
+							dl_txt_unpack_gather_subdata( dl_ctx, unpack_ctx, subtype, member_data + i * subtype->size );
 					}
 				}
 				break;
@@ -658,16 +667,13 @@ static dl_error_t dl_txt_unpack_write_member_subdata( dl_ctx_t dl_ctx, dl_txt_un
 			{
 				case DL_TYPE_STORAGE_STRUCT:
 				{
-					const dl_type_desc* subtype = dl_internal_find_type( dl_ctx, member->type_id );
+					const dl_type_hot* subtype = member->subtype;
 					if( subtype->flags & DL_TYPE_FLAG_HAS_SUBDATA )
 					{
 						const uint8_t* array = *(const uint8_t**) member_data;
 						uint32_t array_count = *(uint32_t*)(member_data + sizeof(uintptr_t));
 						for( uint32_t i = 0; i < array_count; ++i )
-						{
-							dl_error_t err = dl_txt_unpack_write_subdata( dl_ctx, unpack_ctx, writer, subtype, array + i * subtype->size[DL_PTR_SIZE_HOST] );
-							if( DL_ERROR_OK != err ) return err;
-						}
+							dl_txt_unpack_gather_subdata( dl_ctx, unpack_ctx, subtype, array + i * subtype->size );
 					}
 				}
 				break;
@@ -675,12 +681,10 @@ static dl_error_t dl_txt_unpack_write_member_subdata( dl_ctx_t dl_ctx, dl_txt_un
 				{
 					const uint8_t* array = *(const uint8_t**)member_data;
 					uint32_t array_count = *(uint32_t*)(member_data + sizeof(uintptr_t) );
-					return dl_txt_unpack_write_subdata_ptr_array( dl_ctx,
-																  unpack_ctx,
-																  writer,
-																  array,
-																  array_count,
-																  dl_internal_find_type( dl_ctx, member->type_id ) );
+					dl_txt_unpack_gather_subdata_ptr_array( unpack_ctx,
+															array,
+															array_count,
+															member->subtype );
 				}
 				break;
 				default:
@@ -693,27 +697,71 @@ static dl_error_t dl_txt_unpack_write_member_subdata( dl_ctx_t dl_ctx, dl_txt_un
 			// ignore ...
 			break;
 	}
-	return DL_ERROR_OK;
 }
 
-static dl_error_t dl_txt_unpack_write_subdata( dl_ctx_t dl_ctx, dl_txt_unpack_ctx* unpack_ctx, dl_binary_writer* writer, const dl_type_desc* type, const uint8_t* struct_data )
+/*
+	Push all ptrs directly reachable from struct_data, i.e. not via another ptr, to unpack_ctx->ptr_stack in
+	the order they are found. Only offsets and types is needed here so the hot type-data is walked.
+*/
+static void dl_txt_unpack_gather_subdata( dl_ctx_t dl_ctx, dl_txt_unpack_ctx* unpack_ctx, const dl_type_hot* type, const uint8_t* struct_data )
 {
 	if (type->flags & DL_TYPE_FLAG_IS_UNION)
 	{
-		// TODO: check if type is not set at all ...
-		size_t type_offset = dl_internal_union_type_offset(dl_ctx, type, DL_PTR_SIZE_HOST);
-
-		// find member index from union type ...
-		uint32_t union_type = *((uint32_t*)(struct_data + type_offset));
-		const dl_member_desc* member = dl_internal_union_type_to_member(dl_ctx, type, union_type);
-		return dl_txt_unpack_write_member_subdata(dl_ctx, unpack_ctx, writer, member, struct_data + member->offset[DL_PTR_SIZE_HOST]);
+		// find member index from union type, an invalid type is reported when the union is unpacked ...
+		uint32_t union_type = *((uint32_t*)(struct_data + type->union_type_offset[DL_PTR_SIZE_HOST]));
+		const dl_member_hot* member = dl_internal_union_type_to_member_hot(dl_ctx, type, union_type);
+		if( member == 0x0 )
+			return;
+		dl_txt_unpack_gather_member_subdata(dl_ctx, unpack_ctx, member, struct_data + member->offset);
+		return;
 	}
 
 	for (uint32_t member_index = 0; member_index < type->member_count; ++member_index)
 	{
-		const dl_member_desc* member = dl_get_type_member(dl_ctx, type, member_index);
-		dl_error_t err = dl_txt_unpack_write_member_subdata(dl_ctx, unpack_ctx, writer, member, struct_data + member->offset[DL_PTR_SIZE_HOST]);
+		const dl_member_hot* member = type->members + member_index;
+		dl_txt_unpack_gather_member_subdata(dl_ctx, unpack_ctx, member, struct_data + member->offset);
+	}
+}
+
+/*
+	Gather the ptrs reachable from struct_data and push them so that the first one found is popped first,
+	this gives the same depth-first order as recursing into each ptr as soon as it is found without using
+	the callstack.
+*/
+static void dl_txt_unpack_push_subdata( dl_ctx_t dl_ctx, dl_txt_unpack_ctx* unpack_ctx, const dl_type_hot* type, const uint8_t* struct_data )
+{
+	size_t first = unpack_ctx->ptr_stack.Len();
+	dl_txt_unpack_gather_subdata( dl_ctx, unpack_ctx, type, struct_data );
+	size_t last = unpack_ctx->ptr_stack.Len();
+	while( last - first > 1 )
+	{
+		dl_txt_unpack_ctx::SPtr tmp = unpack_ctx->ptr_stack[first];
+		unpack_ctx->ptr_stack[first++] = unpack_ctx->ptr_stack[--last];
+		unpack_ctx->ptr_stack[last] = tmp;
+	}
+}
+
+static dl_error_t dl_txt_unpack_write_subdata( dl_ctx_t dl_ctx, dl_txt_unpack_ctx* unpack_ctx, dl_binary_writer* writer, const dl_type_desc* type, const uint8_t* struct_data )
+{
+	dl_txt_unpack_push_subdata( dl_ctx, unpack_ctx, dl_internal_type_hot( dl_ctx, type ), struct_data );
+
+	while( unpack_ctx->ptr_stack.Len() > 0 )
+	{
+		dl_txt_unpack_ctx::SPtr sub = unpack_ctx->ptr_stack.Pop();
+		if( !unpack_ctx->written_ptrs.insert( (uintptr_t)sub.ptr, 0 ) )
+			continue; // ... pushed more than once before it was written ...
+
+		dl_txt_unpack_write_indent( writer, unpack_ctx );
+		dl_txt_unpack_ptr( writer, unpack_ctx, sub.ptr );
+		dl_binary_writer_write( writer, " : ", 3 );
+
+		dl_error_t err = dl_txt_unpack_struct( dl_ctx, unpack_ctx, writer, dl_internal_type_desc_of( dl_ctx, sub.type ), sub.ptr );
 		if( DL_ERROR_OK != err ) return err;
+
+		// TODO: extra , at last elem =/
+		dl_binary_writer_write( writer, ",\n", 2 );
+
+		dl_txt_unpack_push_subdata( dl_ctx, unpack_ctx, sub.type, sub.ptr );
 	}
 	return DL_ERROR_OK;
 }
@@ -725,12 +773,16 @@ static dl_error_t dl_txt_unpack_struct( dl_ctx_t dl_ctx, dl_txt_unpack_ctx* unpa
 	unpack_ctx->indent += 2;
 	if( type->flags & DL_TYPE_FLAG_IS_UNION )
 	{
-		// TODO: check if type is not set at all ...
 		size_t type_offset = dl_internal_union_type_offset( dl_ctx, type, DL_PTR_SIZE_HOST );
 
 		// find member index from union type ...
 		uint32_t union_type = *((uint32_t*)(struct_data + type_offset));
 		const dl_member_desc* member = dl_internal_union_type_to_member(dl_ctx, type, union_type);
+		if( member == 0x0 )
+		{
+			dl_log_error( dl_ctx, "Could not find union type %X for type %s", union_type, dl_internal_type_name( dl_ctx, type ) );
+			return DL_ERROR_MALFORMED_DATA;
+		}
 		dl_error_t err = dl_txt_unpack_member( dl_ctx, unpack_ctx, writer, member, struct_data + member->offset[DL_PTR_SIZE_HOST] );
 		if( DL_ERROR_OK != err ) return err;
 		dl_binary_writer_write( writer, "\n", 1 );
@@ -816,7 +868,8 @@ dl_error_t dl_txt_unpack_loaded( dl_ctx_t    dl_ctx,                 dl_typeid_t
 	unpackctx.indent               = 0;
 	unpackctx.has_ptrs             = false;
 
-	unpackctx.ptrs.Add( { unpackctx.packed_instance, type } );
+	if( unpackctx.packed_instance != 0x0 )
+		unpackctx.written_ptrs.insert( (uintptr_t)unpackctx.packed_instance, 0 );
 
 	dl_error_t err = dl_txt_unpack_root( dl_ctx, &unpackctx, &writer, type );
 	if( produced_bytes )
@@ -0,0 +1,733 @@
+#include <dl/dl_typelib.h>
+#include "dl_types.h"
+
+#include <algorithm>
+
+dl_error_t dl_internal_build_type_defaults( dl_ctx_t dl_ctx );
+void       dl_internal_detach_inplace_typelib( dl_ctx_t dl_ctx );
+
+/**
+ * Open addressed typeid -> index lookup used to resolve members, typeids are already hashes so they are used as is.
+ */
+struct dl_id_lookup
+{
+	uint32_t* slots;
+	uint32_t  mask;
+};
+
+static bool dl_internal_id_lookup_build( dl_ctx_t dl_ctx, dl_id_lookup* lookup, const dl_typeid_t* ids, uint32_t id_count )
+{
+	uint32_t lookup_size = 16;
+	while( lookup_size < id_count * 2 )
+		lookup_size *= 2;
+	lookup->slots = (uint32_t*)dl_alloc( &dl_ctx->alloc, lookup_size * sizeof( uint32_t ) );
+	if( lookup->slots == 0x0 )
+		return false;
+	memset( lookup->slots, 0xFF, lookup_size * sizeof( uint32_t ) );
+
+	lookup->mask = lookup_size - 1;
+	for( uint32_t i = 0; i < id_count; ++i )
+	{
+		uint32_t slot = ids[i] & lookup->mask;
+		while( lookup->slots[slot] != UINT32_MAX )
+			slot = ( slot + 1 ) & lookup->mask;
+		lookup->slots[slot] = i;
+	}
+	return true;
+}
+
+static uint32_t dl_internal_id_lookup_find( const dl_id_lookup* lookup, const dl_typeid_t* ids, dl_typeid_t id )
+{
+	for( uint32_t slot = id & lookup->mask; lookup->slots[slot] != UINT32_MAX; slot = ( slot + 1 ) & lookup->mask )
+		if( ids[ lookup->slots[slot] ] == id )
+			return lookup->slots[slot];
+	return UINT32_MAX;
+}
+
+/**
+ * Build dl_type_hot and dl_member_hot for all types and members in dl_ctx, called each time types are loaded,
+ * replaced or unloaded. Everything is rebuilt since the hot data point into itself and a grow of the arrays would move it.
+ * This is also where each member get its type or enum resolved, so members referencing types in a typelib loaded
+ * later get resolved when that typelib arrive.
+ */
+dl_error_t dl_internal_build_hot_types( dl_ctx_t dl_ctx )
+{
+	dl_type_hot* type_hots = (dl_type_hot*)dl_realloc( &dl_ctx->alloc, dl_ctx->type_hots, dl_ctx->type_count * sizeof( dl_type_hot ), dl_ctx->type_hots_count * sizeof( dl_type_hot ) );
+	if( dl_ctx->type_count > 0 && type_hots == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	dl_ctx->type_hots       = type_hots;
+	dl_ctx->type_hots_count = 0;
+
+	dl_member_hot* member_hots = (dl_member_hot*)dl_realloc( &dl_ctx->alloc, dl_ctx->member_hots, dl_ctx->member_count * sizeof( dl_member_hot ), dl_ctx->member_hots_count * sizeof( dl_member_hot ) );
+	if( dl_ctx->member_count > 0 && member_hots == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	dl_ctx->member_hots       = member_hots;
+	dl_ctx->member_hots_count = 0;
+
+	dl_id_lookup type_lookup;
+	if( !dl_internal_id_lookup_build( dl_ctx, &type_lookup, dl_ctx->type_ids, dl_ctx->type_count ) )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+
+	dl_id_lookup enum_lookup;
+	if( !dl_internal_id_lookup_build( dl_ctx, &enum_lookup, dl_ctx->enum_ids, dl_ctx->enum_count ) )
+	{
+		dl_free( &dl_ctx->alloc, type_lookup.slots );
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	}
+
+	for( uint32_t i = 0; i < dl_ctx->type_count; ++i )
+	{
+		const dl_type_desc* type = dl_ctx->type_descs + i;
+		dl_type_hot* hot = type_hots + i;
+		hot->size         = type->size[DL_PTR_SIZE_HOST];
+		hot->alignment    = type->alignment[DL_PTR_SIZE_HOST];
+		hot->flags        = type->flags;
+		hot->member_count = type->member_count;
+		hot->members      = member_hots + type->member_start;
+		hot->union_type_offset[DL_PTR_SIZE_32BIT] = 0;
+		hot->union_type_offset[DL_PTR_SIZE_64BIT] = 0;
+		if( type->flags & DL_TYPE_FLAG_IS_UNION )
+		{
+			hot->union_type_offset[DL_PTR_SIZE_32BIT] = dl_internal_calc_union_type_offset( dl_ctx, type, DL_PTR_SIZE_32BIT );
+			hot->union_type_offset[DL_PTR_SIZE_64BIT] = dl_internal_calc_union_type_offset( dl_ctx, type, DL_PTR_SIZE_64BIT );
+		}
+	}
+
+	for( uint32_t i = 0; i < dl_ctx->member_count; ++i )
+	{
+		const dl_member_desc* member = dl_ctx->member_descs + i;
+		dl_member_hot* hot = member_hots + i;
+		hot->type     = member->type;
+		hot->offset   = member->offset[DL_PTR_SIZE_HOST];
+		hot->size     = member->size[DL_PTR_SIZE_HOST];
+		hot->subindex = UINT32_MAX;
+		hot->subtype  = 0x0;
+
+		switch( member->StorageType() )
+		{
+			case DL_TYPE_STORAGE_STRUCT:
+			case DL_TYPE_STORAGE_PTR:
+				hot->subindex = dl_internal_id_lookup_find( &type_lookup, dl_ctx->type_ids, member->type_id );
+				if( hot->subindex != UINT32_MAX )
+					hot->subtype = type_hots + hot->subindex;
+				break;
+			case DL_TYPE_STORAGE_ENUM_INT8:
+			case DL_TYPE_STORAGE_ENUM_INT16:
+			case DL_TYPE_STORAGE_ENUM_INT32:
+			case DL_TYPE_STORAGE_ENUM_INT64:
+			case DL_TYPE_STORAGE_ENUM_UINT8:
+			case DL_TYPE_STORAGE_ENUM_UINT16:
+			case DL_TYPE_STORAGE_ENUM_UINT32:
+			case DL_TYPE_STORAGE_ENUM_UINT64:
+				hot->subindex = dl_internal_id_lookup_find( &enum_lookup, dl_ctx->enum_ids, member->type_id );
+				break;
+			default:
+				break;
+		}
+	}
+
+	dl_free( &dl_ctx->alloc, enum_lookup.slots );
+	dl_free( &dl_ctx->alloc, type_lookup.slots );
+	dl_ctx->type_hots_count   = dl_ctx->type_count;
+	dl_ctx->member_hots_count = dl_ctx->member_count;
+	return DL_ERROR_OK;
+}
+
+/**
+ * Start a new module at the end of all ctx-arrays, called by all typelib-loaders before appending anything.
+ */
+void dl_internal_begin_module( dl_ctx_t dl_ctx, uint32_t name_hash )
+{
+	dl_ctx->modules = (dl_module_desc*)dl_realloc( &dl_ctx->alloc, dl_ctx->modules, ( dl_ctx->module_count + 1 ) * sizeof( dl_module_desc ), dl_ctx->module_count * sizeof( dl_module_desc ) );
+
+	dl_module_desc* module = &dl_ctx->modules[ dl_ctx->module_count++ ];
+	module->name_hash              = name_hash;
+	module->type_start             = dl_ctx->type_count;
+	module->enum_start             = dl_ctx->enum_count;
+	module->member_start           = dl_ctx->member_count;
+	module->enum_value_start       = dl_ctx->enum_value_count;
+	module->enum_alias_start       = dl_ctx->enum_alias_count;
+	module->metadata_start         = dl_ctx->metadatas_count;
+	module->typedata_strings_start = (uint32_t)dl_ctx->typedata_strings_size;
+	module->c_includes_start       = (uint32_t)dl_ctx->c_includes_size;
+	module->default_data_start     = (uint32_t)dl_ctx->default_data_size;
+
+	++dl_ctx->generation;
+}
+
+/**
+ * Get the start-indices of what follows module_index, i.e. the end of the module.
+ */
+static void dl_internal_module_end( dl_ctx_t dl_ctx, unsigned int module_index, dl_module_desc* end )
+{
+	if( module_index + 1 < dl_ctx->module_count )
+	{
+		*end = dl_ctx->modules[ module_index + 1 ];
+		return;
+	}
+
+	end->name_hash              = 0;
+	end->type_start             = dl_ctx->type_count;
+	end->enum_start             = dl_ctx->enum_count;
+	end->member_start           = dl_ctx->member_count;
+	end->enum_value_start       = dl_ctx->enum_value_count;
+	end->enum_alias_start       = dl_ctx->enum_alias_count;
+	end->metadata_start         = dl_ctx->metadatas_count;
+	end->typedata_strings_start = (uint32_t)dl_ctx->typedata_strings_size;
+	end->c_includes_start       = (uint32_t)dl_ctx->c_includes_size;
+	end->default_data_start     = (uint32_t)dl_ctx->default_data_size;
+}
+
+template <typename T>
+static inline void dl_internal_erase_range( T* arr, size_t count, size_t start, size_t end )
+{
+	if( end < count )
+		memmove( arr + start, arr + end, ( count - end ) * sizeof( T ) );
+}
+
+/**
+ * Remove all descriptors of a module from the ctx-arrays and rebase everything loaded after it. Metadata-instances
+ * of the module are not freed since the caller might need them to roll back.
+ */
+static void dl_internal_remove_module( dl_ctx_t dl_ctx, unsigned int module_index )
+{
+	dl_module_desc start = dl_ctx->modules[ module_index ];
+	dl_module_desc end;
+	dl_internal_module_end( dl_ctx, module_index, &end );
+
+	uint32_t types       = end.type_start             - start.type_start;
+	uint32_t enums       = end.enum_start             - start.enum_start;
+	uint32_t members     = end.member_start           - start.member_start;
+	uint32_t enum_values = end.enum_value_start       - start.enum_value_start;
+	uint32_t enum_alias  = end.enum_alias_start       - start.enum_alias_start;
+	uint32_t metadatas   = end.metadata_start         - start.metadata_start;
+	uint32_t strings     = end.typedata_strings_start - start.typedata_strings_start;
+	uint32_t c_includes  = end.c_includes_start       - start.c_includes_start;
+	uint32_t defaults    = end.default_data_start     - start.default_data_start;
+
+	for( unsigned int i = end.type_start; i < dl_ctx->type_count; ++i )
+	{
+		dl_type_desc* type = &dl_ctx->type_descs[i];
+		type->name -= strings;
+		if( type->comment != UINT32_MAX )
+			type->comment -= strings;
+		type->member_start -= members;
+		if( type->metadata_count )
+			type->metadata_start -= metadatas;
+	}
+
+	for( unsigned int i = end.member_start; i < dl_ctx->member_count; ++i )
+	{
+		dl_member_desc* member = &dl_ctx->member_descs[i];
+		member->name -= strings;
+		if( member->comment != UINT32_MAX )
+			member->comment -= strings;
+		if( member->metadata_count )
+			member->metadata_start -= metadatas;
+		if( member->default_value_offset != UINT32_MAX )
+			member->default_value_offset -= defaults;
+	}
+
+	for( unsigned int i = end.enum_start; i < dl_ctx->enum_count; ++i )
+	{
+		dl_enum_desc* e = &dl_ctx->enum_descs[i];
+		e->name -= strings;
+		if( e->comment != UINT32_MAX )
+			e->comment -= strings;
+		e->value_start -= enum_values;
+		e->alias_start -= enum_alias;
+		if( e->metadata_count )
+			e->metadata_start -= metadatas;
+	}
+
+	for( unsigned int i = end.enum_value_start; i < dl_ctx->enum_value_count; ++i )
+	{
+		dl_enum_value_desc* value = &dl_ctx->enum_value_descs[i];
+		value->main_alias -= enum_alias;
+		if( value->comment != UINT32_MAX )
+			value->comment -= strings;
+		if( value->metadata_count )
+			value->metadata_start -= metadatas;
+	}
+
+	for( unsigned int i = end.enum_alias_start; i < dl_ctx->enum_alias_count; ++i )
+	{
+		dl_enum_alias_desc* alias = &dl_ctx->enum_alias_descs[i];
+		alias->name        -= strings;
+		alias->value_index -= enum_values;
+	}
+
+	dl_internal_erase_range( dl_ctx->type_ids,           dl_ctx->type_count,            start.type_start,             end.type_start );
+	dl_internal_erase_range( dl_ctx->type_descs,         dl_ctx->type_count,            start.type_start,             end.type_start );
+	dl_internal_erase_range( dl_ctx->enum_ids,           dl_ctx->enum_count,            start.enum_start,             end.enum_start );
+	dl_internal_erase_range( dl_ctx->enum_descs,         dl_ctx->enum_count,            start.enum_start,             end.enum_start );
+	dl_internal_erase_range( dl_ctx->member_descs,       dl_ctx->member_count,          start.member_start,           end.member_start );
+	dl_internal_erase_range( dl_ctx->enum_value_descs,   dl_ctx->enum_value_count,      start.enum_value_start,       end.enum_value_start );
+	dl_internal_erase_range( dl_ctx->enum_alias_descs,   dl_ctx->enum_alias_count,      start.enum_alias_start,       end.enum_alias_start );
+	dl_internal_erase_range( dl_ctx->metadatas,          dl_ctx->metadatas_count,       start.metadata_start,         end.metadata_start );
+	dl_internal_erase_range( dl_ctx->metadata_infos,     dl_ctx->metadatas_count,       start.metadata_start,         end.metadata_start );
+	dl_internal_erase_range( dl_ctx->metadata_typeinfos, dl_ctx->metadatas_count,       start.metadata_start,         end.metadata_start );
+	dl_internal_erase_range( dl_ctx->typedata_strings,   dl_ctx->typedata_strings_size, start.typedata_strings_start, end.typedata_strings_start );
+	dl_internal_erase_range( dl_ctx->c_includes,         dl_ctx->c_includes_size,       start.c_includes_start,       end.c_includes_start );
+	dl_internal_erase_range( dl_ctx->default_data,       dl_ctx->default_data_size,     start.default_data_start,     end.default_data_start );
+
+	dl_ctx->type_count            -= types;
+	dl_ctx->enum_count            -= enums;
+	dl_ctx->member_count          -= members;
+	dl_ctx->enum_value_count      -= enum_values;
+	dl_ctx->enum_alias_count      -= enum_alias;
+	dl_ctx->metadatas_count       -= metadatas;
+	dl_ctx->typedata_strings_size -= strings;
+	dl_ctx->c_includes_size       -= c_includes;
+	dl_ctx->default_data_size     -= defaults;
+
+	for( unsigned int i = module_index + 1; i < dl_ctx->module_count; ++i )
+	{
+		dl_module_desc* module = &dl_ctx->modules[i];
+		module->type_start             -= types;
+		module->enum_start             -= enums;
+		module->member_start           -= members;
+		module->enum_value_start       -= enum_values;
+		module->enum_alias_start       -= enum_alias;
+		module->metadata_start         -= metadatas;
+		module->typedata_strings_start -= strings;
+		module->c_includes_start       -= c_includes;
+		module->default_data_start     -= defaults;
+	}
+	dl_internal_erase_range( dl_ctx->modules, dl_ctx->module_count, module_index, module_index + 1 );
+	--dl_ctx->module_count;
+
+	// ... all type-indices after the module has moved so defaults and hot types need a full rebuild ...
+	dl_ctx->type_hots_count        = 0;
+	dl_ctx->member_hots_count      = 0;
+	dl_ctx->type_defaults_count    = 0;
+	dl_ctx->default_templates_size = 0;
+	dl_ctx->default_members_count  = 0;
+}
+
+/**
+ * Copy all type-data of dl_ctx to snapshot to be able to roll back a failed replace or unload. Metadata-instances
+ * are shared and not copied and per-type defaults are not copied as they are rebuilt on restore.
+ */
+static void dl_internal_snapshot_create( dl_ctx_t dl_ctx, dl_context* snapshot )
+{
+	memcpy( snapshot, dl_ctx, sizeof( dl_context ) );
+	snapshot->type_ids           = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->type_ids,           dl_ctx->type_count );
+	snapshot->type_descs         = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->type_descs,         dl_ctx->type_count );
+	snapshot->enum_ids           = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->enum_ids,           dl_ctx->enum_count );
+	snapshot->enum_descs         = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->enum_descs,         dl_ctx->enum_count );
+	snapshot->member_descs       = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->member_descs,       dl_ctx->member_count );
+	snapshot->enum_value_descs   = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->enum_value_descs,   dl_ctx->enum_value_count );
+	snapshot->enum_alias_descs   = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->enum_alias_descs,   dl_ctx->enum_alias_count );
+	snapshot->typedata_strings   = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->typedata_strings,   dl_ctx->typedata_strings_size );
+	snapshot->c_includes         = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->c_includes,         dl_ctx->c_includes_size );
+	snapshot->default_data       = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->default_data,       dl_ctx->default_data_size );
+	snapshot->metadatas          = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->metadatas,          dl_ctx->metadatas_count );
+	snapshot->metadata_infos     = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->metadata_infos,     dl_ctx->metadatas_count );
+	snapshot->metadata_typeinfos = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->metadata_typeinfos, dl_ctx->metadatas_count );
+	snapshot->modules            = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->modules,            dl_ctx->module_count );
+
+	snapshot->type_capacity        = snapshot->type_count;
+	snapshot->enum_capacity        = snapshot->enum_count;
+	snapshot->member_capacity      = snapshot->member_count;
+	snapshot->enum_value_capacity  = snapshot->enum_value_count;
+	snapshot->enum_alias_capacity  = snapshot->enum_alias_count;
+	snapshot->typedata_strings_cap = snapshot->typedata_strings_size;
+	snapshot->c_includes_cap       = snapshot->c_includes_size;
+	snapshot->metadatas_cap        = snapshot->metadatas_count;
+
+	snapshot->type_hots              = 0x0;
+	snapshot->member_hots            = 0x0;
+	snapshot->type_hots_count        = 0;
+	snapshot->member_hots_count      = 0;
+	snapshot->type_defaults          = 0x0;
+	snapshot->type_defaults_count    = 0;
+	snapshot->default_templates      = 0x0;
+	snapshot->default_templates_size = 0;
+	snapshot->default_members        = 0x0;
+	snapshot->default_members_count  = 0;
+}
+
+static void dl_internal_free_type_data( dl_allocator* alloc, dl_context* ctx )
+{
+	dl_free( alloc, ctx->type_ids );
+	dl_free( alloc, ctx->type_descs );
+	dl_free( alloc, ctx->enum_ids );
+	dl_free( alloc, ctx->enum_descs );
+	dl_free( alloc, ctx->member_descs );
+	dl_free( alloc, ctx->enum_value_descs );
+	dl_free( alloc, ctx->enum_alias_descs );
+	dl_free( alloc, ctx->typedata_strings );
+	dl_free( alloc, ctx->c_includes );
+	dl_free( alloc, ctx->default_data );
+	dl_free( alloc, (void*)ctx->metadatas );
+	dl_free( alloc, (void*)ctx->metadata_infos );
+	dl_free( alloc, ctx->metadata_typeinfos );
+	dl_free( alloc, ctx->modules );
+	dl_free( alloc, ctx->type_hots );
+	dl_free( alloc, ctx->member_hots );
+	dl_free( alloc, ctx->type_defaults );
+	dl_free( alloc, ctx->default_templates );
+	dl_free( alloc, ctx->default_members );
+}
+
+static void dl_internal_snapshot_restore( dl_ctx_t dl_ctx, dl_context* snapshot )
+{
+	dl_allocator alloc = dl_ctx->alloc;
+	dl_internal_free_type_data( &alloc, dl_ctx );
+	memcpy( dl_ctx, snapshot, sizeof( dl_context ) );
+	(void)dl_internal_build_hot_types( dl_ctx );
+	(void)dl_internal_build_type_defaults( dl_ctx );
+}
+
+static unsigned int dl_internal_find_module( dl_ctx_t dl_ctx, uint32_t name_hash )
+{
+	for( unsigned int i = 0; i < dl_ctx->module_count; ++i )
+		if( dl_ctx->modules[i].name_hash == name_hash )
+			return i;
+	return UINT32_MAX;
+}
+
+/**
+ * Append the ids of all types and enums in a module to ids.
+ */
+static dl_error_t dl_internal_add_module_ids( dl_ctx_t dl_ctx, unsigned int module_index, dl_typeid_t** ids, size_t* id_count )
+{
+	dl_module_desc start = dl_ctx->modules[ module_index ];
+	dl_module_desc end;
+	dl_internal_module_end( dl_ctx, module_index, &end );
+
+	size_t types = end.type_start - start.type_start;
+	size_t enums = end.enum_start - start.enum_start;
+	if( types + enums == 0 )
+		return DL_ERROR_OK;
+
+	dl_typeid_t* new_ids = (dl_typeid_t*)dl_realloc( &dl_ctx->alloc, *ids, ( *id_count + types + enums ) * sizeof( dl_typeid_t ), *id_count * sizeof( dl_typeid_t ) );
+	if( new_ids == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	*ids = new_ids;
+
+	if( types > 0 )
+		memcpy( new_ids + *id_count,         dl_ctx->type_ids + start.type_start, types * sizeof( dl_typeid_t ) );
+	if( enums > 0 )
+		memcpy( new_ids + *id_count + types, dl_ctx->enum_ids + start.enum_start, enums * sizeof( dl_typeid_t ) );
+	*id_count += types + enums;
+	return DL_ERROR_OK;
+}
+
+/**
+ * Re-resolve all members that use one of the types in ids. They need to still find their type and, if the type is
+ * stored inline in the member, find it with the same size and alignment as it had when the member was loaded.
+ */
+static dl_error_t dl_internal_resolve_dependents( dl_ctx_t dl_ctx, dl_typeid_t* ids, size_t id_count )
+{
+	std::sort( ids, ids + id_count );
+
+	for( unsigned int type_index = 0; type_index < dl_ctx->type_count; ++type_index )
+	{
+		const dl_type_desc* type = &dl_ctx->type_descs[ type_index ];
+		for( unsigned int member_index = 0; member_index < type->member_count; ++member_index )
+		{
+			const dl_member_desc* member = &dl_ctx->member_descs[ type->member_start + member_index ];
+			if( member->type_id == 0 || !std::binary_search( ids, ids + id_count, member->type_id ) )
+				continue;
+
+			const dl_enum_desc* sub_enum = dl_internal_find_enum( dl_ctx, member->type_id );
+			if( sub_enum != 0x0 )
+			{
+				if( member->StorageType() != sub_enum->storage )
+				{
+					dl_log_error( dl_ctx, "member '%s::%s' was loaded with another storage for enum '%s'",
+								  dl_internal_type_name( dl_ctx, type ), dl_internal_member_name( dl_ctx, member ), dl_internal_enum_name( dl_ctx, sub_enum ) );
+					return DL_ERROR_TYPE_MISMATCH;
+				}
+				continue;
+			}
+
+			const dl_type_desc* sub_type = dl_internal_find_type( dl_ctx, member->type_id );
+			if( sub_type == 0x0 )
+			{
+				dl_log_error( dl_ctx, "couldn't find type for member '%s::%s'", dl_internal_type_name( dl_ctx, type ), dl_internal_member_name( dl_ctx, member ) );
+				return DL_ERROR_TYPE_NOT_FOUND;
+			}
+
+			if( member->StorageType() != DL_TYPE_STORAGE_STRUCT )
+				continue;
+
+			uint32_t count;
+			switch( member->AtomType() )
+			{
+				case DL_TYPE_ATOM_POD:          count = 1; break;
+				case DL_TYPE_ATOM_INLINE_ARRAY: count = member->inline_array_cnt(); break;
+				default: continue; // only referenced by pointer.
+			}
+
+			for( int ptr_size = DL_PTR_SIZE_32BIT; ptr_size <= DL_PTR_SIZE_64BIT; ++ptr_size )
+			{
+				if( member->size[ ptr_size ] != sub_type->size[ ptr_size ] * count || member->alignment[ ptr_size ] != sub_type->alignment[ ptr_size ] )
+				{
+					dl_log_error( dl_ctx, "member '%s::%s' stores '%s' inline and the size or alignment of '%s' changed",
+								  dl_internal_type_name( dl_ctx, type ), dl_internal_member_name( dl_ctx, member ),
+								  dl_internal_type_name( dl_ctx, sub_type ), dl_internal_type_name( dl_ctx, sub_type ) );
+					return DL_ERROR_TYPE_MISMATCH;
+				}
+			}
+		}
+	}
+	return DL_ERROR_OK;
+}
+
+/**
+ * True if instances of the type type_id in dl_ctx are not laid out as instances of it in old_ctx. Only what is stored in
+ * an instance is compared, not names or comments, and enums never change layout as their storage is checked when
+ * resolving members.
+ */
+static bool dl_internal_type_layout_changed( dl_ctx_t dl_ctx, dl_ctx_t old_ctx, dl_typeid_t type_id )
+{
+	const dl_type_desc* type     = dl_internal_find_type( dl_ctx,  type_id );
+	const dl_type_desc* old_type = dl_internal_find_type( old_ctx, type_id );
+	if( type == 0x0 || old_type == 0x0 )
+		return type != old_type;
+
+	const uint32_t layout_flags = DL_TYPE_FLAG_HAS_SUBDATA | DL_TYPE_FLAG_IS_UNION;
+	if( ( type->flags & layout_flags ) != ( old_type->flags & layout_flags ) ||
+		type->member_count != old_type->member_count ||
+		memcmp( type->size,      old_type->size,      sizeof( type->size ) ) != 0 ||
+		memcmp( type->alignment, old_type->alignment, sizeof( type->alignment ) ) != 0 )
+		return true;
+
+	for( uint32_t i = 0; i < type->member_count; ++i )
+	{
+		const dl_member_desc* member     = &dl_ctx->member_descs[ type->member_start + i ];
+		const dl_member_desc* old_member = &old_ctx->member_descs[ old_type->member_start + i ];
+		if( member->type    != old_member->type ||
+			member->type_id != old_member->type_id ||
+			memcmp( member->size,   old_member->size,   sizeof( member->size ) ) != 0 ||
+			memcmp( member->offset, old_member->offset, sizeof( member->offset ) ) != 0 )
+			return true;
+	}
+	return false;
+}
+
+static bool dl_internal_type_has_subdata( dl_ctx_t dl_ctx, const dl_type_desc* type )
+{
+	for( uint32_t i = 0; i < type->member_count; ++i )
+	{
+		const dl_member_desc* member = &dl_ctx->member_descs[ type->member_start + i ];
+		if( member->AtomType() == DL_TYPE_ATOM_ARRAY )
+			return true;
+
+		switch( member->StorageType() )
+		{
+			case DL_TYPE_STORAGE_STR:
+			case DL_TYPE_STORAGE_PTR:
+				return true;
+			case DL_TYPE_STORAGE_STRUCT:
+			{
+				const dl_type_desc* sub_type = dl_internal_find_type( dl_ctx, member->type_id );
+				if( sub_type != 0x0 && ( sub_type->flags & DL_TYPE_FLAG_HAS_SUBDATA ) )
+					return true;
+			}
+			break;
+			default:
+				break;
+		}
+	}
+	return false;
+}
+
+/**
+ * Update types loaded outside the replaced module that reach a type of it that changed layout, inline, by pointer or
+ * in an array. DL_TYPE_FLAG_HAS_SUBDATA is recalculated for them and members with default values that reach a
+ * changed type are refused since the default value was packed with the old layout and can't be packed again.
+ * Types in [new_type_start, type_count) are loaded from the new module and are left as they are.
+ */
+static dl_error_t dl_internal_update_dependents( dl_ctx_t dl_ctx, dl_ctx_t old_ctx, const dl_typeid_t* ids, size_t id_count, unsigned int new_type_start )
+{
+	if( id_count == 0 )
+		return DL_ERROR_OK;
+
+	dl_typeid_t* changed = (dl_typeid_t*)dl_alloc( &dl_ctx->alloc, ( dl_ctx->type_count + id_count ) * sizeof( dl_typeid_t ) );
+	if( changed == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+
+	size_t changed_count = 0;
+	for( size_t i = 0; i < id_count; ++i )
+		if( dl_internal_type_layout_changed( dl_ctx, old_ctx, ids[i] ) )
+			changed[ changed_count++ ] = ids[i];
+	std::sort( changed, changed + changed_count );
+
+	// ... add types reaching a changed type, a level of nesting per round ...
+	for( size_t sorted_count = 0; sorted_count != changed_count; )
+	{
+		sorted_count = changed_count;
+		for( unsigned int type_index = 0; type_index < new_type_start; ++type_index )
+		{
+			if( std::binary_search( changed, changed + sorted_count, dl_ctx->type_ids[ type_index ] ) )
+				continue;
+
+			const dl_type_desc* type = &dl_ctx->type_descs[ type_index ];
+			for( uint32_t i = 0; i < type->member_count; ++i )
+			{
+				const dl_member_desc* member = &dl_ctx->member_descs[ type->member_start + i ];
+				dl_type_storage_t storage = member->StorageType();
+				if( ( storage == DL_TYPE_STORAGE_STRUCT || storage == DL_TYPE_STORAGE_PTR ) &&
+					std::binary_search( changed, changed + sorted_count, member->type_id ) )
+				{
+					changed[ changed_count++ ] = dl_ctx->type_ids[ type_index ];
+					break;
+				}
+			}
+		}
+		std::sort( changed + sorted_count, changed + changed_count );
+		std::inplace_merge( changed, changed + sorted_count, changed + changed_count );
+	}
+
+	dl_error_t err = DL_ERROR_OK;
+	for( unsigned int type_index = 0; type_index < new_type_start && err == DL_ERROR_OK; ++type_index )
+	{
+		const dl_type_desc* type = &dl_ctx->type_descs[ type_index ];
+		for( uint32_t i = 0; i < type->member_count; ++i )
+		{
+			const dl_member_desc* member = &dl_ctx->member_descs[ type->member_start + i ];
+			dl_type_storage_t storage = member->StorageType();
+			if( member->default_value_offset == UINT32_MAX ||
+				( storage != DL_TYPE_STORAGE_STRUCT && storage != DL_TYPE_STORAGE_PTR ) ||
+				!std::binary_search( changed, changed + changed_count, member->type_id ) )
+				continue;
+
+			dl_log_error( dl_ctx, "member '%s::%s' has a default value of a type that changed layout",
+						  dl_internal_type_name( dl_ctx, type ), dl_internal_member_name( dl_ctx, member ) );
+			err = DL_ERROR_TYPE_MISMATCH;
+			break;
+		}
+	}
+
+	// ... types can't store themselves inline so this settle after as many rounds as types are nested ...
+	for( bool again = err == DL_ERROR_OK; again; )
+	{
+		again = false;
+		for( unsigned int type_index = 0; type_index < new_type_start; ++type_index )
+		{
+			if( !std::binary_search( changed, changed + changed_count, dl_ctx->type_ids[ type_index ] ) )
+				continue;
+
+			dl_type_desc* type = &dl_ctx->type_descs[ type_index ];
+			uint32_t flags = dl_internal_type_has_subdata( dl_ctx, type ) ? ( type->flags | (uint32_t)DL_TYPE_FLAG_HAS_SUBDATA )
+			                                                              : ( type->flags & ~(uint32_t)DL_TYPE_FLAG_HAS_SUBDATA );
+			again = again || flags != type->flags;
+			type->flags = flags;
+		}
+	}
+
+	dl_free( &dl_ctx->alloc, changed );
+	return err;
+}
+
+/**
+ * Unload the module named module and, if lib_data or txt_lib_data is set, load it again from that data. Nothing is
+ * changed in the ctx if this fails.
+ */
+static dl_error_t dl_internal_replace_module( dl_ctx_t dl_ctx, const char* module, const unsigned char* lib_data, const char* txt_lib_data, size_t lib_data_size )
+{
+	dl_error_t err = dl_internal_check_ctx_not_frozen( dl_ctx );
+	if( err != DL_ERROR_OK )
+		return err;
+
+	uint32_t name_hash = dl_internal_hash_string( module );
+	if( name_hash == 0 )
+	{
+		dl_log_error( dl_ctx, "a module-name is required to replace or unload a type library" );
+		return DL_ERROR_INVALID_PARAMETER;
+	}
+
+	bool reload = lib_data != 0x0 || txt_lib_data != 0x0;
+	unsigned int old_module = dl_internal_find_module( dl_ctx, name_hash );
+	if( old_module == UINT32_MAX && !reload )
+	{
+		dl_log_error( dl_ctx, "no type library with module-name '%s' is loaded", module );
+		return DL_ERROR_INVALID_PARAMETER;
+	}
+
+	dl_internal_detach_inplace_typelib( dl_ctx );
+
+	dl_context snapshot;
+	dl_internal_snapshot_create( dl_ctx, &snapshot );
+
+	// ... anything referencing types of the old or the new module needs to be re-resolved ...
+	dl_typeid_t* ids = 0x0;
+	size_t id_count = 0;
+	uint32_t old_metadata_start = 0;
+	uint32_t old_metadata_end   = 0;
+	if( old_module != UINT32_MAX )
+	{
+		dl_module_desc end;
+		dl_internal_module_end( dl_ctx, old_module, &end );
+		old_metadata_start = dl_ctx->modules[ old_module ].metadata_start;
+		old_metadata_end   = end.metadata_start;
+
+		err = dl_internal_add_module_ids( dl_ctx, old_module, &ids, &id_count );
+		dl_internal_remove_module( dl_ctx, old_module );
+	}
+
+	unsigned int new_metadata_start = dl_ctx->metadatas_count;
+	unsigned int new_type_start     = dl_ctx->type_count;
+	if( err == DL_ERROR_OK && reload )
+	{
+		unsigned int new_module = dl_ctx->module_count;
+		if( lib_data != 0x0 )
+			err = dl_context_load_type_library( dl_ctx, lib_data, lib_data_size );
+		else
+			err = dl_context_load_txt_type_library( dl_ctx, txt_lib_data, lib_data_size );
+
+		if( err == DL_ERROR_OK )
+		{
+			dl_ctx->modules[ new_module ].name_hash = name_hash;
+			err = dl_internal_add_module_ids( dl_ctx, new_module, &ids, &id_count );
+		}
+	}
+	else if( err == DL_ERROR_OK )
+		err = dl_internal_build_type_defaults( dl_ctx );
+
+	if( err == DL_ERROR_OK )
+		err = dl_internal_resolve_dependents( dl_ctx, ids, id_count );
+
+	if( err == DL_ERROR_OK )
+		err = dl_internal_update_dependents( dl_ctx, &snapshot, ids, id_count, new_type_start );
+
+	// ... dependents might have changed layout ...
+	if( err == DL_ERROR_OK )
+		err = dl_internal_build_hot_types( dl_ctx );
+
+	dl_free( &dl_ctx->alloc, ids );
+
+	if( err != DL_ERROR_OK )
+	{
+		for( unsigned int i = new_metadata_start; i < dl_ctx->metadatas_count; ++i )
+			dl_free( &dl_ctx->alloc, dl_ctx->metadatas[i] );
+		dl_internal_snapshot_restore( dl_ctx, &snapshot );
+		return err;
+	}
+
+	for( unsigned int i = old_metadata_start; i < old_metadata_end; ++i )
+		dl_free( &dl_ctx->alloc, snapshot.metadatas[i] );
+	dl_internal_free_type_data( &dl_ctx->alloc, &snapshot );
+
+	++dl_ctx->generation;
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_context_replace_type_library( dl_ctx_t dl_ctx, const char* module, const unsigned char* lib_data, size_t lib_data_size )
+{
+	return dl_internal_replace_module( dl_ctx, module, lib_data, 0x0, lib_data_size );
+}
+
+dl_error_t dl_context_replace_txt_type_library( dl_ctx_t dl_ctx, const char* module, const char* lib_data, size_t lib_data_size )
+{
+	return dl_internal_replace_module( dl_ctx, module, 0x0, lib_data, lib_data_size );
+}
+
+dl_error_t dl_context_unload_type_library( dl_ctx_t dl_ctx, const char* module )
+{
+	return dl_internal_replace_module( dl_ctx, module, 0x0, 0x0, 0 );
+}
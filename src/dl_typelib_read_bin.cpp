@@ -2,18 +2,6 @@
 #include "dl_internal_util.h"
 #include "dl_types.h"
 
-static void dl_internal_load_type_library_defaults( dl_ctx_t       dl_ctx,
-														  const uint8_t* default_data,
-														  unsigned int   default_data_size )
-{
-	if( default_data_size == 0 )
-		return;
-
-	dl_ctx->default_data = (uint8_t*)dl_realloc( &dl_ctx->alloc, dl_ctx->default_data, default_data_size + dl_ctx->default_data_size, dl_ctx->default_data_size );
-	memcpy( dl_ctx->default_data + dl_ctx->default_data_size, default_data, default_data_size );
-	dl_ctx->default_data_size += default_data_size;
-}
-
 static void dl_internal_read_typelibrary_header( dl_typelib_header* header, const uint8_t* data )
 {
 	memcpy(header, data, sizeof(dl_typelib_header));
@@ -77,133 +65,291 @@ static void dl_endian_swap_enum_value_desc( dl_enum_value_desc* desc )
 	desc->metadata_start = dl_swap_endian_uint32( desc->metadata_start );
 }
 
+dl_error_t dl_internal_build_type_defaults( dl_ctx_t dl_ctx );
+dl_error_t dl_internal_build_hot_types( dl_ctx_t dl_ctx );
+void       dl_internal_begin_module( dl_ctx_t dl_ctx, uint32_t name_hash );
+
 template <typename T>
 static inline T* dl_realloc_array(dl_allocator* alloc, T* ptr, size_t new_size, size_t old_size)
 {
 	return (T*)dl_realloc(alloc, ptr, new_size * sizeof(T), old_size * sizeof(T));
 }
 
-dl_error_t dl_context_load_type_library( dl_ctx_t dl_ctx, const unsigned char* lib_data, size_t lib_data_size )
+struct dl_typelib_sections
+{
+	size_t types_lookup_offset;
+	size_t enums_lookup_offset;
+	size_t types_offset;
+	size_t enums_offset;
+	size_t members_offset;
+	size_t enum_values_offset;
+	size_t enum_aliases_offset;
+	size_t defaults_offset;
+	size_t typedata_strings_offset;
+	size_t c_includes_offset;
+	size_t metadatas_offset;
+};
+
+static dl_error_t dl_internal_read_typelibrary_sections( dl_typelib_header* header, dl_typelib_sections* sections, const unsigned char* lib_data, size_t lib_data_size )
 {
 	if(lib_data_size < sizeof(dl_typelib_header))
 		return DL_ERROR_MALFORMED_DATA;
 
-	dl_typelib_header header;
-	dl_internal_read_typelibrary_header(&header, lib_data);
-
-	if( header.id      != DL_TYPELIB_ID )      return DL_ERROR_MALFORMED_DATA;
-	if( header.version != DL_TYPELIB_VERSION ) return DL_ERROR_VERSION_MISMATCH;
-
-	size_t types_lookup_offset     = sizeof(dl_typelib_header);
-	size_t enums_lookup_offset     = types_lookup_offset + sizeof( dl_typeid_t ) * header.type_count;
-	size_t types_offset            = enums_lookup_offset + sizeof( dl_typeid_t ) * header.enum_count;
-	size_t enums_offset            = types_offset        + sizeof( dl_type_desc ) * header.type_count;
-	size_t members_offset          = enums_offset        + sizeof( dl_enum_desc ) * header.enum_count;
-	size_t enum_values_offset      = members_offset      + sizeof( dl_member_desc ) * header.member_count;
-	size_t enum_aliases_offset     = enum_values_offset  + sizeof( dl_enum_value_desc ) * header.enum_value_count;
-	size_t defaults_offset         = enum_aliases_offset + sizeof( dl_enum_alias_desc ) * header.enum_alias_count;
-	size_t typedata_strings_offset = defaults_offset + header.default_value_size;
-	size_t c_includes_offset       = typedata_strings_offset + header.typeinfo_strings_size;
-	size_t metadatas_offset        = c_includes_offset + header.c_includes_size;
-
-	dl_ctx->type_ids         = dl_realloc_array( &dl_ctx->alloc, dl_ctx->type_ids,         dl_ctx->type_count + header.type_count,                       dl_ctx->type_count );
-	dl_ctx->type_descs       = dl_realloc_array( &dl_ctx->alloc, dl_ctx->type_descs,       dl_ctx->type_count + header.type_count,                       dl_ctx->type_count );
-	dl_ctx->enum_ids         = dl_realloc_array( &dl_ctx->alloc, dl_ctx->enum_ids,         dl_ctx->enum_count + header.enum_count,                       dl_ctx->enum_count );
-	dl_ctx->enum_descs       = dl_realloc_array( &dl_ctx->alloc, dl_ctx->enum_descs,       dl_ctx->enum_count + header.enum_count,                       dl_ctx->enum_count );
-	dl_ctx->member_descs     = dl_realloc_array( &dl_ctx->alloc, dl_ctx->member_descs,     dl_ctx->member_count + header.member_count,                   dl_ctx->member_count );
-	dl_ctx->enum_value_descs = dl_realloc_array( &dl_ctx->alloc, dl_ctx->enum_value_descs, dl_ctx->enum_value_count + header.enum_value_count,           dl_ctx->enum_value_count );
-	dl_ctx->enum_alias_descs = dl_realloc_array( &dl_ctx->alloc, dl_ctx->enum_alias_descs, dl_ctx->enum_alias_count + header.enum_alias_count,           dl_ctx->enum_alias_count );
-	dl_ctx->typedata_strings = dl_realloc_array( &dl_ctx->alloc, dl_ctx->typedata_strings, dl_ctx->typedata_strings_size + header.typeinfo_strings_size, dl_ctx->typedata_strings_size );
-	if(header.c_includes_size)
-		dl_ctx->c_includes   = dl_realloc_array( &dl_ctx->alloc, dl_ctx->c_includes,       dl_ctx->c_includes_size + header.c_includes_size,             dl_ctx->c_includes_size );
-	if(header.metadatas_count)
+	dl_internal_read_typelibrary_header(header, lib_data);
+
+	if( header->id      != DL_TYPELIB_ID )      return DL_ERROR_MALFORMED_DATA;
+	if( header->version != DL_TYPELIB_VERSION ) return DL_ERROR_VERSION_MISMATCH;
+
+	sections->types_lookup_offset     = sizeof(dl_typelib_header);
+	sections->enums_lookup_offset     = sections->types_lookup_offset + sizeof( dl_typeid_t ) * header->type_count;
+	sections->types_offset            = sections->enums_lookup_offset + sizeof( dl_typeid_t ) * header->enum_count;
+	sections->enums_offset            = sections->types_offset        + sizeof( dl_type_desc ) * header->type_count;
+	sections->members_offset          = sections->enums_offset        + sizeof( dl_enum_desc ) * header->enum_count;
+	sections->enum_values_offset      = sections->members_offset      + sizeof( dl_member_desc ) * header->member_count;
+	sections->enum_aliases_offset     = sections->enum_values_offset  + sizeof( dl_enum_value_desc ) * header->enum_value_count;
+	sections->defaults_offset         = sections->enum_aliases_offset + sizeof( dl_enum_alias_desc ) * header->enum_alias_count;
+	sections->typedata_strings_offset = sections->defaults_offset + header->default_value_size;
+	sections->c_includes_offset       = sections->typedata_strings_offset + header->typeinfo_strings_size;
+	sections->metadatas_offset        = sections->c_includes_offset + header->c_includes_size;
+	return DL_ERROR_OK;
+}
+
+static void dl_internal_reserve_metadatas( dl_ctx_t dl_ctx, unsigned int metadatas_count )
+{
+	size_t needed = dl_ctx->metadatas_count + metadatas_count;
+	if( dl_ctx->metadatas_cap >= needed )
+		return;
+
+	dl_ctx->metadatas          = dl_realloc_array( &dl_ctx->alloc, dl_ctx->metadatas,          needed, dl_ctx->metadatas_count );
+	dl_ctx->metadata_infos     = dl_realloc_array( &dl_ctx->alloc, dl_ctx->metadata_infos,     needed, dl_ctx->metadatas_count );
+	dl_ctx->metadata_typeinfos = dl_realloc_array( &dl_ctx->alloc, dl_ctx->metadata_typeinfos, needed, dl_ctx->metadatas_count );
+	dl_ctx->metadatas_cap      = needed;
+}
+
+static dl_error_t dl_internal_load_type_library_metadatas( dl_ctx_t dl_ctx, const unsigned char* metadatas_data, unsigned int metadatas_count )
+{
+	if( metadatas_count == 0 )
+		return DL_ERROR_OK;
+
+	dl_internal_reserve_metadatas( dl_ctx, metadatas_count );
+
+	// The types used for meta data must be known to be able to patch the data with dl_instance_load_inplace
+	for( unsigned int i = 0; i < metadatas_count; ++i )
 	{
-		dl_ctx->metadatas    = dl_realloc_array( &dl_ctx->alloc, dl_ctx->metadatas,        dl_ctx->metadatas_count + header.metadatas_count,             dl_ctx->metadatas_count );
-		dl_ctx->metadata_infos = dl_realloc_array( &dl_ctx->alloc, dl_ctx->metadata_infos, dl_ctx->metadatas_count + header.metadatas_count,             dl_ctx->metadatas_count );
-		dl_ctx->metadata_typeinfos = dl_realloc_array( &dl_ctx->alloc, dl_ctx->metadata_typeinfos, dl_ctx->metadatas_count + header.metadatas_count,     dl_ctx->metadatas_count );
-		for( unsigned int i = 0; i < header.metadatas_count; ++i )
+		uint32_t metadata_offset              = *reinterpret_cast<const uint32_t*>( metadatas_data + i * sizeof( uint32_t ) );
+		metadata_offset                       = ( DL_ENDIAN_HOST == DL_ENDIAN_BIG ) ? dl_swap_endian_uint32( metadata_offset ) : metadata_offset;
+		const dl_data_header* metadata_header = reinterpret_cast<const dl_data_header*>( metadatas_data + metadatas_count * sizeof( uint32_t ) + metadata_offset );
+		size_t instance_size                  = ( DL_ENDIAN_HOST == DL_ENDIAN_BIG ) ? dl_swap_endian_uint32( metadata_header->instance_size ) : metadata_header->instance_size;
+		dl_ctx->metadatas[dl_ctx->metadatas_count + i] = dl_alloc( &dl_ctx->alloc, instance_size + sizeof( dl_data_header ) );
+		memcpy( dl_ctx->metadatas[dl_ctx->metadatas_count + i], metadata_header, instance_size + sizeof( dl_data_header ) );
+		dl_typeid_t type_id = ( DL_ENDIAN_HOST == DL_ENDIAN_BIG ) ? dl_swap_endian_uint32( metadata_header->root_instance_type ) : metadata_header->root_instance_type;
+		void* loaded_instance;
+		size_t consumed;
+		dl_error_t err = dl_instance_load_inplace( dl_ctx, type_id, (uint8_t*)dl_ctx->metadatas[dl_ctx->metadatas_count + i], instance_size + sizeof( dl_data_header ), &loaded_instance, &consumed );
+		if( err != DL_ERROR_OK )
 		{
-			uint32_t metadata_offset              = *reinterpret_cast<const uint32_t*>( lib_data + metadatas_offset + i * sizeof( uint32_t ) );
-			metadata_offset                       = ( DL_ENDIAN_HOST == DL_ENDIAN_BIG ) ? dl_swap_endian_uint32( metadata_offset ) : metadata_offset;
-			const dl_data_header* metadata_header = reinterpret_cast<const dl_data_header*>( lib_data + metadatas_offset + header.metadatas_count * sizeof( uint32_t ) + metadata_offset );
-			size_t instance_size                  = ( DL_ENDIAN_HOST == DL_ENDIAN_BIG ) ? dl_swap_endian_uint32( metadata_header->instance_size ) : metadata_header->instance_size;
-			dl_ctx->metadatas[dl_ctx->metadatas_count + i] = dl_alloc( &dl_ctx->alloc, instance_size + sizeof( dl_data_header ) );
+			return err;
 		}
+		DL_ASSERT( instance_size + sizeof( dl_data_header ) == consumed );
+		dl_ctx->metadata_infos[dl_ctx->metadatas_count + i] = loaded_instance;
+		dl_ctx->metadata_typeinfos[dl_ctx->metadatas_count + i] = type_id;
 	}
 
-	memcpy( dl_ctx->type_ids         + dl_ctx->type_count,            lib_data + types_lookup_offset, sizeof( dl_typeid_t ) * header.type_count );
-	memcpy( dl_ctx->enum_ids         + dl_ctx->enum_count,            lib_data + enums_lookup_offset, sizeof( dl_typeid_t ) * header.enum_count );
-	memcpy( dl_ctx->type_descs       + dl_ctx->type_count,            lib_data + types_offset,        sizeof( dl_type_desc ) * header.type_count );
-	memcpy( dl_ctx->enum_descs       + dl_ctx->enum_count,            lib_data + enums_offset,        sizeof( dl_enum_desc ) * header.enum_count );
-	memcpy( dl_ctx->member_descs     + dl_ctx->member_count,          lib_data + members_offset,      sizeof( dl_member_desc ) * header.member_count );
-	memcpy( dl_ctx->enum_value_descs + dl_ctx->enum_value_count,      lib_data + enum_values_offset,  sizeof( dl_enum_value_desc ) * header.enum_value_count );
-	memcpy( dl_ctx->enum_alias_descs + dl_ctx->enum_alias_count,      lib_data + enum_aliases_offset, sizeof( dl_enum_alias_desc ) * header.enum_alias_count );
-	memcpy( dl_ctx->typedata_strings + dl_ctx->typedata_strings_size, lib_data + typedata_strings_offset, header.typeinfo_strings_size );
-	if(header.c_includes_size)
-		memcpy( dl_ctx->c_includes   + dl_ctx->c_includes_size,       lib_data + c_includes_offset,       header.c_includes_size );
+	dl_ctx->metadatas_count       += metadatas_count;
+	return DL_ERROR_OK;
+}
+
+/**
+ * Make the ctx own all its descriptor arrays if they are currently referencing a typelib loaded with
+ * dl_context_load_type_library_inplace(), needs to be done before anything is appended to them.
+ */
+void dl_internal_detach_inplace_typelib( dl_ctx_t dl_ctx )
+{
+	if( dl_ctx->inplace_typelib == 0x0 )
+		return;
+
+	dl_ctx->type_ids         = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->type_ids,         dl_ctx->type_count );
+	dl_ctx->type_descs       = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->type_descs,       dl_ctx->type_count );
+	dl_ctx->enum_ids         = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->enum_ids,         dl_ctx->enum_count );
+	dl_ctx->enum_descs       = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->enum_descs,       dl_ctx->enum_count );
+	dl_ctx->member_descs     = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->member_descs,     dl_ctx->member_count );
+	dl_ctx->enum_value_descs = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->enum_value_descs, dl_ctx->enum_value_count );
+	dl_ctx->enum_alias_descs = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->enum_alias_descs, dl_ctx->enum_alias_count );
+	dl_ctx->typedata_strings = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->typedata_strings, dl_ctx->typedata_strings_size );
+	dl_ctx->c_includes       = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->c_includes,       dl_ctx->c_includes_size );
+	dl_ctx->default_data     = dl_internal_copy_array( &dl_ctx->alloc, dl_ctx->default_data,     dl_ctx->default_data_size );
+	dl_ctx->inplace_typelib  = 0x0;
+}
+
+/**
+ * Grow all ctx-arrays once to fit the sum of all typelibs described by total.
+ */
+static void dl_internal_reserve_type_libraries( dl_ctx_t dl_ctx, const dl_typelib_header* total )
+{
+	dl_ctx->type_ids         = dl_realloc_array( &dl_ctx->alloc, dl_ctx->type_ids,         dl_ctx->type_count + total->type_count,                       dl_ctx->type_count );
+	dl_ctx->type_descs       = dl_realloc_array( &dl_ctx->alloc, dl_ctx->type_descs,       dl_ctx->type_count + total->type_count,                       dl_ctx->type_count );
+	dl_ctx->enum_ids         = dl_realloc_array( &dl_ctx->alloc, dl_ctx->enum_ids,         dl_ctx->enum_count + total->enum_count,                       dl_ctx->enum_count );
+	dl_ctx->enum_descs       = dl_realloc_array( &dl_ctx->alloc, dl_ctx->enum_descs,       dl_ctx->enum_count + total->enum_count,                       dl_ctx->enum_count );
+	dl_ctx->member_descs     = dl_realloc_array( &dl_ctx->alloc, dl_ctx->member_descs,     dl_ctx->member_count + total->member_count,                   dl_ctx->member_count );
+	dl_ctx->enum_value_descs = dl_realloc_array( &dl_ctx->alloc, dl_ctx->enum_value_descs, dl_ctx->enum_value_count + total->enum_value_count,           dl_ctx->enum_value_count );
+	dl_ctx->enum_alias_descs = dl_realloc_array( &dl_ctx->alloc, dl_ctx->enum_alias_descs, dl_ctx->enum_alias_count + total->enum_alias_count,           dl_ctx->enum_alias_count );
+	dl_ctx->typedata_strings = dl_realloc_array( &dl_ctx->alloc, dl_ctx->typedata_strings, dl_ctx->typedata_strings_size + total->typeinfo_strings_size, dl_ctx->typedata_strings_size );
+	if(total->c_includes_size)
+		dl_ctx->c_includes   = dl_realloc_array( &dl_ctx->alloc, dl_ctx->c_includes,       dl_ctx->c_includes_size + total->c_includes_size,             dl_ctx->c_includes_size );
+	if(total->default_value_size)
+		dl_ctx->default_data = dl_realloc_array( &dl_ctx->alloc, dl_ctx->default_data,     dl_ctx->default_data_size + total->default_value_size,        dl_ctx->default_data_size );
+	if(total->metadatas_count)
+		dl_internal_reserve_metadatas( dl_ctx, total->metadatas_count );
+}
+
+/**
+ * Copy one typelib into the ctx-arrays, that are required to already have room for it, and rebase all its
+ * indices on what is already loaded. Metadata-instances are not loaded here, but metadata_start is rebased
+ * on metadata_base as that is where the instances will end up.
+ */
+static void dl_internal_append_type_library( dl_ctx_t                   dl_ctx,
+											 const dl_typelib_header*   header,
+											 const dl_typelib_sections* sections,
+											 const unsigned char*       lib_data,
+											 unsigned int               metadata_base )
+{
+	// ... sections of size 0 is skipped as the ctx-array might still be 0x0 ...
+	if(header->type_count)
+	{
+		memcpy( dl_ctx->type_ids     + dl_ctx->type_count,            lib_data + sections->types_lookup_offset,     sizeof( dl_typeid_t ) * header->type_count );
+		memcpy( dl_ctx->type_descs   + dl_ctx->type_count,            lib_data + sections->types_offset,            sizeof( dl_type_desc ) * header->type_count );
+	}
+	if(header->enum_count)
+	{
+		memcpy( dl_ctx->enum_ids     + dl_ctx->enum_count,            lib_data + sections->enums_lookup_offset,     sizeof( dl_typeid_t ) * header->enum_count );
+		memcpy( dl_ctx->enum_descs   + dl_ctx->enum_count,            lib_data + sections->enums_offset,            sizeof( dl_enum_desc ) * header->enum_count );
+	}
+	if(header->member_count)
+		memcpy( dl_ctx->member_descs     + dl_ctx->member_count,          lib_data + sections->members_offset,          sizeof( dl_member_desc ) * header->member_count );
+	if(header->enum_value_count)
+		memcpy( dl_ctx->enum_value_descs + dl_ctx->enum_value_count,      lib_data + sections->enum_values_offset,      sizeof( dl_enum_value_desc ) * header->enum_value_count );
+	if(header->enum_alias_count)
+		memcpy( dl_ctx->enum_alias_descs + dl_ctx->enum_alias_count,      lib_data + sections->enum_aliases_offset,     sizeof( dl_enum_alias_desc ) * header->enum_alias_count );
+	if(header->typeinfo_strings_size)
+		memcpy( dl_ctx->typedata_strings + dl_ctx->typedata_strings_size, lib_data + sections->typedata_strings_offset, header->typeinfo_strings_size );
+	if(header->c_includes_size)
+		memcpy( dl_ctx->c_includes   + dl_ctx->c_includes_size,       lib_data + sections->c_includes_offset,       header->c_includes_size );
 
 	if( DL_ENDIAN_HOST == DL_ENDIAN_BIG )
 	{
-		for( unsigned int i = 0; i < header.type_count; ++i ) dl_ctx->type_ids[ dl_ctx->type_count + i ] = dl_swap_endian_uint32( dl_ctx->type_ids[ dl_ctx->type_count + i ] );
-		for( unsigned int i = 0; i < header.enum_count; ++i ) dl_ctx->enum_ids[ dl_ctx->enum_count + i ] = dl_swap_endian_uint32( dl_ctx->enum_ids[ dl_ctx->enum_count + i ] );
-		for( unsigned int i = 0; i < header.type_count; ++i )       dl_endian_swap_type_desc( dl_ctx->type_descs + dl_ctx->type_count + i );
-		for( unsigned int i = 0; i < header.enum_count; ++i )       dl_endian_swap_enum_desc( dl_ctx->enum_descs + dl_ctx->enum_count + i );
-		for( unsigned int i = 0; i < header.member_count; ++i )     dl_endian_swap_member_desc( dl_ctx->member_descs + dl_ctx->member_count + i );
-		for( unsigned int i = 0; i < header.enum_value_count; ++i ) dl_endian_swap_enum_value_desc( dl_ctx->enum_value_descs + dl_ctx->enum_value_count + i );
+		for( unsigned int i = 0; i < header->type_count; ++i ) dl_ctx->type_ids[ dl_ctx->type_count + i ] = dl_swap_endian_uint32( dl_ctx->type_ids[ dl_ctx->type_count + i ] );
+		for( unsigned int i = 0; i < header->enum_count; ++i ) dl_ctx->enum_ids[ dl_ctx->enum_count + i ] = dl_swap_endian_uint32( dl_ctx->enum_ids[ dl_ctx->enum_count + i ] );
+		for( unsigned int i = 0; i < header->type_count; ++i )       dl_endian_swap_type_desc( dl_ctx->type_descs + dl_ctx->type_count + i );
+		for( unsigned int i = 0; i < header->enum_count; ++i )       dl_endian_swap_enum_desc( dl_ctx->enum_descs + dl_ctx->enum_count + i );
+		for( unsigned int i = 0; i < header->member_count; ++i )     dl_endian_swap_member_desc( dl_ctx->member_descs + dl_ctx->member_count + i );
+		for( unsigned int i = 0; i < header->enum_value_count; ++i ) dl_endian_swap_enum_value_desc( dl_ctx->enum_value_descs + dl_ctx->enum_value_count + i );
 	}
 
 	uint32_t td_str_offset = (uint32_t)dl_ctx->typedata_strings_size;
-	for( unsigned int i = 0; i < header.type_count; ++i )
+	for( unsigned int i = 0; i < header->type_count; ++i )
 	{
 		dl_ctx->type_descs[ dl_ctx->type_count + i ].name += td_str_offset;
 		if(dl_ctx->type_descs[ dl_ctx->type_count + i ].comment != UINT32_MAX)
 			dl_ctx->type_descs[ dl_ctx->type_count + i ].comment += td_str_offset;
 		dl_ctx->type_descs[ dl_ctx->type_count + i ].member_start += dl_ctx->member_count;
-		if( dl_ctx->type_descs[ dl_ctx->type_count + i ].metadata_start )
-			dl_ctx->type_descs[ dl_ctx->type_count + i ].metadata_start += dl_ctx->metadatas_count;
+		if( dl_ctx->type_descs[ dl_ctx->type_count + i ].metadata_count )
+			dl_ctx->type_descs[ dl_ctx->type_count + i ].metadata_start += metadata_base;
 	}
 
-	for( unsigned int i = 0; i < header.member_count; ++i )
+	for( unsigned int i = 0; i < header->member_count; ++i )
 	{
 		dl_ctx->member_descs[ dl_ctx->member_count + i ].name += td_str_offset;
-		if( dl_ctx->member_descs[dl_ctx->member_count + i].metadata_start )
-			dl_ctx->member_descs[dl_ctx->member_count + i].metadata_start += dl_ctx->metadatas_count;
+		if( dl_ctx->member_descs[ dl_ctx->member_count + i ].comment != UINT32_MAX )
+			dl_ctx->member_descs[ dl_ctx->member_count + i ].comment += td_str_offset;
+		if( dl_ctx->member_descs[dl_ctx->member_count + i].metadata_count )
+			dl_ctx->member_descs[dl_ctx->member_count + i].metadata_start += metadata_base;
 
 		if( dl_ctx->member_descs[dl_ctx->member_count + i].default_value_offset != UINT32_MAX )
 			dl_ctx->member_descs[dl_ctx->member_count + i].default_value_offset += (uint32_t)dl_ctx->default_data_size;
 	}
 
-	for( unsigned int i = 0; i < header.enum_count; ++i )
+	for( unsigned int i = 0; i < header->enum_count; ++i )
 	{
 		dl_ctx->enum_descs[ dl_ctx->enum_count + i ].name += td_str_offset;
 		if(dl_ctx->enum_descs[ dl_ctx->enum_count + i ].comment != UINT32_MAX)
 			dl_ctx->enum_descs[ dl_ctx->enum_count+ i ].comment += td_str_offset;
 		dl_ctx->enum_descs[ dl_ctx->enum_count + i ].value_start += dl_ctx->enum_value_count;
 		dl_ctx->enum_descs[ dl_ctx->enum_count + i ].alias_start += dl_ctx->enum_alias_count;
-		if( dl_ctx->enum_descs[ dl_ctx->enum_count + i ].metadata_start )
-			dl_ctx->enum_descs[ dl_ctx->enum_count + i ].metadata_start += dl_ctx->metadatas_count;
+		if( dl_ctx->enum_descs[ dl_ctx->enum_count + i ].metadata_count )
+			dl_ctx->enum_descs[ dl_ctx->enum_count + i ].metadata_start += metadata_base;
 	}
 
-	for( unsigned int i = 0; i < header.enum_alias_count; ++i )
+	for( unsigned int i = 0; i < header->enum_alias_count; ++i )
 	{
 		dl_ctx->enum_alias_descs[ dl_ctx->enum_alias_count + i ].name += td_str_offset;
 		dl_ctx->enum_alias_descs[ dl_ctx->enum_alias_count + i ].value_index += dl_ctx->enum_value_count;
 	}
 
-	for( unsigned int i = 0; i < header.enum_value_count; ++i )
+	for( unsigned int i = 0; i < header->enum_value_count; ++i )
 	{
 		dl_ctx->enum_value_descs[ dl_ctx->enum_value_count + i ].main_alias += dl_ctx->enum_alias_count;
-		if( dl_ctx->enum_value_descs[ dl_ctx->enum_value_count + i ].metadata_start )
-			dl_ctx->enum_value_descs[ dl_ctx->enum_value_count + i ].metadata_start += dl_ctx->metadatas_count;
+		if( dl_ctx->enum_value_descs[ dl_ctx->enum_value_count + i ].comment != UINT32_MAX )
+			dl_ctx->enum_value_descs[ dl_ctx->enum_value_count + i ].comment += td_str_offset;
+		if( dl_ctx->enum_value_descs[ dl_ctx->enum_value_count + i ].metadata_count )
+			dl_ctx->enum_value_descs[ dl_ctx->enum_value_count + i ].metadata_start += metadata_base;
 	}
 
-	dl_ctx->type_count            += header.type_count;
-	dl_ctx->enum_count            += header.enum_count;
-	dl_ctx->member_count          += header.member_count;
-	dl_ctx->enum_value_count      += header.enum_value_count;
-	dl_ctx->enum_alias_count      += header.enum_alias_count;
-	dl_ctx->typedata_strings_size += header.typeinfo_strings_size;
-	dl_ctx->c_includes_size       += header.c_includes_size;
+	if( header->default_value_size )
+		memcpy( dl_ctx->default_data + dl_ctx->default_data_size, lib_data + sections->defaults_offset, header->default_value_size );
+
+	dl_ctx->type_count            += header->type_count;
+	dl_ctx->enum_count            += header->enum_count;
+	dl_ctx->member_count          += header->member_count;
+	dl_ctx->enum_value_count      += header->enum_value_count;
+	dl_ctx->enum_alias_count      += header->enum_alias_count;
+	dl_ctx->typedata_strings_size += header->typeinfo_strings_size;
+	dl_ctx->c_includes_size       += header->c_includes_size;
+	dl_ctx->default_data_size     += header->default_value_size;
+}
+
+dl_error_t dl_context_load_type_libraries( dl_ctx_t dl_ctx, const unsigned char* const* lib_datas, const size_t* lib_data_sizes, unsigned int lib_count )
+{
+	dl_error_t err = dl_internal_check_ctx_not_frozen( dl_ctx );
+	if( err != DL_ERROR_OK )
+		return err;
+
+	dl_typelib_header total;
+	memset( &total, 0x0, sizeof( total ) );
+
+	// ... validate all libs and sum up their sizes before touching the ctx ...
+	for( unsigned int lib = 0; lib < lib_count; ++lib )
+	{
+		dl_typelib_header header;
+		dl_typelib_sections sections;
+		err = dl_internal_read_typelibrary_sections( &header, &sections, lib_datas[lib], lib_data_sizes[lib] );
+		if( err != DL_ERROR_OK )
+			return err;
+
+		total.type_count            += header.type_count;
+		total.enum_count            += header.enum_count;
+		total.member_count          += header.member_count;
+		total.enum_value_count      += header.enum_value_count;
+		total.enum_alias_count      += header.enum_alias_count;
+		total.default_value_size    += header.default_value_size;
+		total.typeinfo_strings_size += header.typeinfo_strings_size;
+		total.c_includes_size       += header.c_includes_size;
+		total.metadatas_count       += header.metadatas_count;
+	}
+
+	dl_internal_detach_inplace_typelib( dl_ctx );
+	dl_internal_reserve_type_libraries( dl_ctx, &total );
+
+	unsigned int metadata_base = dl_ctx->metadatas_count;
+	for( unsigned int lib = 0; lib < lib_count; ++lib )
+	{
+		dl_typelib_header header;
+		dl_typelib_sections sections;
+		(void)dl_internal_read_typelibrary_sections( &header, &sections, lib_datas[lib], lib_data_sizes[lib] );
+		dl_internal_begin_module( dl_ctx, 0 );
+		dl_ctx->modules[ dl_ctx->module_count - 1 ].metadata_start = metadata_base; // metadata-instances are loaded after all libs.
+		dl_internal_append_type_library( dl_ctx, &header, &sections, lib_datas[lib], metadata_base );
+		metadata_base += header.metadatas_count;
+	}
 
 	// we still need to keep the capacity around here, even as they are the same as the type-counts in
 	// the case where we were to read a typelib from text into this ctx as that would do an incremental
@@ -217,30 +363,111 @@ dl_error_t dl_context_load_type_library( dl_ctx_t dl_ctx, const unsigned char* l
 	dl_ctx->typedata_strings_cap  = dl_ctx->typedata_strings_size;
 	dl_ctx->c_includes_cap        = dl_ctx->c_includes_size;
 
-	// The types used for meta data must be known to be able to patch the data with dl_instance_load_inplace
-	for( unsigned int i = 0; i < header.metadatas_count; ++i )
+	err = dl_internal_build_hot_types( dl_ctx );
+	if( err != DL_ERROR_OK )
+		return err;
+
+	// ... metadata can use types from any of the libs so they are loaded when all types are in place ...
+	for( unsigned int lib = 0; lib < lib_count; ++lib )
 	{
-		uint32_t metadata_offset              = *reinterpret_cast<const uint32_t*>( lib_data + metadatas_offset + i * sizeof( uint32_t ) );
-		metadata_offset                       = ( DL_ENDIAN_HOST == DL_ENDIAN_BIG ) ? dl_swap_endian_uint32( metadata_offset ) : metadata_offset;
-		const dl_data_header* metadata_header = reinterpret_cast<const dl_data_header*>( lib_data + metadatas_offset + header.metadatas_count * sizeof( uint32_t ) + metadata_offset );
-		size_t instance_size                  = ( DL_ENDIAN_HOST == DL_ENDIAN_BIG ) ? dl_swap_endian_uint32( metadata_header->instance_size ) : metadata_header->instance_size;
-		memcpy( dl_ctx->metadatas[dl_ctx->metadatas_count + i], metadata_header, instance_size + sizeof( dl_data_header ) );
-		dl_typeid_t type_id = ( DL_ENDIAN_HOST == DL_ENDIAN_BIG ) ? dl_swap_endian_uint32( metadata_header->root_instance_type ) : metadata_header->root_instance_type;
-		void* loaded_instance;
-		size_t consumed;
-		dl_error_t err = dl_instance_load_inplace( dl_ctx, type_id, (uint8_t*)dl_ctx->metadatas[dl_ctx->metadatas_count + i], instance_size + sizeof( dl_data_header ), &loaded_instance, &consumed );
+		dl_typelib_header header;
+		dl_typelib_sections sections;
+		(void)dl_internal_read_typelibrary_sections( &header, &sections, lib_datas[lib], lib_data_sizes[lib] );
+		err = dl_internal_load_type_library_metadatas( dl_ctx, lib_datas[lib] + sections.metadatas_offset, header.metadatas_count );
 		if( err != DL_ERROR_OK )
-		{
 			return err;
-		}
-		DL_ASSERT( instance_size + sizeof( dl_data_header ) == consumed );
-		dl_ctx->metadata_infos[dl_ctx->metadatas_count + i] = loaded_instance;
-		dl_ctx->metadata_typeinfos[dl_ctx->metadatas_count + i] = type_id;
 	}
 
-	dl_ctx->metadatas_count       += header.metadatas_count;
-	dl_ctx->metadatas_cap         = dl_ctx->metadatas_count;
+	return dl_internal_build_type_defaults( dl_ctx );
+}
 
-	dl_internal_load_type_library_defaults( dl_ctx, lib_data + defaults_offset, header.default_value_size );
-	return DL_ERROR_OK;
+dl_error_t dl_context_load_type_library( dl_ctx_t dl_ctx, const unsigned char* lib_data, size_t lib_data_size )
+{
+	return dl_context_load_type_libraries( dl_ctx, &lib_data, &lib_data_size, 1 );
+}
+
+static bool dl_internal_typelib_sections_aligned( const unsigned char* lib_data, const dl_typelib_sections* sections )
+{
+	// all descriptors are built from 32-bit members except dl_enum_value_desc that holds a 64-bit value.
+	uintptr_t start = (uintptr_t)lib_data;
+	return ( start % 4 ) == 0 &&
+		   ( ( start + sections->enum_values_offset ) % 8 ) == 0 &&
+		   ( ( start + sections->enum_aliases_offset ) % 4 ) == 0;
+}
+
+dl_error_t dl_context_load_type_library_inplace( dl_ctx_t dl_ctx, const unsigned char* lib_data, size_t lib_data_size )
+{
+	dl_error_t err = dl_internal_check_ctx_not_frozen( dl_ctx );
+	if( err != DL_ERROR_OK )
+		return err;
+
+	dl_typelib_header header;
+	dl_typelib_sections sections;
+	err = dl_internal_read_typelibrary_sections( &header, &sections, lib_data, lib_data_size );
+	if( err != DL_ERROR_OK )
+		return err;
+
+	if( sections.metadatas_offset > lib_data_size )
+		return DL_ERROR_MALFORMED_DATA;
+
+	// descriptors can only be referenced as is if there is nothing to rebase them on and no endian to swap.
+	bool ctx_is_empty = dl_ctx->type_count            == 0 &&
+						dl_ctx->enum_count            == 0 &&
+						dl_ctx->member_count          == 0 &&
+						dl_ctx->enum_value_count      == 0 &&
+						dl_ctx->enum_alias_count      == 0 &&
+						dl_ctx->metadatas_count       == 0 &&
+						dl_ctx->typedata_strings_size == 0 &&
+						dl_ctx->c_includes_size       == 0 &&
+						dl_ctx->default_data_size     == 0;
+	if( !ctx_is_empty || DL_ENDIAN_HOST == DL_ENDIAN_BIG )
+		return dl_context_load_type_library( dl_ctx, lib_data, lib_data_size );
+
+	if( !dl_internal_typelib_sections_aligned( lib_data, &sections ) )
+		return DL_ERROR_BAD_ALIGNMENT;
+
+	// the ctx-arrays are not const, but nothing is written to them while inplace_typelib is set, see
+	// dl_internal_detach_inplace_typelib().
+	dl_internal_begin_module( dl_ctx, 0 );
+
+	uint8_t* data = const_cast<uint8_t*>( lib_data );
+	dl_ctx->inplace_typelib  = lib_data;
+	dl_ctx->type_ids         = (dl_typeid_t*)( data + sections.types_lookup_offset );
+	dl_ctx->enum_ids         = (dl_typeid_t*)( data + sections.enums_lookup_offset );
+	dl_ctx->type_descs       = (dl_type_desc*)( data + sections.types_offset );
+	dl_ctx->enum_descs       = (dl_enum_desc*)( data + sections.enums_offset );
+	dl_ctx->member_descs     = (dl_member_desc*)( data + sections.members_offset );
+	dl_ctx->enum_value_descs = (dl_enum_value_desc*)( data + sections.enum_values_offset );
+	dl_ctx->enum_alias_descs = (dl_enum_alias_desc*)( data + sections.enum_aliases_offset );
+	dl_ctx->default_data     = data + sections.defaults_offset;
+	dl_ctx->typedata_strings = (char*)( data + sections.typedata_strings_offset );
+	dl_ctx->c_includes       = (char*)( data + sections.c_includes_offset );
+
+	dl_ctx->type_count            = header.type_count;
+	dl_ctx->enum_count            = header.enum_count;
+	dl_ctx->member_count          = header.member_count;
+	dl_ctx->enum_value_count      = header.enum_value_count;
+	dl_ctx->enum_alias_count      = header.enum_alias_count;
+	dl_ctx->default_data_size     = header.default_value_size;
+	dl_ctx->typedata_strings_size = header.typeinfo_strings_size;
+	dl_ctx->c_includes_size       = header.c_includes_size;
+
+	dl_ctx->type_capacity         = dl_ctx->type_count;
+	dl_ctx->enum_capacity         = dl_ctx->enum_count;
+	dl_ctx->member_capacity       = dl_ctx->member_count;
+	dl_ctx->enum_value_capacity   = dl_ctx->enum_value_count;
+	dl_ctx->enum_alias_capacity   = dl_ctx->enum_alias_count;
+	dl_ctx->typedata_strings_cap  = dl_ctx->typedata_strings_size;
+	dl_ctx->c_includes_cap        = dl_ctx->c_includes_size;
+
+	err = dl_internal_build_hot_types( dl_ctx );
+	if( err != DL_ERROR_OK )
+		return err;
+
+	// metadata-instances are patched on load and can not be shared so they are still copied.
+	err = dl_internal_load_type_library_metadatas( dl_ctx, lib_data + sections.metadatas_offset, header.metadatas_count );
+	if( err != DL_ERROR_OK )
+		return err;
+
+	return dl_internal_build_type_defaults( dl_ctx );
 }
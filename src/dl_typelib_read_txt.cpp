@@ -200,12 +200,137 @@ static const dl_builtin_type* dl_find_builtin_type( const char* name )
 
 dl_type_t dl_make_type( dl_type_atom_t atom, dl_type_storage_t storage );
 dl_error_t dl_txt_pack_internal( dl_ctx_t dl_ctx, const char* txt_instance, unsigned char* out_buffer, size_t out_buffer_size, size_t* produced_bytes, bool use_fast_ptr_patch );
+dl_error_t dl_internal_build_type_defaults( dl_ctx_t dl_ctx );
+dl_error_t dl_internal_build_hot_types( dl_ctx_t dl_ctx );
+void       dl_internal_detach_inplace_typelib( dl_ctx_t dl_ctx );
+void       dl_internal_begin_module( dl_ctx_t dl_ctx, uint32_t name_hash );
+
+/**
+ * State kept while loading one txt-typelib, owned by dl_context_load_txt_type_library() so that it can be freed
+ * even if loading fails.
+ */
+struct dl_txt_typelib_load_state
+{
+	uint32_t* type_lookup; ///< open addressed on typeid, index in ctx->type_descs + 1, 0 if slot is empty.
+	uint32_t* enum_lookup; ///< open addressed on typeid, index in ctx->enum_descs + 1, 0 if slot is empty.
+	uint32_t  lookup_mask;
+
+	uint32_t  type_start;   ///< first type loaded by this typelib, all types before it are fully processed.
+	uint32_t  member_start; ///< first member loaded by this typelib.
+	uint8_t*  type_state;   ///< DL_TXT_TYPE_STATE_* for each type loaded by this typelib.
+
+	uint32_t* default_batch_offsets; ///< offset in default_batch_data for each member loaded by this typelib, UINT32_MAX if not packed in a batch.
+	uint8_t*  default_batch_data;
+	char*     default_batch_txt;
+};
+
+enum
+{
+	DL_TXT_TYPE_STATE_LAYOUT_STARTED = 1 << 0,
+	DL_TXT_TYPE_STATE_LAYOUT_DONE    = 1 << 1,
+	DL_TXT_TYPE_STATE_SUBDATA_DONE   = 1 << 2,
+};
+
+static void dl_txt_typelib_lookup_insert( uint32_t* lookup, uint32_t mask, const dl_typeid_t* ids, uint32_t index )
+{
+	for( uint32_t slot = ids[index] & mask; ; slot = ( slot + 1 ) & mask )
+	{
+		if( lookup[slot] == 0 )
+		{
+			lookup[slot] = index + 1;
+			return;
+		}
+
+		// ... keep the first type with a typeid to match dl_internal_find_type() ...
+		if( ids[ lookup[slot] - 1 ] == ids[index] )
+			return;
+	}
+}
+
+static uint32_t dl_txt_typelib_lookup_find( const uint32_t* lookup, uint32_t mask, const dl_typeid_t* ids, dl_typeid_t tid )
+{
+	for( uint32_t slot = tid & mask; lookup[slot] != 0; slot = ( slot + 1 ) & mask )
+		if( ids[ lookup[slot] - 1 ] == tid )
+			return lookup[slot] - 1;
+	return UINT32_MAX;
+}
+
+/**
+ * Build typeid-lookups for all types and enums in ctx, called when all types in the typelib has been read.
+ */
+static void dl_txt_typelib_load_state_build_lookup( dl_ctx_t ctx, dl_txt_typelib_load_state* state )
+{
+	uint32_t max_count = ctx->type_count > ctx->enum_count ? ctx->type_count : ctx->enum_count;
+	uint32_t slots = 16;
+	while( slots < max_count * 2 )
+		slots *= 2;
+
+	state->lookup_mask = slots - 1;
+	state->type_lookup = (uint32_t*)dl_alloc( &ctx->alloc, slots * sizeof( uint32_t ) );
+	state->enum_lookup = (uint32_t*)dl_alloc( &ctx->alloc, slots * sizeof( uint32_t ) );
+	memset( state->type_lookup, 0x0, slots * sizeof( uint32_t ) );
+	memset( state->enum_lookup, 0x0, slots * sizeof( uint32_t ) );
+
+	for( uint32_t i = 0; i < ctx->type_count; ++i )
+		dl_txt_typelib_lookup_insert( state->type_lookup, state->lookup_mask, ctx->type_ids, i );
+	for( uint32_t i = 0; i < ctx->enum_count; ++i )
+		dl_txt_typelib_lookup_insert( state->enum_lookup, state->lookup_mask, ctx->enum_ids, i );
+
+	uint32_t type_count = ctx->type_count - state->type_start;
+	state->type_state = (uint8_t*)dl_alloc( &ctx->alloc, type_count + 1 );
+	memset( state->type_state, 0x0, type_count + 1 );
+}
+
+static void dl_txt_typelib_load_state_free( dl_ctx_t ctx, dl_txt_typelib_load_state* state )
+{
+	dl_free( &ctx->alloc, state->type_lookup );
+	dl_free( &ctx->alloc, state->enum_lookup );
+	dl_free( &ctx->alloc, state->type_state );
+	dl_free( &ctx->alloc, state->default_batch_offsets );
+	dl_free( &ctx->alloc, state->default_batch_data );
+	dl_free( &ctx->alloc, state->default_batch_txt );
+}
+
+static inline uint32_t dl_txt_typelib_find_type_index( dl_ctx_t ctx, dl_txt_typelib_load_state* state, dl_typeid_t tid )
+{
+	return dl_txt_typelib_lookup_find( state->type_lookup, state->lookup_mask, ctx->type_ids, tid );
+}
+
+static inline const dl_type_desc* dl_txt_typelib_find_type( dl_ctx_t ctx, dl_txt_typelib_load_state* state, dl_typeid_t tid )
+{
+	uint32_t type_index = dl_txt_typelib_find_type_index( ctx, state, tid );
+	return type_index == UINT32_MAX ? 0x0 : &ctx->type_descs[type_index];
+}
+
+static inline const dl_enum_desc* dl_txt_typelib_find_enum( dl_ctx_t ctx, dl_txt_typelib_load_state* state, dl_typeid_t tid )
+{
+	uint32_t enum_index = dl_txt_typelib_lookup_find( state->enum_lookup, state->lookup_mask, ctx->enum_ids, tid );
+	return enum_index == UINT32_MAX ? 0x0 : &ctx->enum_descs[enum_index];
+}
+
+static void dl_load_txt_append_default_data( dl_ctx_t ctx, dl_member_desc* member, const uint8_t* data, size_t size )
+{
+	ctx->default_data = (uint8_t*)dl_realloc( &ctx->alloc, ctx->default_data, ctx->default_data_size + size, ctx->default_data_size );
+	memcpy( ctx->default_data + ctx->default_data_size, data, size );
 
-static void dl_load_txt_build_default_data( dl_ctx_t ctx, dl_txt_read_ctx* read_state, unsigned int member_index )
+	member->default_value_offset = (uint32_t)ctx->default_data_size;
+	member->default_value_size   = (uint32_t)size;
+	ctx->default_data_size += size;
+}
+
+static void dl_load_txt_build_default_data( dl_ctx_t ctx, dl_txt_read_ctx* read_state, dl_txt_typelib_load_state* state, unsigned int member_index )
 {
 	if( ctx->member_descs[member_index].default_value_offset == 0xFFFFFFFF )
 		return;
 
+	uint32_t batch_offset = state->default_batch_offsets[member_index - state->member_start];
+	if( batch_offset != UINT32_MAX )
+	{
+		dl_member_desc* member = &ctx->member_descs[member_index];
+		dl_load_txt_append_default_data( ctx, member, state->default_batch_data + batch_offset, member->size[DL_PTR_SIZE_HOST] );
+		return;
+	}
+
 	// TODO: check that this is not outside the buffers
 	dl_type_desc*   def_type   = dl_alloc_type( ctx, dl_internal_hash_string( "a_type_here" ) );
 	dl_member_desc* def_member = dl_alloc_member( ctx );
@@ -242,6 +367,9 @@ static void dl_load_txt_build_default_data( dl_ctx_t ctx, dl_txt_read_ctx* read_
 
 	uint8_t* pack_buffer = (uint8_t*)dl_alloc( &ctx->alloc, prod_bytes );
 
+	// ... bits of bitfields outside the member and padding is not written by pack, clear them to keep default-data deterministic ...
+	memset( pack_buffer, 0x0, prod_bytes );
+
 	bool use_fast_ptr_patch = false;
 	err = dl_txt_pack_internal( ctx, def_buffer, pack_buffer, prod_bytes, 0x0, use_fast_ptr_patch );
 	if( err != DL_ERROR_OK )
@@ -254,20 +382,152 @@ static void dl_load_txt_build_default_data( dl_ctx_t ctx, dl_txt_read_ctx* read_
 	size_t offset_to_data_start = dl_internal_align_up( sizeof( dl_data_header ), def_type->alignment[DL_PTR_SIZE_HOST] );
 	size_t inst_size = prod_bytes - offset_to_data_start;
 
-	ctx->default_data = (uint8_t*)dl_realloc( &ctx->alloc, ctx->default_data, ctx->default_data_size + inst_size, ctx->default_data_size );
-	memcpy( ctx->default_data + ctx->default_data_size, pack_buffer + offset_to_data_start, inst_size );
-
+	dl_load_txt_append_default_data( ctx, member, pack_buffer + offset_to_data_start, inst_size );
 	dl_free( &ctx->alloc, pack_buffer );
 
-	member->default_value_offset = (uint32_t)ctx->default_data_size;
-	member->default_value_size   = (uint32_t)inst_size;
-	ctx->default_data_size += inst_size;
-
 	--ctx->type_count;
 	--ctx->member_count;
 	ctx->typedata_strings_size = name_start;
 }
 
+/**
+ * Number of default-values packed in one go by dl_load_txt_batch_default_data(). Txt pack looks up members by name
+ * so packing too many members of one type at once would go quadratic.
+ */
+#define DL_TXT_DEFAULT_BATCH_SIZE 64
+
+/**
+ * Only default-values without subdata that do not depend on other default-values can be batched, inline structs are
+ * left out since their members could fall back to defaults that are not yet built.
+ */
+static bool dl_load_txt_can_batch_default( const dl_member_desc* member )
+{
+	if( member->default_value_offset == UINT32_MAX )
+		return false;
+
+	if( member->AtomType() == DL_TYPE_ATOM_ARRAY )
+		return false;
+
+	switch( member->StorageType() )
+	{
+		case DL_TYPE_STORAGE_STR:
+		case DL_TYPE_STORAGE_PTR:
+		case DL_TYPE_STORAGE_STRUCT:
+			return false;
+		default:
+			return true;
+	}
+}
+
+/**
+ * Pack default-values DL_TXT_DEFAULT_BATCH_SIZE at a time as members of one temporary type instead
+ * of packing one instance per member. A batch that fails to pack is left to dl_load_txt_build_default_data() so that
+ * the error is reported for the member that caused it.
+ */
+static void dl_load_txt_batch_default_data( dl_ctx_t ctx, dl_txt_read_ctx* read_state, dl_txt_typelib_load_state* state )
+{
+	uint32_t member_end = ctx->member_count;
+	size_t offsets_size = ( member_end - state->member_start + 1 ) * sizeof( uint32_t );
+	state->default_batch_offsets = (uint32_t*)dl_alloc( &ctx->alloc, offsets_size );
+	memset( state->default_batch_offsets, 0xFF, offsets_size );
+
+	size_t batch_data_size = 0;
+	size_t txt_cap = 0;
+
+	uint32_t batch[DL_TXT_DEFAULT_BATCH_SIZE];
+	uint32_t member_index = state->member_start;
+	while( true )
+	{
+		uint32_t batch_count = 0;
+		size_t txt_size = 32;
+		for( ; member_index < member_end && batch_count < DL_TXT_DEFAULT_BATCH_SIZE; ++member_index )
+		{
+			const dl_member_desc* member = &ctx->member_descs[member_index];
+			if( !dl_load_txt_can_batch_default( member ) )
+				continue;
+			batch[batch_count++] = member_index;
+			txt_size += member->default_value_size + 16;
+		}
+		if( batch_count == 0 )
+			return;
+
+		if( txt_cap < txt_size )
+		{
+			state->default_batch_txt = (char*)dl_realloc( &ctx->alloc, state->default_batch_txt, txt_size, txt_cap );
+			txt_cap = txt_size;
+		}
+		char* txt = state->default_batch_txt;
+		size_t txt_pos = (size_t)dl_internal_str_format( txt, txt_cap, "{\"a_type_here\":{" );
+
+		size_t name_start = ctx->typedata_strings_size;
+		dl_substr temp = { "a_type_here", 11 };
+		dl_type_desc* def_type = dl_alloc_type( ctx, dl_internal_hash_string( "a_type_here" ) );
+		def_type->name = dl_alloc_string( ctx, &temp );
+
+		uint32_t size  = 0;
+		uint32_t align = 1;
+		for( uint32_t i = 0; i < batch_count; ++i )
+		{
+			dl_member_desc* def_member = dl_alloc_member( ctx );
+			const dl_member_desc* member = &ctx->member_descs[batch[i]];
+			memcpy( def_member, member, sizeof( dl_member_desc ) );
+
+			char name[16];
+			dl_substr name_str = { name, dl_internal_str_format( name, sizeof(name), "m%u", i ) };
+			def_member->name                 = dl_alloc_string( ctx, &name_str );
+			def_member->comment              = UINT32_MAX;
+			def_member->metadata_count       = 0;
+			def_member->default_value_offset = UINT32_MAX;
+			def_member->default_value_size   = 0;
+
+			uint32_t offset = dl_internal_align_up( size, member->alignment[DL_PTR_SIZE_HOST] );
+			def_member->offset[DL_PTR_SIZE_32BIT] = offset;
+			def_member->offset[DL_PTR_SIZE_64BIT] = offset;
+			size  = offset + member->size[DL_PTR_SIZE_HOST];
+			align = member->alignment[DL_PTR_SIZE_HOST] > align ? member->alignment[DL_PTR_SIZE_HOST] : align;
+
+			txt_pos += (size_t)dl_internal_str_format( txt + txt_pos, txt_cap - txt_pos, "\"%s\":%.*s,", name, (int)member->default_value_size, read_state->start + member->default_value_offset );
+		}
+		txt[txt_pos - 1] = '}';
+		dl_internal_str_format( txt + txt_pos, txt_cap - txt_pos, "}" );
+
+		def_type->size[DL_PTR_SIZE_HOST]      = dl_internal_align_up( size, align );
+		def_type->alignment[DL_PTR_SIZE_HOST] = align;
+		def_type->member_count                = batch_count;
+
+		size_t data_start = dl_internal_align_up( sizeof( dl_data_header ), align );
+		size_t pack_size  = data_start + def_type->size[DL_PTR_SIZE_HOST];
+		uint8_t* pack_buffer = (uint8_t*)dl_alloc( &ctx->alloc, pack_size );
+		memset( pack_buffer, 0x0, pack_size );
+
+		// ... errors are reported when the batch is retried member by member ...
+		dl_error_msg_handler error_msg_func = ctx->error_msg_func;
+		ctx->error_msg_func = 0x0;
+		size_t prod_bytes = 0;
+		bool use_fast_ptr_patch = false;
+		dl_error_t err = dl_txt_pack_internal( ctx, txt, pack_buffer, pack_size, &prod_bytes, use_fast_ptr_patch );
+		ctx->error_msg_func = error_msg_func;
+
+		if( err == DL_ERROR_OK && prod_bytes == pack_size )
+		{
+			const dl_member_desc* def_members = ctx->member_descs + def_type->member_start;
+			state->default_batch_data = (uint8_t*)dl_realloc( &ctx->alloc, state->default_batch_data, batch_data_size + size, batch_data_size );
+			for( uint32_t i = 0; i < batch_count; ++i )
+			{
+				uint32_t member_size = def_members[i].size[DL_PTR_SIZE_HOST];
+				memcpy( state->default_batch_data + batch_data_size, pack_buffer + data_start + def_members[i].offset[DL_PTR_SIZE_HOST], member_size );
+				state->default_batch_offsets[batch[i] - state->member_start] = (uint32_t)batch_data_size;
+				batch_data_size += member_size;
+			}
+		}
+
+		dl_free( &ctx->alloc, pack_buffer );
+		--ctx->type_count;
+		ctx->member_count -= batch_count;
+		ctx->typedata_strings_size = name_start;
+	}
+}
+
 static dl_member_desc* dl_load_txt_find_first_bitfield_member( dl_member_desc* start, dl_member_desc* end )
 {
 	while( start <= end )
@@ -342,11 +602,19 @@ static inline bool dl_internal_find_enum_value_from_name( dl_ctx_t ctx, const ch
 	return false;
 }
 
-static void dl_load_txt_calc_type_size_and_align( dl_ctx_t ctx, dl_txt_read_ctx* read_state, dl_type_desc* type )
+static void dl_load_txt_calc_type_size_and_align( dl_ctx_t ctx, dl_txt_read_ctx* read_state, dl_txt_typelib_load_state* state, uint32_t type_index )
 {
-	// ... is the type already processed ...
-	if( type->size[0] > 0 )
+	// ... types from earlier typelibs are already processed ...
+	if( type_index < state->type_start )
+		return;
+
+	dl_type_desc* type = ctx->type_descs + type_index;
+	uint8_t* type_state = &state->type_state[type_index - state->type_start];
+	if( *type_state & DL_TXT_TYPE_STATE_LAYOUT_DONE )
 		return;
+	if( *type_state & DL_TXT_TYPE_STATE_LAYOUT_STARTED )
+		dl_txt_read_failed( ctx, read_state, DL_ERROR_MALFORMED_DATA, "type '%s' contains itself inline", dl_internal_type_name( ctx, type ) );
+	*type_state |= DL_TXT_TYPE_STATE_LAYOUT_STARTED;
 
 	dl_load_txt_fixup_bitfield_members( ctx, type );
 
@@ -365,7 +633,7 @@ static void dl_load_txt_calc_type_size_and_align( dl_ctx_t ctx, dl_txt_read_ctx*
 		// If a member is marked as a struct it could also have been an enum that we didn't know about parse-time, patch it in that case.
 		if( member->StorageType() == DL_TYPE_STORAGE_STRUCT )
 		{
-			if( const dl_enum_desc* edesc = dl_internal_find_enum( ctx, member->type_id ) )
+			if( const dl_enum_desc* edesc = dl_txt_typelib_find_enum( ctx, state, member->type_id ) )
 				member->set_storage( edesc->storage );
 		}
 
@@ -408,11 +676,12 @@ static void dl_load_txt_calc_type_size_and_align( dl_ctx_t ctx, dl_txt_read_ctx*
 
 				if( storage == DL_TYPE_STORAGE_STRUCT )
 				{
-					const dl_type_desc* sub_type = dl_internal_find_type( ctx, member->type_id );
-					if( sub_type == 0x0 )
+					uint32_t sub_type_index = dl_txt_typelib_find_type_index( ctx, state, member->type_id );
+					if( sub_type_index == UINT32_MAX )
 						continue;
 
-					dl_load_txt_calc_type_size_and_align( ctx, read_state, (dl_type_desc*)sub_type );
+					dl_load_txt_calc_type_size_and_align( ctx, read_state, state, sub_type_index );
+					const dl_type_desc* sub_type = ctx->type_descs + sub_type_index;
 					member->copy_size( sub_type->size );
 					member->copy_align( sub_type->alignment );
 				}
@@ -478,40 +747,48 @@ static void dl_load_txt_calc_type_size_and_align( dl_ctx_t ctx, dl_txt_read_ctx*
 	type->size[DL_PTR_SIZE_64BIT] = dl_internal_align_up( size[DL_PTR_SIZE_64BIT], align[DL_PTR_SIZE_64BIT] );
 	type->alignment[DL_PTR_SIZE_32BIT] = align[DL_PTR_SIZE_32BIT];
 	type->alignment[DL_PTR_SIZE_64BIT] = align[DL_PTR_SIZE_64BIT];
+
+	*type_state |= DL_TXT_TYPE_STATE_LAYOUT_DONE;
 }
 
-static bool dl_context_load_txt_type_has_subdata( dl_ctx_t ctx, dl_txt_read_ctx* read_state, const dl_type_desc* type )
+static bool dl_context_load_txt_type_has_subdata( dl_ctx_t ctx, dl_txt_read_ctx* read_state, dl_txt_typelib_load_state* state, uint32_t type_index )
 {
+	dl_type_desc* type = ctx->type_descs + type_index;
+
+	// ... types from earlier typelibs and types already visited has their flag set ...
+	if( type_index < state->type_start || ( state->type_state[type_index - state->type_start] & DL_TXT_TYPE_STATE_SUBDATA_DONE ) )
+		return ( type->flags & DL_TYPE_FLAG_HAS_SUBDATA ) != 0;
+
 	unsigned int mem_start = type->member_start;
 	unsigned int mem_end   = type->member_start + type->member_count;
 
 	// do the type have subdata?
-	for( unsigned int member_index = mem_start; member_index < mem_end; ++member_index )
+	bool has_subdata = false;
+	for( unsigned int member_index = mem_start; member_index < mem_end && !has_subdata; ++member_index )
 	{
 		dl_member_desc* member = ctx->member_descs + member_index;
 		dl_type_atom_t atom = member->AtomType();
 		dl_type_storage_t storage = member->StorageType();
 
-		switch( atom )
+		if( atom == DL_TYPE_ATOM_ARRAY )
 		{
-			case DL_TYPE_ATOM_ARRAY:
-				return true;
-			default:
-				break;
+			has_subdata = true;
+			break;
 		}
 
 		switch( storage )
 		{
 			case DL_TYPE_STORAGE_STR:
 			case DL_TYPE_STORAGE_PTR:
-				return true;
+				has_subdata = true;
+				break;
 			case DL_TYPE_STORAGE_STRUCT:
 			{
-				const dl_type_desc* subtype = dl_internal_find_type( ctx, member->type_id );
-				if( subtype == NULL )
+				// ... layout has already failed on types containing themselves inline so this can't recurse forever ...
+				uint32_t subtype_index = dl_txt_typelib_find_type_index( ctx, state, member->type_id );
+				if( subtype_index == UINT32_MAX )
 					dl_txt_read_failed( ctx, read_state, DL_ERROR_MALFORMED_DATA, "Member is missing type id.");
-				if( dl_context_load_txt_type_has_subdata( ctx, read_state, subtype ) )
-					return true;
+				has_subdata = dl_context_load_txt_type_has_subdata( ctx, read_state, state, subtype_index );
 			}
 			break;
 			default:
@@ -519,13 +796,10 @@ static bool dl_context_load_txt_type_has_subdata( dl_ctx_t ctx, dl_txt_read_ctx*
 		}
 	}
 
-	return false;
-}
-
-static void dl_context_load_txt_type_set_flags( dl_ctx_t ctx, dl_txt_read_ctx* read_state, dl_type_desc* type )
-{
-	if( dl_context_load_txt_type_has_subdata( ctx, read_state, type ) )
+	if( has_subdata )
 		type->flags |= (uint32_t)DL_TYPE_FLAG_HAS_SUBDATA;
+	state->type_state[type_index - state->type_start] |= DL_TXT_TYPE_STATE_SUBDATA_DONE;
+	return has_subdata;
 }
 
 static void dl_context_create_metadata( dl_ctx_t ctx, dl_txt_read_ctx* read_state, void** metadata )
@@ -1275,21 +1549,29 @@ static void dl_context_load_txt_type_library_read_types( dl_ctx_t ctx, dl_txt_re
 	dl_txt_eat_char( ctx, read_state, '}' );
 }
 
-static const dl_type_desc* dl_internal_member_owner( dl_ctx_t ctx, const dl_member_desc* member )
+static const dl_type_desc* dl_internal_member_owner( dl_ctx_t ctx, dl_txt_typelib_load_state* state, const dl_member_desc* member )
 {
+	// ... types in a txt-typelib are allocated after their members, so member_start is increasing for all types in it ...
 	uint32_t member_index = (uint32_t)(member - ctx->member_descs);
-	for(uint32_t type_index = 0; type_index < ctx->type_count; ++type_index)
+	uint32_t first = state->type_start;
+	uint32_t count = ctx->type_count - state->type_start;
+	while( count > 0 )
 	{
-		const dl_type_desc* type = ctx->type_descs + type_index;
-		if( member_index >= type->member_start &&
-			member_index < type->member_start + type->member_count)
-			return type;
+		uint32_t step = count / 2;
+		if( ctx->type_descs[first + step].member_start <= member_index )
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else
+			count = step;
 	}
-	DL_ASSERT_MSG(false, "couldn't find owner-type of member '%s'", dl_internal_member_name(ctx, member));
-	return 0x0;
+
+	DL_ASSERT_MSG( first > state->type_start, "couldn't find owner-type of member '%s'", dl_internal_member_name( ctx, member ) );
+	return ctx->type_descs + first - 1;
 }
 
-static void dl_context_load_txt_type_library_inner( dl_ctx_t ctx, dl_txt_read_ctx* read_state )
+static void dl_context_load_txt_type_library_inner( dl_ctx_t ctx, dl_txt_read_ctx* read_state, dl_txt_typelib_load_state* state )
 {
 #if defined(_MSC_VER )
 #pragma warning(push)
@@ -1303,6 +1585,8 @@ static void dl_context_load_txt_type_library_inner( dl_ctx_t ctx, dl_txt_read_ct
 		uint32_t type_start = ctx->type_count;
 		uint32_t member_start = ctx->member_count;
 		uint32_t metadata_start = (uint32_t) ctx->metadatas_count;
+		state->type_start   = type_start;
+		state->member_start = member_start;
 
 		dl_txt_eat_char( ctx, read_state, '{' );
 
@@ -1314,7 +1598,7 @@ static void dl_context_load_txt_type_library_inner( dl_ctx_t ctx, dl_txt_read_ct
 			if( strncmp( "module", key.str, 6 ) == 0 )
 			{
 				dl_substr module = dl_txt_eat_and_expect_string( ctx, read_state );
-				(void)module;
+				ctx->modules[ ctx->module_count - 1 ].name_hash = dl_internal_hash_buffer( (const uint8_t*)module.str, (size_t)module.len );
 			}
 			else if( strncmp( "c_includes", key.str, 10 ) == 0 )
 			{
@@ -1339,8 +1623,10 @@ static void dl_context_load_txt_type_library_inner( dl_ctx_t ctx, dl_txt_read_ct
 
 		dl_txt_eat_char( ctx, read_state, '}' );
 
+		dl_txt_typelib_load_state_build_lookup( ctx, state );
+
 		for( unsigned int i = type_start; i < ctx->type_count; ++i )
-			dl_load_txt_calc_type_size_and_align( ctx, read_state, ctx->type_descs + i );
+			dl_load_txt_calc_type_size_and_align( ctx, read_state, state, i );
 
 		// fixup members
 		for( uint32_t member_index = member_start; member_index < ctx->member_count; ++member_index )
@@ -1348,7 +1634,7 @@ static void dl_context_load_txt_type_library_inner( dl_ctx_t ctx, dl_txt_read_ct
 			dl_member_desc* member = ctx->member_descs + member_index;
 			if( member->type_id )
 			{
-				const dl_enum_desc* enum_sub_type = dl_internal_find_enum( ctx, member->type_id );
+				const dl_enum_desc* enum_sub_type = dl_txt_typelib_find_enum( ctx, state, member->type_id );
 				if( enum_sub_type )
 				{
 					// ... type was really an enum ...
@@ -1356,10 +1642,10 @@ static void dl_context_load_txt_type_library_inner( dl_ctx_t ctx, dl_txt_read_ct
 				}
 				else
 				{
-					const dl_type_desc* sub_type = dl_internal_find_type( ctx, member->type_id );
+					const dl_type_desc* sub_type = dl_txt_typelib_find_type( ctx, state, member->type_id );
 					if( sub_type == 0x0 )
 					{
-						const dl_type_desc* owner_type = dl_internal_member_owner( ctx, member );
+						const dl_type_desc* owner_type = dl_internal_member_owner( ctx, state, member );
 						dl_txt_read_failed( ctx, read_state, DL_ERROR_TYPE_NOT_FOUND, 
 											"couldn't find type for member '%s::%s'", 
 											dl_internal_type_name( ctx, owner_type ),
@@ -1369,11 +1655,19 @@ static void dl_context_load_txt_type_library_inner( dl_ctx_t ctx, dl_txt_read_ct
 			}
 		}
 
+		// ... default-values are packed and patched with the hot types, so build them as soon as the layout is known ...
+		if( dl_internal_build_hot_types( ctx ) != DL_ERROR_OK )
+			dl_txt_read_failed( ctx, read_state, DL_ERROR_OUT_OF_LIBRARY_MEMORY, "out of memory building hot types" );
+
+		dl_load_txt_batch_default_data( ctx, read_state, state );
 		for( uint32_t member_index = member_start; member_index < ctx->member_count; ++member_index )
-			dl_load_txt_build_default_data( ctx, read_state, member_index );
+			dl_load_txt_build_default_data( ctx, read_state, state, member_index );
 
 		for( unsigned int i = type_start; i < ctx->type_count; ++i )
-			dl_context_load_txt_type_set_flags( ctx, read_state, ctx->type_descs + i );
+			dl_context_load_txt_type_has_subdata( ctx, read_state, state, i );
+
+		if( dl_internal_build_hot_types( ctx ) != DL_ERROR_OK )
+			dl_txt_read_failed( ctx, read_state, DL_ERROR_OUT_OF_LIBRARY_MEMORY, "out of memory building hot types" );
 
 		for( unsigned int i = metadata_start; i < ctx->metadatas_count; ++i )
 			dl_context_create_metadata(ctx, read_state, ctx->metadatas + i);
@@ -1388,13 +1682,25 @@ dl_error_t dl_context_load_txt_type_library( dl_ctx_t ctx, const char* lib_data,
 {
 	(void)lib_data_size;
 
+	dl_error_t err = dl_internal_check_ctx_not_frozen( ctx );
+	if( err != DL_ERROR_OK )
+		return err;
+
 	dl_txt_read_ctx read_state;
 	read_state.start = lib_data;
 	read_state.end   = lib_data + lib_data_size;
 	read_state.iter  = lib_data;
 	read_state.err   = DL_ERROR_OK;
 
-	dl_context_load_txt_type_library_inner( ctx, &read_state );
+	dl_txt_typelib_load_state state;
+	memset( &state, 0x0, sizeof( state ) );
+
+	dl_internal_detach_inplace_typelib( ctx );
+	dl_internal_begin_module( ctx, 0 );
+	dl_context_load_txt_type_library_inner( ctx, &read_state, &state );
+	dl_txt_typelib_load_state_free( ctx, &state );
+	if( read_state.err != DL_ERROR_OK )
+		return read_state.err;
 
-	return read_state.err;
+	return dl_internal_build_type_defaults( ctx );
 }
@@ -7,6 +7,8 @@
 #include <stdlib.h>
 #include <ctype.h>
 
+#include <algorithm>
+
 #if defined( __GNUC__ )
 static void dl_binary_writer_write_string_fmt( dl_binary_writer* writer, const char* fmt, ... ) __attribute__((format( printf, 2, 3 )));
 #endif
@@ -827,20 +829,25 @@ static dl_error_t dl_context_write_c_header_types( dl_binary_writer* writer, dl_
 	return DL_ERROR_OK;
 }
 
-dl_error_t dl_context_write_type_library_c_header( dl_ctx_t dl_ctx, const char* module_name, char* out_header, size_t out_header_size, size_t* produced_bytes )
+static void dl_context_module_name_uppercase( const char* module_name, char* out_name, size_t out_name_size )
 {
-	char MODULE_NAME[128];
 	size_t pos = 0;
 	const char* iter = module_name;
-	while( *iter && pos < 127 )
+	while( *iter && pos < out_name_size - 1 )
 	{
 		if( isalnum( *iter ) )
-			MODULE_NAME[pos++] = (char)toupper( *iter );
+			out_name[pos++] = (char)toupper( *iter );
 		else
-			MODULE_NAME[pos++] = '_';
+			out_name[pos++] = '_';
 		++iter;
 	}
-	MODULE_NAME[pos] = 0;
+	out_name[pos] = 0;
+}
+
+dl_error_t dl_context_write_type_library_c_header( dl_ctx_t dl_ctx, const char* module_name, char* out_header, size_t out_header_size, size_t* produced_bytes )
+{
+	char MODULE_NAME[128];
+	dl_context_module_name_uppercase( module_name, MODULE_NAME, sizeof(MODULE_NAME) );
 
 	dl_binary_writer writer;
 	dl_binary_writer_init( &writer, (uint8_t*)out_header, out_header_size, out_header == 0x0, DL_ENDIAN_HOST, DL_ENDIAN_HOST, DL_PTR_SIZE_HOST );
@@ -865,3 +872,653 @@ dl_error_t dl_context_write_type_library_c_header( dl_ctx_t dl_ctx, const char*
 
 	return DL_ERROR_OK;
 }
+
+/*
+	c++ serializers, generates specializations of dl_serializer<T> ( see dl/dl_serializer.h ) that do what
+	dl_instance_store(), the pointer-patching of dl_instance_load() and dl_convert() to another endian does but
+	with all offsets and sizes known at compile-time.
+	Stored data has to be byte-identical with what dl_instance_store() produce so the generated code follow the
+	same order of writes as dl_internal_instance_store().
+*/
+struct dl_cpp_serializer_writer
+{
+	dl_ctx_t          ctx;
+	dl_binary_writer* writer;
+	uint64_t*         sorted_types; ///< ( typeid << 32 ) | type-index, sorted for lookup.
+};
+
+struct dl_cpp_serializer_range
+{
+	uint32_t begin;
+	uint32_t end;
+};
+
+// ... ranges of an instance that is copied raw from instance to packed data ...
+struct dl_cpp_serializer_ranges
+{
+	dl_cpp_serializer_range ranges[256];
+	uint32_t                count;
+	bool                    overflow; ///< more ranges than fit, members that do not fit is stored one by one.
+};
+
+struct dl_cpp_serializer_value
+{
+	char str[64];
+};
+
+static const dl_type_desc* dl_cpp_serializer_find_type( dl_cpp_serializer_writer* w, dl_typeid_t tid )
+{
+	uint64_t key = (uint64_t)tid << 32;
+	uint64_t* end = w->sorted_types + w->ctx->type_count;
+	uint64_t* found = std::lower_bound( w->sorted_types, end, key );
+	if( found == end || ( *found >> 32 ) != tid )
+		return 0x0;
+	return w->ctx->type_descs + ( *found & 0xFFFFFFFF );
+}
+
+// ... value that differ between 32- and 64-bit pointers ...
+static dl_cpp_serializer_value dl_cpp_serializer_sel( uint32_t v32, uint32_t v64 )
+{
+	dl_cpp_serializer_value res;
+	if( v32 == v64 )
+		snprintf( res.str, sizeof(res.str), "%u", v32 );
+	else
+		snprintf( res.str, sizeof(res.str), "DL_SERIALIZER_PTR_SEL( %u, %u )", v32, v64 );
+	return res;
+}
+
+static dl_cpp_serializer_value dl_cpp_serializer_offset( const dl_member_desc* member )
+{
+	return dl_cpp_serializer_sel( member->offset[DL_PTR_SIZE_32BIT], member->offset[DL_PTR_SIZE_64BIT] );
+}
+
+static bool dl_cpp_serializer_is_raw_struct( const dl_type_desc* type )
+{
+	return ( type->flags & ( DL_TYPE_FLAG_HAS_SUBDATA | DL_TYPE_FLAG_IS_UNION ) ) == 0;
+}
+
+static void dl_cpp_serializer_add_range( dl_cpp_serializer_ranges* ranges, uint32_t begin, uint32_t size )
+{
+	if( ranges->count > 0 && ranges->ranges[ranges->count - 1].end == begin )
+	{
+		ranges->ranges[ranges->count - 1].end = begin + size;
+		return;
+	}
+	if( ranges->count == DL_ARRAY_LENGTH( ranges->ranges ) )
+	{
+		ranges->overflow = true;
+		return;
+	}
+	ranges->ranges[ranges->count].begin = begin;
+	ranges->ranges[ranges->count].end   = begin + size;
+	++ranges->count;
+}
+
+/*
+	Is member written as is from the instance by dl_internal_store_member()?
+*/
+static bool dl_cpp_serializer_member_is_raw( dl_cpp_serializer_writer* w, const dl_member_desc* member )
+{
+	switch( member->AtomType() )
+	{
+		case DL_TYPE_ATOM_POD:
+			if( member->StorageType() == DL_TYPE_STORAGE_STRUCT )
+			{
+				const dl_type_desc* sub_type = dl_cpp_serializer_find_type( w, member->type_id );
+				return sub_type != 0x0 && dl_cpp_serializer_is_raw_struct( sub_type );
+			}
+			return member->IsSimplePod();
+		case DL_TYPE_ATOM_BITFIELD:
+			return true;
+		case DL_TYPE_ATOM_INLINE_ARRAY:
+			if( member->StorageType() == DL_TYPE_STORAGE_STRUCT )
+			{
+				// ... inline arrays of structs without subdata is written in one go, unions included ...
+				const dl_type_desc* sub_type = dl_cpp_serializer_find_type( w, member->type_id );
+				return sub_type != 0x0 && ( sub_type->flags & DL_TYPE_FLAG_HAS_SUBDATA ) == 0;
+			}
+			return member->IsSimplePod();
+		default:
+			return false;
+	}
+}
+
+static void dl_cpp_serializer_collect_ranges( dl_cpp_serializer_writer* w, const dl_type_desc* type, uint32_t first_member, uint32_t member_count, uint32_t base, dl_ptr_size_t ptr_size, dl_cpp_serializer_ranges* ranges )
+{
+	bool last_was_bitfield = false;
+	for( uint32_t member_index = first_member; member_index < first_member + member_count; ++member_index )
+	{
+		const dl_member_desc* member = dl_get_type_member( w->ctx, type, member_index );
+		bool is_bitfield = member->AtomType() == DL_TYPE_ATOM_BITFIELD;
+		bool skip = last_was_bitfield && is_bitfield; // ... only first bitfield in a group write the storage ...
+		last_was_bitfield = is_bitfield;
+		if( skip || !dl_cpp_serializer_member_is_raw( w, member ) )
+			continue;
+
+		uint32_t offset = base + member->offset[ptr_size];
+		if( member->AtomType() == DL_TYPE_ATOM_POD && member->StorageType() == DL_TYPE_STORAGE_STRUCT )
+		{
+			// ... sub-structs are written member by member, padding is left as 0 ...
+			const dl_type_desc* sub_type = dl_cpp_serializer_find_type( w, member->type_id );
+			dl_cpp_serializer_collect_ranges( w, sub_type, 0, sub_type->member_count, offset, ptr_size, ranges );
+		}
+		else if( member->AtomType() == DL_TYPE_ATOM_INLINE_ARRAY && member->StorageType() == DL_TYPE_STORAGE_STRUCT )
+		{
+			const dl_type_desc* sub_type = dl_cpp_serializer_find_type( w, member->type_id );
+			dl_cpp_serializer_add_range( ranges, offset, member->inline_array_cnt() * sub_type->size[ptr_size] );
+		}
+		else
+			dl_cpp_serializer_add_range( ranges, offset, member->size[ptr_size] );
+	}
+}
+
+static void dl_cpp_serializer_write_ranges( dl_cpp_serializer_writer* w, const dl_cpp_serializer_ranges* ranges, dl_ptr_size_t ptr_size, bool both, const char* indent )
+{
+	for( uint32_t i = 0; i < ranges[ptr_size].count; ++i )
+	{
+		const dl_cpp_serializer_range& r32 = ranges[DL_PTR_SIZE_32BIT].ranges[i];
+		const dl_cpp_serializer_range& r64 = ranges[DL_PTR_SIZE_64BIT].ranges[i];
+		const dl_cpp_serializer_range& r   = ranges[ptr_size].ranges[i];
+		dl_cpp_serializer_value begin = both ? dl_cpp_serializer_sel( r32.begin, r64.begin ) : dl_cpp_serializer_sel( r.begin, r.begin );
+		dl_cpp_serializer_value size  = both ? dl_cpp_serializer_sel( r32.end - r32.begin, r64.end - r64.begin ) : dl_cpp_serializer_sel( r.end - r.begin, r.end - r.begin );
+		dl_binary_writer_write_string_fmt( w->writer, "%sw.write( pos + %s, inst + %s, %s );\n", indent, begin.str, begin.str, size.str );
+	}
+}
+
+static const char* dl_cpp_serializer_type_name( dl_cpp_serializer_writer* w, dl_typeid_t tid )
+{
+	const dl_type_desc* type = dl_cpp_serializer_find_type( w, tid );
+	return type == 0x0 ? "" : dl_internal_type_name( w->ctx, type );
+}
+
+static dl_error_t dl_cpp_serializer_write_store_members( dl_cpp_serializer_writer* w, const dl_type_desc* type, uint32_t first_member, uint32_t member_count, const char* indent )
+{
+	dl_binary_writer* writer = w->writer;
+
+	dl_cpp_serializer_ranges ranges[2];
+	memset( ranges, 0x0, sizeof(ranges) );
+	dl_cpp_serializer_collect_ranges( w, type, first_member, member_count, 0, DL_PTR_SIZE_32BIT, &ranges[DL_PTR_SIZE_32BIT] );
+	dl_cpp_serializer_collect_ranges( w, type, first_member, member_count, 0, DL_PTR_SIZE_64BIT, &ranges[DL_PTR_SIZE_64BIT] );
+	bool overflow = ranges[DL_PTR_SIZE_32BIT].overflow || ranges[DL_PTR_SIZE_64BIT].overflow;
+
+	if( overflow )
+	{
+		// ... huge types store raw members one by one below ...
+	}
+	else if( ranges[DL_PTR_SIZE_32BIT].count == ranges[DL_PTR_SIZE_64BIT].count )
+		dl_cpp_serializer_write_ranges( w, ranges, DL_PTR_SIZE_64BIT, true, indent );
+	else
+	{
+		dl_binary_writer_write_string_fmt( writer, "%sif( sizeof( void* ) == 8 )\n%s{\n", indent, indent );
+		char inner[64];
+		snprintf( inner, sizeof(inner), "%s    ", indent );
+		dl_cpp_serializer_write_ranges( w, ranges, DL_PTR_SIZE_64BIT, false, inner );
+		dl_binary_writer_write_string_fmt( writer, "%s}\n%selse\n%s{\n", indent, indent, indent );
+		dl_cpp_serializer_write_ranges( w, ranges, DL_PTR_SIZE_32BIT, false, inner );
+		dl_binary_writer_write_string_fmt( writer, "%s}\n", indent );
+	}
+
+	bool last_was_bitfield = false;
+	for( uint32_t member_index = first_member; member_index < first_member + member_count; ++member_index )
+	{
+		const dl_member_desc* member = dl_get_type_member( w->ctx, type, member_index );
+		bool is_bitfield = member->AtomType() == DL_TYPE_ATOM_BITFIELD;
+		bool skip = last_was_bitfield && is_bitfield;
+		last_was_bitfield = is_bitfield;
+		if( skip )
+			continue;
+
+		dl_cpp_serializer_value offset = dl_cpp_serializer_offset( member );
+		if( dl_cpp_serializer_member_is_raw( w, member ) )
+		{
+			if( overflow )
+			{
+				dl_cpp_serializer_ranges member_ranges[2];
+				memset( member_ranges, 0x0, sizeof(member_ranges) );
+				dl_cpp_serializer_collect_ranges( w, type, member_index, 1, 0, DL_PTR_SIZE_32BIT, &member_ranges[DL_PTR_SIZE_32BIT] );
+				dl_cpp_serializer_collect_ranges( w, type, member_index, 1, 0, DL_PTR_SIZE_64BIT, &member_ranges[DL_PTR_SIZE_64BIT] );
+				if( member_ranges[DL_PTR_SIZE_32BIT].count != member_ranges[DL_PTR_SIZE_64BIT].count ||
+					member_ranges[DL_PTR_SIZE_32BIT].overflow || member_ranges[DL_PTR_SIZE_64BIT].overflow )
+				{
+					dl_log_error( w->ctx, "type %s is too big to generate a serializer for", dl_internal_type_name( w->ctx, type ) );
+					return DL_ERROR_UNSUPPORTED_OPERATION;
+				}
+				dl_cpp_serializer_write_ranges( w, member_ranges, DL_PTR_SIZE_64BIT, true, indent );
+			}
+			continue;
+		}
+
+		const char* sub_name = dl_cpp_serializer_type_name( w, member->type_id );
+		switch( member->AtomType() )
+		{
+			case DL_TYPE_ATOM_POD:
+				switch( member->StorageType() )
+				{
+					case DL_TYPE_STORAGE_STRUCT:
+						dl_binary_writer_write_string_fmt( writer, "%sdl_serializer<%s>::store( w, pos + %s, inst + %s );\n", indent, sub_name, offset.str, offset.str );
+						break;
+					case DL_TYPE_STORAGE_STR:
+						dl_binary_writer_write_string_fmt( writer, "%sw.store_string( pos + %s, inst + %s );\n", indent, offset.str, offset.str );
+						break;
+					case DL_TYPE_STORAGE_PTR:
+						dl_binary_writer_write_string_fmt( writer, "%sdl_serializer_store_ptr<%s>( w, pos + %s, inst + %s );\n", indent, sub_name, offset.str, offset.str );
+						break;
+					default:
+						DL_ASSERT( false );
+				}
+				break;
+			case DL_TYPE_ATOM_INLINE_ARRAY:
+				switch( member->StorageType() )
+				{
+					case DL_TYPE_STORAGE_STRUCT:
+						dl_binary_writer_write_string_fmt( writer, "%sfor( size_t i = 0; i < %u; ++i )\n"
+																   "%s    dl_serializer<%s>::store( w, pos + %s + i * dl_serializer<%s>::SIZE, inst + %s + i * dl_serializer<%s>::SIZE );\n",
+																   indent, member->inline_array_cnt(), indent, sub_name, offset.str, sub_name, offset.str, sub_name );
+						break;
+					case DL_TYPE_STORAGE_STR:
+						dl_binary_writer_write_string_fmt( writer, "%sfor( size_t i = 0; i < %u; ++i )\n"
+																   "%s    w.store_string( pos + %s + i * sizeof( char* ), inst + %s + i * sizeof( char* ) );\n",
+																   indent, member->inline_array_cnt(), indent, offset.str, offset.str );
+						break;
+					case DL_TYPE_STORAGE_PTR:
+						dl_binary_writer_write_string_fmt( writer, "%sfor( size_t i = 0; i < %u; ++i )\n"
+																   "%s    dl_serializer_store_ptr<%s>( w, pos + %s + i * sizeof( void* ), inst + %s + i * sizeof( void* ) );\n",
+																   indent, member->inline_array_cnt(), indent, sub_name, offset.str, offset.str );
+						break;
+					default:
+						DL_ASSERT( false );
+				}
+				break;
+			case DL_TYPE_ATOM_ARRAY:
+				switch( member->StorageType() )
+				{
+					case DL_TYPE_STORAGE_STRUCT:
+						dl_binary_writer_write_string_fmt( writer, "%sdl_serializer_store_struct_array<%s>( w, pos + %s, inst + %s );\n", indent, sub_name, offset.str, offset.str );
+						break;
+					case DL_TYPE_STORAGE_STR:
+						dl_binary_writer_write_string_fmt( writer, "%sw.store_str_array( pos + %s, inst + %s );\n", indent, offset.str, offset.str );
+						break;
+					case DL_TYPE_STORAGE_PTR:
+						dl_binary_writer_write_string_fmt( writer, "%sdl_serializer_store_ptr_array<%s>( w, pos + %s, inst + %s );\n", indent, sub_name, offset.str, offset.str );
+						break;
+					default:
+						dl_binary_writer_write_string_fmt( writer, "%sw.store_pod_array( pos + %s, inst + %s, %u );\n", indent, offset.str, offset.str, (unsigned int)dl_pod_size( member->StorageType() ) );
+						break;
+				}
+				break;
+			default:
+				DL_ASSERT( false && "Invalid ATOM-type!" );
+				break;
+		}
+	}
+	return DL_ERROR_OK;
+}
+
+static void dl_cpp_serializer_write_patch_member( dl_cpp_serializer_writer* w, const dl_member_desc* member, const char* indent )
+{
+	dl_binary_writer* writer = w->writer;
+	dl_cpp_serializer_value offset = dl_cpp_serializer_offset( member );
+	const dl_type_desc* sub_type = member->StorageType() == DL_TYPE_STORAGE_STRUCT || member->StorageType() == DL_TYPE_STORAGE_PTR
+									? dl_cpp_serializer_find_type( w, member->type_id )
+									: 0x0;
+	const char* sub_name = sub_type ? dl_internal_type_name( w->ctx, sub_type ) : "";
+	bool sub_has_subdata = sub_type != 0x0 && ( sub_type->flags & DL_TYPE_FLAG_HAS_SUBDATA );
+
+	switch( member->AtomType() )
+	{
+		case DL_TYPE_ATOM_POD:
+			switch( member->StorageType() )
+			{
+				case DL_TYPE_STORAGE_STR:
+					dl_binary_writer_write_string_fmt( writer, "%sp.patch( inst + %s );\n", indent, offset.str );
+					break;
+				case DL_TYPE_STORAGE_PTR:
+					dl_binary_writer_write_string_fmt( writer, "%sdl_serializer_patch_ptr<%s>( p, inst + %s );\n", indent, sub_name, offset.str );
+					break;
+				case DL_TYPE_STORAGE_STRUCT:
+					if( sub_has_subdata )
+						dl_binary_writer_write_string_fmt( writer, "%sdl_serializer<%s>::patch( p, inst + %s );\n", indent, sub_name, offset.str );
+					break;
+				default:
+					break;
+			}
+			break;
+		case DL_TYPE_ATOM_INLINE_ARRAY:
+			switch( member->StorageType() )
+			{
+				case DL_TYPE_STORAGE_STR:
+					dl_binary_writer_write_string_fmt( writer, "%sfor( size_t i = 0; i < %u; ++i )\n%s    p.patch( inst + %s + i * sizeof( char* ) );\n", indent, member->inline_array_cnt(), indent, offset.str );
+					break;
+				case DL_TYPE_STORAGE_PTR:
+					dl_binary_writer_write_string_fmt( writer, "%sfor( size_t i = 0; i < %u; ++i )\n%s    dl_serializer_patch_ptr<%s>( p, inst + %s + i * sizeof( void* ) );\n", indent, member->inline_array_cnt(), indent, sub_name, offset.str );
+					break;
+				case DL_TYPE_STORAGE_STRUCT:
+					if( sub_has_subdata )
+						dl_binary_writer_write_string_fmt( writer, "%sfor( size_t i = 0; i < %u; ++i )\n%s    dl_serializer<%s>::patch( p, inst + %s + i * dl_serializer<%s>::SIZE );\n", indent, member->inline_array_cnt(), indent, sub_name, offset.str, sub_name );
+					break;
+				default:
+					break;
+			}
+			break;
+		case DL_TYPE_ATOM_ARRAY:
+			switch( member->StorageType() )
+			{
+				case DL_TYPE_STORAGE_STR:
+					dl_binary_writer_write_string_fmt( writer, "%s{\n"
+															   "%s    unsigned char* a = (unsigned char*)p.patch( inst + %s );\n"
+															   "%s    for( size_t i = 0, n = dl_serializer_read_count( inst + %s ); i < n; ++i )\n"
+															   "%s        p.patch( a + i * sizeof( char* ) );\n"
+															   "%s}\n", indent, indent, offset.str, indent, offset.str, indent, indent );
+					break;
+				case DL_TYPE_STORAGE_PTR:
+					dl_binary_writer_write_string_fmt( writer, "%s{\n"
+															   "%s    unsigned char* a = (unsigned char*)p.patch( inst + %s );\n"
+															   "%s    for( size_t i = 0, n = dl_serializer_read_count( inst + %s ); i < n; ++i )\n"
+															   "%s        dl_serializer_patch_ptr<%s>( p, a + i * sizeof( void* ) );\n"
+															   "%s}\n", indent, indent, offset.str, indent, offset.str, indent, sub_name, indent );
+					break;
+				case DL_TYPE_STORAGE_STRUCT:
+					if( sub_has_subdata )
+					{
+						dl_binary_writer_write_string_fmt( writer, "%s{\n"
+																   "%s    unsigned char* a = (unsigned char*)p.patch( inst + %s );\n"
+																   "%s    for( size_t i = 0, n = dl_serializer_read_count( inst + %s ); i < n; ++i )\n"
+																   "%s        dl_serializer<%s>::patch( p, a + i * dl_serializer_align_up( dl_serializer<%s>::SIZE, dl_serializer<%s>::ALIGNMENT ) );\n"
+																   "%s}\n", indent, indent, offset.str, indent, offset.str, indent, sub_name, sub_name, sub_name, indent );
+						break;
+					}
+					/*fallthrough*/
+				default:
+					dl_binary_writer_write_string_fmt( writer, "%sp.patch( inst + %s );\n", indent, offset.str );
+					break;
+			}
+			break;
+		default:
+			break;
+	}
+}
+
+static void dl_cpp_serializer_write_swap_member( dl_cpp_serializer_writer* w, const dl_type_desc* type, uint32_t member_index, const char* indent )
+{
+	dl_binary_writer* writer = w->writer;
+	const dl_member_desc* member = dl_get_type_member( w->ctx, type, member_index );
+	dl_cpp_serializer_value offset = dl_cpp_serializer_offset( member );
+	const char* sub_name = member->StorageType() == DL_TYPE_STORAGE_STRUCT || member->StorageType() == DL_TYPE_STORAGE_PTR
+							? dl_cpp_serializer_type_name( w, member->type_id )
+							: "";
+
+	switch( member->AtomType() )
+	{
+		case DL_TYPE_ATOM_POD:
+			switch( member->StorageType() )
+			{
+				case DL_TYPE_STORAGE_STRUCT:
+					dl_binary_writer_write_string_fmt( writer, "%sdl_serializer<%s>::swap( s, inst + %s );\n", indent, sub_name, offset.str );
+					break;
+				case DL_TYPE_STORAGE_STR:
+					dl_binary_writer_write_string_fmt( writer, "%ss.swap_ptr( inst + %s );\n", indent, offset.str );
+					break;
+				case DL_TYPE_STORAGE_PTR:
+					dl_binary_writer_write_string_fmt( writer, "%sdl_serializer_swap_ptr<%s>( s, inst + %s );\n", indent, sub_name, offset.str );
+					break;
+				default:
+					if( dl_pod_size( member->StorageType() ) > 1 )
+						dl_binary_writer_write_string_fmt( writer, "%ss.swap_pod( inst + %s, %u );\n", indent, offset.str, (unsigned int)dl_pod_size( member->StorageType() ) );
+					break;
+			}
+			break;
+		case DL_TYPE_ATOM_BITFIELD:
+		{
+			// ... all bitfields sharing storage is swapped together ...
+			dl_binary_writer_write_string_fmt( writer, "%s{\n%s    static const uint16_t fields[] = { ", indent, indent );
+			uint32_t field_count = 0;
+			for( uint32_t i = member_index; i < type->member_count; ++i )
+			{
+				const dl_member_desc* bf = dl_get_type_member( w->ctx, type, i );
+				if( bf->AtomType() != DL_TYPE_ATOM_BITFIELD )
+					break;
+				dl_binary_writer_write_string_fmt( writer, "%s%u, %u", field_count == 0 ? "" : ", ", bf->bitfield_offset(), bf->bitfield_bits() );
+				++field_count;
+			}
+			dl_binary_writer_write_string_fmt( writer, " };\n%s    s.swap_bitfield( inst + %s, %u, fields, %u );\n%s}\n", indent, offset.str, member->size[DL_PTR_SIZE_HOST], field_count, indent );
+		}
+		break;
+		case DL_TYPE_ATOM_INLINE_ARRAY:
+			switch( member->StorageType() )
+			{
+				case DL_TYPE_STORAGE_STRUCT:
+					dl_binary_writer_write_string_fmt( writer, "%sfor( size_t i = 0; i < %u; ++i )\n%s    dl_serializer<%s>::swap( s, inst + %s + i * dl_serializer<%s>::SIZE );\n", indent, member->inline_array_cnt(), indent, sub_name, offset.str, sub_name );
+					break;
+				case DL_TYPE_STORAGE_STR:
+					dl_binary_writer_write_string_fmt( writer, "%sfor( size_t i = 0; i < %u; ++i )\n%s    s.swap_ptr( inst + %s + i * sizeof( char* ) );\n", indent, member->inline_array_cnt(), indent, offset.str );
+					break;
+				case DL_TYPE_STORAGE_PTR:
+					dl_binary_writer_write_string_fmt( writer, "%sfor( size_t i = 0; i < %u; ++i )\n%s    dl_serializer_swap_ptr<%s>( s, inst + %s + i * sizeof( void* ) );\n", indent, member->inline_array_cnt(), indent, sub_name, offset.str );
+					break;
+				default:
+					if( dl_pod_size( member->StorageType() ) > 1 )
+						dl_binary_writer_write_string_fmt( writer, "%ss.swap_pods( inst + %s, %u, %u );\n", indent, offset.str, (unsigned int)dl_pod_size( member->StorageType() ), member->inline_array_cnt() );
+					break;
+			}
+			break;
+		case DL_TYPE_ATOM_ARRAY:
+		{
+			const char* elem_size = "";
+			char elem_size_buffer[256];
+			switch( member->StorageType() )
+			{
+				case DL_TYPE_STORAGE_STRUCT:
+					snprintf( elem_size_buffer, sizeof(elem_size_buffer), "dl_serializer_align_up( dl_serializer<%s>::SIZE, dl_serializer<%s>::ALIGNMENT )", sub_name, sub_name );
+					elem_size = elem_size_buffer;
+					break;
+				case DL_TYPE_STORAGE_STR:
+				case DL_TYPE_STORAGE_PTR:
+					elem_size = "sizeof( void* )";
+					break;
+				default:
+					snprintf( elem_size_buffer, sizeof(elem_size_buffer), "%u", (unsigned int)dl_pod_size( member->StorageType() ) );
+					elem_size = elem_size_buffer;
+					break;
+			}
+
+			dl_binary_writer_write_string_fmt( writer, "%s{\n"
+													   "%s    uintptr_t offset = s.swap_ptr( inst + %s );\n"
+													   "%s    size_t    count  = s.swap_uint32( inst + %s + sizeof( void* ) );\n"
+													   "%s    unsigned char* a = s.subdata( offset, count * %s );\n"
+													   "%s    if( a != 0x0 )\n",
+													   indent, indent, offset.str, indent, offset.str, indent, elem_size, indent );
+			switch( member->StorageType() )
+			{
+				case DL_TYPE_STORAGE_STRUCT:
+					dl_binary_writer_write_string_fmt( writer, "%s        for( size_t i = 0; i < count; ++i )\n%s            dl_serializer<%s>::swap( s, a + i * %s );\n", indent, indent, sub_name, elem_size );
+					break;
+				case DL_TYPE_STORAGE_STR:
+					dl_binary_writer_write_string_fmt( writer, "%s        for( size_t i = 0; i < count; ++i )\n%s            s.swap_ptr( a + i * sizeof( char* ) );\n", indent, indent );
+					break;
+				case DL_TYPE_STORAGE_PTR:
+					dl_binary_writer_write_string_fmt( writer, "%s        for( size_t i = 0; i < count; ++i )\n%s            dl_serializer_swap_ptr<%s>( s, a + i * sizeof( void* ) );\n", indent, indent, sub_name );
+					break;
+				default:
+					dl_binary_writer_write_string_fmt( writer, "%s        s.swap_pods( a, %s, count );\n", indent, elem_size );
+					break;
+			}
+			dl_binary_writer_write_string_fmt( writer, "%s}\n", indent );
+		}
+		break;
+		default:
+			break;
+	}
+}
+
+static dl_error_t dl_cpp_serializer_write_type( dl_cpp_serializer_writer* w, uint32_t type_index )
+{
+	dl_binary_writer*   writer = w->writer;
+	const dl_type_desc* type   = w->ctx->type_descs + type_index;
+	dl_typeid_t         tid    = w->ctx->type_ids[type_index];
+	const char*         name   = dl_internal_type_name( w->ctx, type );
+	bool                is_union = ( type->flags & DL_TYPE_FLAG_IS_UNION ) != 0;
+
+	// ... store ...
+	dl_binary_writer_write_string_fmt( writer, "inline void dl_serializer<%s>::store( dl_serializer_writer& w, size_t pos, const unsigned char* inst )\n{\n", name );
+	if( type->member_count == 0 )
+		dl_binary_writer_write_string_fmt( writer, "    (void)w; (void)pos; (void)inst;\n" );
+	else if( is_union )
+	{
+		dl_cpp_serializer_value type_offset = dl_cpp_serializer_sel( dl_internal_union_type_offset( w->ctx, type, DL_PTR_SIZE_32BIT ),
+																	  dl_internal_union_type_offset( w->ctx, type, DL_PTR_SIZE_64BIT ) );
+		dl_binary_writer_write_string_fmt( writer, "    uint32_t type;\n"
+												   "    memcpy( &type, inst + %s, sizeof( uint32_t ) );\n"
+												   "    switch( type )\n"
+												   "    {\n", type_offset.str );
+		for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+		{
+			// ... union type is typeid + member_index + 1, see dl_internal_union_type_to_member() ...
+			dl_binary_writer_write_string_fmt( writer, "        case 0x%08X:\n", tid + member_index + 1 );
+			dl_error_t err = dl_cpp_serializer_write_store_members( w, type, member_index, 1, "            " );
+			if( err != DL_ERROR_OK )
+				return err;
+			dl_binary_writer_write_string_fmt( writer, "            break;\n" );
+		}
+		dl_binary_writer_write_string_fmt( writer, "        default:\n"
+												   "            w.error = DL_ERROR_MALFORMED_DATA;\n"
+												   "            return;\n"
+												   "    }\n"
+												   "    w.write( pos + %s, &type, sizeof( uint32_t ) );\n", type_offset.str );
+	}
+	else
+	{
+		dl_error_t err = dl_cpp_serializer_write_store_members( w, type, 0, type->member_count, "    " );
+		if( err != DL_ERROR_OK )
+			return err;
+	}
+	dl_binary_writer_write_string_fmt( writer, "}\n\n" );
+
+	// ... patch, only needed for types with subdata ...
+	dl_binary_writer_write_string_fmt( writer, "inline void dl_serializer<%s>::patch( dl_serializer_patcher& p, unsigned char* inst )\n{\n", name );
+	if( ( type->flags & DL_TYPE_FLAG_HAS_SUBDATA ) == 0 )
+		dl_binary_writer_write_string_fmt( writer, "    (void)p; (void)inst;\n" );
+	else if( is_union )
+	{
+		dl_cpp_serializer_value type_offset = dl_cpp_serializer_sel( dl_internal_union_type_offset( w->ctx, type, DL_PTR_SIZE_32BIT ),
+																	  dl_internal_union_type_offset( w->ctx, type, DL_PTR_SIZE_64BIT ) );
+		dl_binary_writer_write_string_fmt( writer, "    uint32_t type;\n"
+												   "    memcpy( &type, inst + %s, sizeof( uint32_t ) );\n"
+												   "    switch( type )\n"
+												   "    {\n", type_offset.str );
+		for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+		{
+			dl_binary_writer_write_string_fmt( writer, "        case 0x%08X:\n", tid + member_index + 1 );
+			dl_cpp_serializer_write_patch_member( w, dl_get_type_member( w->ctx, type, member_index ), "            " );
+			dl_binary_writer_write_string_fmt( writer, "            break;\n" );
+		}
+		dl_binary_writer_write_string_fmt( writer, "        default:\n"
+												   "            break;\n"
+												   "    }\n" );
+	}
+	else
+	{
+		for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+			dl_cpp_serializer_write_patch_member( w, dl_get_type_member( w->ctx, type, member_index ), "    " );
+	}
+	dl_binary_writer_write_string_fmt( writer, "}\n\n" );
+
+	// ... endian swap ...
+	dl_binary_writer_write_string_fmt( writer, "inline void dl_serializer<%s>::swap( dl_serializer_swapper& s, unsigned char* inst )\n{\n", name );
+	size_t swap_start = dl_binary_writer_needed_size( writer );
+	if( is_union )
+	{
+		dl_cpp_serializer_value type_offset = dl_cpp_serializer_sel( dl_internal_union_type_offset( w->ctx, type, DL_PTR_SIZE_32BIT ),
+																	  dl_internal_union_type_offset( w->ctx, type, DL_PTR_SIZE_64BIT ) );
+		dl_binary_writer_write_string_fmt( writer, "    switch( s.swap_uint32( inst + %s ) )\n"
+												   "    {\n", type_offset.str );
+		for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+		{
+			dl_binary_writer_write_string_fmt( writer, "        case 0x%08X:\n", tid + member_index + 1 );
+			dl_cpp_serializer_write_swap_member( w, type, member_index, "            " );
+			dl_binary_writer_write_string_fmt( writer, "            break;\n" );
+		}
+		dl_binary_writer_write_string_fmt( writer, "        default:\n"
+												   "            s.error = DL_ERROR_MALFORMED_DATA;\n"
+												   "            break;\n"
+												   "    }\n" );
+	}
+	else
+	{
+		bool last_was_bitfield = false;
+		for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+		{
+			bool is_bitfield = dl_get_type_member( w->ctx, type, member_index )->AtomType() == DL_TYPE_ATOM_BITFIELD;
+			if( !( last_was_bitfield && is_bitfield ) )
+				dl_cpp_serializer_write_swap_member( w, type, member_index, "    " );
+			last_was_bitfield = is_bitfield;
+		}
+	}
+	if( dl_binary_writer_needed_size( writer ) == swap_start ) // ... nothing to swap in types with only 8-bit members ...
+		dl_binary_writer_write_string_fmt( writer, "    (void)s; (void)inst;\n" );
+	dl_binary_writer_write_string_fmt( writer, "}\n\n" );
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_context_write_type_library_cpp_serializers( dl_ctx_t dl_ctx, const char* module_name, char* out_header, size_t out_header_size, size_t* produced_bytes )
+{
+	char MODULE_NAME[128];
+	dl_context_module_name_uppercase( module_name, MODULE_NAME, sizeof(MODULE_NAME) );
+
+	dl_binary_writer writer;
+	dl_binary_writer_init( &writer, (uint8_t*)out_header, out_header_size, out_header == 0x0, DL_ENDIAN_HOST, DL_ENDIAN_HOST, DL_PTR_SIZE_HOST );
+
+	dl_cpp_serializer_writer w;
+	w.ctx          = dl_ctx;
+	w.writer       = &writer;
+	w.sorted_types = (uint64_t*)malloc( ( dl_ctx->type_count + 1 ) * sizeof(uint64_t) );
+	if( w.sorted_types == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	DL_DEFER( { free( w.sorted_types ); } );
+	for( uint32_t type_index = 0; type_index < dl_ctx->type_count; ++type_index )
+		w.sorted_types[type_index] = ( (uint64_t)dl_ctx->type_ids[type_index] << 32 ) | type_index;
+	std::sort( w.sorted_types, w.sorted_types + dl_ctx->type_count );
+
+	dl_binary_writer_write_string_fmt( &writer, "/* Auto generated c++ serializers for dl type library */\n"
+												"#ifndef __DL_AUTOGEN_SERIALIZERS_%s_INCLUDED\n"
+												"#define __DL_AUTOGEN_SERIALIZERS_%s_INCLUDED\n\n"
+												"// ... include after the header generated for the same type library with dl_context_write_type_library_c_header() ...\n"
+												"#include <dl/dl_serializer.h>\n\n", MODULE_NAME, MODULE_NAME );
+
+	// ... declare all specializations before any of them is used ...
+	for( uint32_t type_index = 0; type_index < dl_ctx->type_count; ++type_index )
+	{
+		const dl_type_desc* type = dl_ctx->type_descs + type_index;
+		dl_cpp_serializer_value size  = dl_cpp_serializer_sel( type->size[DL_PTR_SIZE_32BIT], type->size[DL_PTR_SIZE_64BIT] );
+		dl_cpp_serializer_value align = dl_cpp_serializer_sel( type->alignment[DL_PTR_SIZE_32BIT], type->alignment[DL_PTR_SIZE_64BIT] );
+		dl_binary_writer_write_string_fmt( &writer, "template <>\n"
+													"struct dl_serializer<%s>\n"
+													"{\n"
+													"    static constexpr const dl_typeid_t TYPE_ID     = 0x%08X;\n"
+													"    static constexpr const size_t      SIZE        = %s;\n"
+													"    static constexpr const size_t      ALIGNMENT   = %s;\n"
+													"    static constexpr const bool        HAS_SUBDATA = %s;\n\n"
+													"    static void store( dl_serializer_writer&  w, size_t pos, const unsigned char* inst );\n"
+													"    static void patch( dl_serializer_patcher& p, unsigned char* inst );\n"
+													"    static void swap ( dl_serializer_swapper& s, unsigned char* inst );\n"
+													"};\n\n",
+													dl_internal_type_name( dl_ctx, type ),
+													dl_ctx->type_ids[type_index],
+													size.str,
+													align.str,
+													( type->flags & DL_TYPE_FLAG_HAS_SUBDATA ) ? "true" : "false" );
+	}
+
+	for( uint32_t type_index = 0; type_index < dl_ctx->type_count; ++type_index )
+	{
+		dl_error_t err = dl_cpp_serializer_write_type( &w, type_index );
+		if( err != DL_ERROR_OK )
+			return err;
+	}
+
+	dl_binary_writer_write_string_fmt( &writer, "#endif // __DL_AUTOGEN_SERIALIZERS_%s_INCLUDED\n\n", MODULE_NAME );
+
+	if( produced_bytes )
+		*produced_bytes = dl_binary_writer_needed_size( &writer );
+
+	return DL_ERROR_OK;
+}
@@ -54,6 +54,15 @@ static const uint32_t DL_UNUSED DL_TYPELIB_ID              = ('D'<< 24) | ('L' <
 static const uint32_t DL_UNUSED DL_TYPELIB_ID_SWAPED       = dl_swap_endian_uint32( DL_TYPELIB_ID );
 static const uint32_t DL_UNUSED DL_INSTANCE_ID             = ('D'<< 24) | ('L' << 16) | ('D' << 8) | 'L';
 static const uint32_t DL_UNUSED DL_INSTANCE_ID_SWAPED      = dl_swap_endian_uint32( DL_INSTANCE_ID );
+static const uint32_t DL_UNUSED DL_ARCHIVE_VERSION         = 1; // format version for archives.
+static const uint32_t DL_UNUSED DL_ARCHIVE_ID              = ('D'<< 24) | ('L' << 16) | ('A' << 8) | 'R';
+static const uint32_t DL_UNUSED DL_ARCHIVE_ID_SWAPED       = dl_swap_endian_uint32( DL_ARCHIVE_ID );
+static const uint32_t DL_UNUSED DL_DIFF_VERSION            = 2; // format version for instance diffs.
+static const uint32_t DL_UNUSED DL_DIFF_ID                 = ('D'<< 24) | ('L' << 16) | ('D' << 8) | 'F';
+static const uint32_t DL_UNUSED DL_DIFF_ID_SWAPED          = dl_swap_endian_uint32( DL_DIFF_ID );
+static const uint32_t DL_UNUSED DL_COMPRESSED_VERSION      = 1; // format version for compressed instances.
+static const uint32_t DL_UNUSED DL_COMPRESSED_ID           = ('D'<< 24) | ('L' << 16) | ('C' << 8) | 'Z';
+static const uint32_t DL_UNUSED DL_COMPRESSED_ID_SWAPED    = dl_swap_endian_uint32( DL_COMPRESSED_ID );
 
 #undef DL_UNUSED
 
@@ -122,6 +131,82 @@ struct dl_data_header
 	uint32_t    first_pointer_to_patch;
 };
 
+/*
+	Check that a packed instance has the ptr-size of the host and that the instance, starting header_offset bytes
+	into the packed data, is inside packed_instance_size.
+*/
+static inline bool dl_internal_instance_fits_host( const dl_data_header* header, size_t packed_instance_size, size_t header_offset )
+{
+	return header->is_64_bit_ptr == ( sizeof(void*) == 8 ? 1 : 0 ) &&
+		   packed_instance_size >= header_offset &&
+		   header->instance_size <= packed_instance_size - header_offset;
+}
+
+/*
+	Header of an archive, followed by entry_count dl_archive_index_entry sorted by name_hash and type, the
+	zero-terminated names of all entries and last the packed instances. All offsets are from the start of the archive.
+*/
+struct dl_archive_header
+{
+	uint32_t id;
+	uint32_t version;
+	uint32_t entry_count;
+	uint32_t alignment;      ///< alignment of each packed instance, power of 2 >= 16.
+	uint64_t strings_offset;
+	uint64_t strings_size;
+	uint64_t size;           ///< size of the complete archive.
+};
+
+enum
+{
+	DL_ARCHIVE_ENTRY_FLAG_LOADED = 1 << 0, ///< the instance has been patched in the archive memory by dl_archive_load_inplace().
+};
+
+struct dl_archive_index_entry
+{
+	uint32_t    name_hash;
+	dl_typeid_t type;
+	uint32_t    name;     ///< offset of name in strings.
+	uint32_t    flags;    ///< DL_ARCHIVE_ENTRY_FLAG_*, written as 0 and dl_archive_open() reject archives where it is not.
+	uint64_t    offset;   ///< offset of packed instance.
+	uint64_t    size;     ///< size of packed instance.
+};
+
+/*
+	Header of a patch written by dl_instance_diff, followed by the diff of the root instance.
+*/
+struct dl_diff_header
+{
+	uint32_t    id;
+	uint32_t    version;
+	dl_typeid_t root_type;
+};
+
+/*
+	Header of a compressed instance, followed by block_count dl_compressed_block and the data of the blocks. Block i
+	decompress to the bytes at i * block_size in the packed instance. All offsets are from the start of the header.
+*/
+struct dl_compressed_header
+{
+	uint32_t id;
+	uint32_t version;
+	uint32_t block_size;
+	uint32_t block_count;
+	uint64_t instance_size; ///< size of the complete packed instance.
+};
+
+enum dl_compressed_block_flags
+{
+	DL_COMPRESSED_BLOCK_RAW = 1 << 0 ///< block is stored uncompressed since it did not get smaller by compressing it.
+};
+
+struct dl_compressed_block
+{
+	uint64_t offset;
+	uint32_t size;
+	uint32_t flags;
+};
+
 enum dl_ptr_size_t
 {
 	DL_PTR_SIZE_32BIT = 0,
@@ -250,6 +335,39 @@ struct dl_type_desc
 	uint32_t metadata_start;
 };
 
+struct dl_type_hot;
+
+/*
+	Host-only data about a member needed by the store, load and patch loops, laid out parallel to
+	dl_context::member_descs and kept apart from it so that walking wide types touch as few cache-lines as possible.
+*/
+struct dl_member_hot
+{
+	dl_type_t          type;
+	uint32_t           offset;  ///< offset of member in its type on host.
+	uint32_t           size;    ///< size of member on host.
+	uint32_t           subindex; ///< index of type of struct- and ptr-members in type_descs or of enum-members in enum_descs, UINT32_MAX if not resolved.
+	const dl_type_hot* subtype;  ///< type of struct- and ptr-members, 0x0 for other members and members of types not loaded yet.
+
+	dl_type_atom_t    AtomType()         const { return dl_type_atom_t( (type & DL_TYPE_ATOM_MASK) >> DL_TYPE_ATOM_MIN_BIT); }
+	dl_type_storage_t StorageType()      const { return dl_type_storage_t( (type & DL_TYPE_STORAGE_MASK) >> DL_TYPE_STORAGE_MIN_BIT); }
+	uint32_t          inline_array_cnt() const { return (uint32_t)(type & DL_TYPE_INLINE_ARRAY_CNT_MASK) >> DL_TYPE_INLINE_ARRAY_CNT_MIN_BIT; }
+};
+
+/*
+	Host-only data about a type needed by the store, load and patch loops, laid out parallel to dl_context::type_descs,
+	see dl_internal_build_hot_types().
+*/
+struct dl_type_hot
+{
+	uint32_t             size;      ///< size of type on host.
+	uint32_t             alignment; ///< alignment of type on host.
+	uint32_t             flags;
+	uint32_t             member_count;
+	uint32_t             union_type_offset[2]; ///< offset of the type-tag for both ptr-sizes if type is a union, see dl_internal_calc_union_type_offset().
+	const dl_member_hot* members;
+};
+
 struct dl_enum_value_desc
 {
 	uint32_t main_alias;
@@ -279,6 +397,35 @@ struct dl_enum_alias_desc
 	uint32_t value_index; ///< index of the value this alias belong to.
 };
 
+/*
+	Data used by txt pack to write default values for a type, built for each type as typelibs are loaded.
+*/
+struct dl_type_defaults
+{
+	uint32_t template_offset; ///< offset into dl_context::default_templates of an instance of the type with all default values written, UINT32_MAX if there is none.
+	uint32_t members_start;   ///< offset into dl_context::default_members of members that need work if not set in txt.
+	uint32_t required_count;  ///< number of members without a default value, these are first at members_start.
+	uint32_t subdata_count;   ///< number of members with a default value that has subdata that needs to be written and patched, these follow the required members.
+};
+
+/*
+	One loaded typelib, all loaded typelibs are laid out after each other in the ctx-arrays in the order they were
+	loaded so a module spans from its own start-indices up to the start-indices of the next module.
+*/
+struct dl_module_desc
+{
+	uint32_t name_hash;              ///< hash of the module-name, 0 if loaded without a name.
+	uint32_t type_start;
+	uint32_t enum_start;
+	uint32_t member_start;
+	uint32_t enum_value_start;
+	uint32_t enum_alias_start;
+	uint32_t metadata_start;
+	uint32_t typedata_strings_start;
+	uint32_t c_includes_start;
+	uint32_t default_data_start;
+};
+
 struct dl_context
 {
 	dl_allocator alloc;
@@ -286,6 +433,9 @@ struct dl_context
 	dl_error_msg_handler error_msg_func;
 	void*                error_msg_ctx;
 
+	dl_parallel_for_func parallel_for_func;
+	void*                parallel_ctx;
+
 	unsigned int type_count;
 	unsigned int enum_count;
 	unsigned int member_count;
@@ -323,6 +473,27 @@ struct dl_context
 
 	uint8_t* default_data;
 	size_t   default_data_size;
+
+	const uint8_t* inplace_typelib; ///< typelib loaded with dl_context_load_type_library_inplace() that the descriptor-arrays, typedata_strings, c_includes and default_data points into, 0x0 if they are owned by the ctx.
+
+	dl_module_desc* modules;      ///< all loaded typelibs in load order, see dl_internal_begin_module().
+	unsigned int    module_count;
+	uint32_t        generation;   ///< bumped each time types are loaded, replaced or unloaded.
+
+	bool              frozen;       ///< set by dl_context_freeze(), no more typelibs can be loaded.
+	const dl_context* workspace_of; ///< the frozen ctx this ctx is a workspace of, see dl_context_create_workspace(), all type-data is owned by that ctx. 0x0 if this is not a workspace.
+
+	dl_type_hot*   type_hots;      ///< hot data for the first type_hots_count types in type_descs, see dl_internal_build_hot_types().
+	dl_member_hot* member_hots;    ///< hot data for the first member_hots_count members in member_descs.
+	unsigned int   type_hots_count;
+	unsigned int   member_hots_count;
+
+	dl_type_defaults* type_defaults;       ///< defaults for the first type_defaults_count types in type_descs, see dl_internal_build_type_defaults()
+	unsigned int      type_defaults_count;
+	uint8_t*          default_templates;
+	size_t            default_templates_size;
+	uint32_t*         default_members;
+	size_t            default_members_count;
 };
 
 struct dl_substr
@@ -389,13 +560,20 @@ public:
 		return m_nElements;
 	}
 
-	void Add(const T& _Element)
+	// ... taken by value, _Element might be an element of this array that is moved by GrowIfNeeded() ...
+	void Add(T _Element)
 	{
 		GrowIfNeeded();
 		new (&m_Ptr[m_nElements]) T(_Element);
 		m_nElements++;
 	}
 
+	T Pop()
+	{
+		DL_ASSERT(m_nElements > 0 && "Pop from empty array");
+		return m_Ptr[--m_nElements];
+	}
+
 	DL_FORCEINLINE T& operator[]( size_t _iEl )
 	{
 		DL_ASSERT(_iEl < m_nElements && "Index out of bound");
@@ -429,6 +607,28 @@ inline void dl_log_error( dl_ctx_t dl_ctx, _Printf_format_string_ const char* fm
 	dl_ctx->error_msg_func( buffer, dl_ctx->error_msg_ctx );
 }
 
+/**
+ * Check that typelibs can still be loaded into dl_ctx, i.e. that it is not frozen.
+ */
+inline dl_error_t dl_internal_check_ctx_not_frozen( dl_ctx_t dl_ctx )
+{
+	if( !dl_ctx->frozen )
+		return DL_ERROR_OK;
+
+	dl_log_error( dl_ctx, "can not load a type library into a frozen context" );
+	return DL_ERROR_UNSUPPORTED_OPERATION;
+}
+
+template<typename T>
+static inline T* dl_internal_copy_array( dl_allocator* alloc, const T* src, size_t count )
+{
+	if( count == 0 )
+		return 0x0;
+	T* dst = (T*)dl_alloc( alloc, count * sizeof(T) );
+	memcpy( dst, src, count * sizeof(T) );
+	return dst;
+}
+
 template<typename T>
 static inline T    dl_internal_align_up( const T value,   size_t alignment ) { return T( ((size_t)value + alignment - 1) & ~(alignment - 1) ); }
 static inline bool dl_internal_is_align( const void* ptr, size_t alignment ) { return ((size_t)ptr & (alignment - 1)) == 0; }
@@ -544,16 +744,69 @@ static inline const dl_member_desc* dl_get_type_member( dl_ctx_t ctx, const dl_t
 	return member_index >= ctx->member_count ? nullptr : &ctx->member_descs[ type->member_start + member_index ];
 }
 
+static inline const dl_type_hot* dl_internal_type_hot( dl_ctx_t ctx, const dl_type_desc* type )
+{
+	size_t index = (size_t)( type - ctx->type_descs );
+	return index < ctx->type_hots_count ? ctx->type_hots + index : 0x0;
+}
+
+static inline const dl_type_desc*   dl_internal_type_desc_of  ( dl_ctx_t ctx, const dl_type_hot*   type   ) { return ctx->type_descs   + ( type   - ctx->type_hots ); }
+static inline const dl_member_desc* dl_internal_member_desc_of( dl_ctx_t ctx, const dl_member_hot* member ) { return ctx->member_descs + ( member - ctx->member_hots ); }
+
+/*
+	Return the index of the type or enum used by member resolved when its typelib was loaded, or UINT32_MAX if member
+	is not resolved, i.e. a member that is not part of ctx or that use a type that is not loaded.
+*/
+static inline uint32_t dl_internal_member_subindex( dl_ctx_t ctx, const dl_member_desc* member )
+{
+	size_t index = (size_t)( member - ctx->member_descs );
+	return index < ctx->member_hots_count ? ctx->member_hots[index].subindex : UINT32_MAX;
+}
+
+/*
+	Return the type of a struct- or ptr-member without searching for it, falls back to dl_internal_find_type() for members
+	not resolved.
+*/
+static inline const dl_type_desc* dl_internal_member_type( dl_ctx_t ctx, const dl_member_desc* member )
+{
+	uint32_t subindex = dl_internal_member_subindex( ctx, member );
+	return subindex != UINT32_MAX ? ctx->type_descs + subindex : dl_internal_find_type( ctx, member->type_id );
+}
+
+/*
+	Return the enum of an enum-member without searching for it, falls back to dl_internal_find_enum() for members
+	not resolved.
+*/
+static inline const dl_enum_desc* dl_internal_member_enum( dl_ctx_t ctx, const dl_member_desc* member )
+{
+	uint32_t subindex = dl_internal_member_subindex( ctx, member );
+	return subindex != UINT32_MAX ? ctx->enum_descs + subindex : dl_internal_find_enum( ctx, member->type_id );
+}
+
 static inline const dl_member_desc* dl_internal_union_type_to_member( dl_ctx_t dl_ctx, const dl_type_desc* type, uint32_t union_type )
 {
 	// type is typeid + member_index + 1, + one to separate the member-id from the type-id.
-	return dl_get_type_member(dl_ctx, type, union_type - dl_internal_typeid_of(dl_ctx, type) - 1);
+	uint32_t member_index = union_type - dl_internal_typeid_of( dl_ctx, type ) - 1;
+	return member_index < type->member_count ? &dl_ctx->member_descs[ type->member_start + member_index ] : 0x0;
 }
 
-static inline uint32_t dl_internal_union_type_offset(dl_ctx_t ctx, const dl_type_desc* type, dl_ptr_size_t ptr_size)
+/*
+	Same as dl_internal_union_type_to_member() but for the hot type-data, returns 0x0 if union_type is not a valid tag for type.
+*/
+static inline const dl_member_hot* dl_internal_union_type_to_member_hot( dl_ctx_t dl_ctx, const dl_type_hot* type, uint32_t union_type )
+{
+	uint32_t member_index = union_type - dl_ctx->type_ids[ type - dl_ctx->type_hots ] - 1;
+	return member_index < type->member_count ? type->members + member_index : 0x0;
+}
+
+/*
+	Calculate the offset of the type-tag of a union, it is placed after the largest member.
+	Only used when building the hot type-data, use dl_internal_union_type_offset() to get the cached value.
+*/
+static inline uint32_t dl_internal_calc_union_type_offset(dl_ctx_t ctx, const dl_type_desc* type, dl_ptr_size_t ptr_size)
 {
-	uint32_t max_member_size = 0; // TODO: calc and store this in type?
-	uint32_t max_member_alignment = 0; // TODO: calc and store this in type?
+	uint32_t max_member_size = 0;
+	uint32_t max_member_alignment = 0;
 	for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
 	{
 		const dl_member_desc* member = dl_get_type_member( ctx, type, member_index );
@@ -564,6 +817,12 @@ static inline uint32_t dl_internal_union_type_offset(dl_ctx_t ctx, const dl_type
 	return dl_internal_align_up(max_member_size, max_member_alignment);
 }
 
+static inline uint32_t dl_internal_union_type_offset(dl_ctx_t ctx, const dl_type_desc* type, dl_ptr_size_t ptr_size)
+{
+	const dl_type_hot* hot = dl_internal_type_hot( ctx, type );
+	return hot != 0x0 ? hot->union_type_offset[ptr_size] : dl_internal_calc_union_type_offset( ctx, type, ptr_size );
+}
+
 static inline const dl_enum_value_desc* dl_get_enum_value( dl_ctx_t ctx, const dl_enum_desc* e, unsigned int value_index )
 {
 	return ctx->enum_value_descs + e->value_start + value_index;
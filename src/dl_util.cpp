@@ -30,7 +30,7 @@ static void dl_patch_alloc_funcs( dl_alloc_func& alloc_func, dl_realloc_func& re
 	}
 }
 
-static unsigned char* dl_read_entire_stream( dl_realloc_func realloc_func, void* alloc_ctx, FILE* file, size_t* out_size )		 
+static unsigned char* dl_read_entire_stream( dl_realloc_func realloc_func, dl_free_func free_func, void* alloc_ctx, FILE* file, size_t* out_size )
 {
 	const unsigned int CHUNK_SIZE = 1024;
 	size_t         total_size = 0;
@@ -39,7 +39,13 @@ static unsigned char* dl_read_entire_stream( dl_realloc_func realloc_func, void*
 
 	do
 	{
-		out_buffer = (unsigned char*)realloc_func( out_buffer, CHUNK_SIZE + total_size, total_size, alloc_ctx );
+		unsigned char* new_buffer = (unsigned char*)realloc_func( out_buffer, CHUNK_SIZE + total_size, total_size, alloc_ctx );
+		if( new_buffer == 0x0 )
+		{
+			free_func( out_buffer, alloc_ctx );
+			return 0x0;
+		}
+		out_buffer = new_buffer;
 		chunk_size = fread( out_buffer + total_size, 1, CHUNK_SIZE, file );
 		total_size += chunk_size;
 	}
@@ -47,7 +53,15 @@ static unsigned char* dl_read_entire_stream( dl_realloc_func realloc_func, void*
 
 	// Might need 1 extra byte to write string null terminator
 	if( total_size % CHUNK_SIZE == 0 )
-		out_buffer = (unsigned char*)realloc_func( out_buffer, 1 + total_size, total_size, alloc_ctx );
+	{
+		unsigned char* new_buffer = (unsigned char*)realloc_func( out_buffer, 1 + total_size, total_size, alloc_ctx );
+		if( new_buffer == 0x0 )
+		{
+			free_func( out_buffer, alloc_ctx );
+			return 0x0;
+		}
+		out_buffer = new_buffer;
+	}
 
 	*out_size = total_size;
 	return out_buffer;
@@ -65,6 +79,11 @@ static dl_error_t dl_util_load_from_buffer( dl_ctx_t            dl_ctx,     dl_t
 	dl_instance_info_t info;
 
 	error = dl_instance_get_info( buffer, buffer_size, &info );
+	if( error == DL_ERROR_VERSION_MISMATCH ) // binary data from another version of dl, not txt.
+	{
+		free_func( (void*) buffer, alloc_ctx );
+		return error;
+	}
 
 	dl_util_file_type_t in_file_type = error == DL_ERROR_OK ? DL_UTIL_FILE_TYPE_BINARY : DL_UTIL_FILE_TYPE_TEXT;
 
@@ -92,6 +111,7 @@ static dl_error_t dl_util_load_from_buffer( dl_ctx_t            dl_ctx,     dl_t
 			if( load_size > buffer_size || info.ptrsize < sizeof(void*) )
 			{
 				load_instance = (unsigned char*)alloc_func( load_size, alloc_ctx );
+				if( load_instance == 0x0 ) { free_func( (void*) buffer, alloc_ctx ); return DL_ERROR_OUT_OF_LIBRARY_MEMORY; }
 
 				error = dl_convert( dl_ctx, type, buffer, buffer_size, load_instance, load_size, DL_ENDIAN_HOST, sizeof(void*), 0x0 );
 
@@ -116,6 +136,7 @@ static dl_error_t dl_util_load_from_buffer( dl_ctx_t            dl_ctx,     dl_t
 			if(error != DL_ERROR_OK) { free_func( (void*) buffer, alloc_ctx ); return error; }
 
 			load_instance = (unsigned char*)alloc_func( packed_size, alloc_ctx );
+			if( load_instance == 0x0 ) { free_func( (void*) buffer, alloc_ctx ); return DL_ERROR_OUT_OF_LIBRARY_MEMORY; }
 
 			error = dl_txt_pack(dl_ctx, (char*)buffer, load_instance, packed_size, 0x0);
 
@@ -165,10 +186,18 @@ dl_error_t dl_util_load_from_file( dl_ctx_t     dl_ctx,        dl_typeid_t
 		size_t size = static_cast<size_t>(ftell(in_file));
 		fseek(in_file, 0, SEEK_SET);
 		uint8_t* buffer = (uint8_t*) alloc_func( size + 1, alloc_ctx );
+		if( buffer == 0x0 )
+		{
+			fclose( in_file );
+			return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+		}
 		size_t read = fread(buffer, 1, size, in_file);
 		fclose(in_file);
 		if (read != size)
+		{
+			free_func( buffer, alloc_ctx );
 			return DL_ERROR_INTERNAL_ERROR;
+		}
 		buffer[size] = '\0';
 		error = dl_util_load_from_buffer( dl_ctx, type, buffer, size + 1, filetype, out_instance, out_type, allocated_mem, alloc_func, free_func, alloc_ctx );
 	}
@@ -184,7 +213,9 @@ dl_error_t dl_util_load_from_stream( dl_ctx_t      dl_ctx,        dl_typeid_t
 									 dl_free_func  free_func,     void*               alloc_ctx )
 {
 	dl_patch_alloc_funcs( alloc_func, realloc_func, free_func );
-	unsigned char* file_content = dl_read_entire_stream( realloc_func, alloc_ctx, stream, consumed_bytes );
+	unsigned char* file_content = dl_read_entire_stream( realloc_func, free_func, alloc_ctx, stream, consumed_bytes );
+	if( file_content == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
 	file_content[*consumed_bytes] = '\0';
 
 	return dl_util_load_from_buffer( dl_ctx, type, file_content, *consumed_bytes, filetype, out_instance, out_type, allocated_mem, alloc_func, free_func, alloc_ctx );
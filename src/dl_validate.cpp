@@ -0,0 +1,420 @@
+#include "dl_validate.h"
+#include "dl_ptr_map.h"
+
+// ... value stored in visited for strings, structs store their dl_type_hot* ...
+static const uintptr_t DL_VALIDATE_STRING = 1;
+
+enum dl_validate_type_check
+{
+	DL_VALIDATE_TYPE_UNKNOWN = 0,
+	DL_VALIDATE_TYPE_TRIVIAL,   ///< any bytes is a valid instance of the type.
+	DL_VALIDATE_TYPE_CHECK      ///< type has ptrs, arrays, strings, unions or enums that need to be checked.
+};
+
+struct dl_validate_item
+{
+	const dl_type_hot* type;
+	uintptr_t          offset;
+	uint32_t           count;
+};
+
+struct dl_validate_ctx
+{
+	explicit dl_validate_ctx( dl_ctx_t dl_ctx )
+		: ctx( dl_ctx )
+		, visited( dl_ctx->alloc )
+		, work( dl_ctx->alloc )
+	{
+	}
+
+	dl_ctx_t   ctx;
+	uint8_t*   base;        ///< all offsets in the instance are relative to base.
+	uintptr_t  begin;       ///< offset of the root instance.
+	uintptr_t  end;         ///< offset of the end of the instance.
+	uintptr_t  offset_mask; ///< mask to get the offset from a stored ptr, removes the offset to the next ptr in the ptr-chain.
+	bool       patch;
+	uint64_t*  claimed;     ///< one bit per byte in the instance that is part of a validated struct, array or string.
+	uint64_t*  ptr_slots;   ///< one bit per ptr-sized slot in the instance that hold a non-null ptr, 0x0 when patching.
+	size_t     ptr_count;
+	uint8_t*   type_checks; ///< dl_validate_type_check for each type in ctx.
+	dl_ptr_map visited;     ///< offset of structs pointed to -> type, or DL_VALIDATE_STRING.
+
+	CArrayStatic<dl_validate_item, 64> work; ///< arrays and structs pointed to that is left to validate.
+};
+
+static dl_error_t dl_validate_fail( dl_validate_ctx* vctx, const char* what, uintptr_t offset )
+{
+	dl_log_error( vctx->ctx, "malformed instance, %s at offset " DL_UINT64_FMT_STR, what, (uint64_t)offset );
+	return DL_ERROR_MALFORMED_DATA;
+}
+
+static bool dl_validate_type_needs_check( dl_validate_ctx* vctx, const dl_type_hot* type )
+{
+	uint8_t* check = vctx->type_checks + ( type - vctx->ctx->type_hots );
+	if( *check == DL_VALIDATE_TYPE_UNKNOWN )
+	{
+		uint8_t result = ( type->flags & ( DL_TYPE_FLAG_HAS_SUBDATA | DL_TYPE_FLAG_IS_UNION ) ) ? DL_VALIDATE_TYPE_CHECK : DL_VALIDATE_TYPE_TRIVIAL;
+		for( uint32_t member_index = 0; member_index < type->member_count && result == DL_VALIDATE_TYPE_TRIVIAL; ++member_index )
+		{
+			const dl_member_hot* member  = type->members + member_index;
+			dl_type_storage_t    storage = member->StorageType();
+			if( member->AtomType() == DL_TYPE_ATOM_BITFIELD )
+				continue;
+			if( storage >= DL_TYPE_STORAGE_ENUM_INT8 && storage <= DL_TYPE_STORAGE_ENUM_UINT64 )
+				result = DL_VALIDATE_TYPE_CHECK;
+			else if( storage == DL_TYPE_STORAGE_STRUCT && ( member->subtype == 0x0 || dl_validate_type_needs_check( vctx, member->subtype ) ) )
+				result = DL_VALIDATE_TYPE_CHECK;
+		}
+		*check = result;
+	}
+	return *check == DL_VALIDATE_TYPE_CHECK;
+}
+
+/**
+ * Mark [offset, offset + size) as part of a validated struct, array or string.
+ * @return false if any of the bytes was already marked.
+ */
+static bool dl_validate_claim( dl_validate_ctx* vctx, uintptr_t offset, uint64_t size )
+{
+	if( size == 0 )
+		return true;
+
+	uint64_t first = offset - vctx->begin;
+	uint64_t last  = first + size - 1;
+	for( uint64_t word = first / 64; word <= last / 64; ++word )
+	{
+		uint64_t mask = ~0ULL;
+		if( word == first / 64 )
+			mask &= ~0ULL << ( first % 64 );
+		if( word == last / 64 )
+			mask &= ~0ULL >> ( 63 - last % 64 );
+		if( vctx->claimed[word] & mask )
+			return false;
+		vctx->claimed[word] |= mask;
+	}
+	return true;
+}
+
+/**
+ * Check that [offset, offset + size) is inside the instance, aligned and not part of anything else validated.
+ */
+static bool dl_validate_region( dl_validate_ctx* vctx, uintptr_t offset, uint64_t size, uint32_t alignment )
+{
+	if( offset < vctx->begin || offset > vctx->end || size > vctx->end - offset )
+		return false;
+	if( ( offset & ( alignment - 1 ) ) != 0 )
+		return false;
+	return dl_validate_claim( vctx, offset, size );
+}
+
+/**
+ * Read the offset stored in a ptr, check that it is 0 or inside the instance and patch it or record it to check
+ * against the ptr-chain.
+ */
+static bool dl_validate_read_ptr( dl_validate_ctx* vctx, uint8_t* ptr_data, uintptr_t* out_offset )
+{
+	uintptr_t stored = *(uintptr_t*)ptr_data;
+	uintptr_t offset = stored & vctx->offset_mask;
+	*out_offset = offset;
+	if( offset == 0 )
+		return stored == 0;
+	if( offset < vctx->begin || offset >= vctx->end )
+		return false;
+
+	if( vctx->patch )
+		*(uint8_t**)ptr_data = vctx->base + offset;
+	else
+	{
+		uintptr_t slot = (uintptr_t)( ptr_data - vctx->base - vctx->begin ) / sizeof( void* );
+		vctx->ptr_slots[ slot / 64 ] |= 1ULL << ( slot % 64 );
+		++vctx->ptr_count;
+	}
+	return true;
+}
+
+static dl_error_t dl_validate_str( dl_validate_ctx* vctx, uint8_t* ptr_data )
+{
+	uintptr_t offset;
+	if( !dl_validate_read_ptr( vctx, ptr_data, &offset ) )
+		return dl_validate_fail( vctx, "string outside of instance", (uintptr_t)( ptr_data - vctx->base ) );
+	if( offset == 0 )
+		return DL_ERROR_OK;
+
+	// ... equal strings are stored once and shared between members ...
+	uintptr_t seen;
+	if( vctx->visited.find( offset, &seen ) )
+		return seen == DL_VALIDATE_STRING ? DL_ERROR_OK : dl_validate_fail( vctx, "string overlapping struct", offset );
+
+	const uint8_t* str  = vctx->base + offset;
+	const uint8_t* term = (const uint8_t*)memchr( str, '\0', vctx->end - offset );
+	if( term == 0x0 )
+		return dl_validate_fail( vctx, "unterminated string", offset );
+	if( !dl_validate_claim( vctx, offset, (uint64_t)( term - str ) + 1 ) )
+		return dl_validate_fail( vctx, "overlapping string", offset );
+
+	vctx->visited.insert( offset, DL_VALIDATE_STRING );
+	return DL_ERROR_OK;
+}
+
+static dl_error_t dl_validate_ptr( dl_validate_ctx* vctx, const dl_type_hot* sub_type, uint8_t* ptr_data )
+{
+	uintptr_t offset;
+	if( !dl_validate_read_ptr( vctx, ptr_data, &offset ) )
+		return dl_validate_fail( vctx, "ptr outside of instance", (uintptr_t)( ptr_data - vctx->base ) );
+	if( offset == 0 )
+		return DL_ERROR_OK;
+
+	// ... many ptrs can point to the same struct, it is only validated once ...
+	uintptr_t seen;
+	if( vctx->visited.find( offset, &seen ) )
+		return seen == (uintptr_t)sub_type ? DL_ERROR_OK : dl_validate_fail( vctx, "ptrs of different types to the same data", offset );
+
+	if( !dl_validate_region( vctx, offset, sub_type->size, sub_type->alignment ) )
+		return dl_validate_fail( vctx, "ptr to struct outside of instance, unaligned or overlapping", offset );
+
+	vctx->visited.insert( offset, (uintptr_t)sub_type );
+	if( dl_validate_type_needs_check( vctx, sub_type ) )
+	{
+		dl_validate_item item = { sub_type, offset, 1 };
+		vctx->work.Add( item );
+	}
+	return DL_ERROR_OK;
+}
+
+static bool dl_validate_enum( dl_validate_ctx* vctx, const dl_member_hot* member, dl_type_storage_t storage, const uint8_t* data, uint32_t count )
+{
+	if( member->subindex == UINT32_MAX )
+		return false;
+
+	const dl_enum_desc*       e      = vctx->ctx->enum_descs + member->subindex;
+	const dl_enum_value_desc* values = vctx->ctx->enum_value_descs + e->value_start;
+	size_t                    size   = dl_pod_size( storage );
+
+	bool     have_last = false;
+	uint64_t last      = 0;
+	for( uint32_t i = 0; i < count; ++i )
+	{
+		const uint8_t* value_data = data + i * size;
+		uint64_t value;
+		switch( storage )
+		{
+			case DL_TYPE_STORAGE_ENUM_INT8:   value = (uint64_t)*( int8_t*)  value_data; break;
+			case DL_TYPE_STORAGE_ENUM_UINT8:  value = (uint64_t)*(uint8_t*)  value_data; break;
+			case DL_TYPE_STORAGE_ENUM_INT16:  value = (uint64_t)*( int16_t*) value_data; break;
+			case DL_TYPE_STORAGE_ENUM_UINT16: value = (uint64_t)*(uint16_t*) value_data; break;
+			case DL_TYPE_STORAGE_ENUM_INT32:  value = (uint64_t)*( int32_t*) value_data; break;
+			case DL_TYPE_STORAGE_ENUM_UINT32: value = (uint64_t)*(uint32_t*) value_data; break;
+			case DL_TYPE_STORAGE_ENUM_INT64:  value = (uint64_t)*( int64_t*) value_data; break;
+			default:                          value = *(uint64_t*)value_data; break;
+		}
+
+		// ... arrays of enums often repeat the same value ...
+		if( have_last && value == last )
+			continue;
+
+		uint32_t value_index = 0;
+		while( value_index < e->value_count && values[value_index].value != value )
+			++value_index;
+		if( value_index == e->value_count )
+			return false;
+
+		have_last = true;
+		last      = value;
+	}
+	return true;
+}
+
+static dl_error_t dl_validate_struct( dl_validate_ctx* vctx, const dl_type_hot* type, uint8_t* data );
+
+/**
+ * Validate count elements of the type of member stored after each other, as a pod-, inline array- or array-member.
+ */
+static dl_error_t dl_validate_elements( dl_validate_ctx* vctx, const dl_member_hot* member, dl_type_storage_t storage, uint8_t* data, uint32_t count )
+{
+	dl_error_t err = DL_ERROR_OK;
+	switch( storage )
+	{
+		case DL_TYPE_STORAGE_STR:
+			for( uint32_t i = 0; i < count && err == DL_ERROR_OK; ++i )
+				err = dl_validate_str( vctx, data + i * sizeof( void* ) );
+			return err;
+		case DL_TYPE_STORAGE_PTR:
+			for( uint32_t i = 0; i < count && err == DL_ERROR_OK; ++i )
+				err = dl_validate_ptr( vctx, member->subtype, data + i * sizeof( void* ) );
+			return err;
+		case DL_TYPE_STORAGE_STRUCT:
+		{
+			if( !dl_validate_type_needs_check( vctx, member->subtype ) )
+				return DL_ERROR_OK;
+			uint32_t stride = dl_internal_align_up( member->subtype->size, member->subtype->alignment );
+			for( uint32_t i = 0; i < count && err == DL_ERROR_OK; ++i )
+				err = dl_validate_struct( vctx, member->subtype, data + i * stride );
+			return err;
+		}
+		case DL_TYPE_STORAGE_ENUM_INT8:
+		case DL_TYPE_STORAGE_ENUM_INT16:
+		case DL_TYPE_STORAGE_ENUM_INT32:
+		case DL_TYPE_STORAGE_ENUM_INT64:
+		case DL_TYPE_STORAGE_ENUM_UINT8:
+		case DL_TYPE_STORAGE_ENUM_UINT16:
+		case DL_TYPE_STORAGE_ENUM_UINT32:
+		case DL_TYPE_STORAGE_ENUM_UINT64:
+			if( !dl_validate_enum( vctx, member, storage, data, count ) )
+				return dl_validate_fail( vctx, "invalid enum value", (uintptr_t)( data - vctx->base ) );
+			return DL_ERROR_OK;
+		default:
+			return DL_ERROR_OK;
+	}
+}
+
+static dl_error_t dl_validate_member( dl_validate_ctx* vctx, const dl_member_hot* member, uint8_t* member_data )
+{
+	dl_type_storage_t storage = member->StorageType();
+	if( ( storage == DL_TYPE_STORAGE_STRUCT || storage == DL_TYPE_STORAGE_PTR ) && member->subtype == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	switch( member->AtomType() )
+	{
+		case DL_TYPE_ATOM_POD:
+			return dl_validate_elements( vctx, member, storage, member_data, 1 );
+		case DL_TYPE_ATOM_INLINE_ARRAY:
+			return dl_validate_elements( vctx, member, storage, member_data, member->inline_array_cnt() );
+		case DL_TYPE_ATOM_ARRAY:
+		{
+			uint32_t  count = *(uint32_t*)( member_data + sizeof( void* ) );
+			uintptr_t offset;
+			if( !dl_validate_read_ptr( vctx, member_data, &offset ) )
+				return dl_validate_fail( vctx, "array outside of instance", (uintptr_t)( member_data - vctx->base ) );
+			if( offset == 0 )
+				return count == 0 ? DL_ERROR_OK : dl_validate_fail( vctx, "null array with elements", (uintptr_t)( member_data - vctx->base ) );
+
+			uint32_t elem_size = storage == DL_TYPE_STORAGE_STRUCT ? dl_internal_align_up( member->subtype->size, member->subtype->alignment ) : (uint32_t)dl_pod_size( storage );
+			uint32_t alignment = storage == DL_TYPE_STORAGE_STRUCT ? member->subtype->alignment : elem_size;
+			if( !dl_validate_region( vctx, offset, (uint64_t)elem_size * count, alignment ) )
+				return dl_validate_fail( vctx, "array outside of instance, unaligned or overlapping", offset );
+
+			// ... arrays of structs are validated from the work-list to not recurse once per level in the data ...
+			if( storage == DL_TYPE_STORAGE_STRUCT )
+			{
+				if( count > 0 && dl_validate_type_needs_check( vctx, member->subtype ) )
+				{
+					dl_validate_item item = { member->subtype, offset, count };
+					vctx->work.Add( item );
+				}
+				return DL_ERROR_OK;
+			}
+			return dl_validate_elements( vctx, member, storage, vctx->base + offset, count );
+		}
+		default:
+			return DL_ERROR_OK;
+	}
+}
+
+static dl_error_t dl_validate_struct( dl_validate_ctx* vctx, const dl_type_hot* type, uint8_t* data )
+{
+	if( type->flags & DL_TYPE_FLAG_IS_UNION )
+	{
+		uint32_t union_type = *(uint32_t*)( data + type->union_type_offset[DL_PTR_SIZE_HOST] );
+		const dl_member_hot* member = dl_internal_union_type_to_member_hot( vctx->ctx, type, union_type );
+		if( member == 0x0 )
+			return dl_validate_fail( vctx, "invalid union type", (uintptr_t)( data - vctx->base ) );
+		return dl_validate_member( vctx, member, data + member->offset );
+	}
+
+	for( uint32_t member_index = 0; member_index < type->member_count; ++member_index )
+	{
+		const dl_member_hot* member = type->members + member_index;
+		dl_error_t err = dl_validate_member( vctx, member, data + member->offset );
+		if( DL_ERROR_OK != err )
+			return err;
+	}
+	return DL_ERROR_OK;
+}
+
+/**
+ * Check that the ptr-chain visit exactly the non-null ptrs found while validating the instance, the chain is
+ * strictly increasing so no ptr can be visited twice.
+ */
+static dl_error_t dl_validate_ptr_chain( dl_validate_ctx* vctx, uintptr_t first_pointer_to_patch )
+{
+	uintptr_t offset_shift = sizeof( uintptr_t ) * 4;
+	size_t    count        = 0;
+	uintptr_t pos          = 0;
+	uintptr_t next         = first_pointer_to_patch;
+	while( next != 0 )
+	{
+		if( next > vctx->end - pos )
+			return dl_validate_fail( vctx, "ptr-chain outside of instance", pos );
+		pos += next;
+		if( pos < vctx->begin || pos > vctx->end - sizeof( void* ) || ( pos - vctx->begin ) % sizeof( void* ) != 0 )
+			return dl_validate_fail( vctx, "ptr-chain outside of instance", pos );
+
+		uintptr_t slot = ( pos - vctx->begin ) / sizeof( void* );
+		if( ( vctx->ptr_slots[ slot / 64 ] & ( 1ULL << ( slot % 64 ) ) ) == 0 )
+			return dl_validate_fail( vctx, "ptr-chain patching something that is not a ptr", pos );
+
+		++count;
+		next = *(uintptr_t*)( vctx->base + pos ) >> offset_shift;
+	}
+
+	if( count != vctx->ptr_count )
+		return dl_validate_fail( vctx, "ptr-chain missing ptrs", 0 );
+	return DL_ERROR_OK;
+}
+
+dl_error_t dl_internal_validate_instance( dl_ctx_t              ctx,
+                                          const dl_data_header* header,
+                                          const dl_type_desc*   root_type,
+                                          uint8_t*              instance,
+                                          bool                  patch )
+{
+	const dl_type_hot* root = dl_internal_type_hot( ctx, root_type );
+	if( root == 0x0 )
+		return DL_ERROR_TYPE_NOT_FOUND;
+
+	uintptr_t header_offset = dl_internal_align_up( sizeof( dl_data_header ), root->alignment );
+
+	dl_validate_ctx vctx( ctx );
+	vctx.base        = instance - header_offset;
+	vctx.begin       = header_offset;
+	vctx.end         = header_offset + header->instance_size;
+	vctx.offset_mask = header->not_using_ptr_chain_patching ? ~(uintptr_t)0 : ( (uintptr_t)1 << ( sizeof( uintptr_t ) * 4 ) ) - 1;
+	vctx.patch       = patch;
+	vctx.ptr_count   = 0;
+
+	if( root->size > header->instance_size )
+		return dl_validate_fail( &vctx, "root instance larger than instance", header_offset );
+
+	size_t claimed_words = ( header->instance_size + 63 ) / 64;
+	size_t slot_words    = patch ? 0 : ( header->instance_size / sizeof( void* ) + 63 ) / 64;
+	size_t scratch_size  = sizeof( uint64_t ) * ( claimed_words + slot_words ) + ctx->type_count + 1;
+	uint8_t* scratch = (uint8_t*)dl_alloc( &ctx->alloc, scratch_size );
+	if( scratch == 0x0 )
+		return DL_ERROR_OUT_OF_LIBRARY_MEMORY;
+	memset( scratch, 0x0, scratch_size );
+	vctx.claimed     = (uint64_t*)scratch;
+	vctx.ptr_slots   = patch ? 0x0 : vctx.claimed + claimed_words;
+	vctx.type_checks = scratch + sizeof( uint64_t ) * ( claimed_words + slot_words );
+
+	dl_validate_claim( &vctx, header_offset, root->size );
+	vctx.visited.insert( header_offset, (uintptr_t)root );
+
+	dl_error_t err = DL_ERROR_OK;
+	if( dl_validate_type_needs_check( &vctx, root ) )
+		err = dl_validate_struct( &vctx, root, instance );
+
+	while( err == DL_ERROR_OK && vctx.work.Len() > 0 )
+	{
+		dl_validate_item item   = vctx.work.Pop();
+		uint32_t         stride = dl_internal_align_up( item.type->size, item.type->alignment );
+		uint8_t*         data   = vctx.base + item.offset;
+		for( uint32_t i = 0; i < item.count && err == DL_ERROR_OK; ++i )
+			err = dl_validate_struct( &vctx, item.type, data + (size_t)i * stride );
+	}
+
+	if( err == DL_ERROR_OK && !patch && !header->not_using_ptr_chain_patching )
+		err = dl_validate_ptr_chain( &vctx, header->first_pointer_to_patch );
+
+	dl_free( &ctx->alloc, scratch );
+	return err;
+}
@@ -0,0 +1,30 @@
+#ifndef DL_VALIDATE_H_INCLUDED
+#define DL_VALIDATE_H_INCLUDED
+
+#include "dl_types.h"
+
+/**
+ * Validate a packed instance against its type, and optionally patch it at the same time.
+ *
+ * Walks the instance once, driven by the types, and checks that every ptr, array and string is inside the
+ * instance and aligned, that strings are terminated, that union type-tags and enum values are valid and that no
+ * two structs, arrays or strings overlap, except ptrs to the same struct and strings shared between members.
+ *
+ * @param ctx dl-context containing all types used in the instance.
+ * @param header header of the packed instance, id, version, ptr-size and root-type is expected to be checked.
+ * @param root_type type of the root instance.
+ * @param instance root instance followed by its subdata, header->instance_size bytes. All offsets stored in the
+ *                 instance is relative to instance - the size of the aligned header.
+ * @param patch true to patch each ptr to an address as it is validated, the ptr-chain in header is not used.
+ *              false to only validate the instance, the ptr-chain is then checked to contain exactly the ptrs in
+ *              the instance.
+ * @return DL_ERROR_OK if the instance is valid, DL_ERROR_MALFORMED_DATA otherwise. If patching, the instance
+ *         is only partially patched on error.
+ */
+dl_error_t dl_internal_validate_instance( dl_ctx_t              ctx,
+                                          const dl_data_header* header,
+                                          const dl_type_desc*   root_type,
+                                          uint8_t*              instance,
+                                          bool                  patch );
+
+#endif // DL_VALIDATE_H_INCLUDED
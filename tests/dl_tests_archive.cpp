@@ -0,0 +1,271 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include <gtest/gtest.h>
+
+#include <dl/dl.h>
+#include <dl/dl_archive.h>
+#include <dl/dl_convert.h>
+
+#include "dl_test_common.h"
+
+#include <vector>
+
+class DLArchive : public DL
+{
+public:
+	std::vector<unsigned char> pods1;
+	std::vector<unsigned char> pods2;
+	std::vector<unsigned char> strings;
+
+	template <typename T>
+	void store( const T& inst, std::vector<unsigned char>& out )
+	{
+		size_t size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_store( Ctx, T::TYPE_ID, &inst, 0x0, 0, &size ) );
+		out.resize( size );
+		EXPECT_DL_ERR_OK( dl_instance_store( Ctx, T::TYPE_ID, &inst, &out[0], out.size(), 0x0 ) );
+	}
+
+	virtual void SetUp()
+	{
+		DL::SetUp();
+
+		Pods p;
+		memset( &p, 0x0, sizeof( p ) );
+		p.i32 = 1;
+		store( p, pods1 );
+		p.i32 = 2;
+		store( p, pods2 );
+
+		Strings s = { "cow", "bells" };
+		store( s, strings );
+	}
+
+	// ... archive is written to an aligned buffer, as if it was mapped from a file ...
+	unsigned char* write( const dl_archive_input_t* inputs, unsigned int input_count, unsigned int alignment, size_t* out_size )
+	{
+		size_t size = 0;
+		EXPECT_DL_ERR_OK( dl_archive_write( Ctx, inputs, input_count, alignment, 0x0, 0, &size ) );
+		archive.resize( size + alignment );
+		unsigned char* data = &archive[0] + ( alignment - (uintptr_t)&archive[0] % alignment ) % alignment;
+		size_t produced = 0;
+		EXPECT_DL_ERR_OK( dl_archive_write( Ctx, inputs, input_count, alignment, data, size, &produced ) );
+		EXPECT_EQ( size, produced );
+		*out_size = size;
+		return data;
+	}
+
+	std::vector<unsigned char> archive;
+};
+
+TEST_F( DLArchive, find_and_load )
+{
+	dl_archive_input_t inputs[] = {
+		{ "pods/1",  &pods1[0],   pods1.size() },
+		{ "strings", &strings[0], strings.size() },
+		{ "pods/2",  &pods2[0],   pods2.size() },
+		// ... same name but another type is another key ...
+		{ "pods/1",  &strings[0], strings.size() },
+	};
+
+	size_t size;
+	unsigned char* data = write( inputs, DL_ARRAY_LENGTH( inputs ), 64, &size );
+
+	dl_archive_t ar;
+	EXPECT_DL_ERR_OK( dl_archive_open( data, size, &ar ) );
+	EXPECT_EQ( 4u, ar.entry_count );
+	EXPECT_EQ( 64u, ar.alignment );
+
+	for( unsigned int i = 0; i < ar.entry_count; ++i )
+	{
+		dl_archive_entry_t entry;
+		EXPECT_DL_ERR_OK( dl_archive_get_entry( &ar, i, &entry ) );
+		EXPECT_EQ( 0u, (uintptr_t)entry.packed_instance % 64 );
+	}
+
+	dl_archive_entry_t entry;
+	EXPECT_DL_ERR_OK( dl_archive_find( &ar, "pods/2", Pods::TYPE_ID, &entry ) );
+	EXPECT_STREQ( "pods/2", entry.name );
+	EXPECT_EQ( Pods::TYPE_ID, entry.type );
+	EXPECT_EQ( pods2.size(), entry.packed_instance_size );
+	EXPECT_EQ( 0, memcmp( &pods2[0], entry.packed_instance, pods2.size() ) );
+
+	EXPECT_DL_ERR_OK( dl_archive_find( &ar, "strings", 0, &entry ) );
+	EXPECT_EQ( Strings::TYPE_ID, entry.type );
+
+	EXPECT_DL_ERR_EQ( DL_ERROR_ARCHIVE_ENTRY_NOT_FOUND, dl_archive_find( &ar, "pods/3", 0, &entry ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_ARCHIVE_ENTRY_NOT_FOUND, dl_archive_find( &ar, "strings", Pods::TYPE_ID, &entry ) );
+
+	Pods* p = 0x0;
+	EXPECT_DL_ERR_OK( dl_archive_load_inplace( Ctx, &ar, "pods/1", Pods::TYPE_ID, (void**)&p ) );
+	EXPECT_EQ( 1, p->i32 );
+
+	Strings* s = 0x0;
+	EXPECT_DL_ERR_OK( dl_archive_load_inplace( Ctx, &ar, "pods/1", Strings::TYPE_ID, (void**)&s ) );
+	EXPECT_STREQ( "cow",   s->Str1 );
+	EXPECT_STREQ( "bells", s->Str2 );
+}
+
+TEST_F( DLArchive, load_inplace_twice )
+{
+	dl_archive_input_t inputs[] = { { "strings", &strings[0], strings.size() } };
+
+	size_t size;
+	unsigned char* data = write( inputs, DL_ARRAY_LENGTH( inputs ), 16, &size );
+
+	dl_archive_t ar;
+	EXPECT_DL_ERR_OK( dl_archive_open( data, size, &ar ) );
+
+	// ... the second load return the instance patched by the first without patching it again ...
+	Strings* s1 = 0x0;
+	Strings* s2 = 0x0;
+	EXPECT_DL_ERR_OK( dl_archive_load_inplace( Ctx, &ar, "strings", Strings::TYPE_ID, (void**)&s1 ) );
+	EXPECT_DL_ERR_OK( dl_archive_load_inplace( Ctx, &ar, "strings", Strings::TYPE_ID, (void**)&s2 ) );
+	EXPECT_EQ( s1, s2 );
+	EXPECT_STREQ( "cow",   s2->Str1 );
+	EXPECT_STREQ( "bells", s2->Str2 );
+}
+
+TEST_F( DLArchive, loaded_entries )
+{
+	dl_archive_input_t inputs[] = {
+		{ "pods/1",  &pods1[0],   pods1.size() },
+		{ "strings", &strings[0], strings.size() },
+	};
+
+	size_t size;
+	unsigned char* data = write( inputs, DL_ARRAY_LENGTH( inputs ), 16, &size );
+	std::vector<unsigned char> unloaded( data, data + size );
+
+	dl_archive_t ar;
+	EXPECT_DL_ERR_OK( dl_archive_open( data, size, &ar ) );
+
+	dl_archive_entry_t entry;
+	EXPECT_DL_ERR_OK( dl_archive_find( &ar, "strings", Strings::TYPE_ID, &entry ) );
+	EXPECT_EQ( 0, entry.loaded );
+
+	Strings* s = 0x0;
+	EXPECT_DL_ERR_OK( dl_archive_load_inplace( Ctx, &ar, "strings", Strings::TYPE_ID, (void**)&s ) );
+
+	// ... only the loaded entry is reported as loaded ...
+	EXPECT_DL_ERR_OK( dl_archive_find( &ar, "strings", Strings::TYPE_ID, &entry ) );
+	EXPECT_EQ( 1, entry.loaded );
+	EXPECT_DL_ERR_OK( dl_archive_find( &ar, "pods/1", Pods::TYPE_ID, &entry ) );
+	EXPECT_EQ( 0, entry.loaded );
+	for( unsigned int i = 0; i < ar.entry_count; ++i )
+	{
+		EXPECT_DL_ERR_OK( dl_archive_get_entry( &ar, i, &entry ) );
+		EXPECT_EQ( entry.type == Strings::TYPE_ID ? 1 : 0, entry.loaded );
+	}
+
+	// ... the loaded state is part of the archive memory, memory with patched entries, as if written back to a file and
+	//     mapped again, can not be opened ...
+	dl_archive_t reopened;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_archive_open( data, size, &reopened ) );
+
+	// ... the archive as written can be opened again ...
+	memcpy( data, &unloaded[0], size );
+	EXPECT_DL_ERR_OK( dl_archive_open( data, size, &reopened ) );
+	EXPECT_DL_ERR_OK( dl_archive_find( &reopened, "strings", Strings::TYPE_ID, &entry ) );
+	EXPECT_EQ( 0, entry.loaded );
+}
+
+TEST_F( DLArchive, empty )
+{
+	size_t size;
+	unsigned char* data = write( 0x0, 0, 16, &size );
+
+	dl_archive_t ar;
+	EXPECT_DL_ERR_OK( dl_archive_open( data, size, &ar ) );
+	EXPECT_EQ( 0u, ar.entry_count );
+
+	dl_archive_entry_t entry;
+	EXPECT_DL_ERR_EQ( DL_ERROR_ARCHIVE_ENTRY_NOT_FOUND, dl_archive_find( &ar, "pods/1", 0, &entry ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_archive_get_entry( &ar, 0, &entry ) );
+}
+
+TEST_F( DLArchive, write_errors )
+{
+	dl_archive_input_t twice[] = {
+		{ "pods", &pods1[0], pods1.size() },
+		{ "pods", &pods2[0], pods2.size() },
+	};
+	size_t size = 0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_archive_write( Ctx, twice, DL_ARRAY_LENGTH( twice ), 16, 0x0, 0, &size ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_archive_write( Ctx, twice, 1, 24, 0x0, 0, &size ) );
+
+	unsigned char garbage[32] = { 0 };
+	dl_archive_input_t not_packed[] = { { "garbage", garbage, sizeof( garbage ) } };
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_archive_write( Ctx, not_packed, 1, 16, 0x0, 0, &size ) );
+
+	std::vector<unsigned char> swapped( pods2.size() );
+	dl_endian_t other_endian = DL_ENDIAN_HOST == DL_ENDIAN_LITTLE ? DL_ENDIAN_BIG : DL_ENDIAN_LITTLE;
+	EXPECT_DL_ERR_OK( dl_convert( Ctx, Pods::TYPE_ID, &pods2[0], pods2.size(), &swapped[0], swapped.size(), other_endian, sizeof(void*), 0x0 ) );
+	dl_archive_input_t mixed[] = {
+		{ "pods/1", &pods1[0],   pods1.size() },
+		{ "pods/2", &swapped[0], swapped.size() },
+	};
+	EXPECT_DL_ERR_EQ( DL_ERROR_ENDIAN_MISMATCH, dl_archive_write( Ctx, mixed, DL_ARRAY_LENGTH( mixed ), 16, 0x0, 0, &size ) );
+
+	EXPECT_DL_ERR_OK( dl_archive_write( Ctx, mixed, 1, 16, 0x0, 0, &size ) );
+	std::vector<unsigned char> out( size );
+	EXPECT_DL_ERR_EQ( DL_ERROR_BUFFER_TOO_SMALL, dl_archive_write( Ctx, mixed, 1, 16, &out[0], size - 1, 0x0 ) );
+}
+
+TEST_F( DLArchive, root_type_alignment )
+{
+	A128BitAlignedType inst;
+	inst.Int = 1337;
+	std::vector<unsigned char> aligned;
+	store( inst, aligned );
+
+	dl_archive_input_t inputs[] = { { "aligned", &aligned[0], aligned.size() } };
+	size_t size = 0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_BAD_ALIGNMENT, dl_archive_write( Ctx, inputs, 1, 64, 0x0, 0, &size ) );
+
+	unsigned char* data = write( inputs, 1, 128, &size );
+	dl_archive_t ar;
+	EXPECT_DL_ERR_OK( dl_archive_open( data, size, &ar ) );
+	A128BitAlignedType* loaded = 0x0;
+	EXPECT_DL_ERR_OK( dl_archive_load_inplace( Ctx, &ar, "aligned", A128BitAlignedType::TYPE_ID, (void**)&loaded ) );
+	EXPECT_EQ( 0u, (uintptr_t)loaded % 128 );
+	EXPECT_EQ( 1337u, loaded->Int );
+}
+
+TEST_F( DLArchive, open_errors )
+{
+	dl_archive_input_t inputs[] = { { "pods", &pods1[0], pods1.size() } };
+
+	size_t size;
+	unsigned char* data = write( inputs, DL_ARRAY_LENGTH( inputs ), 64, &size );
+
+	dl_archive_t ar;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_archive_open( data, 8, &ar ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_archive_open( data, size - 1, &ar ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_archive_open( &pods1[0], pods1.size(), &ar ) );
+
+	std::vector<unsigned char> moved( size + 64 + 16 );
+	unsigned char* misaligned = &moved[0] + ( 64 - (uintptr_t)&moved[0] % 64 ) % 64 + 16;
+	memcpy( misaligned, data, size );
+	EXPECT_DL_ERR_EQ( DL_ERROR_BAD_ALIGNMENT, dl_archive_open( misaligned, size, &ar ) );
+
+	// ... an instance outside the archive is found when fetching it ...
+	EXPECT_DL_ERR_OK( dl_archive_open( data, size, &ar ) );
+	ar.size = 64;
+	dl_archive_entry_t entry;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_archive_find( &ar, "pods", 0, &entry ) );
+}
+
+TEST_F( DLArchive, other_endian )
+{
+	std::vector<unsigned char> swapped( pods1.size() );
+	dl_endian_t other_endian = DL_ENDIAN_HOST == DL_ENDIAN_LITTLE ? DL_ENDIAN_BIG : DL_ENDIAN_LITTLE;
+	EXPECT_DL_ERR_OK( dl_convert( Ctx, Pods::TYPE_ID, &pods1[0], pods1.size(), &swapped[0], swapped.size(), other_endian, sizeof(void*), 0x0 ) );
+	dl_archive_input_t inputs[] = { { "pods", &swapped[0], swapped.size() } };
+
+	size_t size;
+	unsigned char* data = write( inputs, DL_ARRAY_LENGTH( inputs ), 16, &size );
+
+	dl_archive_t ar;
+	EXPECT_DL_ERR_EQ( DL_ERROR_ENDIAN_MISMATCH, dl_archive_open( data, size, &ar ) );
+}
@@ -76,6 +76,15 @@ struct DLBase : public DL
 		// calc size of stored instance
 		size_t store_size = 0;
 		EXPECT_DL_ERR_OK(dl_instance_calc_size(dl_ctx, type, pack_me, &store_size));
+
+		// ... the calculated size should be what a store actually produce and the upper bound never be less ...
+		size_t dummy_store_size = 0;
+		size_t upper_bound_size = 0;
+		EXPECT_DL_ERR_OK(dl_instance_store(dl_ctx, type, pack_me, 0x0, 0, &dummy_store_size));
+		EXPECT_DL_ERR_OK(dl_instance_calc_size_ex(dl_ctx, type, pack_me, DL_CALC_SIZE_FLAGS_UPPER_BOUND, &upper_bound_size));
+		EXPECT_EQ(dummy_store_size, store_size);
+		EXPECT_LE(store_size, upper_bound_size);
+
 		unsigned char* store_buffer = (unsigned char*)malloc(store_size+1);
 		for( unsigned int i = 0; i < TEST_REPS; ++i )
 		{
@@ -84,6 +93,7 @@ struct DLBase : public DL
 			EXPECT_DL_ERR_OK( dl_instance_store( dl_ctx, type, pack_me, store_buffer, store_size, 0x0 ) );
 			EXPECT_INSTANCE_INFO( store_buffer, store_size, sizeof(void*), DL_ENDIAN_HOST, type );
 			EXPECT_EQ( 0xFE, store_buffer[store_size] ); // no overwrite on the calculated size plox!
+			EXPECT_DL_ERR_OK( dl_instance_validate( dl_ctx, type, store_buffer, store_size ) );
 
 			unsigned char *out_buffer = 0x0;
 			size_t out_size;
@@ -96,13 +106,58 @@ struct DLBase : public DL
 			// out instance should have correct format
 			EXPECT_INSTANCE_INFO( out_buffer, out_size, sizeof(void*), DL_ENDIAN_HOST, type );
 
+			EXPECT_DL_ERR_OK( dl_instance_validate( dl_ctx, type, out_buffer, out_size ) );
+
 			size_t consumed = 0;
 			EXPECT_DL_ERR_OK( dl_instance_load( dl_ctx, type, unpack_me, unpack_me_size, out_buffer, out_size, &consumed ) );
 
 			EXPECT_EQ( out_size, consumed );
 
+			// ... load again validating while patching into a separate buffer, it should load the same instance ...
+			unsigned char* validated = (unsigned char*)malloc( unpack_me_size );
+			consumed = 0;
+			EXPECT_DL_ERR_OK( dl_instance_load_ex( dl_ctx, type, validated, unpack_me_size, out_buffer, out_size, DL_LOAD_FLAGS_VALIDATE, &consumed ) );
+			EXPECT_EQ( out_size, consumed );
+
+			int  validated_cmp = 1;
+			char validated_diff[256];
+			EXPECT_DL_ERR_OK( dl_instance_compare( dl_ctx, type, unpack_me, validated, &validated_cmp, validated_diff, sizeof( validated_diff ) ) );
+			EXPECT_EQ( 0, validated_cmp ) << "validating load differ at " << validated_diff;
+			free( validated );
+
 			free(out_buffer);
 		}
+
+		// ... a clone of the instance should store to the same bytes as the instance ...
+		size_t clone_size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_clone( dl_ctx, type, pack_me, 0x0, 0, &clone_size ) );
+		void* clone = malloc( clone_size );
+		EXPECT_DL_ERR_OK( dl_instance_clone( dl_ctx, type, pack_me, clone, clone_size, 0x0 ) );
+		unsigned char* clone_store_buffer = (unsigned char*)malloc( store_size );
+		EXPECT_DL_ERR_OK( dl_instance_store( dl_ctx, type, pack_me, store_buffer, store_size, 0x0 ) );
+		EXPECT_DL_ERR_OK( dl_instance_store( dl_ctx, type, clone, clone_store_buffer, store_size, 0x0 ) );
+		EXPECT_EQ( 0, memcmp( store_buffer, clone_store_buffer, store_size ) );
+
+		// ... both the loaded instance and the clone should compare equal to the instance ...
+		int  cmp = 1;
+		char diff_path[256];
+		EXPECT_DL_ERR_OK( dl_instance_compare( dl_ctx, type, pack_me, unpack_me, &cmp, diff_path, sizeof( diff_path ) ) );
+		EXPECT_EQ( 0, cmp ) << "differ at " << diff_path;
+		EXPECT_DL_ERR_OK( dl_instance_compare( dl_ctx, type, pack_me, clone, &cmp, diff_path, sizeof( diff_path ) ) );
+		EXPECT_EQ( 0, cmp ) << "differ at " << diff_path;
+
+		// ... and all of them, and the packed instance, should have the same hash ...
+		uint64_t hash = 0, other_hash = 1;
+		EXPECT_DL_ERR_OK( dl_instance_hash( dl_ctx, type, pack_me, &hash ) );
+		EXPECT_DL_ERR_OK( dl_instance_hash( dl_ctx, type, unpack_me, &other_hash ) );
+		EXPECT_EQ( hash, other_hash );
+		EXPECT_DL_ERR_OK( dl_instance_hash( dl_ctx, type, clone, &other_hash ) );
+		EXPECT_EQ( hash, other_hash );
+		EXPECT_DL_ERR_OK( dl_instance_hash_packed( dl_ctx, type, store_buffer, store_size, &other_hash ) );
+		EXPECT_EQ( hash, other_hash );
+		free( clone_store_buffer );
+		free( clone );
+
 		free(store_buffer);
 	}
 };
@@ -0,0 +1,96 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include <gtest/gtest.h>
+
+#include <dl/dl.h>
+
+#include "dl_test_common.h"
+
+class DLCalcSize : public DL
+{
+public:
+	template <typename T>
+	size_t calc_size( const T& inst, unsigned int flags = DL_CALC_SIZE_FLAGS_NONE )
+	{
+		size_t size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_calc_size_ex( Ctx, T::TYPE_ID, &inst, flags, &size ) );
+		return size;
+	}
+
+	template <typename T>
+	size_t store_size( const T& inst )
+	{
+		size_t size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_store( Ctx, T::TYPE_ID, &inst, 0x0, 0, &size ) );
+		return size;
+	}
+};
+
+TEST_F( DLCalcSize, merged_strings )
+{
+	char apa[] = "apa";
+	const char* strings[] = { "apa", "kossa", apa, 0x0, "" };
+	StringArray s = { { strings, DL_ARRAY_LENGTH( strings ) } };
+
+	size_t exact = calc_size( s );
+	EXPECT_EQ( store_size( s ), exact );
+
+	// ... the upper bound count every string, even equal ones ...
+	EXPECT_EQ( exact + sizeof( "apa" ), calc_size( s, DL_CALC_SIZE_FLAGS_UPPER_BOUND ) );
+}
+
+TEST_F( DLCalcSize, ptrs_and_cycles )
+{
+	DoublePtrChain a1, a2, a3;
+	a1.Int = 1; a1.Next = &a2; a1.Prev = 0x0;
+	a2.Int = 2; a2.Next = &a3; a2.Prev = &a1;
+	a3.Int = 3; a3.Next = &a1; a3.Prev = &a2;
+
+	size_t exact = calc_size( a1 );
+	EXPECT_EQ( store_size( a1 ), exact );
+	EXPECT_EQ( exact, calc_size( a1, DL_CALC_SIZE_FLAGS_UPPER_BOUND ) );
+
+	// ... a ptr to an equal copy of a struct is stored as a struct of its own ...
+	DoublePtrChain a2_copy = a2;
+	a3.Prev = &a2_copy;
+	EXPECT_EQ( store_size( a1 ), calc_size( a1 ) );
+	EXPECT_LT( exact, calc_size( a1 ) );
+}
+
+TEST_F( DLCalcSize, arrays_of_structs )
+{
+	const char* strings1[] = { "apa", "kossa" };
+	const char* strings2[] = { "kossa", "banan" };
+	StringArray arr[] = { { { strings1, DL_ARRAY_LENGTH( strings1 ) } }, { { strings2, DL_ARRAY_LENGTH( strings2 ) } } };
+	BugTest4 inst = { { arr, DL_ARRAY_LENGTH( arr ) } };
+
+	EXPECT_EQ( store_size( inst ), calc_size( inst ) );
+	EXPECT_EQ( calc_size( inst ) + sizeof( "kossa" ), calc_size( inst, DL_CALC_SIZE_FLAGS_UPPER_BOUND ) );
+
+	inst.struct_with_str_arr.count = 0;
+	EXPECT_EQ( store_size( inst ), calc_size( inst ) );
+}
+
+TEST_F( DLCalcSize, invalid_union )
+{
+	test_inline_array_of_unions inst;
+	memset( &inst, 0x0, sizeof( inst ) );
+	inst.arr[0].type = test_union_simple_type_item1;
+	inst.arr[1].type = test_union_simple_type_item2;
+	inst.arr[2].type = test_union_simple_type_item3;
+	EXPECT_EQ( store_size( inst ), calc_size( inst ) );
+
+	// ... unions is checked even when embedded in a struct without subdata ...
+	inst.arr[1].type = (test_union_simple_type)0xFFFFFF;
+	size_t size;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_calc_size( Ctx, test_inline_array_of_unions::TYPE_ID, &inst, &size ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_calc_size_ex( Ctx, test_inline_array_of_unions::TYPE_ID, &inst, DL_CALC_SIZE_FLAGS_UPPER_BOUND, &size ) );
+}
+
+TEST_F( DLCalcSize, invalid_type )
+{
+	Pods p;
+	memset( &p, 0x0, sizeof( p ) );
+	size_t size;
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_NOT_FOUND, dl_instance_calc_size( Ctx, 0xFFFFFFFF, &p, &size ) );
+}
@@ -0,0 +1,117 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include <gtest/gtest.h>
+
+#include <dl/dl.h>
+
+#include "dl_test_common.h"
+
+#include <vector>
+
+class DLClone : public DL
+{
+public:
+	std::vector<uint64_t> cloned; // uint64_t to get the buffer aligned.
+
+	template <typename T>
+	T* clone( const T* inst, size_t* produced = 0x0 )
+	{
+		size_t size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_clone( Ctx, T::TYPE_ID, inst, 0x0, 0, &size ) );
+		EXPECT_LE( sizeof( T ), size );
+		cloned.assign( size / sizeof( uint64_t ) + 1, 0 );
+		EXPECT_DL_ERR_OK( dl_instance_clone( Ctx, T::TYPE_ID, inst, &cloned[0], size, produced ) );
+		return (T*)&cloned[0];
+	}
+
+	bool in_clone( const void* ptr )
+	{
+		const uint8_t* begin = (const uint8_t*)&cloned[0];
+		return (const uint8_t*)ptr >= begin && (const uint8_t*)ptr < begin + cloned.size() * sizeof( uint64_t );
+	}
+};
+
+TEST_F( DLClone, shared_ptrs_and_cycles )
+{
+	DoublePtrChain c1, c2, c3;
+	c1.Int = 1; c1.Next = &c2; c1.Prev = 0x0;
+	c2.Int = 2; c2.Next = &c3; c2.Prev = &c1;
+	c3.Int = 3; c3.Next = 0x0; c3.Prev = &c2;
+
+	size_t produced = 0;
+	DoublePtrChain* root = clone( &c1, &produced );
+
+	// ... each struct is only copied once ...
+	EXPECT_EQ( 3 * sizeof( DoublePtrChain ), produced );
+
+	EXPECT_EQ( 1u, root->Int );
+	EXPECT_EQ( 0x0, root->Prev );
+	ASSERT_TRUE( in_clone( root->Next ) );
+	EXPECT_EQ( 2u, root->Next->Int );
+	EXPECT_EQ( root, root->Next->Prev );
+	ASSERT_TRUE( in_clone( root->Next->Next ) );
+	EXPECT_EQ( 3u, root->Next->Next->Int );
+	EXPECT_EQ( root->Next, root->Next->Next->Prev );
+	EXPECT_EQ( 0x0, root->Next->Next->Next );
+}
+
+TEST_F( DLClone, strings_are_merged )
+{
+	char apa1[] = "apa";
+	char apa2[] = "apa";
+	const char* strings[] = { apa1, "kossa", apa2, apa1, 0x0 };
+	StringArray original = { { strings, DL_ARRAY_LENGTH( strings ) } };
+
+	size_t produced = 0;
+	StringArray* copy = clone( &original, &produced );
+	EXPECT_EQ( sizeof( StringArray ) + DL_ARRAY_LENGTH( strings ) * sizeof( char* ) + sizeof( "apa" ) + sizeof( "kossa" ), produced );
+
+	ASSERT_EQ( DL_ARRAY_LENGTH( strings ), copy->Strings.count );
+	EXPECT_TRUE( in_clone( copy->Strings.data ) );
+	EXPECT_STREQ( "apa",   copy->Strings[0] );
+	EXPECT_STREQ( "kossa", copy->Strings[1] );
+	EXPECT_EQ( copy->Strings[0], copy->Strings[2] );
+	EXPECT_EQ( copy->Strings[0], copy->Strings[3] );
+	EXPECT_EQ( 0x0, copy->Strings[4] );
+	EXPECT_TRUE( in_clone( copy->Strings[0] ) );
+	EXPECT_TRUE( in_clone( copy->Strings[1] ) );
+}
+
+TEST_F( DLClone, empty_array_is_null )
+{
+	const char* strings[] = { "apa" };
+	StringArray original = { { strings, 0 } };
+
+	size_t produced = 0;
+	StringArray* copy = clone( &original, &produced );
+	EXPECT_EQ( sizeof( StringArray ), produced );
+	EXPECT_EQ( 0x0, copy->Strings.data );
+	EXPECT_EQ( 0u, copy->Strings.count );
+}
+
+TEST_F( DLClone, buffer_too_small )
+{
+	DoublePtrChain c1, c2;
+	c1.Int = 1; c1.Next = &c2; c1.Prev = 0x0;
+	c2.Int = 2; c2.Next = 0x0; c2.Prev = &c1;
+
+	uint64_t out[16];
+	memset( out, 0xFE, sizeof( out ) );
+
+	size_t produced = 0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_BUFFER_TOO_SMALL, dl_instance_clone( Ctx, DoublePtrChain::TYPE_ID, &c1, out, sizeof( DoublePtrChain ) + 1, &produced ) );
+	EXPECT_EQ( 2 * sizeof( DoublePtrChain ), produced );
+
+	// ... nothing is written outside of the buffer ...
+	EXPECT_EQ( 0xFE, ( (uint8_t*)out )[sizeof( DoublePtrChain ) + 1] );
+
+	EXPECT_DL_ERR_OK( dl_instance_clone( Ctx, DoublePtrChain::TYPE_ID, &c1, out, produced, 0x0 ) );
+	EXPECT_EQ( 2u, ( (DoublePtrChain*)out )->Next->Int );
+}
+
+TEST_F( DLClone, invalid_type )
+{
+	DoublePtrChain c1 = { 1, 0x0, 0x0 };
+	size_t produced = 0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_NOT_FOUND, dl_instance_clone( Ctx, 0xFEEDBEEF, &c1, 0x0, 0, &produced ) );
+}
@@ -0,0 +1,175 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include <gtest/gtest.h>
+
+#include <dl/dl.h>
+
+#include "dl_test_common.h"
+
+class DLCompare : public DL
+{
+public:
+	char diff_path[256];
+
+	template <typename T>
+	int compare( const T& a, const T& b )
+	{
+		int result = 0x7FFF;
+		EXPECT_DL_ERR_OK( dl_instance_compare( Ctx, T::TYPE_ID, &a, &b, &result, diff_path, sizeof( diff_path ) ) );
+
+		// ... the order should be the same from both directions ...
+		int reverse = 0x7FFF;
+		EXPECT_DL_ERR_OK( dl_instance_compare( Ctx, T::TYPE_ID, &b, &a, &reverse, 0x0, 0 ) );
+		EXPECT_EQ( result < 0, reverse > 0 );
+		EXPECT_EQ( result == 0, reverse == 0 );
+		return result;
+	}
+};
+
+TEST_F( DLCompare, pods_ignore_padding )
+{
+	Pods p1, p2;
+	memset( &p1, 0x00, sizeof( p1 ) );
+	memset( &p2, 0xFF, sizeof( p2 ) );
+	p1.i8 = p2.i8 = -1; p1.i16 = p2.i16 = 2; p1.i32 = p2.i32 = 3; p1.i64 = p2.i64 = 4;
+	p1.u8 = p2.u8 = 5;  p1.u16 = p2.u16 = 6; p1.u32 = p2.u32 = 7; p1.u64 = p2.u64 = 8;
+	p1.f32 = p2.f32 = 9.0f; p1.f64 = p2.f64 = 10.0;
+
+	EXPECT_EQ( 0, compare( p1, p2 ) );
+	EXPECT_STREQ( "", diff_path );
+
+	// ... numbers is ordered by value, not by their bytes ...
+	p2.i8 = 1;
+	EXPECT_GT( 0, compare( p1, p2 ) );
+	EXPECT_STREQ( "i8", diff_path );
+
+	p2.i8  = p1.i8;
+	p2.u16 = 0x100;
+	EXPECT_GT( 0, compare( p1, p2 ) );
+	EXPECT_STREQ( "u16", diff_path );
+
+	p2.u16 = p1.u16;
+	p2.f64 = -10.0;
+	EXPECT_LT( 0, compare( p1, p2 ) );
+	EXPECT_STREQ( "f64", diff_path );
+
+	p1.f64 = 0.0;
+	p2.f64 = -0.0;
+	EXPECT_EQ( 0, compare( p1, p2 ) );
+}
+
+TEST_F( DLCompare, bitfields )
+{
+	TestBits b1, b2;
+	memset( &b1, 0x00, sizeof( b1 ) );
+	memset( &b2, 0x00, sizeof( b2 ) );
+	b1.Bit1 = 1; b1.Bit5 = 1;
+	b2.Bit1 = 1; b2.Bit5 = 1;
+	EXPECT_EQ( 0, compare( b1, b2 ) );
+
+	b2.Bit5 = 2;
+	EXPECT_GT( 0, compare( b1, b2 ) );
+	EXPECT_STREQ( "Bit5", diff_path );
+}
+
+TEST_F( DLCompare, strings_and_arrays )
+{
+	char apa[] = "apa";
+	const char* strings1[] = { "apa", "kossa", 0x0 };
+	const char* strings2[] = { apa, "kossa", 0x0 };
+	StringArray s1 = { { strings1, DL_ARRAY_LENGTH( strings1 ) } };
+	StringArray s2 = { { strings2, DL_ARRAY_LENGTH( strings2 ) } };
+
+	// ... strings is compared by content ...
+	EXPECT_EQ( 0, compare( s1, s2 ) );
+
+	strings2[1] = "kossb";
+	EXPECT_GT( 0, compare( s1, s2 ) );
+	EXPECT_STREQ( "Strings[1]", diff_path );
+
+	strings2[1] = "kossa";
+	strings2[2] = "";
+	EXPECT_GT( 0, compare( s1, s2 ) );
+	EXPECT_STREQ( "Strings[2]", diff_path );
+
+	// ... arrays is ordered by length first ...
+	s2.Strings.count = 2;
+	EXPECT_LT( 0, compare( s1, s2 ) );
+	EXPECT_STREQ( "Strings", diff_path );
+
+	s1.Strings.count = 0;
+	s2.Strings.data  = 0x0;
+	s2.Strings.count = 0;
+	EXPECT_EQ( 0, compare( s1, s2 ) );
+}
+
+TEST_F( DLCompare, ptrs_and_cycles )
+{
+	DoublePtrChain a1, a2, a3;
+	a1.Int = 1; a1.Next = &a2; a1.Prev = 0x0;
+	a2.Int = 2; a2.Next = &a3; a2.Prev = &a1;
+	a3.Int = 3; a3.Next = 0x0; a3.Prev = &a2;
+
+	DoublePtrChain b1, b2, b3;
+	b1 = a1; b1.Next = &b2;
+	b2 = a2; b2.Next = &b3; b2.Prev = &b1;
+	b3 = a3; b3.Prev = &b2;
+
+	EXPECT_EQ( 0, compare( a1, b1 ) );
+
+	b3.Int = 4;
+	EXPECT_GT( 0, compare( a1, b1 ) );
+	EXPECT_STREQ( "Next.Next.Int", diff_path );
+
+	// ... a ptr to an already reached struct differ from a ptr to an equal copy of it ...
+	DoublePtrChain b2_copy = b2;
+	b3.Int  = 3;
+	b3.Prev = &b2_copy;
+	EXPECT_NE( 0, compare( a1, b1 ) );
+	EXPECT_STREQ( "Next.Next.Prev", diff_path );
+
+	b3.Prev = 0x0;
+	EXPECT_LT( 0, compare( a1, b1 ) );
+	EXPECT_STREQ( "Next.Next.Prev", diff_path );
+}
+
+TEST_F( DLCompare, unions )
+{
+	test_union_simple u1;
+	memset( &u1, 0x0, sizeof( u1 ) );
+	u1.type        = test_union_simple_type_item1;
+	u1.value.item1 = 1337;
+
+	test_union_simple u2;
+	memset( &u2, 0xFF, sizeof( u2 ) );
+	u2.type        = test_union_simple_type_item1;
+	u2.value.item1 = 1337;
+	EXPECT_EQ( 0, compare( u1, u2 ) );
+
+	u2.value.item1 = 4711;
+	EXPECT_GT( 0, compare( u1, u2 ) );
+	EXPECT_STREQ( "item1", diff_path );
+
+	// ... unions with different members set is ordered by type-tag ...
+	u2.type = test_union_simple_type_item3;
+	EXPECT_EQ( (uint32_t)u1.type < (uint32_t)u2.type, compare( u1, u2 ) < 0 );
+	EXPECT_STREQ( "", diff_path );
+
+	u2.type = (test_union_simple_type)0xFFFFFF;
+	int result;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_compare( Ctx, test_union_simple::TYPE_ID, &u1, &u2, &result, 0x0, 0 ) );
+}
+
+TEST_F( DLCompare, truncated_path )
+{
+	const char* strings1[] = { "apa", "kossa" };
+	const char* strings2[] = { "apa", "bepa" };
+	StringArray s1 = { { strings1, DL_ARRAY_LENGTH( strings1 ) } };
+	StringArray s2 = { { strings2, DL_ARRAY_LENGTH( strings2 ) } };
+
+	int  result = 0;
+	char short_path[8];
+	EXPECT_DL_ERR_OK( dl_instance_compare( Ctx, StringArray::TYPE_ID, &s1, &s2, &result, short_path, sizeof( short_path ) ) );
+	EXPECT_LT( 0, result );
+	EXPECT_STREQ( "Strings", short_path );
+}
@@ -0,0 +1,174 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include <gtest/gtest.h>
+
+#include <dl/dl.h>
+#include <dl/dl_compress.h>
+#include <dl/dl_convert.h>
+
+#include "dl_test_common.h"
+
+#include <vector>
+
+class DLCompress : public DL
+{
+public:
+	std::vector<uint32_t>      array_data;
+	std::vector<unsigned char> packed;
+
+	void store_array()
+	{
+		PodArray1 arr = { { &array_data[0], (uint32_t)array_data.size() } };
+		size_t size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_store( Ctx, PodArray1::TYPE_ID, &arr, 0x0, 0, &size ) );
+		packed.resize( size );
+		EXPECT_DL_ERR_OK( dl_instance_store( Ctx, PodArray1::TYPE_ID, &arr, &packed[0], packed.size(), 0x0 ) );
+	}
+
+	std::vector<unsigned char> compress( const std::vector<unsigned char>& instance, unsigned int block_size )
+	{
+		size_t size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_compress( Ctx, &instance[0], instance.size(), block_size, 0x0, 0, &size ) );
+		std::vector<unsigned char> out( size );
+		size_t produced = 0;
+		EXPECT_DL_ERR_OK( dl_instance_compress( Ctx, &instance[0], instance.size(), block_size, &out[0], out.size(), &produced ) );
+		EXPECT_EQ( size, produced );
+		return out;
+	}
+
+	std::vector<unsigned char> decompress( const std::vector<unsigned char>& compressed )
+	{
+		size_t size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_decompress( &compressed[0], compressed.size(), 0x0, 0, &size ) );
+		std::vector<unsigned char> out( size );
+		EXPECT_DL_ERR_OK( dl_instance_decompress( &compressed[0], compressed.size(), &out[0], out.size(), 0x0 ) );
+		return out;
+	}
+};
+
+TEST_F( DLCompress, round_trip )
+{
+	for( uint32_t i = 0; i < 20000; ++i )
+		array_data.push_back( i % 100 );
+	store_array();
+
+	std::vector<unsigned char> compressed = compress( packed, 0 );
+	EXPECT_LT( compressed.size(), packed.size() / 10 );
+
+	dl_compressed_info_t info;
+	EXPECT_DL_ERR_OK( dl_compressed_get_info( &compressed[0], compressed.size(), &info ) );
+	EXPECT_EQ( packed.size(), info.instance_size );
+	EXPECT_EQ( 64u * 1024u, info.block_size );
+	EXPECT_EQ( 2u, info.block_count );
+
+	// ... the decompressed buffer is loaded as is ...
+	std::vector<unsigned char> decompressed = decompress( compressed );
+	EXPECT_EQ( packed, decompressed );
+
+	PodArray1* loaded = 0x0;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace( Ctx, PodArray1::TYPE_ID, &decompressed[0], decompressed.size(), (void**)&loaded, 0x0 ) );
+	EXPECT_EQ( array_data.size(), loaded->u32_arr.count );
+	EXPECT_EQ( 0, memcmp( &array_data[0], loaded->u32_arr.data, array_data.size() * sizeof( uint32_t ) ) );
+}
+
+TEST_F( DLCompress, small_instance )
+{
+	Pods p;
+	memset( &p, 0x0, sizeof( p ) );
+	p.i32 = 1337;
+	size_t size = 0;
+	EXPECT_DL_ERR_OK( dl_instance_store( Ctx, Pods::TYPE_ID, &p, 0x0, 0, &size ) );
+	packed.resize( size );
+	EXPECT_DL_ERR_OK( dl_instance_store( Ctx, Pods::TYPE_ID, &p, &packed[0], packed.size(), 0x0 ) );
+
+	EXPECT_EQ( packed, decompress( compress( packed, 0 ) ) );
+}
+
+TEST_F( DLCompress, incompressible_blocks_are_stored_raw )
+{
+	uint32_t rand = 1;
+	for( uint32_t i = 0; i < 4096; ++i )
+	{
+		rand = rand * 1664525u + 1013904223u;
+		array_data.push_back( rand );
+	}
+	store_array();
+
+	std::vector<unsigned char> compressed = compress( packed, 1024 );
+	EXPECT_LE( compressed.size(), packed.size() + 1024 );
+	EXPECT_EQ( packed, decompress( compressed ) );
+}
+
+TEST_F( DLCompress, decompress_blocks_and_range )
+{
+	for( uint32_t i = 0; i < 4096; ++i )
+		array_data.push_back( i * 7 );
+	store_array();
+
+	std::vector<unsigned char> compressed = compress( packed, 1024 );
+	dl_compressed_info_t info;
+	EXPECT_DL_ERR_OK( dl_compressed_get_info( &compressed[0], compressed.size(), &info ) );
+	EXPECT_EQ( ( packed.size() + 1023 ) / 1024, info.block_count );
+
+	// ... blocks in any order to the same buffer gives the same result as decompressing all of it ...
+	std::vector<unsigned char> out( packed.size(), 0xFE );
+	for( unsigned int i = info.block_count; i > 0; i = i > 2 ? i - 2 : 0 )
+		EXPECT_DL_ERR_OK( dl_compressed_decompress_blocks( &compressed[0], compressed.size(), i > 2 ? i - 2 : 0, i > 2 ? 2 : i, &out[0], out.size() ) );
+	EXPECT_EQ( packed, out );
+
+	// ... only the blocks covering the range is touched ...
+	std::fill( out.begin(), out.end(), 0xFE );
+	EXPECT_DL_ERR_OK( dl_compressed_decompress_range( &compressed[0], compressed.size(), 1500, 1000, &out[0], 3072 ) );
+	EXPECT_EQ( 0xFE, out[1023] );
+	EXPECT_EQ( 0, memcmp( &packed[1024], &out[1024], 2048 ) );
+	EXPECT_EQ( 0xFE, out[3072] );
+
+	EXPECT_DL_ERR_OK( dl_compressed_decompress_range( &compressed[0], compressed.size(), 0, 0, 0x0, 0 ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_compressed_decompress_range( &compressed[0], compressed.size(), packed.size() - 10, 11, &out[0], out.size() ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_compressed_decompress_blocks( &compressed[0], compressed.size(), info.block_count - 1, 2, &out[0], out.size() ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_BUFFER_TOO_SMALL, dl_compressed_decompress_blocks( &compressed[0], compressed.size(), 0, 2, &out[0], 2047 ) );
+}
+
+TEST_F( DLCompress, errors )
+{
+	for( uint32_t i = 0; i < 2048; ++i )
+		array_data.push_back( i & 15 );
+	store_array();
+
+	size_t size = 0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_instance_compress( Ctx, &packed[0], packed.size(), 255, 0x0, 0, &size ) );
+
+	unsigned char garbage[64] = { 0 };
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_compress( Ctx, garbage, sizeof( garbage ), 0, 0x0, 0, &size ) );
+
+	std::vector<unsigned char> compressed = compress( packed, 512 );
+	std::vector<unsigned char> out( packed.size() );
+	EXPECT_DL_ERR_EQ( DL_ERROR_BUFFER_TOO_SMALL, dl_instance_compress( Ctx, &packed[0], packed.size(), 512, &out[0], compressed.size() - 1, 0x0 ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_BUFFER_TOO_SMALL, dl_instance_decompress( &compressed[0], compressed.size(), &out[0], out.size() - 1, 0x0 ) );
+
+	dl_compressed_info_t info;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_compressed_get_info( &compressed[0], 8, &info ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_compressed_get_info( &packed[0], packed.size(), &info ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_decompress( &compressed[0], compressed.size() - 1, &out[0], out.size(), 0x0 ) );
+
+	// ... broken block data is found while decompressing, without writing outside of the block ...
+	std::vector<unsigned char> broken( compressed );
+	for( size_t i = broken.size() - 64; i < broken.size(); ++i )
+		broken[i] = 0xFF;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_decompress( &broken[0], broken.size(), &out[0], out.size(), 0x0 ) );
+}
+
+TEST_F( DLCompress, other_endian )
+{
+	for( uint32_t i = 0; i < 4096; ++i )
+		array_data.push_back( i % 33 );
+	store_array();
+
+	std::vector<unsigned char> swapped( packed.size() );
+	dl_endian_t other_endian = DL_ENDIAN_HOST == DL_ENDIAN_LITTLE ? DL_ENDIAN_BIG : DL_ENDIAN_LITTLE;
+	EXPECT_DL_ERR_OK( dl_convert( Ctx, PodArray1::TYPE_ID, &packed[0], packed.size(), &swapped[0], swapped.size(), other_endian, sizeof(void*), 0x0 ) );
+
+	std::vector<unsigned char> compressed = compress( swapped, 1024 );
+	EXPECT_NE( 0, memcmp( &compressed[0], &compress( packed, 1024 )[0], 4 ) );
+	EXPECT_EQ( swapped, decompress( compressed ) );
+}
@@ -0,0 +1,320 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include <gtest/gtest.h>
+
+#include <dl/dl.h>
+#include <dl/dl_diff.h>
+
+#include "dl_test_common.h"
+
+#include <vector>
+
+class DLDiff : public DL
+{
+public:
+	template <typename T>
+	std::vector<unsigned char> store( const T& inst )
+	{
+		size_t size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_store( Ctx, T::TYPE_ID, &inst, 0x0, 0, &size ) );
+		std::vector<unsigned char> out( size );
+		EXPECT_DL_ERR_OK( dl_instance_store( Ctx, T::TYPE_ID, &inst, &out[0], out.size(), 0x0 ) );
+		return out;
+	}
+
+	template <typename T>
+	std::vector<unsigned char> diff( const T& old_inst, const T& new_inst )
+	{
+		size_t size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_diff( Ctx, T::TYPE_ID, &old_inst, &new_inst, 0x0, 0, &size ) );
+		std::vector<unsigned char> patch( size );
+		size_t produced = 0;
+		EXPECT_DL_ERR_OK( dl_instance_diff( Ctx, T::TYPE_ID, &old_inst, &new_inst, &patch[0], patch.size(), &produced ) );
+		EXPECT_EQ( size, produced );
+		return patch;
+	}
+
+	// ... diff old to new, apply the patch on old and check that the result is new stored, returns the size of the patch ...
+	template <typename T>
+	size_t diff_and_apply( const T& old_inst, const T& new_inst )
+	{
+		std::vector<unsigned char> patch    = diff( old_inst, new_inst );
+		std::vector<unsigned char> expected = store( new_inst );
+
+		size_t size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_apply_diff( Ctx, T::TYPE_ID, &old_inst, &patch[0], patch.size(), 0x0, 0, &size ) );
+		EXPECT_EQ( expected.size(), size );
+
+		std::vector<unsigned char> applied( size );
+		EXPECT_DL_ERR_OK( dl_instance_apply_diff( Ctx, T::TYPE_ID, &old_inst, &patch[0], patch.size(), &applied[0], applied.size(), 0x0 ) );
+		EXPECT_EQ( expected, applied );
+
+		// ... and on the old instance loaded from packed data as it will be used when replicating data ...
+		std::vector<unsigned char> old_packed = store( old_inst );
+		T* loaded = 0x0;
+		EXPECT_DL_ERR_OK( dl_instance_load_inplace( Ctx, T::TYPE_ID, &old_packed[0], old_packed.size(), (void**)&loaded, 0x0 ) );
+		std::vector<unsigned char> from_loaded( size );
+		EXPECT_DL_ERR_OK( dl_instance_apply_diff( Ctx, T::TYPE_ID, loaded, &patch[0], patch.size(), &from_loaded[0], from_loaded.size(), 0x0 ) );
+		EXPECT_EQ( expected, from_loaded );
+
+		return patch.size();
+	}
+};
+
+TEST_F( DLDiff, pods )
+{
+	Pods p1;
+	memset( &p1, 0x0, sizeof( p1 ) );
+	p1.i32 = 1;
+	p1.f64 = 2.0;
+	Pods p2 = p1;
+
+	size_t unchanged_size = diff_and_apply( p1, p2 );
+
+	p2.i32 = 3;
+	p2.f64 = 4.0;
+	size_t changed_size = diff_and_apply( p1, p2 );
+	EXPECT_EQ( unchanged_size + 2 + sizeof( p2.i32 ) + sizeof( p2.f64 ), changed_size );
+}
+
+TEST_F( DLDiff, strings )
+{
+	Strings s1 = { "cow", "bells" };
+	Strings s2 = { "cow", "more bells" };
+	diff_and_apply( s1, s2 );
+
+	Strings s3 = { 0x0, "bells" };
+	diff_and_apply( s1, s3 );
+	diff_and_apply( s3, s1 );
+
+	// ... equal strings at other addresses are not changed ...
+	char cow[] = "cow";
+	Strings s4 = { cow, "bells" };
+	EXPECT_EQ( diff( s1, s1 ).size(), diff( s1, s4 ).size() );
+}
+
+TEST_F( DLDiff, pod_array_same_count )
+{
+	std::vector<uint32_t> a1( 1000 );
+	for( size_t i = 0; i < a1.size(); ++i )
+		a1[i] = (uint32_t)i;
+	std::vector<uint32_t> a2( a1 );
+
+	PodArray1 p1 = { { &a1[0], (uint32_t)a1.size() } };
+	PodArray1 p2 = { { &a2[0], (uint32_t)a2.size() } };
+	size_t unchanged_size = diff_and_apply( p1, p2 );
+
+	// ... only changed elements are in the patch ...
+	a2[10]  = 4711;
+	a2[11]  = 4712;
+	a2[500] = 1337;
+	size_t changed_size = diff_and_apply( p1, p2 );
+	EXPECT_GT( changed_size, unchanged_size );
+	EXPECT_LT( changed_size, unchanged_size + 32 );
+
+	for( size_t i = 0; i < a2.size(); ++i )
+		a2[i] = 0;
+	EXPECT_GT( diff_and_apply( p1, p2 ), a2.size() * sizeof( uint32_t ) );
+}
+
+TEST_F( DLDiff, pod_array_insert_remove )
+{
+	std::vector<uint32_t> a1( 1000 );
+	for( size_t i = 0; i < a1.size(); ++i )
+		a1[i] = (uint32_t)i;
+	PodArray1 p1 = { { &a1[0], (uint32_t)a1.size() } };
+
+	// ... insert in the middle only write inserted element ...
+	std::vector<uint32_t> inserted( a1 );
+	inserted.insert( inserted.begin() + 500, 4711 );
+	PodArray1 p2 = { { &inserted[0], (uint32_t)inserted.size() } };
+	EXPECT_LT( diff_and_apply( p1, p2 ), 32u );
+
+	std::vector<uint32_t> removed( a1 );
+	removed.erase( removed.begin() + 10, removed.begin() + 20 );
+	PodArray1 p3 = { { &removed[0], (uint32_t)removed.size() } };
+	EXPECT_LT( diff_and_apply( p1, p3 ), 32u );
+
+	std::vector<uint32_t> appended( a1 );
+	appended.push_back( 1 );
+	appended.push_back( 2 );
+	PodArray1 p4 = { { &appended[0], (uint32_t)appended.size() } };
+	EXPECT_LT( diff_and_apply( p1, p4 ), 32u );
+
+	PodArray1 empty = { { 0x0, 0 } };
+	diff_and_apply( p1, empty );
+	diff_and_apply( empty, p1 );
+	diff_and_apply( empty, empty );
+}
+
+TEST_F( DLDiff, struct_and_string_arrays )
+{
+	Pods2 s1[] = { { 1, 2 }, { 3, 4 }, { 5, 6 } };
+	Pods2 s2[] = { { 1, 2 }, { 7, 8 }, { 3, 4 }, { 5, 6 } };
+	Pods2 s3[] = { { 1, 2 }, { 3, 9 }, { 5, 6 } };
+	StructArray1 sa1 = { { s1, DL_ARRAY_LENGTH( s1 ) } };
+	StructArray1 sa2 = { { s2, DL_ARRAY_LENGTH( s2 ) } };
+	StructArray1 sa3 = { { s3, DL_ARRAY_LENGTH( s3 ) } };
+	diff_and_apply( sa1, sa2 );
+	diff_and_apply( sa2, sa1 );
+	diff_and_apply( sa1, sa3 );
+
+	const char* str1[] = { "a", "bb", "ccc" };
+	const char* str2[] = { "a", "dddd", "bb", "ccc" };
+	const char* str3[] = { "a", 0x0, "ccc" };
+	StringArray st1 = { { str1, DL_ARRAY_LENGTH( str1 ) } };
+	StringArray st2 = { { str2, DL_ARRAY_LENGTH( str2 ) } };
+	StringArray st3 = { { str3, DL_ARRAY_LENGTH( str3 ) } };
+	diff_and_apply( st1, st2 );
+	diff_and_apply( st2, st1 );
+	diff_and_apply( st1, st3 );
+
+	// ... arrays of arrays ...
+	uint32_t u1[] = { 1, 2, 3 };
+	uint32_t u2[] = { 1, 4, 3, 5 };
+	PodArray1 sub1[] = { { { u1, DL_ARRAY_LENGTH( u1 ) } }, { { u1, DL_ARRAY_LENGTH( u1 ) } } };
+	PodArray1 sub2[] = { { { u1, DL_ARRAY_LENGTH( u1 ) } }, { { u2, DL_ARRAY_LENGTH( u2 ) } }, { { 0x0, 0 } } };
+	PodArray2 pa1 = { { sub1, DL_ARRAY_LENGTH( sub1 ) } };
+	PodArray2 pa2 = { { sub2, DL_ARRAY_LENGTH( sub2 ) } };
+	diff_and_apply( pa1, pa2 );
+	diff_and_apply( pa2, pa1 );
+}
+
+TEST_F( DLDiff, long_runs )
+{
+	// ... runs of changed elements longer than what fit in one run, for elements written and rolled back one by one ...
+	std::vector<const char*> str1( 1000, "apa" );
+	std::vector<const char*> str2( str1 );
+	for( size_t i = 100; i < 900; ++i )
+		str2[i] = ( i % 300 ) == 0 ? "apa" : "kossa";
+	StringArray st1 = { { &str1[0], (uint32_t)str1.size() } };
+	StringArray st2 = { { &str2[0], (uint32_t)str2.size() } };
+	diff_and_apply( st1, st2 );
+	diff_and_apply( st2, st1 );
+
+	std::vector<uint32_t> a1( 1000, 1 );
+	std::vector<uint32_t> a2( a1 );
+	for( size_t i = 0; i < 400; ++i )
+		a2[i] = 2;
+	PodArray1 p1 = { { &a1[0], (uint32_t)a1.size() } };
+	PodArray1 p2 = { { &a2[0], (uint32_t)a2.size() } };
+	EXPECT_LT( diff_and_apply( p1, p2 ), 400 * sizeof( uint32_t ) + 32 );
+
+	// ... elements added in a splice is always written, even when zero ...
+	std::vector<uint32_t> a3( 1200, 0 );
+	PodArray1 p3 = { { &a3[0], (uint32_t)a3.size() } };
+	EXPECT_GT( diff_and_apply( p1, p3 ), 200 * sizeof( uint32_t ) );
+}
+
+TEST_F( DLDiff, inline_arrays )
+{
+	WithInlineStructArray i1 = { { { 1, 2 }, { 3, 4 }, { 5, 6 } } };
+	WithInlineStructArray i2 = { { { 1, 2 }, { 3, 7 }, { 5, 6 } } };
+	diff_and_apply( i1, i2 );
+
+	StringInlineArray s1 = { { "a", "b", "c" } };
+	StringInlineArray s2 = { { "a", 0x0, "d" } };
+	diff_and_apply( s1, s2 );
+	diff_and_apply( s2, s1 );
+}
+
+TEST_F( DLDiff, ptrs )
+{
+	Pods p1;
+	memset( &p1, 0x0, sizeof( p1 ) );
+	p1.i32 = 1;
+	Pods p2 = p1;
+	p2.i32 = 2;
+
+	SimplePtr shared = { &p1, &p1 };
+	SimplePtr changed = { &p2, &p2 };
+	SimplePtr split = { &p1, &p2 };
+	SimplePtr null = { 0x0, &p1 };
+	diff_and_apply( shared, changed );
+	diff_and_apply( shared, split );
+	diff_and_apply( split, shared );
+	diff_and_apply( shared, null );
+	diff_and_apply( null, shared );
+
+	PtrChain c3 = { 3, 0x0 };
+	PtrChain c2 = { 2, &c3 };
+	PtrChain c1 = { 1, &c2 };
+	PtrChain n4 = { 4, 0x0 };
+	PtrChain n3 = { 3, &n4 };
+	PtrChain n2 = { 5, &n3 };
+	PtrChain n1 = { 1, &n2 };
+	diff_and_apply( c1, n1 );
+	diff_and_apply( n1, c1 );
+
+	// ... circular ...
+	c3.Next = &c1;
+	n4.Next = &n2;
+	diff_and_apply( c1, n1 );
+	diff_and_apply( n1, c1 );
+}
+
+TEST_F( DLDiff, unions )
+{
+	test_union_simple u1;
+	memset( &u1, 0x0, sizeof( u1 ) );
+	u1.type        = test_union_simple_type_item1;
+	u1.value.item1 = 1337;
+
+	test_union_simple u2;
+	memset( &u2, 0x0, sizeof( u2 ) );
+	u2.type        = test_union_simple_type_item1;
+	u2.value.item1 = 4711;
+	diff_and_apply( u1, u2 );
+
+	test_union_simple u3;
+	memset( &u3, 0x0, sizeof( u3 ) );
+	u3.type            = test_union_simple_type_item3;
+	u3.value.item3.i8  = 1;
+	u3.value.item3.f64 = 2.0;
+	diff_and_apply( u1, u3 );
+	diff_and_apply( u3, u1 );
+
+	// ... switching to a member that is 0 is still a change ...
+	test_union_simple u4;
+	memset( &u4, 0x0, sizeof( u4 ) );
+	u4.type = test_union_simple_type_item2;
+	diff_and_apply( u1, u4 );
+}
+
+TEST_F( DLDiff, bitfields )
+{
+	TestBits b1;
+	memset( &b1, 0x0, sizeof( b1 ) );
+	b1.Bit1 = 1;
+	b1.Bit4 = 1;
+	TestBits b2 = b1;
+	b2.Bit3 = 5;
+	b2.Bit6 = 3;
+	diff_and_apply( b1, b2 );
+}
+
+TEST_F( DLDiff, errors )
+{
+	Pods p1;
+	memset( &p1, 0x0, sizeof( p1 ) );
+	Pods p2 = p1;
+	p2.i32 = 1;
+	std::vector<unsigned char> patch = diff( p1, p2 );
+
+	unsigned char out[1024];
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_MISMATCH,  dl_instance_apply_diff( Ctx, Pods2::TYPE_ID, &p1, &patch[0], patch.size(), out, sizeof( out ), 0x0 ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_apply_diff( Ctx, Pods::TYPE_ID,  &p1, &patch[0], patch.size() - 1, out, sizeof( out ), 0x0 ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_apply_diff( Ctx, Pods::TYPE_ID,  &p1, &patch[0], 4, out, sizeof( out ), 0x0 ) );
+
+	std::vector<unsigned char> trailing( patch );
+	trailing.push_back( 0 );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_apply_diff( Ctx, Pods::TYPE_ID, &p1, &trailing[0], trailing.size(), out, sizeof( out ), 0x0 ) );
+
+	std::vector<unsigned char> bad_member( patch );
+	bad_member[ bad_member.size() - 1 - sizeof( p2.i32 ) - 1 ] = 100;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_apply_diff( Ctx, Pods::TYPE_ID, &p1, &bad_member[0], bad_member.size(), out, sizeof( out ), 0x0 ) );
+
+	unsigned char small[4];
+	EXPECT_DL_ERR_EQ( DL_ERROR_BUFFER_TOO_SMALL, dl_instance_diff( Ctx, Pods::TYPE_ID, &p1, &p2, small, sizeof( small ), 0x0 ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_NOT_FOUND,   dl_instance_diff( Ctx, 0x12345678, &p1, &p2, 0x0, 0, 0x0 ) );
+}
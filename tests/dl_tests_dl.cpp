@@ -11,6 +11,7 @@
 #include <dl/dl.h>
 #include <dl/dl_txt.h>
 #include <dl/dl_convert.h>
+#include <dl/dl_typelib.h>
 
 #include "dl_test_common.h"
 
@@ -370,6 +371,79 @@ TEST_F( DL, lots_of_members )
 	EXPECT_EQ(0, memcmp(loaded, &t1, sizeof(t1)));
 }
 
+struct dl_test_counting_alloc
+{
+	int allocs;
+	int frees;
+};
+
+static void* dl_test_counting_alloc_func( size_t size, void* alloc_ctx )
+{
+	++( (dl_test_counting_alloc*)alloc_ctx )->allocs;
+	return malloc( size );
+}
+
+static void dl_test_counting_free_func( void* ptr, void* alloc_ctx )
+{
+	++( (dl_test_counting_alloc*)alloc_ctx )->frees;
+	free( ptr );
+}
+
+TEST_F( DL, frozen_ctx_and_workspaces )
+{
+	dl_ctx_t ws;
+	EXPECT_DL_ERR_EQ( DL_ERROR_UNSUPPORTED_OPERATION, dl_context_create_workspace( this->Ctx, 0x0, &ws ) );
+
+	EXPECT_DL_ERR_OK( dl_context_freeze( this->Ctx ) );
+
+	static const unsigned char typelib[] = {
+		#include "generated/small.bin.h"
+	};
+	EXPECT_DL_ERR_EQ( DL_ERROR_UNSUPPORTED_OPERATION, dl_context_load_type_library( this->Ctx, typelib, sizeof(typelib) ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_UNSUPPORTED_OPERATION, dl_context_load_txt_type_library( this->Ctx, "{}", 2 ) );
+
+	dl_test_counting_alloc counters[2] = { { 0, 0 }, { 0, 0 } };
+	dl_ctx_t workspaces[2];
+	for( int i = 0; i < 2; ++i )
+	{
+		dl_create_params_t p;
+		DL_CREATE_PARAMS_SET_DEFAULT(p);
+		p.alloc_func = dl_test_counting_alloc_func;
+		p.free_func  = dl_test_counting_free_func;
+		p.alloc_ctx  = &counters[i];
+		EXPECT_DL_ERR_OK( dl_context_create_workspace( this->Ctx, &p, &workspaces[i] ) );
+		EXPECT_GT( counters[i].allocs, 0 );
+	}
+
+	// ... workspaces are frozen as well ...
+	EXPECT_DL_ERR_EQ( DL_ERROR_UNSUPPORTED_OPERATION, dl_context_load_type_library( workspaces[0], typelib, sizeof(typelib) ) );
+
+	// ... and all of them should be usable interleaved with each other and the frozen ctx ...
+	dl_ctx_t ctxs[] = { workspaces[0], this->Ctx, workspaces[1] };
+	for( unsigned int i = 0; i < DL_ARRAY_LENGTH(ctxs); ++i )
+	{
+		bug_with_substr t1 = { "str1", { "str2" } };
+		unsigned char packed_instance[256];
+		size_t pack_size;
+		EXPECT_DL_ERR_OK( dl_instance_store( ctxs[i], bug_with_substr::TYPE_ID, (void**)(void*)&t1, packed_instance, sizeof( packed_instance ), &pack_size ) );
+
+		char txt[256];
+		EXPECT_DL_ERR_OK( dl_txt_unpack( ctxs[i], bug_with_substr::TYPE_ID, packed_instance, pack_size, txt, sizeof(txt), 0x0 ) );
+		EXPECT_DL_ERR_OK( dl_txt_pack( ctxs[i], txt, packed_instance, sizeof( packed_instance ), &pack_size ) );
+
+		bug_with_substr* loaded;
+		EXPECT_DL_ERR_OK( dl_instance_load_inplace( ctxs[i], bug_with_substr::TYPE_ID, packed_instance, pack_size, (void**)(void*)&loaded, 0x0 ) );
+		EXPECT_STREQ( t1.str, loaded->str );
+		EXPECT_STREQ( t1.sub.str, loaded->sub.str );
+	}
+
+	for( int i = 0; i < 2; ++i )
+	{
+		EXPECT_DL_ERR_OK( dl_context_destroy( workspaces[i] ) );
+		EXPECT_EQ( counters[i].allocs, counters[i].frees );
+	}
+}
+
 int main(int argc, char **argv)
 {
 	::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,155 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include <gtest/gtest.h>
+
+#include <dl/dl.h>
+
+#include "dl_test_common.h"
+
+#include <vector>
+
+class DLHash : public DL
+{
+public:
+	template <typename T>
+	uint64_t hash( const T& inst )
+	{
+		uint64_t result = 0;
+		EXPECT_DL_ERR_OK( dl_instance_hash( Ctx, T::TYPE_ID, &inst, &result ) );
+
+		// ... the packed instance should always hash the same as the loaded ...
+		size_t size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_store( Ctx, T::TYPE_ID, &inst, 0x0, 0, &size ) );
+		std::vector<unsigned char> packed( size );
+		EXPECT_DL_ERR_OK( dl_instance_store( Ctx, T::TYPE_ID, &inst, &packed[0], size, 0x0 ) );
+		uint64_t packed_result = 0;
+		EXPECT_DL_ERR_OK( dl_instance_hash_packed( Ctx, T::TYPE_ID, &packed[0], size, &packed_result ) );
+		EXPECT_EQ( result, packed_result );
+		return result;
+	}
+};
+
+TEST_F( DLHash, pods )
+{
+	Pods p1, p2;
+	memset( &p1, 0x00, sizeof( p1 ) );
+	memset( &p2, 0xFF, sizeof( p2 ) );
+	p1.i8 = p2.i8 = -1; p1.i16 = p2.i16 = 2; p1.i32 = p2.i32 = 3; p1.i64 = p2.i64 = 4;
+	p1.u8 = p2.u8 = 5;  p1.u16 = p2.u16 = 6; p1.u32 = p2.u32 = 7; p1.u64 = p2.u64 = 8;
+	p1.f32 = p2.f32 = 9.0f; p1.f64 = p2.f64 = 10.0;
+
+	// ... padding is not part of the hash ...
+	uint64_t h1 = hash( p1 );
+	EXPECT_EQ( h1, hash( p2 ) );
+
+	// ... the hash is stable, between runs and platforms ...
+	EXPECT_EQ( 0x966BB31675992D9BULL, h1 );
+
+	p2.u64 = 9;
+	EXPECT_NE( h1, hash( p2 ) );
+
+	p2.u64 = p1.u64;
+	p1.f64 = 0.0;
+	p2.f64 = -0.0;
+	EXPECT_EQ( hash( p1 ), hash( p2 ) );
+}
+
+TEST_F( DLHash, bitfields )
+{
+	TestBits b1, b2;
+	memset( &b1, 0x00, sizeof( b1 ) );
+	memset( &b2, 0x00, sizeof( b2 ) );
+	b1.Bit1 = 1; b1.Bit5 = 1;
+	b2.Bit1 = 1; b2.Bit5 = 1;
+	EXPECT_EQ( hash( b1 ), hash( b2 ) );
+
+	b2.Bit5 = 2;
+	EXPECT_NE( hash( b1 ), hash( b2 ) );
+}
+
+TEST_F( DLHash, strings )
+{
+	char apa[] = "apa";
+	const char* strings1[] = { "apa", "kossa", "apa", 0x0 };
+	const char* strings2[] = { apa, "kossa", "apa", 0x0 };
+	StringArray s1 = { { strings1, DL_ARRAY_LENGTH( strings1 ) } };
+	StringArray s2 = { { strings2, DL_ARRAY_LENGTH( strings2 ) } };
+	EXPECT_EQ( hash( s1 ), hash( s2 ) );
+
+	// ... moving characters between strings change the hash ...
+	strings2[0] = "apak";
+	strings2[1] = "ossa";
+	EXPECT_NE( hash( s1 ), hash( s2 ) );
+
+	strings2[0] = "apa";
+	strings2[1] = "kossa";
+	strings2[3] = "";
+	EXPECT_NE( hash( s1 ), hash( s2 ) );
+
+	s2.Strings.count = 3;
+	EXPECT_NE( hash( s1 ), hash( s2 ) );
+}
+
+TEST_F( DLHash, ptrs_and_cycles )
+{
+	DoublePtrChain a1, a2, a3;
+	a1.Int = 1; a1.Next = &a2; a1.Prev = 0x0;
+	a2.Int = 2; a2.Next = &a3; a2.Prev = &a1;
+	a3.Int = 3; a3.Next = 0x0; a3.Prev = &a2;
+
+	DoublePtrChain b1, b2, b3;
+	b1 = a1; b1.Next = &b2;
+	b2 = a2; b2.Next = &b3; b2.Prev = &b1;
+	b3 = a3; b3.Prev = &b2;
+
+	uint64_t h = hash( a1 );
+	EXPECT_EQ( h, hash( b1 ) );
+
+	// ... a ptr to an already reached struct hash different from a ptr to an equal copy of it ...
+	DoublePtrChain b2_copy = b2;
+	b3.Prev = &b2_copy;
+	EXPECT_NE( h, hash( b1 ) );
+
+	b3.Prev = &b2;
+	b3.Int  = 4;
+	EXPECT_NE( h, hash( b1 ) );
+}
+
+TEST_F( DLHash, unions )
+{
+	test_union_simple u1;
+	memset( &u1, 0x0, sizeof( u1 ) );
+	u1.type        = test_union_simple_type_item1;
+	u1.value.item1 = 1337;
+
+	test_union_simple u2;
+	memset( &u2, 0xFF, sizeof( u2 ) );
+	u2.type        = test_union_simple_type_item1;
+	u2.value.item1 = 1337;
+	EXPECT_EQ( hash( u1 ), hash( u2 ) );
+
+	u2.type = (test_union_simple_type)0xFFFFFF;
+	uint64_t result;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_hash( Ctx, test_union_simple::TYPE_ID, &u2, &result ) );
+}
+
+TEST_F( DLHash, packed_errors )
+{
+	const char* strings[] = { "apa", "kossa" };
+	StringArray s = { { strings, DL_ARRAY_LENGTH( strings ) } };
+
+	size_t size = 0;
+	EXPECT_DL_ERR_OK( dl_instance_store( Ctx, StringArray::TYPE_ID, &s, 0x0, 0, &size ) );
+	std::vector<unsigned char> packed( size );
+	EXPECT_DL_ERR_OK( dl_instance_store( Ctx, StringArray::TYPE_ID, &s, &packed[0], size, 0x0 ) );
+
+	uint64_t result;
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_MISMATCH,  dl_instance_hash_packed( Ctx, Pods::TYPE_ID, &packed[0], size, &result ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_hash_packed( Ctx, StringArray::TYPE_ID, &packed[0], size - 1, &result ) );
+
+	// ... an array pointing outside of the instance ...
+	uintptr_t* data = (uintptr_t*)&packed[size - sizeof( "apa" ) - sizeof( "kossa" ) - 2 * sizeof( void* ) - sizeof( StringArray )];
+	EXPECT_LT( ( *data & 0xFFFF ) - 1, size );
+	*data = 0xFFFF;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_hash_packed( Ctx, StringArray::TYPE_ID, &packed[0], size, &result ) );
+}
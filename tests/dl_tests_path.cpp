@@ -0,0 +1,374 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include <gtest/gtest.h>
+
+#include <dl/dl.h>
+#include <dl/dl_path.h>
+
+#include "dl_test_common.h"
+
+#include <vector>
+
+class DLPath : public DL
+{
+public:
+	std::vector<unsigned char> packed;
+	std::vector<uint64_t>      loaded; // uint64_t to get the buffer aligned.
+
+	template <typename T>
+	void store( const T& inst )
+	{
+		size_t size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_store( Ctx, T::TYPE_ID, &inst, 0x0, 0, &size ) );
+		packed.resize( size );
+		EXPECT_DL_ERR_OK( dl_instance_store( Ctx, T::TYPE_ID, &inst, &packed[0], packed.size(), 0x0 ) );
+	}
+
+	template <typename V>
+	const V* load( dl_typeid_t type, const char* path, size_t* produced = 0x0 )
+	{
+		size_t size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_load_path( Ctx, type, path, 0x0, 0, &packed[0], packed.size(), &size ) );
+		EXPECT_LE( sizeof( V ), size );
+		loaded.assign( size / sizeof( uint64_t ) + 1, 0 );
+		EXPECT_DL_ERR_OK( dl_instance_load_path( Ctx, type, path, &loaded[0], size, &packed[0], packed.size(), produced ) );
+		return (const V*)&loaded[0];
+	}
+
+	dl_path_t compile( dl_typeid_t type, const char* path )
+	{
+		dl_path_t compiled = 0x0;
+		EXPECT_DL_ERR_OK( dl_path_compile( Ctx, type, path, &compiled ) );
+		return compiled;
+	}
+
+	dl_error_t compile_err( dl_typeid_t type, const char* path )
+	{
+		dl_path_t compiled = 0x0;
+		dl_error_t err = dl_path_compile( Ctx, type, path, &compiled );
+		if( err == DL_ERROR_OK )
+			EXPECT_DL_ERR_OK( dl_path_destroy( compiled ) );
+		return err;
+	}
+
+	dl_error_t load_err( dl_typeid_t type, const char* path )
+	{
+		uint64_t out[64];
+		return dl_instance_load_path( Ctx, type, path, out, sizeof( out ), &packed[0], packed.size(), 0x0 );
+	}
+};
+
+TEST_F( DLPath, struct_members )
+{
+	Pod2InStructInStruct inst = { { { 1, 2 }, { 3, 4 } } };
+	store( inst );
+
+	size_t produced = 0;
+	EXPECT_EQ( 4u, *load<uint32_t>( Pod2InStructInStruct::TYPE_ID, "p2struct.Pod2.Int2", &produced ) );
+	EXPECT_EQ( sizeof( uint32_t ), produced );
+
+	const Pods2* pod1 = load<Pods2>( Pod2InStructInStruct::TYPE_ID, "p2struct.Pod1", &produced );
+	EXPECT_EQ( sizeof( Pods2 ), produced );
+	EXPECT_EQ( 1u, pod1->Int1 );
+	EXPECT_EQ( 2u, pod1->Int2 );
+
+	// ... empty path is the entire instance ...
+	const Pod2InStructInStruct* all = load<Pod2InStructInStruct>( Pod2InStructInStruct::TYPE_ID, "" );
+	EXPECT_EQ( 4u, all->p2struct.Pod2.Int2 );
+}
+
+TEST_F( DLPath, arrays )
+{
+	uint32_t arr1[] = { 1, 2 };
+	uint32_t arr2[] = { 3, 4, 5, 6 };
+	PodArray1 sub[] = { { { arr1, DL_ARRAY_LENGTH( arr1 ) } }, { { arr2, DL_ARRAY_LENGTH( arr2 ) } } };
+	PodArray2 inst  = { { sub, DL_ARRAY_LENGTH( sub ) } };
+	store( inst );
+
+	size_t all_size = 0;
+	size_t produced = 0;
+	EXPECT_DL_ERR_OK( dl_instance_load_path( Ctx, PodArray2::TYPE_ID, "", 0x0, 0, &packed[0], packed.size(), &all_size ) );
+
+	EXPECT_EQ( 5u, *load<uint32_t>( PodArray2::TYPE_ID, "sub_arr[1].u32_arr[2]", &produced ) );
+	EXPECT_EQ( sizeof( uint32_t ), produced );
+
+	// ... only the selected element and its array is loaded ...
+	const PodArray1* elem = load<PodArray1>( PodArray2::TYPE_ID, "sub_arr[1]", &produced );
+	EXPECT_LT( produced, all_size );
+	EXPECT_EQ( 4u, elem->u32_arr.count );
+	EXPECT_EQ( (const uint8_t*)&loaded[0] + sizeof( PodArray1 ), (const uint8_t*)elem->u32_arr.data );
+	EXPECT_EQ( 3u, elem->u32_arr[0] );
+	EXPECT_EQ( 6u, elem->u32_arr[3] );
+
+	// ... the array-member itself ...
+	const PodArray2* whole = load<PodArray2>( PodArray2::TYPE_ID, "sub_arr" ); // PodArray2 has only the array-member.
+	EXPECT_EQ( 2u, whole->sub_arr.count );
+	EXPECT_EQ( 2u, whole->sub_arr[0].u32_arr[1] );
+	EXPECT_EQ( 4u, whole->sub_arr[1].u32_arr[1] );
+
+	EXPECT_DL_ERR_EQ( DL_ERROR_MEMBER_NOT_FOUND, load_err( PodArray2::TYPE_ID, "sub_arr[2]" ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MEMBER_NOT_FOUND, load_err( PodArray2::TYPE_ID, "sub_arr[0].u32_arr[2]" ) );
+
+	Pods2 pods[3] = { { 1, 2 }, { 3, 4 }, { 5, 6 } };
+	WithInlineStructArray inl;
+	memcpy( inl.Array, pods, sizeof( pods ) );
+	store( inl );
+	EXPECT_EQ( 5u, *load<uint32_t>( WithInlineStructArray::TYPE_ID, "Array[2].Int1" ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MEMBER_NOT_FOUND, load_err( WithInlineStructArray::TYPE_ID, "Array[3].Int1" ) );
+}
+
+TEST_F( DLPath, strings )
+{
+	InlineArrayWithSubString inst = { { { "apa" }, { "kossa" } } };
+	store( inst );
+
+	size_t produced = 0;
+	const char* const* str = load<const char*>( InlineArrayWithSubString::TYPE_ID, "Array[1].Str", &produced );
+	EXPECT_STREQ( "kossa", *str );
+	EXPECT_EQ( sizeof( char* ) + sizeof( "kossa" ), produced );
+}
+
+TEST_F( DLPath, ptrs )
+{
+	DoublePtrChain ptr1 = { 1, 0x0,   0x0 };
+	DoublePtrChain ptr2 = { 2, &ptr1, 0x0 };
+	DoublePtrChain ptr3 = { 3, &ptr2, 0x0 };
+	ptr1.Prev = &ptr2;
+	ptr2.Prev = &ptr3;
+	store( ptr3 );
+
+	EXPECT_EQ( 1u, *load<uint32_t>( DoublePtrChain::TYPE_ID, "Next.Next.Int" ) );
+
+	// ... a ptr-member is loaded as the ptr followed by the struct it point to ...
+	const DoublePtrChain* next = *load<DoublePtrChain*>( DoublePtrChain::TYPE_ID, "Next" );
+	EXPECT_EQ( (const uint8_t*)&loaded[0] + sizeof( void* ), (const uint8_t*)next );
+	EXPECT_EQ( 2u, next->Int );
+	EXPECT_EQ( 1u, next->Next->Int );
+	EXPECT_EQ( next, next->Next->Prev );
+	EXPECT_EQ( 3u, next->Prev->Int );
+	EXPECT_EQ( next, next->Prev->Next );
+
+	EXPECT_DL_ERR_EQ( DL_ERROR_MEMBER_NOT_FOUND, load_err( DoublePtrChain::TYPE_ID, "Next.Next.Next.Int" ) );
+}
+
+TEST_F( DLPath, unions )
+{
+	test_union_simple inst;
+	memset( &inst, 0x0, sizeof( inst ) );
+	inst.type = test_union_simple_type_item3;
+	inst.value.item3.i32 = 1337;
+	store( inst );
+
+	EXPECT_EQ( 1337, *load<int32_t>( test_union_simple::TYPE_ID, "item3.i32" ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MEMBER_NOT_FOUND, load_err( test_union_simple::TYPE_ID, "item1" ) );
+}
+
+TEST_F( DLPath, errors )
+{
+	Pod2InStructInStruct inst = { { { 1, 2 }, { 3, 4 } } };
+	store( inst );
+
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, load_err( Pod2InStructInStruct::TYPE_ID, "p2struct..Pod1" ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, load_err( Pod2InStructInStruct::TYPE_ID, "p2struct." ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, load_err( Pod2InStructInStruct::TYPE_ID, ".p2struct" ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, load_err( Pod2InStructInStruct::TYPE_ID, "p2struct[1" ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MEMBER_NOT_FOUND,  load_err( Pod2InStructInStruct::TYPE_ID, "p2struct[0]" ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MEMBER_NOT_FOUND,  load_err( Pod2InStructInStruct::TYPE_ID, "p2struct.Pod3" ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MEMBER_NOT_FOUND,  load_err( Pod2InStructInStruct::TYPE_ID, "p2struct.Pod1.Int1.Int2" ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_MISMATCH,     load_err( Pods2::TYPE_ID, "Int1" ) );
+
+	uint32_t out[2];
+	size_t produced = 0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_BUFFER_TOO_SMALL, dl_instance_load_path( Ctx, Pod2InStructInStruct::TYPE_ID, "p2struct.Pod1", out, sizeof( uint32_t ), &packed[0], packed.size(), &produced ) );
+	EXPECT_EQ( sizeof( Pods2 ), produced );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_load_path( Ctx, Pod2InStructInStruct::TYPE_ID, "p2struct.Pod1", out, sizeof( out ), &packed[0], packed.size() - 1, 0x0 ) );
+}
+
+TEST_F( DLPath, unaligned_offsets )
+{
+	DoublePtrChain ptr1 = { 1, 0x0,   0x0 };
+	DoublePtrChain ptr2 = { 2, &ptr1, 0x0 };
+	DoublePtrChain ptr3 = { 3, &ptr2, &ptr1 };
+	ptr1.Prev = &ptr2;
+	ptr2.Prev = &ptr3;
+	store( ptr3 );
+
+	// ... find the root by loading a copy and move the offset in root.Next one byte so that it is unaligned ...
+	std::vector<unsigned char> copy( packed );
+	DoublePtrChain* root = 0x0;
+	ASSERT_DL_ERR_OK( dl_instance_load_inplace( Ctx, DoublePtrChain::TYPE_ID, &copy[0], copy.size(), (void**)&root, 0x0 ) );
+	size_t next_pos = (size_t)( (unsigned char*)&root->Next - &copy[0] );
+	packed[next_pos] = (unsigned char)( packed[next_pos] + 1 );
+
+	// ... the path loader do not validate the instance, it should read the moved struct without unaligned loads and
+	//     either load it or report it as malformed ...
+	EXPECT_DL_ERR_OK( load_err( DoublePtrChain::TYPE_ID, "Next.Int" ) );
+	dl_error_t err = load_err( DoublePtrChain::TYPE_ID, "Next" );
+	EXPECT_TRUE( err == DL_ERROR_OK || err == DL_ERROR_MALFORMED_DATA ) << dl_error_to_string( err );
+	err = load_err( DoublePtrChain::TYPE_ID, "Next.Next.Int" );
+	EXPECT_TRUE( err == DL_ERROR_OK || err == DL_ERROR_MALFORMED_DATA || err == DL_ERROR_MEMBER_NOT_FOUND ) << dl_error_to_string( err );
+
+	uint32_t arr1[] = { 1, 2 };
+	uint32_t arr2[] = { 3, 4, 5, 6 };
+	PodArray1 sub[] = { { { arr1, DL_ARRAY_LENGTH( arr1 ) } }, { { arr2, DL_ARRAY_LENGTH( arr2 ) } } };
+	PodArray2 inst  = { { sub, DL_ARRAY_LENGTH( sub ) } };
+	store( inst );
+
+	copy = packed;
+	PodArray2* arr_root = 0x0;
+	ASSERT_DL_ERR_OK( dl_instance_load_inplace( Ctx, PodArray2::TYPE_ID, &copy[0], copy.size(), (void**)&arr_root, 0x0 ) );
+	size_t arr_pos = (size_t)( (unsigned char*)&arr_root->sub_arr.data - &copy[0] );
+	packed[arr_pos] = (unsigned char)( packed[arr_pos] + 1 );
+
+	err = load_err( PodArray2::TYPE_ID, "sub_arr[1].u32_arr[0]" );
+	EXPECT_TRUE( err == DL_ERROR_OK || err == DL_ERROR_MALFORMED_DATA || err == DL_ERROR_MEMBER_NOT_FOUND ) << dl_error_to_string( err );
+	err = load_err( PodArray2::TYPE_ID, "sub_arr" );
+	EXPECT_TRUE( err == DL_ERROR_OK || err == DL_ERROR_MALFORMED_DATA ) << dl_error_to_string( err );
+}
+
+TEST_F( DLPath, compiled_pods )
+{
+	Pod2InStructInStruct inst = { { { 1, 2 }, { 3, 4 } } };
+	dl_path_t path = compile( Pod2InStructInStruct::TYPE_ID, "p2struct.Pod2.Int2" );
+
+	dl_path_info_t info;
+	EXPECT_DL_ERR_OK( dl_path_get_info( path, &info ) );
+	EXPECT_EQ( DL_TYPE_ATOM_POD,       info.atom );
+	EXPECT_EQ( DL_TYPE_STORAGE_UINT32, info.storage );
+	EXPECT_EQ( sizeof( uint32_t ),     info.size );
+
+	EXPECT_EQ( &inst.p2struct.Pod2.Int2, dl_path_resolve( path, &inst ) );
+
+	int64_t  i64 = 0;
+	uint64_t u64 = 0;
+	EXPECT_DL_ERR_OK( dl_path_get_int64( path, &inst, &i64 ) );
+	EXPECT_EQ( 4, i64 );
+	EXPECT_DL_ERR_OK( dl_path_set_uint64( path, &inst, 0xFFFFFFFF ) );
+	EXPECT_EQ( 0xFFFFFFFFu, inst.p2struct.Pod2.Int2 );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_path_set_uint64( path, &inst, 0x100000000ULL ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_path_set_int64( path, &inst, -1 ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_MISMATCH,     dl_path_set_fp64( path, &inst, 1.0 ) );
+	EXPECT_DL_ERR_OK( dl_path_destroy( path ) );
+
+	Pods pods;
+	memset( &pods, 0x0, sizeof( pods ) );
+	pods.i8  = -7;
+	pods.f32 = 1.5f;
+	path = compile( Pods::TYPE_ID, "i8" );
+	EXPECT_DL_ERR_OK( dl_path_get_int64( path, &pods, &i64 ) );
+	EXPECT_EQ( -7, i64 );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_path_get_uint64( path, &pods, &u64 ) );
+	EXPECT_DL_ERR_OK( dl_path_set_int64( path, &pods, -128 ) );
+	EXPECT_EQ( -128, pods.i8 );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_path_set_int64( path, &pods, -129 ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_path_set_int64( path, &pods, 128 ) );
+	EXPECT_DL_ERR_OK( dl_path_destroy( path ) );
+
+	path = compile( Pods::TYPE_ID, "f32" );
+	double f64 = 0.0;
+	EXPECT_DL_ERR_OK( dl_path_get_fp64( path, &pods, &f64 ) );
+	EXPECT_EQ( 1.5, f64 );
+	EXPECT_DL_ERR_OK( dl_path_set_fp64( path, &pods, 2.25 ) );
+	EXPECT_EQ( 2.25f, pods.f32 );
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_MISMATCH, dl_path_get_int64( path, &pods, &i64 ) );
+	EXPECT_DL_ERR_OK( dl_path_destroy( path ) );
+}
+
+TEST_F( DLPath, compiled_bitfields_and_enums )
+{
+	TestBits bits;
+	memset( &bits, 0x0, sizeof( bits ) );
+	bits.Bit3 = 5;
+	bits.Bit6 = 2;
+
+	dl_path_t path = compile( TestBits::TYPE_ID, "Bit3" );
+	uint64_t value = 0;
+	EXPECT_DL_ERR_OK( dl_path_get_uint64( path, &bits, &value ) );
+	EXPECT_EQ( 5u, value );
+	EXPECT_DL_ERR_OK( dl_path_set_uint64( path, &bits, 7 ) );
+	EXPECT_EQ( 7u, bits.Bit3 );
+	EXPECT_EQ( 0u, bits.Bit2 );
+	EXPECT_EQ( 0u, bits.Bit1 );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_path_set_uint64( path, &bits, 8 ) );
+	EXPECT_DL_ERR_OK( dl_path_destroy( path ) );
+
+	path = compile( TestBits::TYPE_ID, "Bit6" );
+	EXPECT_DL_ERR_OK( dl_path_get_uint64( path, &bits, &value ) );
+	EXPECT_EQ( 2u, value );
+	EXPECT_DL_ERR_OK( dl_path_destroy( path ) );
+
+	TestingEnum e = { TESTENUM1_VALUE3 };
+	path = compile( TestingEnum::TYPE_ID, "TheEnum" );
+	dl_path_info_t info;
+	EXPECT_DL_ERR_OK( dl_path_get_info( path, &info ) );
+	EXPECT_NE( 0u, info.type_id );
+	EXPECT_DL_ERR_OK( dl_path_get_uint64( path, &e, &value ) );
+	EXPECT_EQ( (uint64_t)TESTENUM1_VALUE3, value );
+	EXPECT_DL_ERR_OK( dl_path_set_uint64( path, &e, TESTENUM1_VALUE4 ) );
+	EXPECT_EQ( TESTENUM1_VALUE4, e.TheEnum );
+	EXPECT_DL_ERR_OK( dl_path_destroy( path ) );
+}
+
+TEST_F( DLPath, compiled_arrays_ptrs_and_unions )
+{
+	uint32_t arr1[] = { 1, 2 };
+	uint32_t arr2[] = { 3, 4, 5, 6 };
+	PodArray1 sub[] = { { { arr1, DL_ARRAY_LENGTH( arr1 ) } }, { { arr2, DL_ARRAY_LENGTH( arr2 ) } } };
+	PodArray2 arrays = { { sub, DL_ARRAY_LENGTH( sub ) } };
+
+	dl_path_t path = compile( PodArray2::TYPE_ID, "sub_arr[1].u32_arr[2]" );
+	EXPECT_EQ( &arr2[2], dl_path_resolve( path, &arrays ) );
+	sub[1].u32_arr.count = 2;
+	EXPECT_EQ( 0x0, dl_path_resolve( path, &arrays ) );
+	int64_t value = 0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MEMBER_NOT_FOUND, dl_path_get_int64( path, &arrays, &value ) );
+	EXPECT_DL_ERR_OK( dl_path_destroy( path ) );
+
+	InlineArrayWithSubString strs = { { { "apa" }, { "kossa" } } };
+	path = compile( InlineArrayWithSubString::TYPE_ID, "Array[1].Str" );
+	const char* str = 0x0;
+	EXPECT_DL_ERR_OK( dl_path_get_str( path, &strs, &str ) );
+	EXPECT_STREQ( "kossa", str );
+	EXPECT_DL_ERR_OK( dl_path_set_str( path, &strs, "bulle" ) );
+	EXPECT_STREQ( "bulle", strs.Array[1].Str );
+	EXPECT_DL_ERR_OK( dl_path_destroy( path ) );
+
+	path = compile( WithInlineStructArray::TYPE_ID, "Array" );
+	dl_path_info_t info;
+	EXPECT_DL_ERR_OK( dl_path_get_info( path, &info ) );
+	EXPECT_EQ( DL_TYPE_ATOM_INLINE_ARRAY, info.atom );
+	EXPECT_EQ( DL_TYPE_STORAGE_STRUCT,    info.storage );
+	EXPECT_EQ( Pods2::TYPE_ID,            info.type_id );
+	EXPECT_EQ( 3u,                        info.array_count );
+	EXPECT_DL_ERR_OK( dl_path_destroy( path ) );
+
+	DoublePtrChain ptr1 = { 1, 0x0,   0x0 };
+	DoublePtrChain ptr2 = { 2, &ptr1, 0x0 };
+	path = compile( DoublePtrChain::TYPE_ID, "Next.Int" );
+	EXPECT_EQ( &ptr1.Int, dl_path_resolve( path, &ptr2 ) );
+	EXPECT_EQ( 0x0, dl_path_resolve( path, &ptr1 ) );
+	EXPECT_DL_ERR_OK( dl_path_destroy( path ) );
+
+	test_union_simple u;
+	memset( &u, 0x0, sizeof( u ) );
+	u.type = test_union_simple_type_item3;
+	u.value.item3.u16 = 17;
+	path = compile( test_union_simple::TYPE_ID, "item3.u16" );
+	EXPECT_EQ( &u.value.item3.u16, dl_path_resolve( path, &u ) );
+	u.type = test_union_simple_type_item1;
+	EXPECT_EQ( 0x0, dl_path_resolve( path, &u ) );
+	EXPECT_DL_ERR_OK( dl_path_destroy( path ) );
+}
+
+TEST_F( DLPath, compiled_errors )
+{
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, compile_err( Pod2InStructInStruct::TYPE_ID, "p2struct..Pod1" ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, compile_err( PodArray2::TYPE_ID, "sub_arr[x]" ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, compile_err( PodArray2::TYPE_ID, "sub_arr[99999999999]" ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MEMBER_NOT_FOUND,  compile_err( Pod2InStructInStruct::TYPE_ID, "p2struct.Pod3" ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MEMBER_NOT_FOUND,  compile_err( WithInlineStructArray::TYPE_ID, "Array[3]" ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_NOT_FOUND,    compile_err( 0x12345678, "a" ) );
+
+	// ... indexing arrays is only checked when used ...
+	EXPECT_DL_ERR_OK( compile_err( PodArray2::TYPE_ID, "sub_arr[1000].u32_arr[7]" ) );
+}
@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include "dl_tests_base.h"
+
+#include <dl/dl_convert.h>
+
+#include "generated/unittest.serializers.h"
+
+#include <vector>
+
+// ... copy of size bytes of data in storage aligned to T, 0x0 data gives an aligned buffer of size bytes ...
+template <typename T>
+static unsigned char* dl_serializer_test_aligned( std::vector<unsigned char>& storage, const unsigned char* data, size_t size )
+{
+	storage.resize( size + DL_ALIGNOF( T ) );
+	unsigned char* aligned = &storage[0] + ( DL_ALIGNOF( T ) - (uintptr_t)&storage[0] % DL_ALIGNOF( T ) ) % DL_ALIGNOF( T );
+	if( data != 0x0 )
+		memcpy( aligned, data, size );
+	return aligned;
+}
+
+// ... check that the generated serializer for T produce the same data as the interpreted path in all directions ...
+template <typename T>
+static void dl_serializer_test_instance( dl_ctx_t dl_ctx, const T& inst )
+{
+	size_t interp_size = 0;
+	size_t gen_size    = 0;
+	EXPECT_DL_ERR_OK( dl_instance_calc_size( dl_ctx, T::TYPE_ID, &inst, &interp_size ) );
+	EXPECT_DL_ERR_OK( dl_serializer_calc_size( inst, &gen_size ) );
+	EXPECT_EQ( interp_size, gen_size );
+
+	std::vector<unsigned char> interp( interp_size );
+	std::vector<unsigned char> gen( gen_size );
+	EXPECT_DL_ERR_OK( dl_instance_store( dl_ctx, T::TYPE_ID, &inst, &interp[0], interp.size(), 0x0 ) );
+	size_t produced = 0;
+	EXPECT_DL_ERR_OK( dl_serializer_store( inst, &gen[0], gen.size(), &produced ) );
+	EXPECT_EQ( gen_size, produced );
+	EXPECT_EQ( interp, gen );
+
+	// ... load with generated code and store again with interpreter ...
+	std::vector<unsigned char> loaded_storage;
+	unsigned char* loaded = dl_serializer_test_aligned<T>( loaded_storage, &gen[0], gen.size() );
+	T* loaded_inst = 0x0;
+	size_t consumed = 0;
+	EXPECT_DL_ERR_OK( dl_serializer_load_inplace( loaded, gen.size(), &loaded_inst, &consumed ) );
+	EXPECT_EQ( gen.size(), consumed );
+	std::vector<unsigned char> restored( interp_size );
+	EXPECT_DL_ERR_OK( dl_instance_store( dl_ctx, T::TYPE_ID, loaded_inst, &restored[0], restored.size(), 0x0 ) );
+	EXPECT_EQ( interp, restored );
+
+	// ... swap endian and back ...
+	std::vector<unsigned char> swapped( gen );
+	EXPECT_DL_ERR_OK( dl_serializer_swap_endian<T>( &swapped[0], swapped.size() ) );
+	EXPECT_NE( gen, swapped );
+	std::vector<unsigned char> swapped_twice( swapped );
+	EXPECT_DL_ERR_OK( dl_serializer_swap_endian<T>( &swapped_twice[0], swapped_twice.size() ) );
+	EXPECT_EQ( gen, swapped_twice );
+
+	// ... generated code should swap to the same bytes as the interpreter, dl_convert modify its input so convert a copy ...
+	dl_endian_t other_endian = DL_ENDIAN_HOST == DL_ENDIAN_LITTLE ? DL_ENDIAN_BIG : DL_ENDIAN_LITTLE;
+	std::vector<unsigned char> gen_copy( gen );
+	std::vector<unsigned char> interp_swapped( gen.size() * 2 + 1024 );
+	size_t interp_swapped_size = 0;
+	EXPECT_DL_ERR_OK( dl_convert( dl_ctx, T::TYPE_ID, &gen_copy[0], gen_copy.size(), &interp_swapped[0], interp_swapped.size(), other_endian, sizeof( void* ), &interp_swapped_size ) );
+	EXPECT_EQ( swapped.size(), interp_swapped_size );
+	if( swapped.size() == interp_swapped_size )
+		EXPECT_EQ( 0, memcmp( &swapped[0], &interp_swapped[0], interp_swapped_size ) );
+
+	// ... data swapped by generated code should be readable by the interpreter ...
+	std::vector<unsigned char> converted_storage;
+	size_t converted_capacity = gen.size() * 2 + 1024;
+	unsigned char* converted = dl_serializer_test_aligned<T>( converted_storage, 0x0, converted_capacity );
+	size_t converted_size = 0;
+	EXPECT_DL_ERR_OK( dl_convert( dl_ctx, T::TYPE_ID, &swapped[0], swapped.size(), converted, converted_capacity, DL_ENDIAN_HOST, sizeof( void* ), &converted_size ) );
+	T* converted_inst = 0x0;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace( dl_ctx, T::TYPE_ID, converted, converted_size, (void**)&converted_inst, 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_instance_store( dl_ctx, T::TYPE_ID, converted_inst, &restored[0], restored.size(), 0x0 ) );
+	EXPECT_EQ( interp, restored );
+}
+
+// ... pack txt with the interpreter and test the generated serializer on the loaded instance ...
+template <typename T>
+static void dl_serializer_test_txt( dl_ctx_t dl_ctx, const char* txt )
+{
+	size_t packed_size = 0;
+	EXPECT_DL_ERR_OK( dl_txt_pack( dl_ctx, txt, 0x0, 0, &packed_size ) );
+	std::vector<unsigned char> packed_storage;
+	unsigned char* packed = dl_serializer_test_aligned<T>( packed_storage, 0x0, packed_size );
+	EXPECT_DL_ERR_OK( dl_txt_pack( dl_ctx, txt, packed, packed_size, 0x0 ) );
+
+	T* inst = 0x0;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace( dl_ctx, T::TYPE_ID, packed, packed_size, (void**)&inst, 0x0 ) );
+	if( inst != 0x0 )
+		dl_serializer_test_instance( dl_ctx, *inst );
+}
+
+TEST_F( DL, serializer_pods )
+{
+	Pods p;
+	memset( &p, 0x0, sizeof( p ) );
+	p.i8  = 1;
+	p.i16 = 2;
+	p.i32 = 3;
+	p.i64 = 4;
+	p.u8  = 5;
+	p.u16 = 6;
+	p.u32 = 7;
+	p.u64 = 8;
+	p.f32 = 9.0f;
+	p.f64 = 10.0;
+	dl_serializer_test_instance( Ctx, p );
+
+	dl_serializer_test_txt<A128BitAlignedType>( Ctx, STRINGIFY( { "A128BitAlignedType" : { "Int" : 4711 } } ) );
+}
+
+TEST_F( DL, serializer_ptrs )
+{
+	Pods p;
+	memset( &p, 0x0, sizeof( p ) );
+	p.i32 = 1337;
+
+	SimplePtr shared = { &p, &p };
+	dl_serializer_test_instance( Ctx, shared );
+
+	SimplePtr with_null = { &p, 0x0 };
+	dl_serializer_test_instance( Ctx, with_null );
+
+	PtrChain c3 = { 3, 0x0 };
+	PtrChain c2 = { 2, &c3 };
+	PtrChain c1 = { 1, &c2 };
+	dl_serializer_test_instance( Ctx, c1 );
+
+	// ... circular, the pointer back to the root should point to the root ...
+	c3.Next = &c1;
+	dl_serializer_test_instance( Ctx, c1 );
+}
+
+TEST_F( DL, serializer_strings )
+{
+	Strings s = { "cow", "bells" };
+	dl_serializer_test_instance( Ctx, s );
+
+	// ... equal strings are stored once ...
+	Strings same = { "moo", "moo" };
+	dl_serializer_test_instance( Ctx, same );
+
+	const char* strs[] = { "a", "bb", "a", "ccc" };
+	StringArray arr;
+	arr.Strings.data  = strs;
+	arr.Strings.count = DL_ARRAY_LENGTH( strs );
+	dl_serializer_test_instance( Ctx, arr );
+
+	dl_serializer_test_txt<InlineArrayWithSubString>( Ctx, STRINGIFY( { "InlineArrayWithSubString" : { "Array" : [ { "Str" : "str1" }, { "Str" : "str2" } ] } } ) );
+}
+
+TEST_F( DL, serializer_arrays )
+{
+	dl_serializer_test_txt<StructArray1>( Ctx, STRINGIFY( { "StructArray1" : { "Array" : [ { "Int1" : 1, "Int2" : 2 }, { "Int1" : 3, "Int2" : 4 } ] } } ) );
+	dl_serializer_test_txt<WithInlineStructArray>( Ctx, STRINGIFY( { "WithInlineStructArray" : { "Array" : [ { "Int1" : 1, "Int2" : 2 }, { "Int1" : 3, "Int2" : 4 }, { "Int1" : 5, "Int2" : 6 } ] } } ) );
+	dl_serializer_test_txt<StructArrayRecursive1>( Ctx, STRINGIFY( { "StructArrayRecursive1" : { "Array" : [ { "Array" : [ { "Array" : [] }, { "Array" : [ { "Array" : [] } ] } ] } ] } } ) );
+	dl_serializer_test_txt<test_array_pad>( Ctx, STRINGIFY( { "test_array_pad" : { "components" : [ { "ptr" : [ 1, 2, 3 ], "type" : 1 }, { "ptr" : [ 4 ], "type" : 2 } ] } } ) );
+
+	// ... empty arrays are stored as null ...
+	dl_serializer_test_txt<StructArray1>( Ctx, STRINGIFY( { "StructArray1" : { "Array" : [] } } ) );
+}
+
+TEST_F( DL, serializer_bitfields )
+{
+	dl_serializer_test_txt<TestBits>( Ctx, STRINGIFY( { "TestBits" : { "Bit1" : 1, "Bit2" : 2, "Bit3" : 5, "make_it_uneven" : 7, "Bit4" : 1, "Bit5" : 3, "Bit6" : 6 } } ) );
+	dl_serializer_test_txt<MoreBits>( Ctx, STRINGIFY( { "MoreBits" : { "Bit1" : 512, "Bit2" : 1 } } ) );
+}
+
+TEST_F( DL, serializer_unions )
+{
+	dl_serializer_test_txt<test_union_simple>( Ctx, STRINGIFY( { "test_union_simple" : { "item1" : 1337 } } ) );
+	dl_serializer_test_txt<test_union_simple>( Ctx, STRINGIFY( { "test_union_simple" : { "item3" : { "i8" : 1, "i16" : 2, "i32" : 3, "i64" : 4, "u8" : 5, "u16" : 6, "u32" : 7, "u64" : 8, "f32" : 9, "f64" : 10 } } } ) );
+	dl_serializer_test_txt<test_union_array>( Ctx, STRINGIFY( { "test_union_array" : { "arr" : [ 1, 2, 3, 4 ] } } ) );
+	dl_serializer_test_txt<test_with_union_array>( Ctx, STRINGIFY( { "test_with_union_array" : { "properties" : [ { "floats" : [ 1, 2 ] }, { "ints" : [ 3 ] } ] } } ) );
+}
+
+TEST_F( DL, serializer_load_errors )
+{
+	Pods p;
+	memset( &p, 0x0, sizeof( p ) );
+	std::vector<unsigned char> packed_storage;
+	unsigned char* packed = dl_serializer_test_aligned<Pods>( packed_storage, 0x0, 256 );
+	size_t produced = 0;
+	EXPECT_DL_ERR_OK( dl_serializer_store( p, packed, 256, &produced ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_BUFFER_TOO_SMALL, dl_serializer_store( p, packed, produced - 1, 0x0 ) );
+
+	SimplePtr* wrong_type = 0x0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_MISMATCH, dl_serializer_load_inplace( packed, produced, &wrong_type, 0x0 ) );
+
+	// ... instance_size in the header that do not fit in the packed data ...
+	Pods* truncated = 0x0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_serializer_load_inplace( packed, produced - 1, &truncated, 0x0 ) );
+
+	Pods loaded;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_serializer_load( &loaded, sizeof( loaded ), packed, produced - 1, 0x0 ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_BUFFER_TOO_SMALL, dl_serializer_load( &loaded, sizeof( loaded ) - 1, packed, produced, 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_serializer_load( &loaded, sizeof( loaded ), packed, produced, 0x0 ) );
+	EXPECT_EQ( 0, memcmp( &p, &loaded, sizeof( p ) ) );
+}
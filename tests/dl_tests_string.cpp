@@ -53,3 +53,15 @@ TYPED_TEST(DLBase, escaped_val_in_string)
 	EXPECT_STREQ(Orig.Str1, Loaded[0].Str1);
 	EXPECT_STREQ(Orig.Str2, Loaded[0].Str2);
 }
+
+TYPED_TEST(DLBase, escaped_val_in_long_string)
+{
+	// escapes at, before and after every position in the 8-char blocks scanned when unpacking text.
+	Strings Orig = { "0123456\"89abcde\\ghijklmnopq\nstuvwx'zABCDEFG\tIJKLMNOPQRSTUVWXYZ\"", "\\0123456789abcdefghijklmnopqrstuvwxyz\xc3\xa5\xc3\xa4\xc3\xb6\r" } ;
+	Strings Loaded[64];
+
+	this->do_the_round_about( Strings::TYPE_ID, &Orig, Loaded, sizeof(Loaded) );
+
+	EXPECT_STREQ(Orig.Str1, Loaded[0].Str1);
+	EXPECT_STREQ(Orig.Str2, Loaded[0].Str2);
+}
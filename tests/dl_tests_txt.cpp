@@ -9,6 +9,8 @@
 
 #include <math.h> // isnan
 #include <limits>
+#include <string>
+#include <vector>
 
 #if defined(_MSC_VER)
 #  include <float.h> // isnan
@@ -163,6 +165,30 @@ TEST_F(DLText, default_value_pod)
 	EXPECT_EQ(11.0,  loaded.f64);
 }
 
+TEST_F(DLText, default_value_pod_partially_set)
+{
+	// set members should override the default-template, the rest should keep their defaults.
+
+	const char* text_data = STRINGIFY( { "PodsDefaults" : { "i16" : 33, "u64" : 99, "f32" : 1.5 } } );
+
+	unsigned char out_data_text[1024];
+	PodsDefaults loaded;
+
+	EXPECT_DL_ERR_OK(dl_txt_pack(Ctx, text_data, out_data_text, sizeof(out_data_text), 0x0));
+	EXPECT_DL_ERR_OK(dl_instance_load(Ctx, PodsDefaults::TYPE_ID, &loaded, sizeof(loaded), out_data_text, sizeof(out_data_text), 0x0));
+
+	EXPECT_EQ(2,     loaded.i8);
+	EXPECT_EQ(33,    loaded.i16);
+	EXPECT_EQ(4,     loaded.i32);
+	EXPECT_EQ(5,     loaded.i64);
+	EXPECT_EQ(6u,    loaded.u8);
+	EXPECT_EQ(7u,    loaded.u16);
+	EXPECT_EQ(8u,    loaded.u32);
+	EXPECT_EQ(99u,   loaded.u64);
+	EXPECT_EQ(1.5f,  loaded.f32);
+	EXPECT_EQ(11.0,  loaded.f64);
+}
+
 TEST_F(DLText, default_value_string)
 {
 	// default-values should be set correctly!
@@ -1625,3 +1651,137 @@ TEST_F( DLText, lots_of_members )
 		} 
 	}), DL_ERROR_OK );
 }
+
+TEST_F( DLText, unpack_long_ptr_chain )
+{
+	// unpacking "__subdata" used to recurse once per ptr and search all earlier ptrs, make sure a long chain works.
+	const uint32_t CHAIN_LEN = 4096;
+	std::vector<PtrChain> chain( CHAIN_LEN );
+	for( uint32_t i = 0; i < CHAIN_LEN; ++i )
+	{
+		chain[i].Int  = i;
+		chain[i].Next = i + 1 < CHAIN_LEN ? &chain[i + 1] : &chain[0];
+	}
+
+	size_t packed_size;
+	ASSERT_DL_ERR_OK( dl_instance_calc_size( Ctx, PtrChain::TYPE_ID, &chain[0], &packed_size ) );
+	std::vector<unsigned char> packed( packed_size );
+	ASSERT_DL_ERR_OK( dl_instance_store( Ctx, PtrChain::TYPE_ID, &chain[0], &packed[0], packed_size, 0x0 ) );
+
+	size_t txt_size;
+	ASSERT_DL_ERR_OK( dl_txt_unpack_calc_size( Ctx, PtrChain::TYPE_ID, &packed[0], packed_size, &txt_size ) );
+	std::vector<char> txt( txt_size );
+	ASSERT_DL_ERR_OK( dl_txt_unpack( Ctx, PtrChain::TYPE_ID, &packed[0], packed_size, &txt[0], txt_size, 0x0 ) );
+
+	size_t repacked_size;
+	ASSERT_DL_ERR_OK( dl_txt_pack_calc_size( Ctx, &txt[0], &repacked_size ) );
+	EXPECT_EQ( packed_size, repacked_size );
+	std::vector<unsigned char> repacked( repacked_size );
+	ASSERT_DL_ERR_OK( dl_txt_pack( Ctx, &txt[0], &repacked[0], repacked_size, 0x0 ) );
+
+	PtrChain* loaded;
+	ASSERT_DL_ERR_OK( dl_instance_load_inplace( Ctx, PtrChain::TYPE_ID, &repacked[0], repacked_size, (void**)&loaded, 0x0 ) );
+	const PtrChain* iter = loaded;
+	for( uint32_t i = 0; i < CHAIN_LEN; ++i )
+	{
+		ASSERT_EQ( i, iter->Int );
+		iter = iter->Next;
+	}
+	EXPECT_EQ( loaded, iter );
+}
+
+static void dl_test_parallel_for_reversed( dl_job_func job, void* job_data, unsigned int job_count, void* parallel_ctx )
+{
+	// ... run jobs backwards, output should not depend on job order ...
+	for( unsigned int i = job_count; i > 0; --i )
+		job( job_data, i - 1 );
+	*(unsigned int*)parallel_ctx += job_count;
+}
+
+static void dl_test_pack_with_ctx( dl_ctx_t dl_ctx, const char* txt, dl_error_t expect, std::vector<unsigned char>& out )
+{
+	size_t size = 0;
+	EXPECT_DL_ERR_EQ( expect, dl_txt_pack_calc_size( dl_ctx, txt, &size ) );
+	if( expect != DL_ERROR_OK )
+		return;
+
+	out.assign( size, 0 ); // unwritten padding is left as is in the out-buffer, start with the same content.
+	size_t produced = 0;
+	EXPECT_DL_ERR_OK( dl_txt_pack( dl_ctx, txt, &out[0], out.size(), &produced ) );
+	EXPECT_EQ( size, produced );
+}
+
+TEST_F( DLText, parallel_pack_struct_array )
+{
+	static const unsigned char typelib[] = {
+		#include "generated/unittest.bin.h"
+	};
+
+	dl_ctx_t par_ctx;
+	dl_create_params_t p;
+	DL_CREATE_PARAMS_SET_DEFAULT(p);
+	unsigned int jobs_run = 0;
+	p.parallel_for_func = dl_test_parallel_for_reversed;
+	p.parallel_ctx      = &jobs_run;
+	ASSERT_DL_ERR_OK( dl_context_create( &par_ctx, &p ) );
+	ASSERT_DL_ERR_OK( dl_context_load_type_library( par_ctx, typelib, sizeof(typelib) ) );
+
+	std::string txt = "{ \"parallel_pack_root\" : { \"items\" : [\n";
+	const unsigned int ITEM_COUNT = 1301;
+	char item[512];
+	for( unsigned int i = 0; i < ITEM_COUNT; ++i )
+	{
+		switch( i % 4 )
+		{
+			case 0:
+				snprintf( item, sizeof(item), "{ \"name\" : \"item_%u\", \"bytes\" : [], \"u64s\" : [], \"strs\" : [], \"sub\" : [] }", i );
+				break;
+			case 1:
+				snprintf( item, sizeof(item), "{ \"name\" : \"i[%u],\\\"\", \"bytes\" : [ %u ], \"u64s\" : [ %u, 2 ], \"strs\" : [ \"a\", \"]\" ], \"sub\" : [ { \"u32_arr\" : [ %u ] } ], \"ptr\" : \"p%u\" } // ], {\n", i, i & 0xFF, i, i, i % 7 );
+				break;
+			case 2:
+				snprintf( item, sizeof(item), "/* { */ { \"def_str\" : \"s%u\", \"name\" : 'n', \"bytes\" : [ 1, 2, 3 ], \"u64s\" : [ %u ], \"strs\" : [ \"b%u\" ], \"sub\" : [ { \"u32_arr\" : [] }, { \"u32_arr\" : [ 1, 2 ] } ], \"def_arr\" : [ %u ], \"ptr\" : null }", i, i, i, i );
+				break;
+			case 3:
+				snprintf( item, sizeof(item), "{ \"name\" : \"\", \"bytes\" : [ 7 ], \"u64s\" : [], \"strs\" : [ \"c\", \"d\", \"e\" ], \"sub\" : [], \"ptr\" : \"p%u\" }", i % 5 );
+				break;
+		}
+		txt += i == 0 ? "" : ",\n";
+		txt += item;
+	}
+	txt += "],\n \"__subdata\" : {";
+	for( unsigned int i = 0; i < 7; ++i )
+	{
+		snprintf( item, sizeof(item), "%s \"p%u\" : { \"Int1\" : %u, \"Int2\" : %u }", i == 0 ? "" : ",", i, i, i * 2 );
+		txt += item;
+	}
+	txt += "} } }";
+
+	std::vector<unsigned char> serial;
+	std::vector<unsigned char> parallel;
+	dl_test_pack_with_ctx( Ctx, txt.c_str(), DL_ERROR_OK, serial );
+	dl_test_pack_with_ctx( par_ctx, txt.c_str(), DL_ERROR_OK, parallel );
+	ASSERT_EQ( serial.size(), parallel.size() );
+	EXPECT_EQ( 0, memcmp( &serial[0], &parallel[0], serial.size() ) );
+	EXPECT_GT( jobs_run, 1u );
+
+	parallel_pack_root* loaded;
+	ASSERT_DL_ERR_OK( dl_instance_load_inplace( par_ctx, parallel_pack_root::TYPE_ID, &parallel[0], parallel.size(), (void**)&loaded, 0x0 ) );
+	ASSERT_EQ( ITEM_COUNT, loaded->items.count );
+	EXPECT_STREQ( "i[1001],\"", loaded->items[1001].name );
+	EXPECT_STREQ( "]", loaded->items[1001].strs[1] );
+	EXPECT_EQ( 0u, loaded->items[1001].ptr->Int1 );
+	EXPECT_STREQ( "s1002", loaded->items[1002].def_str );
+	EXPECT_EQ( 1002u, loaded->items[1002].def_arr[0] );
+	EXPECT_STREQ( "cowbells", loaded->items[1003].def_str );
+	EXPECT_EQ( 7u, loaded->items[1003].def_arr[3] );
+	EXPECT_EQ( loaded->items[3].ptr, loaded->items[1003].ptr );
+
+	// ... errors in one of the jobs should be reported just as in the serial pack ...
+	std::string broken = txt;
+	broken.replace( broken.find( "\"item_1000\"" ), 11, "\"item_1000\", \"nomember\" : 1" );
+	dl_test_pack_with_ctx( Ctx, broken.c_str(), DL_ERROR_TXT_INVALID_MEMBER, serial );
+	dl_test_pack_with_ctx( par_ctx, broken.c_str(), DL_ERROR_TXT_INVALID_MEMBER, parallel );
+
+	EXPECT_DL_ERR_OK( dl_context_destroy( par_ctx ) );
+}
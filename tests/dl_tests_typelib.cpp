@@ -4,6 +4,7 @@
 #include <dl/dl_typelib.h>
 #include <dl/dl_txt.h>
 #include <dl/dl_reflect.h>
+#include <dl/dl_convert.h>
 
 #define STRINGIFY( ... ) #__VA_ARGS__
 
@@ -315,6 +316,60 @@ TEST_F( DLTypeLibTxt, inline_array_too_big)
 	typelibtxt_expect_error( ctx, DL_ERROR_TXT_PARSE_ERROR, typelib );
 }
 
+TEST_F( DLTypeLibTxt, type_contains_itself_inline )
+{
+	typelibtxt_expect_error( ctx, DL_ERROR_MALFORMED_DATA, STRINGIFY({
+		"types" : {
+			"a" : { "members" : [ { "name" : "b", "type" : "b" } ] },
+			"b" : { "members" : [ { "name" : "a", "type" : "a[2]" } ] }
+		}
+	}));
+}
+
+TEST_F( DLTypeLibTxt, many_default_values )
+{
+	// ... more defaults than are packed in one go while loading the typelib, with different sizes and alignment ...
+	const unsigned int MEMBER_COUNT = 150;
+	char* typelib = (char*)malloc( MEMBER_COUNT * 64 + 64 );
+	strcpy( typelib, "{ \"types\" : { \"many_defaults\" : { \"members\" : [ " );
+	for( unsigned int i = 0; i < MEMBER_COUNT; ++i )
+		sprintf( typelib + strlen( typelib ), "{ \"name\" : \"m%u\", \"type\" : \"%s\", \"default\" : %u }%s", i, i % 2 ? "uint8" : "uint32", i, i + 1 < MEMBER_COUNT ? "," : "" );
+	strcat( typelib, "] } } }" );
+
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib, strlen( typelib ) ) );
+
+	dl_typeid_t tid;
+	EXPECT_DL_ERR_OK( dl_reflect_get_type_id( ctx, "many_defaults", &tid ) );
+
+	dl_member_info_t members[MEMBER_COUNT];
+	EXPECT_DL_ERR_OK( dl_reflect_get_type_members( ctx, tid, members, MEMBER_COUNT ) );
+
+	unsigned char packed[1024];
+	unsigned char loaded[1024];
+	EXPECT_DL_ERR_OK( dl_txt_pack( ctx, STRINGIFY( { "many_defaults" : {} } ), packed, sizeof(packed), 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_instance_load( ctx, tid, loaded, sizeof(loaded), packed, sizeof(packed), 0x0 ) );
+
+	for( unsigned int i = 0; i < MEMBER_COUNT; ++i )
+	{
+		if( i % 2 )
+			EXPECT_EQ( (uint8_t)i, loaded[ members[i].offset ] );
+		else
+		{
+			uint32_t val;
+			memcpy( &val, loaded + members[i].offset, sizeof(val) );
+			EXPECT_EQ( i, val );
+		}
+	}
+
+	// ... an invalid default among many should still be reported ...
+	char* bad = strstr( typelib, "\"default\" : 77 " );
+	ASSERT_NE( (char*)0x0, bad );
+	memcpy( bad, "\"default\" : \"x\"", 15 );
+	typelibtxt_expect_error( ctx, DL_ERROR_INVALID_DEFAULT_VALUE, typelib );
+
+	free( typelib );
+}
+
 TEST_F( DLTypeLibUnpackTxt, round_about )
 {
 	const char* testlib1 = STRINGIFY({
@@ -435,6 +490,31 @@ TEST_F( DLTypeLib, enum_in_2_tlds )
 	free(tl2);
 }
 
+TEST_F( DLTypeLib, load_binary_with_empty_sections )
+{
+	// ... the sections that are empty in the typelib are still unallocated in a new context ...
+	const char only_enums[] = STRINGIFY({ "enums" : { "e" : { "values" : { "a" : 1 } } } });
+	const char only_types[] = STRINGIFY({ "types" : { "t" : { "members" : [ { "name" : "m", "type" : "int32" } ] } } });
+
+	size_t enums_size;
+	size_t types_size;
+	uint8_t* enums_lib = test_pack_txt_type_lib( only_enums, sizeof(only_enums)-1, &enums_size );
+	uint8_t* types_lib = test_pack_txt_type_lib( only_types, sizeof(only_types)-1, &types_size );
+
+	EXPECT_DL_ERR_OK( dl_context_load_type_library( ctx, enums_lib, enums_size ) );
+
+	dl_ctx_t ctx2;
+	dl_create_params_t p;
+	DL_CREATE_PARAMS_SET_DEFAULT(p);
+	p.error_msg_func = test_log_error;
+	EXPECT_DL_ERR_OK( dl_context_create( &ctx2, &p ) );
+	EXPECT_DL_ERR_OK( dl_context_load_type_library( ctx2, types_lib, types_size ) );
+	EXPECT_DL_ERR_OK( dl_context_destroy( ctx2 ) );
+
+	free( enums_lib );
+	free( types_lib );
+}
+
 // test read-errors for enum
 
 // invalid type
@@ -461,6 +541,379 @@ TEST_F( DLTypeLib, defaults_in_2_tlds )
 	free(tl2);
 }
 
+TEST_F( DLTypeLib, load_inplace )
+{
+	const char typelib1[] = STRINGIFY({ "module" : "tl1", "enums" : { "e1" : { "values" : { "e1_v1" : 1, "e1_v2" : 2 } } }, "types" : { "tl1_type" : { "members" : [ { "name" : "m1", "type" : "e1" }, { "name" : "m2", "type" : "string", "default" : "apa" } ] } } });
+	const char typelib2[] = STRINGIFY({ "module" : "tl2", "types" : { "tl2_type" : { "members" : [ { "name" : "m1", "type" : "tl1_type" }, { "name" : "m2", "type" : "fp32", "default" : 2.0 } ] } } });
+
+	size_t tl1_size;
+	uint8_t* tl1 = test_pack_txt_type_lib( typelib1, sizeof(typelib1)-1, &tl1_size );
+	EXPECT_DL_ERR_OK( dl_context_load_type_library_inplace( ctx, tl1, tl1_size ) );
+
+	// ... descriptors should be referenced from the typelib and not copied ...
+	dl_typeid_t tl1_type;
+	dl_type_info_t info;
+	EXPECT_DL_ERR_OK( dl_reflect_get_type_id( ctx, "tl1_type", &tl1_type ) );
+	EXPECT_DL_ERR_OK( dl_reflect_get_type_info( ctx, tl1_type, &info ) );
+	EXPECT_GE( (const uint8_t*)info.name, tl1 );
+	EXPECT_LT( (const uint8_t*)info.name, tl1 + tl1_size );
+
+	uint8_t outbuf[256];
+	EXPECT_DL_ERR_OK( dl_txt_pack( ctx, STRINGIFY( { "tl1_type" : { "m1" : "e1_v2" } } ), outbuf, sizeof(outbuf), 0x0 ) );
+
+	// ... loading one more typelib should copy the first one and still work ...
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib2, sizeof(typelib2)-1 ) );
+	EXPECT_DL_ERR_OK( dl_txt_pack( ctx, STRINGIFY( { "tl2_type" : { "m1" : { "m1" : "e1_v1" } } } ), outbuf, sizeof(outbuf), 0x0 ) );
+
+	dl_typeid_t tl2_type;
+	uint64_t loadbuf[32];
+	EXPECT_DL_ERR_OK( dl_reflect_get_type_id( ctx, "tl2_type", &tl2_type ) );
+	EXPECT_DL_ERR_OK( dl_instance_load( ctx, tl2_type, loadbuf, sizeof(loadbuf), outbuf, sizeof(outbuf), 0x0 ) );
+
+	free(tl1);
+}
+
+TEST_F( DLTypeLib, load_inplace_bad_alignment )
+{
+	const char typelib1[] = STRINGIFY({ "module" : "tl1", "types" : { "tl1_type" : { "members" : [ { "name" : "m1", "type" : "uint32" } ] } } });
+
+	size_t tl1_size;
+	uint8_t* tl1 = test_pack_txt_type_lib( typelib1, sizeof(typelib1)-1, &tl1_size );
+	uint8_t* unaligned = (uint8_t*)malloc( tl1_size + 1 );
+	memcpy( unaligned + 1, tl1, tl1_size );
+
+	EXPECT_DL_ERR_EQ( DL_ERROR_BAD_ALIGNMENT, dl_context_load_type_library_inplace( ctx, unaligned + 1, tl1_size ) );
+
+	free(unaligned);
+	free(tl1);
+}
+
+TEST_F( DLTypeLib, load_many )
+{
+	static const unsigned char typelib1[] = {
+		#include "generated/unittest.bin.h"
+	};
+	static const unsigned char typelib2[] = {
+		#include "generated/unittest2.bin.h"
+	};
+	static const unsigned char typelib3[] = {
+		#include "generated/sized_enums.bin.h"
+	};
+	const unsigned char* libs[] = { typelib1, typelib2, typelib3 };
+	size_t lib_sizes[]          = { sizeof(typelib1), sizeof(typelib2), sizeof(typelib3) };
+
+	dl_ctx_t one_at_a_time;
+	dl_create_params_t p;
+	DL_CREATE_PARAMS_SET_DEFAULT(p);
+	p.error_msg_func = error_msg_handler;
+	EXPECT_DL_ERR_OK( dl_context_create( &one_at_a_time, &p ) );
+	for( unsigned int i = 0; i < DL_ARRAY_LENGTH(libs); ++i )
+		EXPECT_DL_ERR_OK( dl_context_load_type_library( one_at_a_time, libs[i], lib_sizes[i] ) );
+
+	EXPECT_DL_ERR_OK( dl_context_load_type_libraries( ctx, libs, lib_sizes, DL_ARRAY_LENGTH(libs) ) );
+
+	// ... both contexts should end up with exactly the same typelib ...
+	size_t expect_size = 0;
+	size_t batch_size = 0;
+	EXPECT_DL_ERR_OK( dl_context_write_type_library( one_at_a_time, 0x0, 0, &expect_size ) );
+	EXPECT_DL_ERR_OK( dl_context_write_type_library( ctx, 0x0, 0, &batch_size ) );
+	ASSERT_EQ( expect_size, batch_size );
+
+	unsigned char* expect = (unsigned char*)malloc( expect_size );
+	unsigned char* batch  = (unsigned char*)malloc( batch_size );
+	EXPECT_DL_ERR_OK( dl_context_write_type_library( one_at_a_time, expect, expect_size, 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_context_write_type_library( ctx, batch, batch_size, 0x0 ) );
+	EXPECT_EQ( 0, memcmp( expect, batch, expect_size ) );
+
+	free( expect );
+	free( batch );
+	EXPECT_DL_ERR_OK( dl_context_destroy( one_at_a_time ) );
+}
+
+TEST_F( DLTypeLib, load_many_with_invalid_lib )
+{
+	static const unsigned char typelib1[] = {
+		#include "generated/unittest.bin.h"
+	};
+	unsigned char not_a_typelib[128];
+	memset( not_a_typelib, 0xFE, sizeof(not_a_typelib) );
+
+	const unsigned char* libs[] = { typelib1, not_a_typelib };
+	size_t lib_sizes[]          = { sizeof(typelib1), sizeof(not_a_typelib) };
+
+	// ... nothing should be loaded if one lib is bad ...
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_context_load_type_libraries( ctx, libs, lib_sizes, DL_ARRAY_LENGTH(libs) ) );
+
+	dl_type_context_info_t info;
+	EXPECT_DL_ERR_OK( dl_reflect_context_info( ctx, &info ) );
+	EXPECT_EQ( 0u, info.num_types );
+}
+
+static unsigned int test_type_member_count( dl_ctx_t ctx, const char* type_name )
+{
+	dl_typeid_t tid;
+	dl_type_info_t info;
+	EXPECT_DL_ERR_OK( dl_reflect_get_type_id( ctx, type_name, &tid ) );
+	EXPECT_DL_ERR_OK( dl_reflect_get_type_info( ctx, tid, &info ) );
+	return info.member_count;
+}
+
+TEST_F( DLTypeLib, replace_txt_module )
+{
+	const char typelib1[]  = STRINGIFY({ "module" : "tl1", "enums" : { "e1" : { "values" : { "e1_v1" : 1, "e1_v2" : 2 } } }, "types" : { "tl1_type" : { "members" : [ { "name" : "m1", "type" : "e1" } ] } } });
+	const char typelib1b[] = STRINGIFY({ "module" : "tl1", "enums" : { "e1" : { "values" : { "e1_v1" : 1, "e1_v3" : 3 } } }, "types" : { "tl1_type" : { "members" : [ { "name" : "m1", "type" : "e1" }, { "name" : "m2", "type" : "uint32", "default" : 7 } ] } } });
+	const char typelib2[]  = STRINGIFY({ "module" : "tl2", "types" : { "tl2_type" : { "members" : [ { "name" : "m1", "type" : "tl1_type*" }, { "name" : "m2", "type" : "e1" } ] } } });
+
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib1, sizeof(typelib1)-1 ) );
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib2, sizeof(typelib2)-1 ) );
+	EXPECT_EQ( 1u, test_type_member_count( ctx, "tl1_type" ) );
+
+	dl_type_context_info_t before;
+	EXPECT_DL_ERR_OK( dl_reflect_context_info( ctx, &before ) );
+
+	// ... tl1 is only referenced by pointer and through an enum of the same storage so it can be replaced ...
+	EXPECT_DL_ERR_OK( dl_context_replace_txt_type_library( ctx, "tl1", typelib1b, sizeof(typelib1b)-1 ) );
+
+	dl_type_context_info_t after;
+	EXPECT_DL_ERR_OK( dl_reflect_context_info( ctx, &after ) );
+	EXPECT_NE( before.generation, after.generation );
+	EXPECT_EQ( before.num_types, after.num_types );
+	EXPECT_EQ( 2u, test_type_member_count( ctx, "tl1_type" ) );
+
+	uint8_t outbuf[256];
+	EXPECT_DL_ERR_OK( dl_txt_pack( ctx, STRINGIFY( { "tl1_type" : { "m1" : "e1_v3" } } ), outbuf, sizeof(outbuf), 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_txt_pack( ctx, STRINGIFY( { "tl2_type" : { "m1" : null, "m2" : "e1_v3" } } ), outbuf, sizeof(outbuf), 0x0 ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_TXT_INVALID_ENUM_VALUE, dl_txt_pack( ctx, STRINGIFY( { "tl2_type" : { "m1" : null, "m2" : "e1_v2" } } ), outbuf, sizeof(outbuf), 0x0 ) );
+}
+
+TEST_F( DLTypeLib, replace_module_inline_size_change )
+{
+	const char typelib1[]  = STRINGIFY({ "module" : "tl1", "types" : { "tl1_type" : { "members" : [ { "name" : "m1", "type" : "uint32" } ] } } });
+	const char typelib1b[] = STRINGIFY({ "module" : "tl1", "types" : { "tl1_type" : { "members" : [ { "name" : "m1", "type" : "uint32" }, { "name" : "m2", "type" : "uint32" } ] } } });
+	const char typelib2[]  = STRINGIFY({ "module" : "tl2", "types" : { "tl2_type" : { "members" : [ { "name" : "m1", "type" : "tl1_type" } ] } } });
+
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib1, sizeof(typelib1)-1 ) );
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib2, sizeof(typelib2)-1 ) );
+
+	dl_type_context_info_t before;
+	EXPECT_DL_ERR_OK( dl_reflect_context_info( ctx, &before ) );
+
+	// ... tl2_type stores tl1_type inline so it can't grow, ctx should be left untouched ...
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_MISMATCH, dl_context_replace_txt_type_library( ctx, "tl1", typelib1b, sizeof(typelib1b)-1 ) );
+
+	dl_type_context_info_t after;
+	EXPECT_DL_ERR_OK( dl_reflect_context_info( ctx, &after ) );
+	EXPECT_EQ( before.generation, after.generation );
+	EXPECT_EQ( before.num_types,  after.num_types );
+	EXPECT_EQ( 1u, test_type_member_count( ctx, "tl1_type" ) );
+
+	uint8_t outbuf[256];
+	EXPECT_DL_ERR_OK( dl_txt_pack( ctx, STRINGIFY( { "tl2_type" : { "m1" : { "m1" : 1 } } } ), outbuf, sizeof(outbuf), 0x0 ) );
+}
+
+TEST_F( DLTypeLib, replace_module_store_uses_new_layout )
+{
+	const char typelib1[]  = STRINGIFY({ "module" : "tl1", "types" : { "tl1_type" : { "members" : [ { "name" : "m1", "type" : "uint32" } ] } } });
+	const char typelib1b[] = STRINGIFY({ "module" : "tl1", "types" : { "tl1_type" : { "members" : [ { "name" : "m1", "type" : "uint32" }, { "name" : "m2", "type" : "uint32" } ] } } });
+	const char typelib2[]  = STRINGIFY({ "module" : "tl2", "types" : { "tl2_type" : { "members" : [ { "name" : "m1", "type" : "tl1_type*" } ] } } });
+
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib1, sizeof(typelib1)-1 ) );
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib2, sizeof(typelib2)-1 ) );
+
+	struct { uint32_t m1; uint32_t m2; } pointee = { 1, 2 };
+	struct { const void* m1; } root = { &pointee };
+
+	dl_typeid_t tid;
+	EXPECT_DL_ERR_OK( dl_reflect_get_type_id( ctx, "tl2_type", &tid ) );
+
+	size_t size_before = 0;
+	EXPECT_DL_ERR_OK( dl_instance_calc_size( ctx, tid, &root, &size_before ) );
+
+	// ... the type pointed to by tl2_type grows, storing should follow the pointer with the new layout ...
+	EXPECT_DL_ERR_OK( dl_context_replace_txt_type_library( ctx, "tl1", typelib1b, sizeof(typelib1b)-1 ) );
+
+	size_t size_after = 0;
+	EXPECT_DL_ERR_OK( dl_instance_calc_size( ctx, tid, &root, &size_after ) );
+	EXPECT_EQ( size_before + sizeof(uint32_t), size_after );
+
+	unsigned char packed[256];
+	EXPECT_DL_ERR_OK( dl_instance_store( ctx, tid, &root, packed, sizeof(packed), 0x0 ) );
+
+	void* loaded = 0x0;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace( ctx, tid, packed, size_after, &loaded, 0x0 ) );
+	const uint32_t* loaded_pointee = *(const uint32_t**)loaded;
+	EXPECT_EQ( 1u, loaded_pointee[0] );
+	EXPECT_EQ( 2u, loaded_pointee[1] );
+}
+
+TEST_F( DLTypeLib, replace_module_inline_gains_subdata )
+{
+	const char typelib_a[]  = STRINGIFY({ "module" : "a", "types" : { "inner" : { "members" : [ { "name" : "x", "type" : "uint64" }, { "name" : "y", "type" : "uint64" } ] } } });
+	const char typelib_ab[] = STRINGIFY({ "module" : "a", "types" : { "inner" : { "members" : [ { "name" : "s", "type" : "string" }, { "name" : "y", "type" : "uint64" } ] } } });
+	const char typelib_b[]  = STRINGIFY({ "module" : "b", "types" : { "outer" : { "members" : [ { "name" : "i", "type" : "inner" } ] } } });
+
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib_a, sizeof(typelib_a)-1 ) );
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib_b, sizeof(typelib_b)-1 ) );
+
+	// ... inner keep its size and alignment but now has a string, outer should get subdata as if loaded after it ...
+	EXPECT_DL_ERR_OK( dl_context_replace_txt_type_library( ctx, "a", typelib_ab, sizeof(typelib_ab)-1 ) );
+
+	dl_ctx_t fresh;
+	dl_create_params_t p;
+	DL_CREATE_PARAMS_SET_DEFAULT(p);
+	p.error_msg_func = error_msg_handler;
+	EXPECT_DL_ERR_OK( dl_context_create( &fresh, &p ) );
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( fresh, typelib_ab, sizeof(typelib_ab)-1 ) );
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( fresh, typelib_b,  sizeof(typelib_b)-1 ) );
+
+	dl_typeid_t tid;
+	EXPECT_DL_ERR_OK( dl_reflect_get_type_id( ctx, "outer", &tid ) );
+
+	struct { const char* s; uint64_t y; } outer = { "hello", 2 };
+	dl_ctx_t ctxs[] = { ctx, fresh };
+	for( size_t i = 0; i < DL_ARRAY_LENGTH( ctxs ); ++i )
+	{
+		size_t clone_size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_clone( ctxs[i], tid, &outer, 0x0, 0, &clone_size ) );
+		EXPECT_EQ( sizeof( outer ) + sizeof( "hello" ), clone_size );
+
+		uint64_t clone[8];
+		EXPECT_DL_ERR_OK( dl_instance_clone( ctxs[i], tid, &outer, clone, sizeof( clone ), 0x0 ) );
+		const char* cloned_str = *(const char**)clone;
+		EXPECT_TRUE( cloned_str >= (const char*)clone && cloned_str < (const char*)clone + clone_size );
+		EXPECT_STREQ( "hello", cloned_str );
+
+		int cmp = 1;
+		EXPECT_DL_ERR_OK( dl_instance_compare( ctxs[i], tid, &outer, clone, &cmp, 0x0, 0 ) );
+		EXPECT_EQ( 0, cmp );
+	}
+
+	// ... and lose it again when the string goes away ...
+	EXPECT_DL_ERR_OK( dl_context_replace_txt_type_library( ctx, "a", typelib_a, sizeof(typelib_a)-1 ) );
+	size_t clone_size = 0;
+	EXPECT_DL_ERR_OK( dl_instance_clone( ctx, tid, &outer, 0x0, 0, &clone_size ) );
+	EXPECT_EQ( sizeof( outer ), clone_size );
+
+	EXPECT_DL_ERR_OK( dl_context_destroy( fresh ) );
+}
+
+TEST_F( DLTypeLib, replace_module_default_of_changed_type )
+{
+	const char typelib_a[]  = STRINGIFY({ "module" : "a", "types" : { "inner" : { "members" : [ { "name" : "x", "type" : "uint64" }, { "name" : "y", "type" : "uint64" } ] } } });
+	const char typelib_ab[] = STRINGIFY({ "module" : "a", "types" : { "inner" : { "members" : [ { "name" : "s", "type" : "string" }, { "name" : "y", "type" : "uint64" } ] } } });
+	const char typelib_ac[] = STRINGIFY({ "module" : "a", "types" : { "inner" : { "members" : [ { "name" : "x", "type" : "uint64" }, { "name" : "y", "type" : "uint64" } ], "comment" : "only the comment changed" } } });
+	const char typelib_b[]  = STRINGIFY({ "module" : "b", "types" : { "outer" : { "members" : [ { "name" : "i", "type" : "inner", "default" : { "x" : 1, "y" : 2 } } ] } } });
+
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib_a, sizeof(typelib_a)-1 ) );
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib_b, sizeof(typelib_b)-1 ) );
+
+	// ... the default of outer.i was packed with the old layout of inner and can't be used with the new ...
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_MISMATCH, dl_context_replace_txt_type_library( ctx, "a", typelib_ab, sizeof(typelib_ab)-1 ) );
+
+	// ... as long as the layout is the same it is fine ...
+	EXPECT_DL_ERR_OK( dl_context_replace_txt_type_library( ctx, "a", typelib_ac, sizeof(typelib_ac)-1 ) );
+
+	uint64_t packed[16];
+	EXPECT_DL_ERR_OK( dl_txt_pack( ctx, STRINGIFY( { "outer" : {} } ), (unsigned char*)packed, sizeof(packed), 0x0 ) );
+
+	dl_typeid_t tid;
+	EXPECT_DL_ERR_OK( dl_reflect_get_type_id( ctx, "outer", &tid ) );
+	uint64_t* loaded = 0x0;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace( ctx, tid, (unsigned char*)packed, sizeof(packed), (void**)&loaded, 0x0 ) );
+	EXPECT_EQ( 1u, loaded[0] );
+	EXPECT_EQ( 2u, loaded[1] );
+}
+
+TEST_F( DLTypeLib, members_resolved_across_modules )
+{
+	const char typelib1[]  = STRINGIFY({ "module" : "tl1", "enums" : { "e1" : { "values" : { "e1_v1" : 1, "e1_v2" : 2 } } }, "types" : { "tl1_type" : { "members" : [ { "name" : "m1", "type" : "e1" } ] } } });
+	const char typelib1b[] = STRINGIFY({ "module" : "tl1", "enums" : { "e0" : { "values" : { "e0_v1" : 1 } }, "e1" : { "values" : { "e1_v1" : 1, "e1_v2" : 2 } } }, "types" : { "tl0_type" : { "members" : [ { "name" : "m1", "type" : "e0" } ] }, "tl1_type" : { "members" : [ { "name" : "m1", "type" : "e1" } ] } } });
+	const char typelib2[]  = STRINGIFY({ "module" : "tl2", "types" : { "tl2_type" : { "members" : [ { "name" : "inl", "type" : "tl1_type" }, { "name" : "arr", "type" : "tl1_type[]" }, { "name" : "ptr", "type" : "tl1_type*" }, { "name" : "e", "type" : "e1[2]" } ] } } });
+	const char txt[] = STRINGIFY( { "tl2_type" : { "inl" : { "m1" : "e1_v2" }, "arr" : [ { "m1" : "e1_v1" }, { "m1" : "e1_v2" } ], "ptr" : "p1", "e" : [ "e1_v2", "e1_v1" ], "__subdata" : { "p1" : { "m1" : "e1_v2" } } } } );
+
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib1, sizeof(typelib1)-1 ) );
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib2, sizeof(typelib2)-1 ) );
+
+	dl_typeid_t tid;
+	EXPECT_DL_ERR_OK( dl_reflect_get_type_id( ctx, "tl2_type", &tid ) );
+
+	uint8_t packed[256];
+	char txt_before[1024];
+	EXPECT_DL_ERR_OK( dl_txt_pack( ctx, txt, packed, sizeof(packed), 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_txt_unpack( ctx, tid, packed, sizeof(packed), txt_before, sizeof(txt_before), 0x0 ) );
+	EXPECT_NE( (const char*)0x0, strstr( txt_before, "e1_v2" ) );
+
+	// ... tl1 get new types and enums that move the ones used by tl2_type, its members should follow ...
+	EXPECT_DL_ERR_OK( dl_context_replace_txt_type_library( ctx, "tl1", typelib1b, sizeof(typelib1b)-1 ) );
+
+	char txt_after[1024];
+	EXPECT_DL_ERR_OK( dl_txt_pack( ctx, txt, packed, sizeof(packed), 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_txt_unpack( ctx, tid, packed, sizeof(packed), txt_after, sizeof(txt_after), 0x0 ) );
+	EXPECT_STREQ( txt_before, txt_after );
+
+	uint8_t swapped[256];
+	size_t swapped_size = 0;
+	dl_endian_t other_endian = DL_ENDIAN_HOST == DL_ENDIAN_LITTLE ? DL_ENDIAN_BIG : DL_ENDIAN_LITTLE;
+	EXPECT_DL_ERR_OK( dl_convert( ctx, tid, packed, sizeof(packed), swapped, sizeof(swapped), other_endian, sizeof(void*), &swapped_size ) );
+	EXPECT_DL_ERR_OK( dl_convert( ctx, tid, swapped, swapped_size, packed, sizeof(packed), DL_ENDIAN_HOST, sizeof(void*), 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_txt_unpack( ctx, tid, packed, sizeof(packed), txt_after, sizeof(txt_after), 0x0 ) );
+	EXPECT_STREQ( txt_before, txt_after );
+}
+
+TEST_F( DLTypeLib, unload_module )
+{
+	const char typelib1[] = STRINGIFY({ "module" : "tl1", "types" : { "tl1_type" : { "members" : [ { "name" : "m1", "type" : "string", "default" : "apa" } ] } } });
+	const char typelib2[] = STRINGIFY({ "module" : "tl2", "types" : { "tl2_type" : { "members" : [ { "name" : "m1", "type" : "tl1_type[]" } ] } } });
+	const char typelib3[] = STRINGIFY({ "module" : "tl3", "types" : { "tl3_type" : { "members" : [ { "name" : "m1", "type" : "fp32", "default" : 2.0 } ] } } });
+
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib1, sizeof(typelib1)-1 ) );
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib2, sizeof(typelib2)-1 ) );
+	EXPECT_DL_ERR_OK( dl_context_load_txt_type_library( ctx, typelib3, sizeof(typelib3)-1 ) );
+
+	EXPECT_DL_ERR_EQ( DL_ERROR_INVALID_PARAMETER, dl_context_unload_type_library( ctx, "not_loaded" ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_NOT_FOUND,    dl_context_unload_type_library( ctx, "tl1" ) );
+
+	// ... unloading a module in the middle should leave the ones after it usable ...
+	EXPECT_DL_ERR_OK( dl_context_unload_type_library( ctx, "tl2" ) );
+	EXPECT_DL_ERR_OK( dl_context_unload_type_library( ctx, "tl1" ) );
+
+	dl_type_context_info_t info;
+	EXPECT_DL_ERR_OK( dl_reflect_context_info( ctx, &info ) );
+	EXPECT_EQ( 1u, info.num_types );
+
+	dl_typeid_t tid;
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_NOT_FOUND, dl_reflect_get_type_id( ctx, "tl1_type", &tid ) );
+
+	uint8_t outbuf[256];
+	char txt_out[256];
+	EXPECT_DL_ERR_OK( dl_txt_pack( ctx, STRINGIFY( { "tl3_type" : {} } ), outbuf, sizeof(outbuf), 0x0 ) );
+	EXPECT_DL_ERR_OK( dl_reflect_get_type_id( ctx, "tl3_type", &tid ) );
+	EXPECT_DL_ERR_OK( dl_txt_unpack( ctx, tid, outbuf, sizeof(outbuf), txt_out, sizeof(txt_out), 0x0 ) );
+	EXPECT_NE( (const char*)0x0, strstr( txt_out, "2" ) );
+}
+
+TEST_F( DLTypeLib, replace_bin_module_not_loaded )
+{
+	const char typelib1[] = STRINGIFY({ "module" : "tl1", "types" : { "tl1_type" : { "members" : [ { "name" : "m1", "type" : "uint32" } ] } } });
+
+	size_t tl1_size;
+	uint8_t* tl1 = test_pack_txt_type_lib( typelib1, sizeof(typelib1)-1, &tl1_size );
+
+	// ... replacing a module that is not loaded loads it under that name ...
+	EXPECT_DL_ERR_OK( dl_context_replace_type_library( ctx, "bin_module", tl1, tl1_size ) );
+	EXPECT_DL_ERR_OK( dl_context_replace_type_library( ctx, "bin_module", tl1, tl1_size ) );
+
+	dl_type_context_info_t info;
+	EXPECT_DL_ERR_OK( dl_reflect_context_info( ctx, &info ) );
+	EXPECT_EQ( 1u, info.num_types );
+
+	EXPECT_DL_ERR_OK( dl_context_unload_type_library( ctx, "bin_module" ) );
+	EXPECT_DL_ERR_OK( dl_reflect_context_info( ctx, &info ) );
+	EXPECT_EQ( 0u, info.num_types );
+
+	free(tl1);
+}
+
 TEST_F( DLTypeLibTxt, DISABLED_default_inl_arr_of_bits )
 {
 	// Only one default value for an inline array of two
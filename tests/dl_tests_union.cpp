@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "dl_tests_base.h"
+#include <dl/dl_convert.h>
 
 TYPED_TEST(DLBase, union_simple)
 {
@@ -258,3 +259,29 @@ TYPED_TEST(DLBase, union_wrong_type)
 TYPED_TEST(DLBase, ptr_to_union)
 {
 }
+
+TEST_F(DL, union_wrong_type_in_packed)
+{
+	test_union_simple original;
+	original.type = test_union_simple_type_item1;
+	original.value.item1 = 1337;
+
+	unsigned char packed[256];
+	size_t packed_size = 0;
+	EXPECT_DL_ERR_OK( dl_instance_store( Ctx, test_union_simple::TYPE_ID, &original, packed, sizeof(packed), &packed_size ) );
+
+	unsigned char loaded_buffer[256];
+	memcpy( loaded_buffer, packed, packed_size );
+	test_union_simple* loaded = 0x0;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace( Ctx, test_union_simple::TYPE_ID, loaded_buffer, packed_size, (void**)&loaded, 0x0 ) );
+
+	// ... a type-tag of another type, i.e. out of range of the members of test_union_simple, should be detected everywhere ...
+	test_union_simple_type* type_in_packed = (test_union_simple_type*)( packed + ( (unsigned char*)&loaded->type - loaded_buffer ) );
+	*type_in_packed = (test_union_simple_type)( test_union_simple::TYPE_ID + 1000 );
+
+	char txt[1024];
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_txt_unpack( Ctx, test_union_simple::TYPE_ID, packed, packed_size, txt, sizeof(txt), 0x0 ) );
+
+	unsigned char converted[256];
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_convert( Ctx, test_union_simple::TYPE_ID, packed, packed_size, converted, sizeof(converted), DL_ENDIAN_HOST, sizeof(void*) == 4 ? 8 : 4, 0x0 ) );
+}
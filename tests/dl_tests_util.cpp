@@ -251,6 +251,34 @@ TEST_F( DLUtil, auto_detect_text_file_format )
 	free( allocated_mem );
 }
 
+TEST_F( DLUtil, load_binary_with_other_version )
+{
+	EXPECT_DL_ERR_OK( dl_util_store_to_file( Ctx, Pods::TYPE_ID, TEMP_FILE_NAME, DL_UTIL_FILE_TYPE_BINARY, DL_ENDIAN_HOST, sizeof(void*), &p, 0x0, 0x0, 0x0 ) );
+
+	// ... bump the version in the header, the data should still be found to be binary and not be parsed as txt ...
+	FILE* f = fopen( TEMP_FILE_NAME, "r+b" );
+	ASSERT_NE( (FILE*)0x0, f );
+	uint32_t version;
+	fseek( f, sizeof( uint32_t ), SEEK_SET );
+	EXPECT_EQ( 1u, fread( &version, sizeof( version ), 1, f ) );
+	version += 1;
+	fseek( f, sizeof( uint32_t ), SEEK_SET );
+	EXPECT_EQ( 1u, fwrite( &version, sizeof( version ), 1, f ) );
+	fclose( f );
+
+	void* instance = 0x0;
+	void* allocated_mem = 0x0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_VERSION_MISMATCH, dl_util_load_from_file( Ctx, Pods::TYPE_ID, TEMP_FILE_NAME, DL_UTIL_FILE_TYPE_AUTO, &instance, 0x0, &allocated_mem, 0x0, 0x0, 0x0 ) );
+	EXPECT_EQ( 0x0, instance );
+
+	f = fopen( TEMP_FILE_NAME, "rb" );
+	ASSERT_NE( (FILE*)0x0, f );
+	size_t consumed = 0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_VERSION_MISMATCH, dl_util_load_from_stream( Ctx, Pods::TYPE_ID, f, DL_UTIL_FILE_TYPE_AUTO, &instance, 0x0, &allocated_mem, &consumed, 0x0, 0x0, 0x0, 0x0 ) );
+	fclose( f );
+	EXPECT_EQ( 0x0, instance );
+}
+
 TEST_F( DLUtil, dl_util_load_non_existing_file )
 {
 	EXPECT_DL_ERR_EQ( DL_ERROR_UTIL_FILE_NOT_FOUND,
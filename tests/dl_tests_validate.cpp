@@ -0,0 +1,221 @@
+/* copyright (c) 2010 Fredrik Kihlander, see LICENSE for more info */
+
+#include <gtest/gtest.h>
+
+#include <dl/dl.h>
+#include <dl/dl_txt.h>
+
+#include "dl_test_common.h"
+
+#include <stddef.h>
+#include <vector>
+
+class DLValidate : public DL
+{
+public:
+	template <typename T>
+	std::vector<unsigned char> store( const T& inst )
+	{
+		size_t size = 0;
+		EXPECT_DL_ERR_OK( dl_instance_store( Ctx, T::TYPE_ID, &inst, 0x0, 0, &size ) );
+		std::vector<unsigned char> out( size );
+		EXPECT_DL_ERR_OK( dl_instance_store( Ctx, T::TYPE_ID, &inst, &out[0], out.size(), 0x0 ) );
+		return out;
+	}
+
+	// ... offset of the root instance in packed, found by loading a copy ...
+	size_t root_offset( dl_typeid_t type, const std::vector<unsigned char>& packed )
+	{
+		std::vector<unsigned char> copy( packed );
+		void* loaded = 0x0;
+		EXPECT_DL_ERR_OK( dl_instance_load_inplace( Ctx, type, &copy[0], copy.size(), &loaded, 0x0 ) );
+		return (size_t)( (unsigned char*)loaded - &copy[0] );
+	}
+
+	// ... validating with dl_instance_validate and loading with DL_LOAD_FLAGS_VALIDATE should agree ...
+	dl_error_t validate( dl_typeid_t type, const std::vector<unsigned char>& packed )
+	{
+		dl_error_t err = dl_instance_validate( Ctx, type, &packed[0], packed.size() );
+
+		std::vector<unsigned char> copy( packed );
+		void* loaded = 0x0;
+		dl_error_t load_err = dl_instance_load_inplace_ex( Ctx, type, &copy[0], copy.size(), DL_LOAD_FLAGS_VALIDATE, &loaded, 0x0 );
+		if( err == DL_ERROR_OK )
+			EXPECT_DL_ERR_OK( load_err );
+		return err;
+	}
+};
+
+TEST_F( DLValidate, valid_instances )
+{
+	Strings strings = { "cow", "bells" };
+	std::vector<unsigned char> packed = store( strings );
+	EXPECT_DL_ERR_OK( validate( Strings::TYPE_ID, packed ) );
+
+	Strings loaded[4];
+	EXPECT_DL_ERR_OK( dl_instance_load_ex( Ctx, Strings::TYPE_ID, loaded, sizeof( loaded ), &packed[0], packed.size(), DL_LOAD_FLAGS_VALIDATE, 0x0 ) );
+	EXPECT_STREQ( "cow",   loaded[0].Str1 );
+	EXPECT_STREQ( "bells", loaded[0].Str2 );
+
+	// ... circular ptrs and ptrs to the root ...
+	DoublePtrChain ptr1 = { 1, 0x0,   0x0 };
+	DoublePtrChain ptr2 = { 2, &ptr1, 0x0 };
+	DoublePtrChain ptr3 = { 3, &ptr2, 0x0 };
+	ptr1.Prev = &ptr2;
+	ptr2.Prev = &ptr3;
+	packed = store( ptr3 );
+	EXPECT_DL_ERR_OK( validate( DoublePtrChain::TYPE_ID, packed ) );
+
+	DoublePtrChain* chain = 0x0;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace_ex( Ctx, DoublePtrChain::TYPE_ID, &packed[0], packed.size(), DL_LOAD_FLAGS_VALIDATE, (void**)&chain, 0x0 ) );
+	EXPECT_EQ( 3u, chain->Int );
+	EXPECT_EQ( 1u, chain->Next->Next->Int );
+	EXPECT_EQ( chain, chain->Next->Prev );
+
+	// ... equal strings are shared ...
+	const char* str_data[] = { "apa", "kossa", "apa", "apa" };
+	StringArray arr = { { str_data, DL_ARRAY_LENGTH( str_data ) } };
+	EXPECT_DL_ERR_OK( validate( StringArray::TYPE_ID, store( arr ) ) );
+}
+
+TEST_F( DLValidate, header )
+{
+	Strings strings = { "cow", "bells" };
+	std::vector<unsigned char> packed = store( strings );
+
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_validate( Ctx, Strings::TYPE_ID, &packed[0], 8 ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_validate( Ctx, Strings::TYPE_ID, &packed[0], packed.size() - 1 ) );
+	EXPECT_DL_ERR_EQ( DL_ERROR_TYPE_MISMATCH,  dl_instance_validate( Ctx, Pods::TYPE_ID,    &packed[0], packed.size() ) );
+
+	// ... truncated data is found before loading, also when not copying the instance ...
+	Strings loaded[4];
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_load_ex( Ctx, Strings::TYPE_ID, loaded, sizeof( loaded ), &packed[0], packed.size() - 1, DL_LOAD_FLAGS_VALIDATE, 0x0 ) );
+}
+
+TEST_F( DLValidate, strings )
+{
+	Strings strings = { "cow", "bells" };
+	std::vector<unsigned char> packed = store( strings );
+	size_t root = root_offset( Strings::TYPE_ID, packed );
+
+	std::vector<unsigned char> outside( packed );
+	*(uintptr_t*)&outside[ root + offsetof( Strings, Str1 ) ] += packed.size();
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, validate( Strings::TYPE_ID, outside ) );
+
+	// ... the last string is stored last in the instance ...
+	std::vector<unsigned char> unterminated( packed );
+	unterminated.back() = 'x';
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, validate( Strings::TYPE_ID, unterminated ) );
+
+	// ... string pointing into the root instance ...
+	std::vector<unsigned char> overlapping( packed );
+	uintptr_t offset_mask = ( (uintptr_t)1 << ( sizeof( uintptr_t ) * 4 ) ) - 1;
+	uintptr_t* str1 = (uintptr_t*)&overlapping[ root + offsetof( Strings, Str1 ) ];
+	*str1 = ( *str1 & ~offset_mask ) | root;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, validate( Strings::TYPE_ID, overlapping ) );
+}
+
+TEST_F( DLValidate, arrays )
+{
+	uint32_t array_data[] = { 1, 2, 3, 4 };
+	PodArray1 arr = { { array_data, DL_ARRAY_LENGTH( array_data ) } };
+	std::vector<unsigned char> packed = store( arr );
+	size_t root = root_offset( PodArray1::TYPE_ID, packed );
+	EXPECT_DL_ERR_OK( validate( PodArray1::TYPE_ID, packed ) );
+
+	std::vector<unsigned char> too_long( packed );
+	*(uint32_t*)&too_long[ root + offsetof( PodArray1, u32_arr ) + sizeof( void* ) ] = 5;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, validate( PodArray1::TYPE_ID, too_long ) );
+
+	std::vector<unsigned char> huge( packed );
+	*(uint32_t*)&huge[ root + offsetof( PodArray1, u32_arr ) + sizeof( void* ) ] = 0xFFFFFFFF;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, validate( PodArray1::TYPE_ID, huge ) );
+
+	std::vector<unsigned char> null_with_elements( packed );
+	*(uintptr_t*)&null_with_elements[ root + offsetof( PodArray1, u32_arr ) ] = 0;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, validate( PodArray1::TYPE_ID, null_with_elements ) );
+}
+
+TEST_F( DLValidate, union_type_and_enum_value )
+{
+	test_union_simple u;
+	memset( &u, 0x0, sizeof( u ) );
+	u.type = test_union_simple_type_item1;
+	u.value.item1 = 1337;
+	std::vector<unsigned char> packed = store( u );
+	size_t root = root_offset( test_union_simple::TYPE_ID, packed );
+	EXPECT_DL_ERR_OK( validate( test_union_simple::TYPE_ID, packed ) );
+
+	*(uint32_t*)&packed[ root + offsetof( test_union_simple, type ) ] = 1234;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, validate( test_union_simple::TYPE_ID, packed ) );
+
+	TestingEnum e = { TESTENUM1_VALUE3 };
+	packed = store( e );
+	root = root_offset( TestingEnum::TYPE_ID, packed );
+	EXPECT_DL_ERR_OK( validate( TestingEnum::TYPE_ID, packed ) );
+
+	*(uint32_t*)&packed[ root + offsetof( TestingEnum, TheEnum ) ] = 17;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, validate( TestingEnum::TYPE_ID, packed ) );
+}
+
+TEST_F( DLValidate, ptr_chain )
+{
+	Strings strings = { "cow", "bells" };
+	std::vector<unsigned char> packed = store( strings );
+	size_t root = root_offset( Strings::TYPE_ID, packed );
+
+	// ... end the ptr-chain after the first ptr so that the second is never patched by dl_instance_load ...
+	uintptr_t offset_mask = ( (uintptr_t)1 << ( sizeof( uintptr_t ) * 4 ) ) - 1;
+	*(uintptr_t*)&packed[ root + offsetof( Strings, Str1 ) ] &= offset_mask;
+	EXPECT_DL_ERR_EQ( DL_ERROR_MALFORMED_DATA, dl_instance_validate( Ctx, Strings::TYPE_ID, &packed[0], packed.size() ) );
+
+	// ... while validating load do not use the ptr-chain ...
+	Strings* loaded = 0x0;
+	EXPECT_DL_ERR_OK( dl_instance_load_inplace_ex( Ctx, Strings::TYPE_ID, &packed[0], packed.size(), DL_LOAD_FLAGS_VALIDATE, (void**)&loaded, 0x0 ) );
+	EXPECT_STREQ( "cow",   loaded->Str1 );
+	EXPECT_STREQ( "bells", loaded->Str2 );
+}
+
+TEST_F( DLValidate, every_byte_broken )
+{
+	// ... break each byte of an instance with ptrs, arrays, strings and structs, validation should never read outside
+	//     of the instance and only accept instances that can be loaded ...
+	const char* str_data[] = { "apa", "kossa" };
+	StringArray strs = { { str_data, DL_ARRAY_LENGTH( str_data ) } };
+	DoublePtrChain ptr1 = { 1, 0x0,   0x0 };
+	DoublePtrChain ptr2 = { 2, &ptr1, &ptr1 };
+	Pods2 pods[] = { { 1, 2 }, { 3, 4 } };
+	StructArray1 structs = { { pods, DL_ARRAY_LENGTH( pods ) } };
+
+	std::vector<unsigned char> instances[] = { store( strs ), store( ptr2 ), store( structs ) };
+	dl_typeid_t                types[]     = { StringArray::TYPE_ID, DoublePtrChain::TYPE_ID, StructArray1::TYPE_ID };
+
+	for( size_t i = 0; i < DL_ARRAY_LENGTH( instances ); ++i )
+	{
+		for( size_t byte = 0; byte < instances[i].size(); ++byte )
+		{
+			const unsigned char values[] = { 0x00, 0x01, 0x7F, 0xFF };
+			for( size_t v = 0; v < DL_ARRAY_LENGTH( values ); ++v )
+			{
+				std::vector<unsigned char> broken( instances[i] );
+				broken[byte] = values[v];
+				if( dl_instance_validate( Ctx, types[i], &broken[0], broken.size() ) != DL_ERROR_OK )
+					continue;
+
+				// ... an accepted instance should be possible to walk, both packed by unpacking it to text and loaded by
+				//     storing it again ...
+				size_t txt_size = 0;
+				EXPECT_DL_ERR_OK( dl_txt_unpack_calc_size( Ctx, types[i], &broken[0], broken.size(), &txt_size ) );
+				std::vector<char> txt( txt_size + 1 );
+				EXPECT_DL_ERR_OK( dl_txt_unpack( Ctx, types[i], &broken[0], broken.size(), &txt[0], txt.size(), 0x0 ) );
+
+				void* loaded = 0x0;
+				EXPECT_DL_ERR_OK( dl_instance_load_inplace( Ctx, types[i], &broken[0], broken.size(), &loaded, 0x0 ) );
+				size_t store_size = 0;
+				EXPECT_DL_ERR_OK( dl_instance_store( Ctx, types[i], loaded, 0x0, 0, &store_size ) );
+				std::vector<unsigned char> stored( store_size );
+				EXPECT_DL_ERR_OK( dl_instance_store( Ctx, types[i], loaded, &stored[0], stored.size(), 0x0 ) );
+			}
+		}
+	}
+}
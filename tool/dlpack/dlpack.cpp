@@ -2,6 +2,8 @@
 #include <dl/dl.h>
 #include <dl/dl_util.h>
 #include <dl/dl_reflect.h>
+#include <dl/dl_convert.h>
+#include <dl/dl_archive.h>
 
 #include "getopt/getopt.h"
 
@@ -14,15 +16,16 @@
 #define M_ERROR_AND_QUIT(fmt, ...) { fprintf(stderr, "Error: " fmt "\n", ##__VA_ARGS__); return 1; }
 
 /*
-	Tool that take DL-data in text-form and output a packed binary.
+	Tool that take DL-data in text-form and output a packed binary, or build an archive of many instances.
 */
 
 int g_Verbose = 0;
 
 enum
 {
-	MAX_LIB_PATHS = 128,
-	MAX_LIBS      = 128
+	MAX_LIB_PATHS      = 128,
+	MAX_LIBS           = 128,
+	MAX_ARCHIVE_INPUTS = 4096
 };
 
 unsigned int g_num_lib_paths = 0;
@@ -49,6 +52,17 @@ bool add_lib( const char* lib )
 	return true;
 }
 
+unsigned int g_num_archive_inputs = 0;
+const char*  g_archive_inputs[MAX_ARCHIVE_INPUTS];
+
+bool add_archive_input( const char* input )
+{
+	if( g_num_archive_inputs >= MAX_ARCHIVE_INPUTS )
+		return false;
+	g_archive_inputs[g_num_archive_inputs++] = input;
+	return true;
+}
+
 void error_report_function( const char* msg, void* ctx )
 {
 	(void)ctx;
@@ -58,7 +72,8 @@ void error_report_function( const char* msg, void* ctx )
 void print_help( getopt_context_t* ctx )
 {
 	char buffer[2048];
-	printf("usage: dl_pack.exe [options] file_to_pack\n\n");
+	printf("usage: dl_pack.exe [options] file_to_pack\n");
+	printf("       dl_pack.exe [options] -a [name=]file_to_pack ...\n\n");
 	printf("%s", getopt_create_help_string( ctx, buffer, sizeof(buffer) ) );
 }
 
@@ -126,10 +141,153 @@ dl_ctx_t create_ctx()
 	return dl_ctx;
 }
 
+/*
+	Load an instance from txt or binary and pack it for the requested platform, returned buffer need to be freed by free().
+*/
+unsigned char* pack_instance( dl_ctx_t dl_ctx, const char* path, dl_endian_t out_endian, unsigned int out_ptr_size, size_t* out_size )
+{
+	dl_typeid_t type;
+	void* instance = 0x0;
+	void* allocated_mem;
+	dl_error_t err = dl_util_load_from_file( dl_ctx, 0, path, DL_UTIL_FILE_TYPE_AUTO, &instance, &type, &allocated_mem, 0x0, 0x0, 0x0 );
+	if( err != DL_ERROR_OK )
+		M_ERROR_AND_FAIL( "DL error reading \"%s\": %s", path, dl_error_to_string( err ) );
+
+	size_t packed_size = 0;
+	err = dl_instance_store( dl_ctx, type, instance, 0x0, 0, &packed_size );
+	unsigned char* packed = (unsigned char*)malloc( packed_size );
+	if( err == DL_ERROR_OK )
+		err = dl_instance_store( dl_ctx, type, instance, packed, packed_size, 0x0 );
+	free( allocated_mem );
+
+	size_t converted_size = 0;
+	if( err == DL_ERROR_OK )
+		err = dl_convert( dl_ctx, type, packed, packed_size, 0x0, 0, out_endian, out_ptr_size, &converted_size );
+	unsigned char* converted = (unsigned char*)malloc( converted_size );
+	if( err == DL_ERROR_OK )
+		err = dl_convert( dl_ctx, type, packed, packed_size, converted, converted_size, out_endian, out_ptr_size, 0x0 );
+	free( packed );
+
+	if( err != DL_ERROR_OK )
+	{
+		free( converted );
+		M_ERROR_AND_FAIL( "DL error packing \"%s\": %s", path, dl_error_to_string( err ) );
+	}
+
+	*out_size = converted_size;
+	return converted;
+}
+
+/*
+	Pack all archive inputs, given as name=path or just path to use the path as name, and write an archive of them.
+*/
+int write_archive( dl_ctx_t dl_ctx, FILE* out_file, dl_endian_t out_endian, unsigned int out_ptr_size, unsigned int alignment )
+{
+	dl_archive_input_t* inputs = (dl_archive_input_t*)malloc( sizeof( dl_archive_input_t ) * ( g_num_archive_inputs + 1 ) );
+	char** names = (char**)malloc( sizeof( char* ) * ( g_num_archive_inputs + 1 ) );
+	unsigned int num_inputs = 0;
+	int result = 0;
+
+	for( ; num_inputs < g_num_archive_inputs; ++num_inputs )
+	{
+		const char* arg  = g_archive_inputs[num_inputs];
+		const char* sep  = strchr( arg, '=' );
+		const char* path = sep ? sep + 1 : arg;
+		size_t name_len  = sep ? (size_t)( sep - arg ) : strlen( arg );
+
+		names[num_inputs] = (char*)malloc( name_len + 1 );
+		memcpy( names[num_inputs], arg, name_len );
+		names[num_inputs][name_len] = '\0';
+
+		M_VERBOSE_OUTPUT( "Adding \"%s\" from file %s", names[num_inputs], path );
+
+		dl_archive_input_t* input = &inputs[num_inputs];
+		input->name            = names[num_inputs];
+		input->packed_instance = pack_instance( dl_ctx, path, out_endian, out_ptr_size, &input->packed_instance_size );
+		if( input->packed_instance == 0x0 )
+		{
+			free( names[num_inputs] );
+			result = 1;
+			break;
+		}
+	}
+
+	if( result == 0 )
+	{
+		size_t archive_size = 0;
+		dl_error_t err = dl_archive_write( dl_ctx, inputs, num_inputs, alignment, 0x0, 0, &archive_size );
+		unsigned char* archive = (unsigned char*)malloc( archive_size );
+		if( err == DL_ERROR_OK )
+			err = dl_archive_write( dl_ctx, inputs, num_inputs, alignment, archive, archive_size, 0x0 );
+
+		if( err != DL_ERROR_OK )
+		{
+			fprintf( stderr, "Error: DL error writing archive: %s\n", dl_error_to_string( err ) );
+			result = 1;
+		}
+		else
+			fwrite( archive, 1, archive_size, out_file );
+		free( archive );
+	}
+
+	for( unsigned int i = 0; i < num_inputs; ++i )
+	{
+		free( (void*)inputs[i].packed_instance );
+		free( names[i] );
+	}
+	free( inputs );
+	free( names );
+	return result;
+}
+
+/*
+	List all instances in an archive.
+*/
+int show_archive_info( dl_ctx_t dl_ctx, unsigned char* data, size_t size )
+{
+	// ... archives are opened inplace and need to be aligned, copy to a buffer aligned for any archive ...
+	unsigned char* aligned_alloc = (unsigned char*)malloc( size + 4096 );
+	unsigned char* aligned = aligned_alloc + ( 4096 - (uintptr_t)aligned_alloc % 4096 ) % 4096;
+	memcpy( aligned, data, size );
+
+	dl_archive_t archive;
+	dl_error_t err = dl_archive_open( aligned, size, &archive );
+	if( err != DL_ERROR_OK )
+	{
+		free( aligned_alloc );
+		M_ERROR_AND_QUIT( "DL error opening archive: %s", dl_error_to_string( err ) );
+	}
+
+	printf( "archive info:\n" );
+	printf( "instances: %u\n", archive.entry_count );
+	printf( "alignment: %u\n", archive.alignment );
+	printf( "size:      %zu\n\n", archive.size );
+	printf( "%-10s %-10s %-10s %-24s %s\n", "hash", "offset", "size", "type", "name" );
+
+	for( unsigned int i = 0; i < archive.entry_count; ++i )
+	{
+		dl_archive_entry_t entry;
+		err = dl_archive_get_entry( &archive, i, &entry );
+		if( err != DL_ERROR_OK )
+		{
+			free( aligned_alloc );
+			M_ERROR_AND_QUIT( "DL error reading archive entry %u: %s", i, dl_error_to_string( err ) );
+		}
+
+		dl_type_info_t tinfo;
+		const char* type_name = dl_reflect_get_type_info( dl_ctx, entry.type, &tinfo ) == DL_ERROR_OK ? tinfo.name : "<unknown>";
+		printf( "0x%08X %-10zu %-10zu %-24s %s\n", entry.name_hash, (size_t)( entry.packed_instance - aligned ), entry.packed_instance_size, type_name, entry.name );
+	}
+
+	free( aligned_alloc );
+	return 0;
+}
+
 int main( int argc, const char** argv )
 {
-	int show_info = 0;
-	int do_unpack = 0;
+	int show_info  = 0;
+	int do_unpack  = 0;
+	int do_archive = 0;
 
 	static const getopt_option_t option_list[] =
 	{
@@ -140,7 +298,9 @@ int main( int argc, const char** argv )
 		{ "endian",  'e', GETOPT_OPTION_TYPE_REQUIRED, 0x0,        'e', "endianness of output data, if not specified pack-platform is assumed", "little,big" },
 		{ "ptrsize", 'p', GETOPT_OPTION_TYPE_REQUIRED, 0x0,        'p', "ptr-size of output data, if not specified pack-platform is assumed", "4,8" },
 		{ "unpack",  'u', GETOPT_OPTION_TYPE_FLAG_SET, &do_unpack,   1, "force dl_pack to treat input data as a packed instance that should be unpacked.", 0x0 },
-		{ "info",    'i', GETOPT_OPTION_TYPE_FLAG_SET, &show_info,   1, "make dl_pack show info about a packed instance.", 0x0 },
+		{ "info",    'i', GETOPT_OPTION_TYPE_FLAG_SET, &show_info,   1, "make dl_pack show info about a packed instance or list the instances in an archive.", 0x0 },
+		{ "archive", 'a', GETOPT_OPTION_TYPE_FLAG_SET, &do_archive,  1, "pack all input-files, given as [name=]file, to an archive.", 0x0 },
+		{ "align",   'A', GETOPT_OPTION_TYPE_REQUIRED, 0x0,        'A', "alignment of instances in archive, defaults to 16", "16,32,64,..." },
 		{ "verbose", 'v', GETOPT_OPTION_TYPE_FLAG_SET, &g_Verbose,   1, "verbose output", 0x0 },
 		GETOPT_OPTIONS_END
 	};
@@ -153,6 +313,7 @@ int main( int argc, const char** argv )
 	const char*  in_file_path   = "";
 	dl_endian_t  out_endian     = DL_ENDIAN_HOST;
 	unsigned int out_ptr_size   = sizeof(void*);
+	unsigned int out_alignment  = 16;
 
 	int opt;
 	while( (opt = getopt_next( &go_ctx ) ) != -1 )
@@ -182,18 +343,46 @@ int main( int argc, const char** argv )
 
 				out_ptr_size = (unsigned int)(go_ctx.current_opt_arg[0] - '0');
 				break;
+			case 'A':
+				out_alignment = (unsigned int)strtoul( go_ctx.current_opt_arg, 0x0, 10 );
+				if( out_alignment < 16 || ( out_alignment & ( out_alignment - 1 ) ) != 0 )
+					M_ERROR_AND_QUIT("align-flag need a power of 2 >= 16, not \"%s\"!", go_ctx.current_opt_arg);
+				break;
 			case '!': M_ERROR_AND_QUIT("incorrect usage of flag \"%s\"!", go_ctx.current_opt_arg); break;
 			case '?': M_ERROR_AND_QUIT("unrecognized flag \"%s\"!", go_ctx.current_opt_arg); break;
 			case '+':
-				if(in_file_path[0] != '\0')
-					M_ERROR_AND_QUIT("input-file already set to: \"%s\", trying to set it to \"%s\"", in_file_path, go_ctx.current_opt_arg);
-
-				in_file_path = go_ctx.current_opt_arg;
+				// ... all input-files are collected, only archives can be built from more than one ...
+				if( !add_archive_input( go_ctx.current_opt_arg ) )
+					M_ERROR_AND_QUIT( "dl_pack only supports %u files in an archive!", MAX_ARCHIVE_INPUTS );
 				break;
 			case 0: break; // ignore, flag was set!
 		}
 	}
 
+	if( do_archive == 0 && g_num_archive_inputs > 1 )
+		M_ERROR_AND_QUIT("input-file already set to: \"%s\", trying to set it to \"%s\"", g_archive_inputs[0], g_archive_inputs[1]);
+	if( do_archive == 0 && g_num_archive_inputs == 1 )
+		in_file_path = g_archive_inputs[0];
+
+	if( do_archive == 1 )
+	{
+		if( g_num_archive_inputs == 0 )
+			M_ERROR_AND_QUIT( "no input-files to pack to archive!" );
+
+		FILE* out_file = out_file_path[0] == '\0' ? stdout : fopen( out_file_path, "wb" );
+		if( out_file == 0x0 ) M_ERROR_AND_QUIT( "Could not open output file: %s", out_file_path );
+
+		dl_ctx_t dl_ctx = create_ctx();
+		if( dl_ctx == 0x0 )
+			return 1;
+
+		int result = write_archive( dl_ctx, out_file, out_endian, out_ptr_size, out_alignment );
+
+		if( out_file_path[0] != '\0' ) fclose( out_file );
+		(void) dl_context_destroy( dl_ctx );
+		return result;
+	}
+
 	FILE* in_file  = in_file_path[0]  == '\0' ? stdin  : fopen( in_file_path, "rb" );
 	FILE* out_file = out_file_path[0] == '\0' ? stdout : fopen( out_file_path, "wb" );
 	if( in_file  == 0x0 ) M_ERROR_AND_QUIT( "Could not open input file: %s", in_file_path );
@@ -208,6 +397,18 @@ int main( int argc, const char** argv )
 		size_t         size;
 		unsigned char* data = read_file( in_file, &size );
 
+		// ... anything that is not malformed as an archive is an archive, if only of the wrong endian or misaligned ...
+		dl_archive_t archive;
+		if( dl_archive_open( data, size, &archive ) != DL_ERROR_MALFORMED_DATA )
+		{
+			int result = show_archive_info( dl_ctx, data, size );
+			free( data );
+			if( in_file_path[0]  != '\0' ) fclose( in_file );
+			if( out_file_path[0] != '\0' ) fclose( out_file );
+			(void) dl_context_destroy( dl_ctx );
+			return result;
+		}
+
 		dl_instance_info_t info;
 		dl_error_t err = dl_instance_get_info( data, size, &info );
 		if( err != DL_ERROR_OK )
@@ -7,23 +7,43 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <sys/stat.h>
 
 #include <vector>
+#include <thread>
+#include <atomic>
 
 #ifdef _MSC_VER
 #define snprintf _snprintf
+#include <direct.h>
+#include <process.h>
+#define mkdir( path, mode ) _mkdir( path )
+#define getpid _getpid
+#else
+#include <unistd.h>
 #endif
 
 struct dltlc_args
 {
 	const char* input;
 	const char* output;
+	const char* cache_dir;
 
 	int unpack;
 	int show_info;
 	int c_header;
+	int cpp_serializers;
+	unsigned int jobs;
 };
 
+/*
+	Format version of the cache, part of all cache-keys. Bump when the output of dltlc itself changes in a way that
+	should invalidate all cached results, changes in the output of dl is picked up by cache_seed_init().
+*/
+static const char DLTLC_CACHE_VERSION[] = "dltlc-cache-3";
+
 static int verbose = 0;
 std::vector<const char*> inputs;
 
@@ -42,6 +62,9 @@ static int parse_args( int argc, const char** argv, dltlc_args* args )
 		{ "info",     'i', GETOPT_OPTION_TYPE_FLAG_SET, &args->show_info, 1, "make dl_pack show info about a packed instance.", 0x0 },
 		{ "verbose",  'v', GETOPT_OPTION_TYPE_FLAG_SET, &verbose,         1, "verbose output", 0x0 },
 		{ "c-header", 'c', GETOPT_OPTION_TYPE_FLAG_SET, &args->c_header,  1, "output c header instead of tld binary", 0x0 },
+		{ "cpp-serializers", 's', GETOPT_OPTION_TYPE_FLAG_SET, &args->cpp_serializers, 1, "output c++ serializers, to include after the c header, instead of tld binary", 0x0 },
+		{ "cache",    'C', GETOPT_OPTION_TYPE_REQUIRED, 0x0,            'C', "cache compiled typelibs and outputs in dir, keyed on the content of all inputs.", "dir" },
+		{ "jobs",     'j', GETOPT_OPTION_TYPE_REQUIRED, 0x0,            'j', "number of inputs to compile in parallel, defaults to the number of cores.", "count" },
 		GETOPT_OPTIONS_END
 	};
 
@@ -76,6 +99,19 @@ static int parse_args( int argc, const char** argv, dltlc_args* args )
 				args->output = go_ctx.current_opt_arg;
 				break;
 
+			case 'C':
+				args->cache_dir = go_ctx.current_opt_arg;
+				break;
+
+			case 'j':
+				args->jobs = (unsigned int)strtoul( go_ctx.current_opt_arg, 0x0, 10 );
+				if( args->jobs == 0 )
+				{
+					fprintf( stderr, "-j/--jobs need to be at least 1\n" );
+					return 1;
+				}
+				break;
+
 			case '!':
 				fprintf( stderr, "incorrect usage of flag \"%s\"\n", go_ctx.current_opt_arg );
 				return 1;
@@ -90,9 +126,9 @@ static int parse_args( int argc, const char** argv, dltlc_args* args )
 		}
 	}
 
-	if( args->show_info + args->c_header + args->unpack > 1 )
+	if( args->show_info + args->c_header + args->cpp_serializers + args->unpack > 1 )
 	{
-		fprintf( stderr, "more than one of, -u,--unpack, -i,--info or -c,--c_header was specified!\n" );
+		fprintf( stderr, "more than one of, -u,--unpack, -i,--info, -c,--c_header or -s,--cpp-serializers was specified!\n" );
 		return 1;
 	}
 
@@ -123,23 +159,18 @@ static unsigned char* read_entire_stream( FILE* file, size_t* out_size )
 	return out_buffer;
 }
 
-static bool load_typelib( dl_ctx_t ctx, FILE* f )
+static bool load_typelib( dl_ctx_t ctx, const unsigned char* data, size_t size )
 {
-	size_t size = 0;
-	unsigned char* data = read_entire_stream( f, &size );
-
 	dl_error_t err = dl_context_load_type_library( ctx, data, size );
 	if( err != DL_ERROR_OK )
 		err = dl_context_load_txt_type_library( ctx, (const char*)data, size ); // ... try text ...
 
-	free( data );
-
 	if( err != DL_ERROR_OK )
 		VERBOSE_OUTPUT( "failed to load typelib with error %s", dl_error_to_string( err ) );
 	return err == DL_ERROR_OK;
 }
 
-static int write_tl_as_text( dl_ctx_t ctx, FILE* out )
+static unsigned char* write_tl_as_text( dl_ctx_t ctx, size_t* out_size )
 {
 	dl_error_t err;
 
@@ -149,21 +180,23 @@ static int write_tl_as_text( dl_ctx_t ctx, FILE* out )
 	if( err != DL_ERROR_OK )
 	{
 		fprintf( stderr, "failed to query typelib-txt size with error \"%s\"\n", dl_error_to_string( err ) );
-		return 1;
+		return 0x0;
 	}
 
 	char* outdata = (char*)malloc( res_size );
 	err = dl_context_write_txt_type_library( ctx, outdata, res_size, 0x0 );
-	if( err == DL_ERROR_OK )
-		fwrite( outdata, res_size, 1, out );
-	else
+	if( err != DL_ERROR_OK )
+	{
 		fprintf( stderr, "failed to write typelib-txt size with error \"%s\"\n", dl_error_to_string( err ) );
+		free( outdata );
+		return 0x0;
+	}
 
-	free( outdata );
-	return err == DL_ERROR_OK ? 0 : 1;
+	*out_size = res_size;
+	return (unsigned char*)outdata;
 }
 
-static int write_tl_as_c_header( dl_ctx_t ctx, const char* module_name, FILE* out )
+static unsigned char* write_tl_as_c_header( dl_ctx_t ctx, const char* module_name, size_t* out_size )
 {
 	dl_error_t err;
 
@@ -173,21 +206,49 @@ static int write_tl_as_c_header( dl_ctx_t ctx, const char* module_name, FILE* ou
 	if( err != DL_ERROR_OK )
 	{
 		fprintf( stderr, "failed to query c-header size for typelib with error \"%s\"\n", dl_error_to_string( err ) );
-		return 1;
+		return 0x0;
 	}
 
 	char* outdata = (char*)malloc( res_size );
 	err = dl_context_write_type_library_c_header( ctx, module_name, outdata, res_size, 0x0 );
-	if( err == DL_ERROR_OK )
-		fwrite( outdata, res_size, 1, out );
-	else
+	if( err != DL_ERROR_OK )
+	{
 		fprintf( stderr, "failed to write c-header for typelib with error \"%s\"\n", dl_error_to_string( err ) );
+		free( outdata );
+		return 0x0;
+	}
+
+	*out_size = res_size;
+	return (unsigned char*)outdata;
+}
+
+static unsigned char* write_tl_as_cpp_serializers( dl_ctx_t ctx, const char* module_name, size_t* out_size )
+{
+	dl_error_t err;
 
-	free( outdata );
-	return err == DL_ERROR_OK ? 0 : 1;
+	// ... query result size ...
+	size_t res_size;
+	err = dl_context_write_type_library_cpp_serializers( ctx, module_name, 0x0, 0, &res_size );
+	if( err != DL_ERROR_OK )
+	{
+		fprintf( stderr, "failed to query c++ serializers size for typelib with error \"%s\"\n", dl_error_to_string( err ) );
+		return 0x0;
+	}
+
+	char* outdata = (char*)malloc( res_size );
+	err = dl_context_write_type_library_cpp_serializers( ctx, module_name, outdata, res_size, 0x0 );
+	if( err != DL_ERROR_OK )
+	{
+		fprintf( stderr, "failed to write c++ serializers for typelib with error \"%s\"\n", dl_error_to_string( err ) );
+		free( outdata );
+		return 0x0;
+	}
+
+	*out_size = res_size;
+	return (unsigned char*)outdata;
 }
 
-static int write_tl_as_binary( dl_ctx_t ctx, FILE* out )
+static unsigned char* write_tl_as_binary( dl_ctx_t ctx, size_t* out_size )
 {
 	dl_error_t err;
 
@@ -197,18 +258,242 @@ static int write_tl_as_binary( dl_ctx_t ctx, FILE* out )
 	if( err != DL_ERROR_OK )
 	{
 		fprintf( stderr, "failed to query typelib size with error \"%s\"\n", dl_error_to_string( err ) );
-		return 1;
+		return 0x0;
 	}
 
 	unsigned char* outdata = (unsigned char*)malloc( res_size );
 	err = dl_context_write_type_library( ctx, outdata, res_size, 0x0 );
-	if( err == DL_ERROR_OK )
-		fwrite( outdata, res_size, 1, out );
-	else
+	if( err != DL_ERROR_OK )
+	{
 		fprintf( stderr, "failed to write typelib size with error \"%s\"\n", dl_error_to_string( err ) );
+		free( outdata );
+		return 0x0;
+	}
 
-	free( outdata );
-	return err == DL_ERROR_OK ? 0 : 1;
+	*out_size = res_size;
+	return outdata;
+}
+
+/*
+	One input to dltlc, compiled on its own to a binary typelib if it do not depend on types in any other input.
+*/
+struct dltlc_input
+{
+	const char*    path;
+	unsigned char* data;
+	size_t         size;
+
+	unsigned char* lib;       ///< input compiled on its own, 0x0 if not compiled or if it depend on other inputs.
+	size_t         lib_size;
+	bool           dependent; ///< input failed to compile on its own, it is loaded after all inputs before it.
+};
+
+static uint64_t hash_buffer( uint64_t hash, const void* data, size_t size )
+{
+	// ... FNV-1a ...
+	const unsigned char* iter = (const unsigned char*)data;
+	for( size_t i = 0; i < size; ++i )
+		hash = ( hash ^ iter[i] ) * 0x100000001B3ULL;
+	return hash;
+}
+
+static uint64_t cache_seed = 0xCBF29CE484222325ULL;
+
+/*
+	Fold what the linked dl writes for an empty context into the seed of all cache-keys. The typelib header carry the
+	typelib format version and the text, c-header and c++ serializers show changes to the writers so that a cache
+	filled by another version of dl is never used.
+*/
+static bool cache_seed_init()
+{
+	dl_ctx_t ctx;
+	dl_create_params_t p;
+	DL_CREATE_PARAMS_SET_DEFAULT(p);
+	if( dl_context_create( &ctx, &p ) != DL_ERROR_OK )
+		return false;
+
+	unsigned char* outputs[4];
+	size_t         sizes[4] = { 0, 0, 0, 0 };
+	outputs[0] = write_tl_as_binary( ctx, &sizes[0] );
+	outputs[1] = write_tl_as_text( ctx, &sizes[1] );
+	outputs[2] = write_tl_as_c_header( ctx, "dltlc_cache", &sizes[2] );
+	outputs[3] = write_tl_as_cpp_serializers( ctx, "dltlc_cache", &sizes[3] );
+	(void)dl_context_destroy( ctx );
+
+	bool ok = true;
+	uint64_t seed = hash_buffer( cache_seed, DLTLC_CACHE_VERSION, sizeof( DLTLC_CACHE_VERSION ) );
+	for( size_t i = 0; i < sizeof( outputs ) / sizeof( outputs[0] ); ++i )
+	{
+		ok = ok && outputs[i] != 0x0;
+		seed = hash_buffer( seed, &sizes[i], sizeof( sizes[i] ) );
+		if( outputs[i] )
+			seed = hash_buffer( seed, outputs[i], sizes[i] );
+		free( outputs[i] );
+	}
+	cache_seed = seed;
+	return ok;
+}
+
+static uint64_t hash_begin()
+{
+	return cache_seed;
+}
+
+static void cache_path( char* path, size_t path_size, const char* cache_dir, uint64_t key, const char* ext )
+{
+	snprintf( path, path_size, "%s/%016llx.%s", cache_dir, (unsigned long long)key, ext );
+}
+
+static unsigned char* cache_read( const char* cache_dir, uint64_t key, const char* ext, size_t* out_size )
+{
+	char path[2048];
+	cache_path( path, sizeof(path), cache_dir, key, ext );
+	FILE* f = fopen( path, "rb" );
+	if( f == 0x0 )
+		return 0x0;
+
+	unsigned char* data = read_entire_stream( f, out_size );
+	fclose( f );
+	VERBOSE_OUTPUT( "cache hit \"%s\"", path );
+	return data;
+}
+
+static void cache_write( const char* cache_dir, uint64_t key, const char* ext, const unsigned char* data, size_t size )
+{
+	// ... write to a temporary file and rename it in place so that other instances of dltlc never see a partial file ...
+	char path[2048];
+	char tmp_path[2048 + 32];
+	cache_path( path, sizeof(path), cache_dir, key, ext );
+	// ... the pid keep instances of dltlc apart and the stack-address the threads within one instance ...
+	const char* unique = tmp_path;
+	snprintf( tmp_path, sizeof(tmp_path), "%s.%u.%llx.tmp", path, (unsigned int)getpid(), (unsigned long long)hash_buffer( (uint64_t)time( 0x0 ), &unique, sizeof(unique) ) );
+
+	FILE* f = fopen( tmp_path, "wb" );
+	if( f == 0x0 )
+	{
+		VERBOSE_OUTPUT( "failed to write to cache \"%s\"", tmp_path );
+		return;
+	}
+	bool ok = size == 0 || fwrite( data, size, 1, f ) == 1;
+	ok = fclose( f ) == 0 && ok;
+	if( !ok || rename( tmp_path, path ) != 0 )
+		remove( tmp_path );
+}
+
+/*
+	Compile one input to a binary typelib on its own, errors are not reported since an input that fail here might
+	depend on types in the inputs before it and is loaded again after them.
+*/
+static void compile_input( dltlc_input* input, const char* cache_dir )
+{
+	uint64_t key = hash_buffer( hash_begin(), input->data, input->size );
+	if( cache_dir )
+	{
+		size_t dep_size;
+		unsigned char* dep = cache_read( cache_dir, key, "dep", &dep_size );
+		if( dep != 0x0 )
+		{
+			free( dep );
+			input->dependent = true;
+			return;
+		}
+
+		input->lib = cache_read( cache_dir, key, "tlb", &input->lib_size );
+		if( input->lib != 0x0 )
+			return;
+	}
+
+	dl_ctx_t ctx;
+	dl_create_params_t p;
+	DL_CREATE_PARAMS_SET_DEFAULT(p);
+	if( dl_context_create( &ctx, &p ) != DL_ERROR_OK )
+		return; // ... input is left uncompiled and is loaded from its source as any other input ...
+
+	if( dl_context_load_type_library( ctx, input->data, input->size ) == DL_ERROR_OK ||
+		dl_context_load_txt_type_library( ctx, (const char*)input->data, input->size ) == DL_ERROR_OK )
+	{
+		size_t lib_size;
+		if( dl_context_write_type_library( ctx, 0x0, 0, &lib_size ) == DL_ERROR_OK )
+		{
+			input->lib = (unsigned char*)malloc( lib_size );
+			if( dl_context_write_type_library( ctx, input->lib, lib_size, 0x0 ) == DL_ERROR_OK )
+				input->lib_size = lib_size;
+			else
+			{
+				free( input->lib );
+				input->lib = 0x0;
+			}
+		}
+	}
+	else
+		input->dependent = true;
+
+	(void)dl_context_destroy( ctx );
+
+	if( cache_dir )
+	{
+		if( input->lib )
+			cache_write( cache_dir, key, "tlb", input->lib, input->lib_size );
+		else if( input->dependent )
+			cache_write( cache_dir, key, "dep", 0x0, 0 );
+	}
+}
+
+static void compile_inputs( std::vector<dltlc_input>& compile, const char* cache_dir, unsigned int jobs )
+{
+	std::atomic<size_t> next( 0 );
+	auto worker = [&]()
+	{
+		for( size_t i = next++; i < compile.size(); i = next++ )
+			compile_input( &compile[i], cache_dir );
+	};
+
+	if( jobs > compile.size() )
+		jobs = (unsigned int)compile.size();
+
+	std::vector<std::thread> threads;
+	for( unsigned int i = 1; i < jobs; ++i )
+		threads.push_back( std::thread( worker ) );
+	worker();
+	for( size_t i = 0; i < threads.size(); ++i )
+		threads[i].join();
+}
+
+/*
+	Load all inputs into ctx in order, runs of inputs that compiled on their own are loaded in one go.
+*/
+static bool load_inputs( dl_ctx_t ctx, std::vector<dltlc_input>& compile )
+{
+	std::vector<const unsigned char*> libs;
+	std::vector<size_t> lib_sizes;
+	for( size_t i = 0; i <= compile.size(); ++i )
+	{
+		if( i < compile.size() && compile[i].lib )
+		{
+			libs.push_back( compile[i].lib );
+			lib_sizes.push_back( compile[i].lib_size );
+			continue;
+		}
+
+		if( libs.size() )
+		{
+			dl_error_t err = dl_context_load_type_libraries( ctx, &libs[0], &lib_sizes[0], (unsigned int)libs.size() );
+			if( err != DL_ERROR_OK )
+			{
+				fprintf( stderr, "failed to load compiled typelibs with error %s\n", dl_error_to_string( err ) );
+				return false;
+			}
+			libs.clear();
+			lib_sizes.clear();
+		}
+
+		if( i < compile.size() && !load_typelib( ctx, compile[i].data, compile[i].size ) )
+		{
+			fprintf( stderr, "failed to load typelib from \"%s\"\n", compile[i].path );
+			return false;
+		}
+	}
+	return true;
 }
 
 static void show_tl_members( dl_ctx_t ctx, const char* member_fmt, dl_typeid_t tid, unsigned int member_count )
@@ -322,23 +607,23 @@ int main( int argc, const char** argv )
 	if( ret < 2 )
 		return ret;
 
-	dl_ctx_t ctx;
-	dl_create_params_t p;
-	DL_CREATE_PARAMS_SET_DEFAULT(p);
-	p.error_msg_func = error_report_function;
-
-	dl_error_t err = dl_context_create( &ctx, &p );
-	if( err != DL_ERROR_OK )
-		fprintf( stderr, "failed to create data library context, error \"%s\"\n", dl_error_to_string( err ) );
+	if( args.jobs == 0 )
+	{
+		args.jobs = std::thread::hardware_concurrency();
+		if( args.jobs == 0 )
+			args.jobs = 1;
+	}
 
+	std::vector<dltlc_input> compile;
 	if( inputs.size() == 0 )
 	{
 		VERBOSE_OUTPUT( "loading typelib from stdin" );
 
-		if( !load_typelib( ctx, stdin ) )
-		{
-			return 1;
-		}
+		dltlc_input input;
+		memset( &input, 0x0, sizeof(input) );
+		input.path = "stdin";
+		input.data = read_entire_stream( stdin, &input.size );
+		compile.push_back( input );
 	}
 	else
 	{
@@ -351,54 +636,116 @@ int main( int argc, const char** argv )
 				return 1;
 			}
 
-			if( !load_typelib( ctx, f ) )
-			{
-				fprintf( stderr, "failed to load typelib from \"%s\"\n", inputs[i] );
-				fclose( f );
-				return 1;
-			}
-
+			dltlc_input input;
+			memset( &input, 0x0, sizeof(input) );
+			input.path = inputs[i];
+			input.data = read_entire_stream( f, &input.size );
+			compile.push_back( input );
 			fclose( f );
 		}
 	}
 
-	int res = 0;
+	const char* module_name = "STDOUT";
+	if( args.output )
+	{
+		module_name = args.output;
+		for( const char* iter = args.output; *iter; ++iter )
+			if( *iter == '/' || *iter == '\\' )
+				module_name = iter + 1;
+	}
 
-	FILE* output = args.output == 0x0 ? stdout : fopen( args.output, "wb" );
-	if( output == 0x0 )
+	// ... the output only depend on the inputs, the kind of output and the module-name so with a cache a rebuild with
+	//     unchanged inputs only need to hash them ...
+	const char* cache_dir = args.cache_dir;
+	if( cache_dir )
 	{
-		fprintf( stderr, "failed to open output: \"%s\"\n", args.output );
-		return 1;
+		mkdir( cache_dir, 0777 ); // ... ok to fail if it already exists ...
+		if( !cache_seed_init() )
+		{
+			fprintf( stderr, "failed to get the dl version for the cache, building without cache\n" );
+			cache_dir = 0x0;
+		}
 	}
 
-	if( args.show_info )
-		show_tl_info( ctx );
-	else if( args.unpack )
-		res = write_tl_as_text( ctx, output );
-	else if( args.c_header )
+	uint64_t output_key = hash_begin();
+	const char* output_kind = args.unpack ? "txt" : args.c_header ? "h" : args.cpp_serializers ? "cpp" : "tlb";
+	output_key = hash_buffer( output_key, output_kind, strlen( output_kind ) + 1 );
+	if( args.c_header || args.cpp_serializers )
+		output_key = hash_buffer( output_key, module_name, strlen( module_name ) + 1 );
+	for( size_t i = 0; i < compile.size(); ++i )
 	{
-		if( output == stdout )
-			res = write_tl_as_c_header( ctx, "STDOUT", output );
-		else
+		output_key = hash_buffer( output_key, &compile[i].size, sizeof( compile[i].size ) );
+		output_key = hash_buffer( output_key, compile[i].data, compile[i].size );
+	}
+
+	unsigned char* out_data = 0x0;
+	size_t out_size = 0;
+	if( cache_dir && !args.show_info )
+		out_data = cache_read( cache_dir, output_key, "out", &out_size );
+
+	int res = 0;
+	if( out_data == 0x0 )
+	{
+		// ... compile inputs on their own in parallel, only worth it if there are several or if they are cached ...
+		if( compile.size() > 1 || cache_dir )
+			compile_inputs( compile, cache_dir, args.jobs );
+
+		dl_ctx_t ctx;
+		dl_create_params_t p;
+		DL_CREATE_PARAMS_SET_DEFAULT(p);
+		p.error_msg_func = error_report_function;
+
+		dl_error_t err = dl_context_create( &ctx, &p );
+		if( err != DL_ERROR_OK )
 		{
-			const char* module_name = args.output;
-			const char* iter = args.output;
-			while( *iter )
-			{
-				if( *iter == '/' || *iter == '\\' )
-					module_name = iter + 1;
-				++iter;
-			}
-			res = write_tl_as_c_header( ctx, module_name, output );
+			fprintf( stderr, "failed to create data library context, error \"%s\"\n", dl_error_to_string( err ) );
+			return 1;
 		}
+
+		if( !load_inputs( ctx, compile ) )
+			return 1;
+
+		if( args.show_info )
+			show_tl_info( ctx );
+		else if( args.unpack )
+			out_data = write_tl_as_text( ctx, &out_size );
+		else if( args.c_header )
+			out_data = write_tl_as_c_header( ctx, module_name, &out_size );
+		else if( args.cpp_serializers )
+			out_data = write_tl_as_cpp_serializers( ctx, module_name, &out_size );
+		else
+			out_data = write_tl_as_binary( ctx, &out_size );
+
+		if( !args.show_info && out_data == 0x0 )
+			res = 1;
+		else if( cache_dir && out_data )
+			cache_write( cache_dir, output_key, "out", out_data, out_size );
+
+		(void) dl_context_destroy( ctx );
 	}
-	else
-		res = write_tl_as_binary( ctx, output );
 
-	if( output != stdout )
-		fclose( output );
+	for( size_t i = 0; i < compile.size(); ++i )
+	{
+		free( compile[i].data );
+		free( compile[i].lib );
+	}
+
+	if( out_data )
+	{
+		FILE* output = args.output == 0x0 ? stdout : fopen( args.output, "wb" );
+		if( output == 0x0 )
+		{
+			fprintf( stderr, "failed to open output: \"%s\"\n", args.output );
+			free( out_data );
+			return 1;
+		}
+
+		fwrite( out_data, out_size, 1, output );
 
-	(void) dl_context_destroy( ctx );
+		if( output != stdout )
+			fclose( output );
+		free( out_data );
+	}
 
 	return res;
 }